@@ -0,0 +1,244 @@
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#if defined(GEOARROW_BENCHMARK_WITH_ZSTD)
+#include <zstd.h>
+#endif
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file codec_benchmark.cc
+///
+/// Benchmarks related to transporting the coordinates of a native array. Three
+/// ways of getting coordinates from one place to another are considered:
+///
+/// - Copying the raw float64 buffers. This is the baseline for decode speed and
+///   the worst case for size.
+/// - Compressing the raw float64 buffers with zstd (only if the benchmarks were
+///   built with zstd available)
+/// - Encoding with the GeoArrowCodec (quantize to 1e-7, delta, zigzag, bit-pack)
+///
+/// The input is a linestring array whose coordinates lie on noisy circles with a
+/// radius of about 10 m in longitude/latitude, which is roughly the shape of GPS
+/// traces.
+
+using geoarrow::benchmark_util::kNumCoordsPrettyBig;
+
+static const int64_t kNumCoordsPerLinestring = 1000;
+
+// Owns an ArrowArray and a GeoArrowArrayView of a linestring array
+class LinestringFixture {
+ public:
+  LinestringFixture() {
+    int64_t n_linestrings = kNumCoordsPrettyBig / kNumCoordsPerLinestring;
+
+    offsets_.push_back(0);
+    for (int64_t i = 0; i < n_linestrings; i++) {
+      offsets_.push_back(offsets_.back() + static_cast<int32_t>(kNumCoordsPerLinestring));
+    }
+
+    // Each linestring is a circle with a radius of about 10 m centered at a random
+    // location, plus about 1 m of noise
+    std::vector<double> centers(n_linestrings * 2);
+    geoarrow::benchmark_util::FillRandom(n_linestrings, 2, centers.data(), 1234, -123.0,
+                                         -121.0);
+    geoarrow::benchmark_util::FillRandom(n_linestrings, 2, centers.data() + 1, 5678,
+                                         48.0, 50.0);
+    std::vector<double> noise(kNumCoordsPrettyBig * 2);
+    geoarrow::benchmark_util::FillRandom(kNumCoordsPrettyBig * 2, 1, noise.data(), 9012,
+                                         -0.00001, 0.00001);
+
+    xs_.resize(kNumCoordsPrettyBig);
+    ys_.resize(kNumCoordsPrettyBig);
+    for (int64_t i = 0; i < n_linestrings; i++) {
+      geoarrow::benchmark_util::PointsOnCircle(
+          kNumCoordsPerLinestring, 1, xs_.data() + i * kNumCoordsPerLinestring,
+          ys_.data() + i * kNumCoordsPerLinestring, M_PI / 100.0, 0.0001);
+      for (int64_t j = i * kNumCoordsPerLinestring; j < offsets_[i + 1]; j++) {
+        xs_[j] += centers[i * 2] + noise[j * 2];
+        ys_[j] += centers[i * 2 + 1] + noise[j * 2 + 1];
+      }
+    }
+
+    GeoArrowArrayViewInitFromType(&array_view_, GEOARROW_TYPE_LINESTRING);
+    array_view_.length[0] = n_linestrings;
+    array_view_.offsets[0] = offsets_.data();
+    array_view_.first_offset[0] = 0;
+    array_view_.last_offset[0] = offsets_.back();
+    array_view_.coords.n_coords = kNumCoordsPrettyBig;
+    array_view_.coords.values[0] = xs_.data();
+    array_view_.coords.values[1] = ys_.data();
+  }
+
+  const struct GeoArrowArrayView* array_view() const { return &array_view_; }
+
+  int64_t raw_size_bytes() const {
+    return static_cast<int64_t>(offsets_.size() * sizeof(int32_t) +
+                                (xs_.size() + ys_.size()) * sizeof(double));
+  }
+
+  const std::vector<double>& xs() const { return xs_; }
+  const std::vector<double>& ys() const { return ys_; }
+
+ private:
+  std::vector<int32_t> offsets_;
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  struct GeoArrowArrayView array_view_;
+};
+
+static struct GeoArrowQuantization Quantization() {
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[0] = 1e-7;
+  quantization.scale[1] = 1e-7;
+  return quantization;
+}
+
+static void SetCounters(benchmark::State& state, int64_t raw_size_bytes,
+                        int64_t encoded_size_bytes) {
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+  state.SetBytesProcessed(raw_size_bytes * state.iterations());
+  state.counters["ratio"] =
+      static_cast<double>(raw_size_bytes) / static_cast<double>(encoded_size_bytes);
+}
+
+/// \brief Copy the raw offset and float64 coordinate buffers
+static void RawCopy(benchmark::State& state) {
+  LinestringFixture fixture;
+  std::vector<double> xs(kNumCoordsPrettyBig);
+  std::vector<double> ys(kNumCoordsPrettyBig);
+
+  for (auto _ : state) {
+    std::memcpy(xs.data(), fixture.xs().data(), xs.size() * sizeof(double));
+    std::memcpy(ys.data(), fixture.ys().data(), ys.size() * sizeof(double));
+    benchmark::DoNotOptimize(xs.data());
+    benchmark::DoNotOptimize(ys.data());
+  }
+
+  SetCounters(state, fixture.raw_size_bytes(), fixture.raw_size_bytes());
+}
+
+/// \brief Encode the linestring array using the GeoArrowCodec
+static void CodecEncode(benchmark::State& state) {
+  LinestringFixture fixture;
+  struct GeoArrowQuantization quantization = Quantization();
+  struct GeoArrowCodec codec;
+  struct GeoArrowBufferView encoded;
+  GeoArrowCodecInit(&codec);
+
+  for (auto _ : state) {
+    if (GeoArrowCodecEncode(&codec, fixture.array_view(), &quantization, &encoded,
+                            nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowCodecEncode() failed");
+    }
+
+    benchmark::DoNotOptimize(encoded);
+  }
+
+  SetCounters(state, fixture.raw_size_bytes(), encoded.size_bytes);
+  GeoArrowCodecReset(&codec);
+}
+
+/// \brief Decode a GeoArrowCodec-encoded buffer into a builder
+template <enum GeoArrowType type>
+static void CodecDecode(benchmark::State& state) {
+  LinestringFixture fixture;
+  struct GeoArrowQuantization quantization = Quantization();
+  struct GeoArrowCodec codec;
+  struct GeoArrowBufferView encoded;
+  GeoArrowCodecInit(&codec);
+  if (GeoArrowCodecEncode(&codec, fixture.array_view(), &quantization, &encoded,
+                          nullptr) != GEOARROW_OK) {
+    throw std::runtime_error("GeoArrowCodecEncode() failed");
+  }
+
+  struct GeoArrowBuilder builder;
+  struct ArrowArray array;
+  GeoArrowBuilderInitFromType(&builder, type);
+  if (type == GEOARROW_TYPE_INT32_LINESTRING) {
+    builder.view.quantization = quantization;
+  }
+
+  for (auto _ : state) {
+    if (GeoArrowCodecDecode(&codec, encoded, &builder, nullptr) != GEOARROW_OK ||
+        GeoArrowBuilderFinish(&builder, &array, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowCodecDecode() failed");
+    }
+
+    array.release(&array);
+  }
+
+  SetCounters(state, fixture.raw_size_bytes(), encoded.size_bytes);
+  GeoArrowBuilderReset(&builder);
+  GeoArrowCodecReset(&codec);
+}
+
+#if defined(GEOARROW_BENCHMARK_WITH_ZSTD)
+static std::vector<uint8_t> ZstdCompressCoords(const LinestringFixture& fixture) {
+  std::vector<uint8_t> raw(kNumCoordsPrettyBig * 2 * sizeof(double));
+  std::memcpy(raw.data(), fixture.xs().data(), kNumCoordsPrettyBig * sizeof(double));
+  std::memcpy(raw.data() + kNumCoordsPrettyBig * sizeof(double), fixture.ys().data(),
+              kNumCoordsPrettyBig * sizeof(double));
+
+  std::vector<uint8_t> compressed(ZSTD_compressBound(raw.size()));
+  size_t size = ZSTD_compress(compressed.data(), compressed.size(), raw.data(),
+                              raw.size(), ZSTD_CLEVEL_DEFAULT);
+  if (ZSTD_isError(size)) {
+    throw std::runtime_error(ZSTD_getErrorName(size));
+  }
+
+  compressed.resize(size);
+  return compressed;
+}
+
+/// \brief Compress the raw float64 coordinate buffers using zstd
+static void ZstdEncode(benchmark::State& state) {
+  LinestringFixture fixture;
+  std::vector<uint8_t> compressed;
+
+  for (auto _ : state) {
+    compressed = ZstdCompressCoords(fixture);
+    benchmark::DoNotOptimize(compressed.data());
+  }
+
+  SetCounters(state, fixture.raw_size_bytes(),
+              static_cast<int64_t>(compressed.size()));
+}
+
+/// \brief Decompress zstd-compressed float64 coordinate buffers
+static void ZstdDecode(benchmark::State& state) {
+  LinestringFixture fixture;
+  std::vector<uint8_t> compressed = ZstdCompressCoords(fixture);
+  std::vector<uint8_t> raw(kNumCoordsPrettyBig * 2 * sizeof(double));
+
+  for (auto _ : state) {
+    size_t size =
+        ZSTD_decompress(raw.data(), raw.size(), compressed.data(), compressed.size());
+    if (ZSTD_isError(size)) {
+      throw std::runtime_error(ZSTD_getErrorName(size));
+    }
+
+    benchmark::DoNotOptimize(raw.data());
+  }
+
+  SetCounters(state, fixture.raw_size_bytes(),
+              static_cast<int64_t>(compressed.size()));
+}
+
+BENCHMARK(ZstdEncode);
+BENCHMARK(ZstdDecode);
+#endif
+
+BENCHMARK(RawCopy);
+BENCHMARK(CodecEncode);
+BENCHMARK(CodecDecode<GEOARROW_TYPE_LINESTRING>);
+BENCHMARK(CodecDecode<GEOARROW_TYPE_INTERLEAVED_LINESTRING>);
+BENCHMARK(CodecDecode<GEOARROW_TYPE_INT32_LINESTRING>);
@@ -0,0 +1,206 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file measure_benchmark.cc
+///
+/// Benchmarks for the length, area, centroid, num_coords, and
+/// unique_geometry_types_agg kernels. Native input with double coordinates is
+/// measured directly from its buffers; WKB input is visited, which gives a baseline
+/// for what the native path avoids. Counts and geometry types of WKB input only read
+/// geometry headers.
+
+using geoarrow::benchmark_util::kNumCoordsPrettyBig;
+
+enum Input { NATIVE, WKB };
+
+static const int64_t kNumCoordsPerPolygon = 101;
+
+// Owns a polygon array (one ring per polygon) and its WKB equivalent with a total of
+// kNumCoordsPrettyBig coordinates
+class PolygonFixture {
+ public:
+  PolygonFixture() {
+    int64_t n_polygons = kNumCoordsPrettyBig / kNumCoordsPerPolygon;
+    std::vector<int32_t> geom_offsets;
+    std::vector<int32_t> ring_offsets;
+    for (int64_t i = 0; i <= n_polygons; i++) {
+      geom_offsets.push_back(static_cast<int32_t>(i));
+      ring_offsets.push_back(static_cast<int32_t>(i * kNumCoordsPerPolygon));
+    }
+
+    // Each ring is a closed circle
+    int64_t n_coords = n_polygons * kNumCoordsPerPolygon;
+    std::vector<double> xs(n_coords);
+    std::vector<double> ys(n_coords);
+    for (int64_t i = 0; i < n_polygons; i++) {
+      geoarrow::benchmark_util::PointsOnCircle(
+          kNumCoordsPerPolygon, 1, xs.data() + i * kNumCoordsPerPolygon,
+          ys.data() + i * kNumCoordsPerPolygon, 2 * M_PI / (kNumCoordsPerPolygon - 1));
+    }
+
+    struct GeoArrowBufferView buffers[4] = {
+        {{reinterpret_cast<const uint8_t*>(geom_offsets.data())},
+         static_cast<int64_t>(geom_offsets.size() * sizeof(int32_t))},
+        {{reinterpret_cast<const uint8_t*>(ring_offsets.data())},
+         static_cast<int64_t>(ring_offsets.size() * sizeof(int32_t))},
+        {{reinterpret_cast<const uint8_t*>(xs.data())},
+         static_cast<int64_t>(xs.size() * sizeof(double))},
+        {{reinterpret_cast<const uint8_t*>(ys.data())},
+         static_cast<int64_t>(ys.size() * sizeof(double))}};
+
+    struct GeoArrowBuilder builder;
+    GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_POLYGON);
+    for (int j = 0; j < 4; j++) {
+      GeoArrowBuilderAppendBuffer(&builder, 1 + j, buffers[j]);
+    }
+
+    if (GeoArrowBuilderFinish(&builder, &native_, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowBuilderFinish() failed");
+    }
+    GeoArrowBuilderReset(&builder);
+
+    struct GeoArrowArrayReader reader;
+    struct GeoArrowArrayWriter writer;
+    struct GeoArrowVisitor v;
+    GeoArrowArrayReaderInitFromType(&reader, GEOARROW_TYPE_POLYGON);
+    GeoArrowArrayWriterInitFromType(&writer, GEOARROW_TYPE_WKB);
+    GeoArrowArrayWriterInitVisitor(&writer, &v);
+    if (GeoArrowArrayReaderSetArray(&reader, &native_, nullptr) != GEOARROW_OK ||
+        GeoArrowArrayReaderVisit(&reader, 0, native_.length, &v) != GEOARROW_OK ||
+        GeoArrowArrayWriterFinish(&writer, &wkb_, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("Conversion to WKB failed");
+    }
+
+    GeoArrowArrayWriterReset(&writer);
+    GeoArrowArrayReaderReset(&reader);
+
+    GeoArrowSchemaInitExtension(&native_schema_, GEOARROW_TYPE_POLYGON);
+    GeoArrowSchemaInitExtension(&wkb_schema_, GEOARROW_TYPE_WKB);
+  }
+
+  ~PolygonFixture() {
+    native_.release(&native_);
+    wkb_.release(&wkb_);
+    native_schema_.release(&native_schema_);
+    wkb_schema_.release(&wkb_schema_);
+  }
+
+  struct ArrowSchema* schema(enum Input input) {
+    return input == NATIVE ? &native_schema_ : &wkb_schema_;
+  }
+
+  struct ArrowArray* array(enum Input input) {
+    return input == NATIVE ? &native_ : &wkb_;
+  }
+
+ private:
+  struct ArrowArray native_;
+  struct ArrowArray wkb_;
+  struct ArrowSchema native_schema_;
+  struct ArrowSchema wkb_schema_;
+};
+
+template <enum Input input>
+static void MeasurePolygons(benchmark::State& state, const std::string& name) {
+  PolygonFixture fixture;
+  struct GeoArrowKernel kernel;
+  struct ArrowSchema schema_out;
+  struct ArrowArray out;
+
+  if (GeoArrowKernelInit(&kernel, name.c_str(), nullptr) != GEOARROW_OK ||
+      kernel.start(&kernel, fixture.schema(input), nullptr, &schema_out, nullptr) !=
+          GEOARROW_OK) {
+    throw std::runtime_error("Failed to start kernel");
+  }
+
+  for (auto _ : state) {
+    if (kernel.push_batch(&kernel, fixture.array(input), &out, nullptr) !=
+        GEOARROW_OK) {
+      throw std::runtime_error("push_batch() failed");
+    }
+
+    out.release(&out);
+  }
+
+  schema_out.release(&schema_out);
+  kernel.release(&kernel);
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+}
+
+/// \brief Calculate the perimeter of each polygon
+template <enum Input input>
+static void LengthPolygons(benchmark::State& state) {
+  MeasurePolygons<input>(state, "length");
+}
+
+/// \brief Calculate the area of each polygon
+template <enum Input input>
+static void AreaPolygons(benchmark::State& state) {
+  MeasurePolygons<input>(state, "area");
+}
+
+/// \brief Calculate the centroid of each polygon
+template <enum Input input>
+static void CentroidPolygons(benchmark::State& state) {
+  MeasurePolygons<input>(state, "centroid");
+}
+
+/// \brief Count the coordinates of each polygon
+///
+/// This never touches coordinate memory.
+template <enum Input input>
+static void NumCoordsPolygons(benchmark::State& state) {
+  MeasurePolygons<input>(state, "num_coords");
+}
+
+BENCHMARK(LengthPolygons<NATIVE>);
+BENCHMARK(LengthPolygons<WKB>);
+BENCHMARK(AreaPolygons<NATIVE>);
+BENCHMARK(AreaPolygons<WKB>);
+BENCHMARK(CentroidPolygons<NATIVE>);
+BENCHMARK(CentroidPolygons<WKB>);
+BENCHMARK(NumCoordsPolygons<NATIVE>);
+BENCHMARK(NumCoordsPolygons<WKB>);
+
+/// \brief Collect the unique geometry types of all polygons
+template <enum Input input>
+static void UniqueGeometryTypesPolygons(benchmark::State& state) {
+  PolygonFixture fixture;
+  struct GeoArrowKernel kernel;
+  struct ArrowSchema schema_out;
+  struct ArrowArray out;
+
+  if (GeoArrowKernelInit(&kernel, "unique_geometry_types_agg", nullptr) !=
+          GEOARROW_OK ||
+      kernel.start(&kernel, fixture.schema(input), nullptr, &schema_out, nullptr) !=
+          GEOARROW_OK) {
+    throw std::runtime_error("Failed to start kernel");
+  }
+
+  for (auto _ : state) {
+    if (kernel.push_batch(&kernel, fixture.array(input), nullptr, nullptr) !=
+        GEOARROW_OK) {
+      throw std::runtime_error("push_batch() failed");
+    }
+  }
+
+  if (kernel.finish(&kernel, &out, nullptr) != GEOARROW_OK) {
+    throw std::runtime_error("finish() failed");
+  }
+
+  out.release(&out);
+  schema_out.release(&schema_out);
+  kernel.release(&kernel);
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+}
+
+BENCHMARK(UniqueGeometryTypesPolygons<NATIVE>);
+BENCHMARK(UniqueGeometryTypesPolygons<WKB>);
@@ -0,0 +1,128 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file mvt_benchmark.cc
+///
+/// Benchmarks for encoding a 4096-extent Mapbox Vector Tile layer with 50,000
+/// features whose coordinates are already in tile space.
+
+static const int64_t kNumFeatures = 50000;
+static const uint32_t kExtent = 4096;
+static const int64_t kNumCoordsPerFeature = 21;
+
+// Owns an array of kNumFeatures points, linestrings, or polygons (one ring per
+// polygon) spread over a grid covering the tile
+class TileFixture {
+ public:
+  explicit TileFixture(enum GeoArrowType type) {
+    int64_t n_coords_per_feature = type == GEOARROW_TYPE_POINT ? 1 : kNumCoordsPerFeature;
+    int64_t n_coords = kNumFeatures * n_coords_per_feature;
+    std::vector<int32_t> geom_offsets;
+    std::vector<int32_t> coord_offsets;
+    for (int64_t i = 0; i <= kNumFeatures; i++) {
+      geom_offsets.push_back(static_cast<int32_t>(i));
+      coord_offsets.push_back(static_cast<int32_t>(i * n_coords_per_feature));
+    }
+
+    // Each linestring or ring is a closed circle centered on a cell of a 224 x 224
+    // grid
+    std::vector<double> xs(n_coords);
+    std::vector<double> ys(n_coords);
+    double cell = static_cast<double>(kExtent) / 224;
+    for (int64_t i = 0; i < kNumFeatures; i++) {
+      double* x = xs.data() + i * n_coords_per_feature;
+      double* y = ys.data() + i * n_coords_per_feature;
+      geoarrow::benchmark_util::PointsOnCircle(
+          static_cast<uint32_t>(n_coords_per_feature), 1, x, y,
+          2 * M_PI / (n_coords_per_feature - 1), cell * 0.4);
+      for (int64_t j = 0; j < n_coords_per_feature; j++) {
+        x[j] += (i % 224 + 0.5) * cell;
+        y[j] += (i / 224 + 0.5) * cell;
+      }
+    }
+
+    std::vector<struct GeoArrowBufferView> buffers;
+    if (type == GEOARROW_TYPE_POLYGON) {
+      buffers.push_back({{reinterpret_cast<const uint8_t*>(geom_offsets.data())},
+                         static_cast<int64_t>(geom_offsets.size() * sizeof(int32_t))});
+    }
+
+    if (type != GEOARROW_TYPE_POINT) {
+      buffers.push_back({{reinterpret_cast<const uint8_t*>(coord_offsets.data())},
+                         static_cast<int64_t>(coord_offsets.size() * sizeof(int32_t))});
+    }
+
+    buffers.push_back({{reinterpret_cast<const uint8_t*>(xs.data())},
+                       static_cast<int64_t>(xs.size() * sizeof(double))});
+    buffers.push_back({{reinterpret_cast<const uint8_t*>(ys.data())},
+                       static_cast<int64_t>(ys.size() * sizeof(double))});
+
+    struct GeoArrowBuilder builder;
+    GeoArrowBuilderInitFromType(&builder, type);
+    for (size_t j = 0; j < buffers.size(); j++) {
+      GeoArrowBuilderAppendBuffer(&builder, static_cast<int64_t>(1 + j), buffers[j]);
+    }
+
+    if (GeoArrowBuilderFinish(&builder, &geometry_, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowBuilderFinish() failed");
+    }
+    GeoArrowBuilderReset(&builder);
+  }
+
+  ~TileFixture() { geometry_.release(&geometry_); }
+
+  struct ArrowArray* geometry() { return &geometry_; }
+
+ private:
+  struct ArrowArray geometry_;
+};
+
+static void EncodeTile(benchmark::State& state, enum GeoArrowType type) {
+  TileFixture fixture(type);
+  struct GeoArrowMVTWriter writer;
+  struct GeoArrowBufferView tile;
+
+  if (GeoArrowMVTWriterInit(&writer, type, "layer", kExtent, nullptr, nullptr) !=
+      GEOARROW_OK) {
+    throw std::runtime_error("GeoArrowMVTWriterInit() failed");
+  }
+
+  for (auto _ : state) {
+    if (GeoArrowMVTWriterAppend(&writer, fixture.geometry(), nullptr, nullptr) !=
+            GEOARROW_OK ||
+        GeoArrowMVTWriterFinish(&writer, &tile, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("Failed to encode tile");
+    }
+
+    benchmark::DoNotOptimize(tile);
+  }
+
+  GeoArrowMVTWriterReset(&writer);
+  state.SetItemsProcessed(kNumFeatures * state.iterations());
+}
+
+/// \brief Encode 50,000 points
+static void EncodeTilePoints(benchmark::State& state) {
+  EncodeTile(state, GEOARROW_TYPE_POINT);
+}
+
+/// \brief Encode 50,000 linestrings with 21 coordinates each
+static void EncodeTileLinestrings(benchmark::State& state) {
+  EncodeTile(state, GEOARROW_TYPE_LINESTRING);
+}
+
+/// \brief Encode 50,000 polygons with 21 coordinates each
+static void EncodeTilePolygons(benchmark::State& state) {
+  EncodeTile(state, GEOARROW_TYPE_POLYGON);
+}
+
+BENCHMARK(EncodeTilePoints);
+BENCHMARK(EncodeTileLinestrings);
+BENCHMARK(EncodeTilePolygons);
@@ -0,0 +1,147 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file select_benchmark.cc
+///
+/// Benchmarks related to selecting and concatenating rows of native arrays. The
+/// visitor-based strategy is what as_geoarrow does when it is used to merge chunks;
+/// the buffer strategy is GeoArrowArrayConcat() and GeoArrowArrayTake(), which copy
+/// offset and coordinate buffers directly.
+
+using geoarrow::benchmark_util::kNumCoordsPrettyBig;
+
+enum Strategy { VISITOR, BUFFERS };
+
+static const int64_t kNumChunks = 16;
+static const int64_t kNumCoordsPerLinestring = 100;
+
+// Owns kNumChunks linestring arrays with a total of kNumCoordsPrettyBig coordinates
+class LinestringChunks {
+ public:
+  LinestringChunks() {
+    int64_t n_coords = kNumCoordsPrettyBig / kNumChunks;
+    int64_t n_linestrings = n_coords / kNumCoordsPerLinestring;
+    std::vector<int32_t> offsets;
+    for (int64_t i = 0; i <= n_linestrings; i++) {
+      offsets.push_back(static_cast<int32_t>(i * kNumCoordsPerLinestring));
+    }
+
+    std::vector<double> xs(n_coords);
+    std::vector<double> ys(n_coords);
+    geoarrow::benchmark_util::PointsOnCircle(static_cast<uint32_t>(n_coords), 1,
+                                             xs.data(), ys.data());
+
+    struct GeoArrowBufferView buffers[3] = {
+        {{reinterpret_cast<const uint8_t*>(offsets.data())},
+         static_cast<int64_t>(offsets.size() * sizeof(int32_t))},
+        {{reinterpret_cast<const uint8_t*>(xs.data())},
+         static_cast<int64_t>(xs.size() * sizeof(double))},
+        {{reinterpret_cast<const uint8_t*>(ys.data())},
+         static_cast<int64_t>(ys.size() * sizeof(double))}};
+
+    chunks_.resize(kNumChunks);
+    for (int64_t i = 0; i < kNumChunks; i++) {
+      struct GeoArrowBuilder builder;
+      GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_LINESTRING);
+      for (int j = 0; j < 3; j++) {
+        GeoArrowBuilderAppendBuffer(&builder, 1 + j, buffers[j]);
+      }
+
+      if (GeoArrowBuilderFinish(&builder, &chunks_[i], nullptr) != GEOARROW_OK) {
+        throw std::runtime_error("GeoArrowBuilderFinish() failed");
+      }
+
+      GeoArrowBuilderReset(&builder);
+      pointers_.push_back(&chunks_[i]);
+    }
+  }
+
+  ~LinestringChunks() {
+    for (auto& chunk : chunks_) {
+      chunk.release(&chunk);
+    }
+  }
+
+  const struct ArrowArray* const* chunks() const { return pointers_.data(); }
+
+ private:
+  std::vector<struct ArrowArray> chunks_;
+  std::vector<const struct ArrowArray*> pointers_;
+};
+
+/// \brief Concatenate kNumChunks linestring arrays
+template <enum Strategy strategy>
+static void ConcatLinestrings(benchmark::State& state) {
+  LinestringChunks fixture;
+  struct ArrowArray out;
+
+  for (auto _ : state) {
+    if (strategy == VISITOR) {
+      struct GeoArrowArrayReader reader;
+      struct GeoArrowNativeWriter writer;
+      struct GeoArrowVisitor v;
+      GeoArrowArrayReaderInitFromType(&reader, GEOARROW_TYPE_LINESTRING);
+      GeoArrowNativeWriterInit(&writer, GEOARROW_TYPE_LINESTRING);
+      GeoArrowNativeWriterInitVisitor(&writer, &v);
+      for (int64_t i = 0; i < kNumChunks; i++) {
+        const struct ArrowArray* chunk = fixture.chunks()[i];
+        if (GeoArrowArrayReaderSetArray(&reader, chunk, nullptr) != GEOARROW_OK ||
+            GeoArrowArrayReaderVisit(&reader, 0, chunk->length, &v) != GEOARROW_OK) {
+          throw std::runtime_error("Visitor-based concatenation failed");
+        }
+      }
+
+      if (GeoArrowNativeWriterFinish(&writer, &out, nullptr) != GEOARROW_OK) {
+        throw std::runtime_error("Visitor-based concatenation failed");
+      }
+
+      GeoArrowNativeWriterReset(&writer);
+      GeoArrowArrayReaderReset(&reader);
+    } else if (strategy == BUFFERS) {
+      if (GeoArrowArrayConcat(fixture.chunks(), kNumChunks, GEOARROW_TYPE_LINESTRING,
+                              &out, nullptr) != GEOARROW_OK) {
+        throw std::runtime_error("GeoArrowArrayConcat() failed");
+      }
+    }
+
+    out.release(&out);
+  }
+
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+}
+
+/// \brief Take every other linestring in pairs (i.e., runs of two rows)
+static void TakeLinestrings(benchmark::State& state) {
+  LinestringChunks fixture;
+  const struct ArrowArray* chunk = fixture.chunks()[0];
+  std::vector<int64_t> indices;
+  for (int64_t i = 0; (i + 1) < chunk->length; i += 4) {
+    indices.push_back(i);
+    indices.push_back(i + 1);
+  }
+
+  struct ArrowArray out;
+  for (auto _ : state) {
+    if (GeoArrowArrayTake(chunk, GEOARROW_TYPE_LINESTRING, indices.data(),
+                          static_cast<int64_t>(indices.size()), &out,
+                          nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowArrayTake() failed");
+    }
+
+    out.release(&out);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(indices.size()) *
+                          kNumCoordsPerLinestring * state.iterations());
+}
+
+BENCHMARK(ConcatLinestrings<VISITOR>);
+BENCHMARK(ConcatLinestrings<BUFFERS>);
+BENCHMARK(TakeLinestrings);
@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file transpose_benchmark.cc
+///
+/// Benchmarks related to converting between separated and interleaved coordinates.
+/// The visitor-based strategy is what as_geoarrow does for arbitrary input; the
+/// transpose strategy is what as_geoarrow and GeoArrowArrayTransposeCoords() do when
+/// only the coordinate layout changes.
+
+enum Strategy { VISITOR, TRANSPOSE };
+
+/// \brief Convert a point array of type to the other coordinate layout
+template <enum GeoArrowType type, enum Strategy strategy>
+static void TransposePoints(benchmark::State& state) {
+  struct GeoArrowArrayView view;
+  GeoArrowArrayViewInitFromType(&view, type);
+  int64_t n_coords = geoarrow::benchmark_util::kNumCoordsPrettyBig;
+  int n_values = view.coords.n_values;
+  int is_interleaved = view.schema_view.coord_type == GEOARROW_COORD_TYPE_INTERLEAVED;
+  enum GeoArrowType out_type =
+      GeoArrowMakeType(view.schema_view.geometry_type, view.schema_view.dimensions,
+                       is_interleaved ? GEOARROW_COORD_TYPE_SEPARATE
+                                      : GEOARROW_COORD_TYPE_INTERLEAVED);
+
+  std::vector<double> coords(n_coords * n_values);
+  view.length[0] = n_coords;
+  view.coords.n_coords = n_coords;
+  for (int i = 0; i < n_values; i++) {
+    view.coords.values[i] = is_interleaved ? coords.data() + i
+                                           : coords.data() + (i * n_coords);
+  }
+
+  geoarrow::benchmark_util::PointsOnCircle(static_cast<uint32_t>(n_coords),
+                                           view.coords.coords_stride,
+                                           const_cast<double*>(view.coords.values[0]),
+                                           const_cast<double*>(view.coords.values[1]));
+
+  if (strategy == VISITOR) {
+    struct GeoArrowNativeWriter writer;
+    struct GeoArrowVisitor v;
+    struct ArrowArray out;
+
+    for (auto _ : state) {
+      GeoArrowNativeWriterInit(&writer, out_type);
+      GeoArrowNativeWriterInitVisitor(&writer, &v);
+      if (GeoArrowArrayViewVisitNative(&view, 0, n_coords, &v) != GEOARROW_OK ||
+          GeoArrowNativeWriterFinish(&writer, &out, nullptr) != GEOARROW_OK) {
+        throw std::runtime_error("Visitor-based conversion failed");
+      }
+
+      GeoArrowNativeWriterReset(&writer);
+      out.release(&out);
+    }
+  } else if (strategy == TRANSPOSE) {
+    std::vector<double> out(n_coords * n_values);
+    const void* src[4];
+    void* dst[4];
+    for (int i = 0; i < n_values; i++) {
+      src[i] = view.coords.values[i];
+      dst[i] = out.data() + (i * n_coords);
+    }
+
+    for (auto _ : state) {
+      if (is_interleaved) {
+        GeoArrowDeinterleaveOrdinates(src[0], dst, n_coords, n_values, sizeof(double));
+      } else {
+        GeoArrowInterleaveOrdinates(src, out.data(), n_coords, n_values, sizeof(double));
+      }
+
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+
+  state.SetItemsProcessed(n_coords * state.iterations());
+}
+
+BENCHMARK(TransposePoints<GEOARROW_TYPE_POINT, VISITOR>);
+BENCHMARK(TransposePoints<GEOARROW_TYPE_POINT, TRANSPOSE>);
+BENCHMARK(TransposePoints<GEOARROW_TYPE_INTERLEAVED_POINT, VISITOR>);
+BENCHMARK(TransposePoints<GEOARROW_TYPE_INTERLEAVED_POINT, TRANSPOSE>);
+BENCHMARK(TransposePoints<GEOARROW_TYPE_POINT_Z, TRANSPOSE>);
+BENCHMARK(TransposePoints<GEOARROW_TYPE_INTERLEAVED_POINT_ZM, TRANSPOSE>);
@@ -0,0 +1,166 @@
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "geoarrow/geoarrow.h"
+
+#include "benchmark_util.hpp"
+
+/// \file wkt_writer_benchmark.cc
+///
+/// Benchmarks for writing native linestrings to WKT. Projected coordinates rounded
+/// to the centimetre are printed without ryu; longitude/latitude coordinates use
+/// all available digits. GeoArrowArrayFormatWKT() is benchmarked using one
+/// std::thread per task.
+
+using geoarrow::benchmark_util::kNumCoordsPrettyBig;
+
+enum Coords { PROJECTED, LONLAT };
+
+static const int64_t kNumCoordsPerLinestring = 1000;
+
+// Owns a linestring array with a total of kNumCoordsPrettyBig coordinates
+class LinestringFixture {
+ public:
+  explicit LinestringFixture(enum Coords coords) {
+    int64_t n_linestrings = kNumCoordsPrettyBig / kNumCoordsPerLinestring;
+    std::vector<int32_t> offsets;
+    for (int64_t i = 0; i <= n_linestrings; i++) {
+      offsets.push_back(static_cast<int32_t>(i * kNumCoordsPerLinestring));
+    }
+
+    std::vector<double> xs(kNumCoordsPrettyBig);
+    std::vector<double> ys(kNumCoordsPrettyBig);
+    for (int64_t i = 0; i < n_linestrings; i++) {
+      geoarrow::benchmark_util::PointsOnCircle(
+          kNumCoordsPerLinestring, 1, xs.data() + i * kNumCoordsPerLinestring,
+          ys.data() + i * kNumCoordsPerLinestring);
+    }
+
+    for (int64_t i = 0; i < kNumCoordsPrettyBig; i++) {
+      if (coords == PROJECTED) {
+        xs[i] = std::round((xs[i] * 1000 + 500000) * 100) / 100;
+        ys[i] = std::round((ys[i] * 1000 + 4000000) * 100) / 100;
+      } else {
+        xs[i] = xs[i] / 10 - 64;
+        ys[i] = ys[i] / 10 + 45;
+      }
+    }
+
+    struct GeoArrowBufferView buffers[3] = {
+        {{reinterpret_cast<const uint8_t*>(offsets.data())},
+         static_cast<int64_t>(offsets.size() * sizeof(int32_t))},
+        {{reinterpret_cast<const uint8_t*>(xs.data())},
+         static_cast<int64_t>(xs.size() * sizeof(double))},
+        {{reinterpret_cast<const uint8_t*>(ys.data())},
+         static_cast<int64_t>(ys.size() * sizeof(double))}};
+
+    struct GeoArrowBuilder builder;
+    GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_LINESTRING);
+    for (int j = 0; j < 3; j++) {
+      GeoArrowBuilderAppendBuffer(&builder, 1 + j, buffers[j]);
+    }
+
+    if (GeoArrowBuilderFinish(&builder, &array_, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowBuilderFinish() failed");
+    }
+    GeoArrowBuilderReset(&builder);
+  }
+
+  ~LinestringFixture() { array_.release(&array_); }
+
+  struct ArrowArray* array() { return &array_; }
+
+ private:
+  struct ArrowArray array_;
+};
+
+template <enum Coords coords>
+static void WriteWKT(benchmark::State& state, int precision) {
+  LinestringFixture fixture(coords);
+  struct GeoArrowArrayReader reader;
+  struct ArrowArray out;
+
+  GeoArrowArrayReaderInitFromType(&reader, GEOARROW_TYPE_LINESTRING);
+  if (GeoArrowArrayReaderSetArray(&reader, fixture.array(), nullptr) != GEOARROW_OK) {
+    throw std::runtime_error("GeoArrowArrayReaderSetArray() failed");
+  }
+
+  for (auto _ : state) {
+    struct GeoArrowArrayWriter writer;
+    struct GeoArrowVisitor v;
+    GeoArrowArrayWriterInitFromType(&writer, GEOARROW_TYPE_WKT);
+    GeoArrowArrayWriterSetPrecision(&writer, precision);
+    GeoArrowArrayWriterInitVisitor(&writer, &v);
+    if (GeoArrowArrayReaderVisit(&reader, 0, fixture.array()->length, &v) !=
+            GEOARROW_OK ||
+        GeoArrowArrayWriterFinish(&writer, &out, nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("Conversion to WKT failed");
+    }
+
+    GeoArrowArrayWriterReset(&writer);
+    out.release(&out);
+  }
+
+  GeoArrowArrayReaderReset(&reader);
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+}
+
+/// \brief Write linestrings to WKT with the default precision
+template <enum Coords coords>
+static void WriteWKTDefault(benchmark::State& state) {
+  WriteWKT<coords>(state, 16);
+}
+
+/// \brief Write linestrings to WKT using the shortest representation that round trips
+template <enum Coords coords>
+static void WriteWKTShortest(benchmark::State& state) {
+  WriteWKT<coords>(state, GEOARROW_PRECISION_SHORTEST);
+}
+
+BENCHMARK(WriteWKTDefault<PROJECTED>);
+BENCHMARK(WriteWKTDefault<LONLAT>);
+BENCHMARK(WriteWKTShortest<PROJECTED>);
+BENCHMARK(WriteWKTShortest<LONLAT>);
+
+// Runs each task on its own std::thread
+static void ThreadParallelFor(struct GeoArrowExecutor* executor, int64_t n_tasks,
+                              void (*task)(void* task_data, int64_t i),
+                              void* task_data) {
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < n_tasks; i++) {
+    threads.emplace_back(task, task_data, i);
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+/// \brief Write linestrings to WKT with the default precision using n_tasks threads
+template <enum Coords coords>
+static void FormatWKTTasks(benchmark::State& state) {
+  LinestringFixture fixture(coords);
+  struct GeoArrowExecutor executor;
+  executor.parallel_for = &ThreadParallelFor;
+  executor.private_data = nullptr;
+  struct ArrowArray out;
+
+  for (auto _ : state) {
+    if (GeoArrowArrayFormatWKT(fixture.array(), GEOARROW_TYPE_LINESTRING, 16, -1,
+                               GEOARROW_TYPE_WKT, state.range(0), &executor, &out,
+                               nullptr) != GEOARROW_OK) {
+      throw std::runtime_error("GeoArrowArrayFormatWKT() failed");
+    }
+
+    out.release(&out);
+  }
+
+  state.SetItemsProcessed(kNumCoordsPrettyBig * state.iterations());
+}
+
+BENCHMARK(FormatWKTTasks<LONLAT>)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
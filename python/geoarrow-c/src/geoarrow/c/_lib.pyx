@@ -5,7 +5,9 @@
 """Low-level geoarrow Python bindings."""
 
 from libc.stdint cimport uint8_t, int32_t, int64_t, uintptr_t
-from cpython cimport Py_buffer, PyObject
+from libc.stdlib cimport malloc, free
+from cpython cimport Py_buffer, PyObject, PyBUF_STRIDES
+from cpython.pycapsule cimport PyCapsule_New, PyCapsule_GetPointer
 from libcpp cimport bool
 from libcpp.string cimport string
 
@@ -33,6 +35,13 @@ cdef extern from "geoarrow_type.h":
         void (*release)(ArrowArray*)
         void* private_data
 
+    struct ArrowArrayStream:
+        int (*get_schema)(ArrowArrayStream*, ArrowSchema* out)
+        int (*get_next)(ArrowArrayStream*, ArrowArray* out)
+        const char* (*get_last_error)(ArrowArrayStream*)
+        void (*release)(ArrowArrayStream*)
+        void* private_data
+
     ctypedef int GeoArrowErrorCode
     cdef int GEOARROW_OK
 
@@ -58,6 +67,10 @@ cdef extern from "geoarrow_type.h":
         GEOARROW_COORD_TYPE_UNKNOWN = 0
         GEOARROW_COORD_TYPE_SEPARATE = 1
         GEOARROW_COORD_TYPE_INTERLEAVED = 2
+        GEOARROW_COORD_TYPE_SEPARATE_FLOAT = 3
+        GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT = 4
+        GEOARROW_COORD_TYPE_SEPARATE_INT32 = 5
+        GEOARROW_COORD_TYPE_INTERLEAVED_INT32 = 6
 
     cpdef enum GeoArrowType:
         GEOARROW_TYPE_UNINITIALIZED = 0
@@ -119,6 +132,104 @@ cdef extern from "geoarrow_type.h":
         GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM = 13005
         GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM = 13006
 
+        GEOARROW_TYPE_FLOAT_POINT = 20001
+        GEOARROW_TYPE_FLOAT_LINESTRING = 20002
+        GEOARROW_TYPE_FLOAT_POLYGON = 20003
+        GEOARROW_TYPE_FLOAT_MULTIPOINT = 20004
+        GEOARROW_TYPE_FLOAT_MULTILINESTRING = 20005
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON = 20006
+        GEOARROW_TYPE_FLOAT_POINT_Z = 21001
+        GEOARROW_TYPE_FLOAT_LINESTRING_Z = 21002
+        GEOARROW_TYPE_FLOAT_POLYGON_Z = 21003
+        GEOARROW_TYPE_FLOAT_MULTIPOINT_Z = 21004
+        GEOARROW_TYPE_FLOAT_MULTILINESTRING_Z = 21005
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON_Z = 21006
+        GEOARROW_TYPE_FLOAT_POINT_M = 22001
+        GEOARROW_TYPE_FLOAT_LINESTRING_M = 22002
+        GEOARROW_TYPE_FLOAT_POLYGON_M = 22003
+        GEOARROW_TYPE_FLOAT_MULTIPOINT_M = 22004
+        GEOARROW_TYPE_FLOAT_MULTILINESTRING_M = 22005
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON_M = 22006
+        GEOARROW_TYPE_FLOAT_POINT_ZM = 23001
+        GEOARROW_TYPE_FLOAT_LINESTRING_ZM = 23002
+        GEOARROW_TYPE_FLOAT_POLYGON_ZM = 23003
+        GEOARROW_TYPE_FLOAT_MULTIPOINT_ZM = 23004
+        GEOARROW_TYPE_FLOAT_MULTILINESTRING_ZM = 23005
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON_ZM = 23006
+
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT = 30001
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING = 30002
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON = 30003
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT = 30004
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING = 30005
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON = 30006
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_Z = 31001
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_Z = 31002
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_Z = 31003
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_Z = 31004
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_Z = 31005
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_Z = 31006
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_M = 32001
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_M = 32002
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M = 32003
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_M = 32004
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_M = 32005
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_M = 32006
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_ZM = 33001
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_ZM = 33002
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_ZM = 33003
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_ZM = 33004
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_ZM = 33005
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_ZM = 33006
+        GEOARROW_TYPE_INT32_POINT = 40001
+        GEOARROW_TYPE_INT32_LINESTRING = 40002
+        GEOARROW_TYPE_INT32_POLYGON = 40003
+        GEOARROW_TYPE_INT32_MULTIPOINT = 40004
+        GEOARROW_TYPE_INT32_MULTILINESTRING = 40005
+        GEOARROW_TYPE_INT32_MULTIPOLYGON = 40006
+        GEOARROW_TYPE_INT32_POINT_Z = 41001
+        GEOARROW_TYPE_INT32_LINESTRING_Z = 41002
+        GEOARROW_TYPE_INT32_POLYGON_Z = 41003
+        GEOARROW_TYPE_INT32_MULTIPOINT_Z = 41004
+        GEOARROW_TYPE_INT32_MULTILINESTRING_Z = 41005
+        GEOARROW_TYPE_INT32_MULTIPOLYGON_Z = 41006
+        GEOARROW_TYPE_INT32_POINT_M = 42001
+        GEOARROW_TYPE_INT32_LINESTRING_M = 42002
+        GEOARROW_TYPE_INT32_POLYGON_M = 42003
+        GEOARROW_TYPE_INT32_MULTIPOINT_M = 42004
+        GEOARROW_TYPE_INT32_MULTILINESTRING_M = 42005
+        GEOARROW_TYPE_INT32_MULTIPOLYGON_M = 42006
+        GEOARROW_TYPE_INT32_POINT_ZM = 43001
+        GEOARROW_TYPE_INT32_LINESTRING_ZM = 43002
+        GEOARROW_TYPE_INT32_POLYGON_ZM = 43003
+        GEOARROW_TYPE_INT32_MULTIPOINT_ZM = 43004
+        GEOARROW_TYPE_INT32_MULTILINESTRING_ZM = 43005
+        GEOARROW_TYPE_INT32_MULTIPOLYGON_ZM = 43006
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT = 50001
+        GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING = 50002
+        GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON = 50003
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT = 50004
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING = 50005
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON = 50006
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT_Z = 51001
+        GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_Z = 51002
+        GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_Z = 51003
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_Z = 51004
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_Z = 51005
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_Z = 51006
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT_M = 52001
+        GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_M = 52002
+        GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_M = 52003
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_M = 52004
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_M = 52005
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_M = 52006
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT_ZM = 53001
+        GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_ZM = 53002
+        GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_ZM = 53003
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_ZM = 53004
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_ZM = 53005
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_ZM = 53006
+
     cpdef enum GeoArrowEdgeType:
         GEOARROW_EDGE_TYPE_PLANAR
         GEOARROW_EDGE_TYPE_SPHERICAL
@@ -171,12 +282,36 @@ cdef extern from "geoarrow_type.h":
         void (*release)(GeoArrowKernel* kernel)
         void* private_data
 
+    struct GeoArrowStatistics:
+        int64_t num_batches
+        int64_t num_features
+        int64_t num_null_features
+        int64_t num_coords
+        int64_t bytes_read
+        int64_t bytes_written
+        int64_t num_reallocations
+        int64_t start_ns
+        int64_t push_batch_ns
+        int64_t finish_ns
+
     struct GeoArrowCoordView:
         const double* values[4]
         int64_t n_coords
         int32_t n_values
         int32_t coords_stride
 
+    struct GeoArrowFloatCoordView:
+        const float* values[8]
+        int64_t n_coords
+        int32_t n_values
+        int32_t coords_stride
+
+    struct GeoArrowInt32CoordView:
+        const int32_t* values[8]
+        int64_t n_coords
+        int32_t n_values
+        int32_t coords_stride
+
     struct GeoArrowArrayView:
         GeoArrowSchemaView schema_view
         int64_t offset[4]
@@ -187,6 +322,8 @@ cdef extern from "geoarrow_type.h":
         int32_t first_offset[3]
         int32_t last_offset[3]
         GeoArrowCoordView coords
+        GeoArrowFloatCoordView coords_float
+        GeoArrowInt32CoordView coords_int32
 
 
 
@@ -196,6 +333,13 @@ cdef extern from "geoarrow_type.h":
 
 cdef extern from "geoarrow.h":
     GeoArrowErrorCode GeoArrowKernelInit(GeoArrowKernel* kernel, const char* name, const char* options)
+    GeoArrowErrorCode GeoArrowKernelEnableStatistics(GeoArrowKernel* kernel)
+    GeoArrowErrorCode GeoArrowKernelGetStatistics(GeoArrowKernel* kernel,
+                                                  GeoArrowStatistics* out)
+    GeoArrowErrorCode GeoArrowKernelStreamInit(ArrowArrayStream* out,
+                                               ArrowArrayStream* input,
+                                               const char* name, const char* options,
+                                               GeoArrowError* error) nogil
 
     GeoArrowErrorCode GeoArrowArrayViewInitFromSchema(GeoArrowArrayView* array_view,
                                                       ArrowSchema* schema,
@@ -346,6 +490,52 @@ cdef class ArrayHolder:
         self.c_array.release(&self.c_array)
 
 
+cdef void pycapsule_array_stream_deleter(object stream_capsule) noexcept:
+    cdef ArrowArrayStream* stream = <ArrowArrayStream*>PyCapsule_GetPointer(
+        stream_capsule, "arrow_array_stream"
+    )
+    if stream.release != NULL:
+        stream.release(stream)
+
+    free(stream)
+
+
+cdef class ArrayStreamHolder:
+    cdef ArrowArrayStream c_array_stream
+
+    def __cinit__(self):
+        self.c_array_stream.release = NULL
+
+    def __dealloc__(self):
+        if self.c_array_stream.release != NULL:
+            self.c_array_stream.release(&self.c_array_stream)
+
+    def _addr(self):
+        return <uintptr_t>&self.c_array_stream
+
+    def is_valid(self):
+        return self.c_array_stream.release != NULL
+
+    def release(self):
+        if self.c_array_stream.release == NULL:
+            raise ValueError('ArrayStream is already released')
+        self.c_array_stream.release(&self.c_array_stream)
+
+    def __arrow_c_stream__(self, requested_schema=None):
+        if requested_schema is not None:
+            raise NotImplementedError("requested_schema is not supported")
+        if self.c_array_stream.release == NULL:
+            raise ValueError('ArrayStream is already released')
+
+        cdef ArrowArrayStream* c_stream_out = <ArrowArrayStream*>malloc(sizeof(ArrowArrayStream))
+        if c_stream_out == NULL:
+            raise MemoryError()
+
+        c_stream_out[0] = self.c_array_stream
+        self.c_array_stream.release = NULL
+        return PyCapsule_New(c_stream_out, "arrow_array_stream", &pycapsule_array_stream_deleter)
+
+
 cdef class CGeometryDataType:
     cdef GeometryDataType c_vector_type
 
@@ -495,7 +685,48 @@ cdef class CKernel:
         if self.c_kernel.release != NULL:
             self.c_kernel.release(&self.c_kernel)
 
+    def _assert_valid(self):
+        if self.c_kernel.release == NULL:
+            raise ValueError(f"GeoArrowKernel<{self.cname_str}> is already released")
+
+    def enable_statistics(self):
+        """Collect counters and timings while this kernel is executed
+
+        Must be called before :meth:`start`. Use :meth:`statistics` to retrieve
+        the values collected so far.
+        """
+        self._assert_valid()
+        cdef int result = GeoArrowKernelEnableStatistics(&self.c_kernel)
+        if result != GEOARROW_OK:
+            Error.raise_error(
+                f"GeoArrowKernelEnableStatistics('{self.cname_str}')", result
+            )
+
+    def statistics(self):
+        """Return a dict of the statistics collected since :meth:`enable_statistics`"""
+        self._assert_valid()
+        cdef GeoArrowStatistics stats
+        cdef int result = GeoArrowKernelGetStatistics(&self.c_kernel, &stats)
+        if result != GEOARROW_OK:
+            Error.raise_error(
+                f"GeoArrowKernelGetStatistics('{self.cname_str}')", result
+            )
+
+        return {
+            "num_batches": stats.num_batches,
+            "num_features": stats.num_features,
+            "num_null_features": stats.num_null_features,
+            "num_coords": stats.num_coords,
+            "bytes_read": stats.bytes_read,
+            "bytes_written": stats.bytes_written,
+            "num_reallocations": stats.num_reallocations,
+            "start_ns": stats.start_ns,
+            "push_batch_ns": stats.push_batch_ns,
+            "finish_ns": stats.finish_ns,
+        }
+
     def start(self, SchemaHolder schema, const char* options):
+        self._assert_valid()
         cdef Error error = Error()
         out = SchemaHolder()
         cdef int result = self.c_kernel.start(&self.c_kernel, &schema.c_schema,
@@ -506,6 +737,7 @@ cdef class CKernel:
         return out
 
     def push_batch(self, ArrayHolder array):
+        self._assert_valid()
         cdef Error error = Error()
         out = ArrayHolder()
         cdef int result
@@ -518,6 +750,7 @@ cdef class CKernel:
         return out
 
     def finish(self):
+        self._assert_valid()
         cdef Error error = Error()
         out = ArrayHolder()
         cdef int result
@@ -527,21 +760,85 @@ cdef class CKernel:
             error.raise_message(f"GeoArrowKernel<{self.cname_str}>::finish()", result)
 
     def push_batch_agg(self, ArrayHolder array):
+        self._assert_valid()
         cdef Error error = Error()
-        cdef int result = self.c_kernel.push_batch(&self.c_kernel, &array.c_array,
-                                                   NULL, &error.c_error)
+        cdef int result
+        with nogil:
+            result = self.c_kernel.push_batch(&self.c_kernel, &array.c_array,
+                                              NULL, &error.c_error)
         if result != GEOARROW_OK:
             error.raise_message(f"GeoArrowKernel<{self.cname_str}>::push_batch()", result)
 
     def finish_agg(self):
+        self._assert_valid()
         cdef Error error = Error()
         out = ArrayHolder()
-        cdef int result = self.c_kernel.finish(&self.c_kernel, &out.c_array, &error.c_error)
+        cdef int result
+        with nogil:
+            result = self.c_kernel.finish(&self.c_kernel, &out.c_array, &error.c_error)
         if result != GEOARROW_OK:
             error.raise_message(f"GeoArrowKernel<{self.cname_str}>::finish()", result)
 
         return out
 
+    def execute_stream(self, stream, const char* options):
+        """Apply this kernel to every batch of an ArrowArrayStream
+
+        ``stream`` may be any object implementing ``__arrow_c_stream__`` or a
+        PyCapsule named ``"arrow_array_stream"``, which is consumed. The returned
+        ``ArrayStreamHolder`` wraps a fresh kernel of the same name that is started
+        with the schema of the input and pushes one input batch per output batch
+        without holding the GIL (or emits a single batch at the end of the input
+        for aggregate kernels). This kernel is released and cannot be reused
+        afterwards. Because the statistics of this kernel would be lost, this
+        raises if :meth:`enable_statistics` was called.
+        """
+        self._assert_valid()
+
+        cdef GeoArrowStatistics stats
+        if GeoArrowKernelGetStatistics(&self.c_kernel, &stats) == GEOARROW_OK:
+            raise ValueError(
+                f"GeoArrowKernel<{self.cname_str}>::execute_stream() does not support "
+                "statistics"
+            )
+
+        if hasattr(stream, "__arrow_c_stream__"):
+            stream = stream.__arrow_c_stream__()
+
+        cdef ArrowArrayStream* c_stream_in = <ArrowArrayStream*>PyCapsule_GetPointer(
+            stream, "arrow_array_stream"
+        )
+        if c_stream_in.release == NULL:
+            raise ValueError("ArrowArrayStream is already released")
+
+        cname_bytes = self.cname_str.encode("UTF-8")
+        cdef const char* cname = cname_bytes
+        cdef Error error = Error()
+        cdef ArrayStreamHolder out = ArrayStreamHolder()
+        cdef int result
+        with nogil:
+            result = GeoArrowKernelStreamInit(&out.c_array_stream, c_stream_in,
+                                              cname, options, &error.c_error)
+        if result != GEOARROW_OK:
+            error.raise_message(f"GeoArrowKernel<{self.cname_str}>::execute_stream()", result)
+
+        # The kernel is started lazily: do so here so that invalid options
+        # are reported by this call rather than by the consumer of the stream
+        cdef SchemaHolder schema = SchemaHolder()
+        result = out.c_array_stream.get_schema(&out.c_array_stream, &schema.c_schema)
+        if result != GEOARROW_OK:
+            message = out.c_array_stream.get_last_error(&out.c_array_stream)
+            message = message.decode("UTF-8")
+            out.release()
+            raise GeoArrowCException(
+                f"GeoArrowKernel<{self.cname_str}>::execute_stream()", result, message
+            )
+
+        # Only release this kernel once the stream is known to be valid such that
+        # invalid options leave it usable
+        self.c_kernel.release(&self.c_kernel)
+        return out
+
 
 cdef class CArrayView:
     cdef GeoArrowArrayView c_array_view
@@ -614,28 +911,157 @@ cdef class CArrayView:
 
         return buffers
 
+    def _assert_native(self):
+        cdef GeoArrowGeometryType geometry_type = self.c_array_view.schema_view.geometry_type
+        if geometry_type < GEOARROW_GEOMETRY_TYPE_POINT or geometry_type > GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+            raise ValueError("Can't access offsets or coordinates of a serialized or box array")
+
+    def _offsets(self, int level):
+        self._assert_native()
+        if level >= self.c_array_view.n_offsets:
+            raise ValueError(f"Array has no offsets at level {level}")
+
+        # Zero-length levels point to a static zero; otherwise apply this level's
+        # offset so that the values of each offset buffer index directly into the
+        # next offset buffer (or the coordinates).
+        cdef const int32_t* ptr = self.c_array_view.offsets[level]
+        cdef int64_t length = 1
+        if self.c_array_view.length[level] > 0:
+            ptr += self.c_array_view.offset[level]
+            if level == 0:
+                length = self.c_array_view.length[0] + 1
+            else:
+                length = self.c_array_view.last_offset[level - 1] + 1
+
+        return CArrayViewBuffer(self, <uintptr_t>ptr, 4, length, 'i')
+
+    def geometry_offsets(self):
+        """Zero-copy view of the outermost offsets with the array offset applied
+
+        Element ``i`` and ``i + 1`` bound the parts (multi geometries), rings
+        (polygons), or coordinates (linestrings, multipoints) of feature ``i``.
+        """
+        return self._offsets(0)
+
+    def part_offsets(self):
+        """Zero-copy view of the part offsets of a multilinestring or multipolygon
+
+        Values index into :meth:`ring_offsets` for multipolygons or into the
+        coordinates for multilinestrings.
+        """
+        cdef GeoArrowGeometryType geometry_type = self.c_array_view.schema_view.geometry_type
+        if geometry_type != GEOARROW_GEOMETRY_TYPE_MULTILINESTRING and geometry_type != GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+            raise ValueError("part_offsets() requires a multilinestring or multipolygon array")
+        return self._offsets(1)
+
+    def ring_offsets(self):
+        """Zero-copy view of the ring offsets of a polygon or multipolygon
+
+        Values index into the coordinates.
+        """
+        cdef GeoArrowGeometryType geometry_type = self.c_array_view.schema_view.geometry_type
+        if geometry_type == GEOARROW_GEOMETRY_TYPE_POLYGON:
+            return self._offsets(1)
+        elif geometry_type == GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+            return self._offsets(2)
+        else:
+            raise ValueError("ring_offsets() requires a polygon or multipolygon array")
+
+    def coords_xy(self):
+        """Zero-copy views of the x and y coordinate values
+
+        Returns a tuple of two buffers with the stride of the underlying storage
+        (i.e., a non-contiguous view for interleaved coordinates) covering every
+        coordinate referenced by the innermost offsets. Buffers have format ``'f'``
+        for arrays with float coordinate storage, ``'i'`` (the stored quantized
+        values, before scale and offset are applied) for arrays with int32
+        coordinate storage, and ``'d'`` otherwise.
+        """
+        self._assert_native()
+
+        cdef GeoArrowCoordView* coords = &self.c_array_view.coords
+        cdef GeoArrowFloatCoordView* coords_float = &self.c_array_view.coords_float
+        cdef GeoArrowInt32CoordView* coords_int32 = &self.c_array_view.coords_int32
+        cdef int64_t n_coords
+        if self.c_array_view.n_offsets == 0:
+            n_coords = self.c_array_view.length[0]
+        else:
+            n_coords = self.c_array_view.last_offset[self.c_array_view.n_offsets - 1]
+
+        # The offset of the coordinate array itself is not applied to coords.values
+        cdef int64_t coord_offset = self.c_array_view.offset[self.c_array_view.n_offsets]
+        cdef GeoArrowCoordType coord_type = self.c_array_view.schema_view.coord_type
+        cdef const float* x_float
+        cdef const float* y_float
+        if (
+            coord_type == GEOARROW_COORD_TYPE_SEPARATE_FLOAT
+            or coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT
+        ):
+            x_float = coords_float.values[0] + coord_offset * coords_float.coords_stride
+            y_float = coords_float.values[1] + coord_offset * coords_float.coords_stride
+            return (
+                CArrayViewBuffer(self, <uintptr_t>x_float, 4, n_coords, 'f',
+                                 coords_float.coords_stride * 4),
+                CArrayViewBuffer(self, <uintptr_t>y_float, 4, n_coords, 'f',
+                                 coords_float.coords_stride * 4),
+            )
+
+        cdef const int32_t* x_int32
+        cdef const int32_t* y_int32
+        if (
+            coord_type == GEOARROW_COORD_TYPE_SEPARATE_INT32
+            or coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_INT32
+        ):
+            x_int32 = coords_int32.values[0] + coord_offset * coords_int32.coords_stride
+            y_int32 = coords_int32.values[1] + coord_offset * coords_int32.coords_stride
+            return (
+                CArrayViewBuffer(self, <uintptr_t>x_int32, 4, n_coords, 'i',
+                                 coords_int32.coords_stride * 4),
+                CArrayViewBuffer(self, <uintptr_t>y_int32, 4, n_coords, 'i',
+                                 coords_int32.coords_stride * 4),
+            )
+
+        cdef const double* x = coords.values[0] + coord_offset * coords.coords_stride
+        cdef const double* y = coords.values[1] + coord_offset * coords.coords_stride
+        cdef Py_ssize_t stride = coords.coords_stride * 8
+        return (
+            CArrayViewBuffer(self, <uintptr_t>x, 8, n_coords, 'd', stride),
+            CArrayViewBuffer(self, <uintptr_t>y, 8, n_coords, 'd', stride),
+        )
+
 
 cdef class CArrayViewBuffer:
     cdef object _base
     cdef void* _ptr
     cdef Py_ssize_t _item_size
     cdef Py_ssize_t _shape
+    cdef Py_ssize_t _stride
     cdef str _format
 
-    def __cinit__(self, base, uintptr_t ptr, item_size_bytes, length_elements, format):
+    def __cinit__(self, base, uintptr_t ptr, item_size_bytes, length_elements, format,
+                  stride_bytes=None):
         self._base = base
         self._ptr = <void*>ptr
         self._item_size = item_size_bytes
         self._shape = length_elements
+        if stride_bytes is None:
+            self._stride = item_size_bytes
+        else:
+            self._stride = stride_bytes
         self._format = format
 
     def __getbuffer__(self, Py_buffer *buffer, int flags):
+        if self._stride != self._item_size and (flags & PyBUF_STRIDES) != PyBUF_STRIDES:
+            raise BufferError("CArrayViewBuffer is not contiguous")
+
         buffer.buf = self._ptr
 
         if self._format == 'i':
             buffer.format = 'i'
         elif self._format == 'd':
             buffer.format = 'd'
+        elif self._format == 'f':
+            buffer.format = 'f'
         else:
             buffer.format = NULL
 
@@ -646,7 +1072,7 @@ cdef class CArrayViewBuffer:
         buffer.obj = self
         buffer.readonly = 1
         buffer.shape = &self._shape
-        buffer.strides = &self._item_size
+        buffer.strides = &self._stride
         buffer.suboffsets = NULL
 
     def __releasebuffer__(self, Py_buffer *buffer):
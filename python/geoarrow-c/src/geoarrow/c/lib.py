@@ -3,6 +3,7 @@ from ._lib import (
     CKernel,
     SchemaHolder,
     ArrayHolder,
+    ArrayStreamHolder,
     CGeometryDataType,
     CArrayView,
     CBuilder,
@@ -86,6 +87,14 @@ class CoordType:
     #: Coordinate type compose of a single array containing all dimensions
     #:(i.e., a fixed-size list)
     INTERLEAVED = _lib.GEOARROW_COORD_TYPE_INTERLEAVED
+    #: Like SEPARATE but with float (32-bit) ordinate storage
+    SEPARATE_FLOAT = _lib.GEOARROW_COORD_TYPE_SEPARATE_FLOAT
+    #: Like INTERLEAVED but with float (32-bit) ordinate storage
+    INTERLEAVED_FLOAT = _lib.GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT
+    #: Like SEPARATE but with quantized int32 ordinate storage
+    SEPARATE_INT32 = _lib.GEOARROW_COORD_TYPE_SEPARATE_INT32
+    #: Like INTERLEAVED but with quantized int32 ordinate storage
+    INTERLEAVED_INT32 = _lib.GEOARROW_COORD_TYPE_INTERLEAVED_INT32
 
 
 class EdgeType:
@@ -184,6 +184,75 @@ def test_kernel_void_agg():
     assert array_out_pa == pa.array([None], pa.null())
 
 
+def test_kernel_statistics():
+    kernel = lib.CKernel(b"void")
+    with pytest.raises(lib.GeoArrowCException):
+        kernel.statistics()
+
+    kernel.enable_statistics()
+    with pytest.raises(lib.GeoArrowCException):
+        kernel.enable_statistics()
+
+    schema_in = lib.SchemaHolder()
+    pa.int32()._export_to_c(schema_in._addr())
+    kernel.start(schema_in, b"")
+
+    array_in = lib.ArrayHolder()
+    pa.array([1, None, 3], pa.int32())._export_to_c(array_in._addr())
+    kernel.push_batch(array_in)
+    kernel.push_batch(array_in)
+
+    stats = kernel.statistics()
+    assert stats["num_batches"] == 2
+    assert stats["num_features"] == 6
+    assert stats["num_null_features"] == 2
+    assert stats["push_batch_ns"] >= 0
+
+
+def test_kernel_execute_stream():
+    if not hasattr(pa.ChunkedArray, "__arrow_c_stream__"):
+        pytest.skip("ChunkedArray.__arrow_c_stream__ requires pyarrow >= 14")
+
+    chunked_in = pa.chunked_array([pa.array([1, 2, 3]), pa.array([4, 5])])
+
+    kernel = lib.CKernel(b"void")
+    stream_out = kernel.execute_stream(chunked_in, b"")
+    assert isinstance(stream_out, lib.ArrayStreamHolder)
+    chunked_out = pa.chunked_array(stream_out)
+    assert chunked_out.type == pa.null()
+    assert [len(chunk) for chunk in chunked_out.chunks] == [3, 2]
+
+    # The kernel is owned by the stream after execute_stream()
+    with pytest.raises(ValueError):
+        kernel.push_batch(lib.ArrayHolder())
+
+    kernel = lib.CKernel(b"void_agg")
+    stream_out = kernel.execute_stream(chunked_in.__arrow_c_stream__(), b"")
+    chunked_out = pa.chunked_array(stream_out)
+    assert [len(chunk) for chunk in chunked_out.chunks] == [1]
+
+    # Statistics would be lost with the kernel, so this is an error that leaves
+    # both the kernel and the input untouched
+    kernel = lib.CKernel(b"void")
+    kernel.enable_statistics()
+    with pytest.raises(ValueError, match="does not support statistics"):
+        kernel.execute_stream(chunked_in, b"")
+    assert kernel.statistics()["num_batches"] == 0
+
+
+def test_kernel_execute_stream_error():
+    if not hasattr(pa.ChunkedArray, "__arrow_c_stream__"):
+        pytest.skip("ChunkedArray.__arrow_c_stream__ requires pyarrow >= 14")
+
+    kernel = lib.CKernel(b"as_geoarrow")
+    chunked_in = pa.chunked_array([pa.array([1, 2, 3])])
+    with pytest.raises(lib.GeoArrowCException):
+        kernel.execute_stream(chunked_in, b"")
+
+    # Invalid options don't release the kernel
+    kernel._assert_valid()
+
+
 def test_kernel_init_error():
     with pytest.raises(lib.GeoArrowCException):
         lib.CKernel(b"not_a_kernel")
@@ -195,6 +264,125 @@ def test_kernel_init_error():
         lib.CKernel(None)
 
 
+def make_c_array_view(geometry_type, coord_type, storage):
+    type_obj = lib.CGeometryDataType.Make(geometry_type, ga.Dimensions.XY, coord_type)
+    array = lib.ArrayHolder()
+    storage._export_to_c(array._addr())
+    return lib.CArrayView(array, type_obj.to_schema())
+
+
+def test_c_array_view_point():
+    storage = pa.array(
+        [{"x": 0.0, "y": 1.0}, {"x": 2.0, "y": 3.0}, {"x": 4.0, "y": 5.0}],
+        pa.struct([pa.field("x", pa.float64()), pa.field("y", pa.float64())]),
+    )
+    array_view = make_c_array_view(
+        ga.GeometryType.POINT, ga.CoordType.SEPARATE, storage[1:]
+    )
+    x, y = array_view.coords_xy()
+    np.testing.assert_array_equal(np.asarray(x), [2.0, 4.0])
+    np.testing.assert_array_equal(np.asarray(y), [3.0, 5.0])
+
+    with pytest.raises(ValueError):
+        array_view.geometry_offsets()
+
+
+def test_c_array_view_point_float():
+    storage = pa.array(
+        [{"x": 0.0, "y": 1.0}, {"x": 2.0, "y": 3.0}, {"x": 4.5, "y": 5.0}],
+        pa.struct([pa.field("x", pa.float32()), pa.field("y", pa.float32())]),
+    )
+    array_view = make_c_array_view(
+        ga.GeometryType.POINT, ga.CoordType.SEPARATE_FLOAT, storage[1:]
+    )
+    x, y = array_view.coords_xy()
+    x = np.asarray(x)
+    assert x.dtype == np.float32
+    np.testing.assert_array_equal(x, [2.0, 4.5])
+    np.testing.assert_array_equal(np.asarray(y), [3.0, 5.0])
+
+
+def test_c_array_view_point_int32():
+    storage = pa.array(
+        [{"x": 0, "y": 1}, {"x": 2, "y": 3}, {"x": -4, "y": 5}],
+        pa.struct([pa.field("x", pa.int32()), pa.field("y", pa.int32())]),
+    )
+    array_view = make_c_array_view(
+        ga.GeometryType.POINT, ga.CoordType.SEPARATE_INT32, storage[1:]
+    )
+    x, y = array_view.coords_xy()
+    x = np.asarray(x)
+    assert x.dtype == np.int32
+    np.testing.assert_array_equal(x, [2, -4])
+    np.testing.assert_array_equal(np.asarray(y), [3, 5])
+
+
+def test_c_array_view_linestring_interleaved():
+    storage = pa.array(
+        [[[0.0, 1.0], [2.0, 3.0]], [[4.0, 5.0], [6.0, 7.0], [8.0, 9.0]]],
+        pa.list_(pa.list_(pa.float64(), 2)),
+    )
+    storage = storage.cast(
+        pa.list_(pa.field("vertices", pa.list_(pa.field("xy", pa.float64()), 2)))
+    )
+    array_view = make_c_array_view(
+        ga.GeometryType.LINESTRING, ga.CoordType.INTERLEAVED, storage[1:]
+    )
+
+    geometry_offsets = np.asarray(array_view.geometry_offsets())
+    np.testing.assert_array_equal(geometry_offsets, [2, 5])
+
+    x, y = array_view.coords_xy()
+    x = np.asarray(x)
+    y = np.asarray(y)
+    assert x.strides == (16,)
+    np.testing.assert_array_equal(x[geometry_offsets[0] :], [4.0, 6.0, 8.0])
+    np.testing.assert_array_equal(y[geometry_offsets[0] :], [5.0, 7.0, 9.0])
+
+    with pytest.raises(ValueError):
+        array_view.part_offsets()
+
+    with pytest.raises(ValueError):
+        array_view.ring_offsets()
+
+
+def test_c_array_view_multipolygon():
+    coord = pa.struct(
+        [
+            pa.field("x", pa.float64(), nullable=False),
+            pa.field("y", pa.float64(), nullable=False),
+        ]
+    )
+    storage_type = pa.list_(
+        pa.field(
+            "polygons",
+            pa.list_(
+                pa.field(
+                    "rings",
+                    pa.list_(pa.field("vertices", coord, nullable=False)),
+                    nullable=False,
+                )
+            ),
+            nullable=False,
+        )
+    )
+    ring = [{"x": 0.0, "y": 0.0}, {"x": 1.0, "y": 0.0}, {"x": 0.0, "y": 0.0}]
+    storage = pa.array([[[ring]], [[ring], [ring, ring]]], storage_type)
+
+    array_view = make_c_array_view(
+        ga.GeometryType.MULTIPOLYGON, ga.CoordType.SEPARATE, storage[1:]
+    )
+    np.testing.assert_array_equal(np.asarray(array_view.geometry_offsets()), [1, 3])
+    np.testing.assert_array_equal(np.asarray(array_view.part_offsets()), [0, 1, 2, 4])
+    np.testing.assert_array_equal(
+        np.asarray(array_view.ring_offsets()), [0, 3, 6, 9, 12]
+    )
+
+    x, y = array_view.coords_xy()
+    assert len(np.asarray(x)) == 12
+    np.testing.assert_array_equal(np.asarray(y), [0.0, 0.0, 0.0] * 4)
+
+
 def test_builder():
     type_obj = lib.CGeometryDataType.Make(
         lib.GeometryType.LINESTRING, ga.Dimensions.XY, ga.CoordType.SEPARATE
@@ -13,8 +13,120 @@ struct GeoArrowArrayReaderPrivate {
   union GeoArrowArrayReaderSrc src;
   struct GeoArrowWKTReader wkt_reader;
   struct GeoArrowWKBReader wkb_reader;
+  struct GeoArrowStatistics* stats;
+  struct GeoArrowVisitor* stats_v;
 };
 
+// A visitor that counts features and coordinates into a GeoArrowStatistics before
+// forwarding each call to the visitor that was passed to GeoArrowArrayReaderVisit().
+// This is only used when statistics were requested.
+static int feat_start_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  private_data->stats->num_features++;
+  return private_data->stats_v->feat_start(private_data->stats_v);
+}
+
+static int null_feat_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  private_data->stats->num_null_features++;
+  return private_data->stats_v->null_feat(private_data->stats_v);
+}
+
+static int geom_start_stats(struct GeoArrowVisitor* v,
+                            enum GeoArrowGeometryType geometry_type,
+                            enum GeoArrowDimensions dimensions) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  return private_data->stats_v->geom_start(private_data->stats_v, geometry_type,
+                                           dimensions);
+}
+
+static int ring_start_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  return private_data->stats_v->ring_start(private_data->stats_v);
+}
+
+static int coords_stats(struct GeoArrowVisitor* v,
+                        const struct GeoArrowCoordView* coords) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  private_data->stats->num_coords += coords->n_coords;
+  return private_data->stats_v->coords(private_data->stats_v, coords);
+}
+
+static int ring_end_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  return private_data->stats_v->ring_end(private_data->stats_v);
+}
+
+static int geom_end_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  return private_data->stats_v->geom_end(private_data->stats_v);
+}
+
+static int feat_end_stats(struct GeoArrowVisitor* v) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)v->private_data;
+  return private_data->stats_v->feat_end(private_data->stats_v);
+}
+
+static void GeoArrowArrayReaderInitStatisticsVisitor(
+    struct GeoArrowArrayReaderPrivate* private_data, struct GeoArrowVisitor* v,
+    struct GeoArrowVisitor* out) {
+  private_data->stats_v = v;
+  out->private_data = private_data;
+  out->error = v->error;
+  out->feat_start = &feat_start_stats;
+  out->null_feat = &null_feat_stats;
+  out->geom_start = &geom_start_stats;
+  out->ring_start = &ring_start_stats;
+  out->coords = &coords_stats;
+  out->ring_end = &ring_end_stats;
+  out->geom_end = &geom_end_stats;
+  out->feat_end = &feat_end_stats;
+}
+
+static int64_t GeoArrowArrayViewBytes(const struct GeoArrowArrayView* array_view) {
+  int64_t bytes = 0;
+  if (array_view->validity_bitmap != NULL) {
+    bytes += _ArrowBytesForBits(array_view->length[0]);
+  }
+
+  for (int32_t i = 0; i < array_view->n_offsets; i++) {
+    bytes += (array_view->length[i] + 1) * (int64_t)sizeof(int32_t);
+  }
+
+  if (array_view->data != NULL) {
+    if (array_view->length[0] > 0) {
+      const int32_t* offsets = array_view->offsets[0] + array_view->offset[0];
+      bytes += offsets[array_view->length[0]] - offsets[0];
+    }
+  } else {
+    bytes += array_view->length[array_view->n_offsets] * array_view->coords.n_values *
+             GeoArrowCoordTypeOrdinateSize(array_view->schema_view.coord_type);
+  }
+
+  return bytes;
+}
+
+static int64_t GeoArrowArrowArrayViewBytes(const struct ArrowArrayView* array_view) {
+  int64_t bytes = 0;
+  for (int i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    bytes += array_view->buffer_views[i].size_bytes;
+  }
+
+  for (int32_t i = 0; i < array_view->n_variadic_buffers; i++) {
+    bytes += array_view->variadic_buffer_sizes[i];
+  }
+
+  return bytes;
+}
+
 static GeoArrowErrorCode GeoArrowArrayReaderVisitWKT(
     const struct GeoArrowArrayView* array_view, int64_t offset, int64_t length,
     struct GeoArrowWKTReader* reader, struct GeoArrowVisitor* v) {
@@ -191,6 +303,19 @@ GeoArrowErrorCode GeoArrowArrayReaderInitFromSchema(struct GeoArrowArrayReader*
     return result;
   }
 
+  // Quantized coordinates are decoded using the scale and offset in the metadata
+  if (GeoArrowCoordTypeIsQuantized(schema_view.coord_type)) {
+    struct GeoArrowMetadataView metadata_view;
+    result = GeoArrowMetadataViewInit(&metadata_view, schema_view.extension_metadata,
+                                      error);
+    if (result != GEOARROW_OK) {
+      ArrowFree(private_data);
+      return result;
+    }
+
+    private_data->src.geoarrow.quantization = metadata_view.quantization;
+  }
+
   reader->private_data = private_data;
   return GEOARROW_OK;
 }
@@ -227,16 +352,35 @@ GeoArrowErrorCode GeoArrowArrayReaderSetArray(struct GeoArrowArrayReader* reader
     case GEOARROW_TYPE_WKB_VIEW:
       GEOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(&private_data->src.arrow, array,
                                                     (struct ArrowError*)error));
+      if (private_data->stats != NULL) {
+        private_data->stats->bytes_read +=
+            GeoArrowArrowArrayViewBytes(&private_data->src.arrow);
+      }
       break;
     default:
       GEOARROW_RETURN_NOT_OK(
           GeoArrowArrayViewSetArray(&private_data->src.geoarrow, array, error));
+      if (private_data->stats != NULL) {
+        private_data->stats->bytes_read +=
+            GeoArrowArrayViewBytes(&private_data->src.geoarrow);
+      }
       break;
   }
 
+  if (private_data->stats != NULL) {
+    private_data->stats->num_batches++;
+  }
+
   return GEOARROW_OK;
 }
 
+void GeoArrowArrayReaderSetStatistics(struct GeoArrowArrayReader* reader,
+                                      struct GeoArrowStatistics* stats) {
+  struct GeoArrowArrayReaderPrivate* private_data =
+      (struct GeoArrowArrayReaderPrivate*)reader->private_data;
+  private_data->stats = stats;
+}
+
 GeoArrowErrorCode GeoArrowArrayReaderVisit(struct GeoArrowArrayReader* reader,
                                            int64_t offset, int64_t length,
                                            struct GeoArrowVisitor* v) {
@@ -247,6 +391,12 @@ GeoArrowErrorCode GeoArrowArrayReaderVisit(struct GeoArrowArrayReader* reader,
     return GEOARROW_OK;
   }
 
+  struct GeoArrowVisitor stats_v;
+  if (private_data->stats != NULL) {
+    GeoArrowArrayReaderInitStatisticsVisitor(private_data, v, &stats_v);
+    v = &stats_v;
+  }
+
   switch (private_data->type) {
     case GEOARROW_TYPE_WKT:
       return GeoArrowArrayReaderVisitWKT(&private_data->src.geoarrow, offset, length,
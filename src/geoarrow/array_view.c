@@ -63,7 +63,7 @@ static int GeoArrowArrayViewInitInternal(struct GeoArrowArrayView* array_view) {
     array_view->coords.n_values *= 2;
   }
 
-  switch (array_view->schema_view.coord_type) {
+  switch (GeoArrowCoordTypeLayout(array_view->schema_view.coord_type)) {
     case GEOARROW_COORD_TYPE_SEPARATE:
       array_view->coords.coords_stride = 1;
       break;
@@ -76,6 +76,14 @@ static int GeoArrowArrayViewInitInternal(struct GeoArrowArrayView* array_view) {
       break;
   }
 
+  array_view->coords_float.n_coords = 0;
+  array_view->coords_float.n_values = array_view->coords.n_values;
+  array_view->coords_float.coords_stride = array_view->coords.coords_stride;
+  array_view->coords_int32.n_coords = 0;
+  array_view->coords_int32.n_values = array_view->coords.n_values;
+  array_view->coords_int32.coords_stride = array_view->coords.coords_stride;
+  GeoArrowQuantizationInitDefault(&array_view->quantization);
+
   return GEOARROW_OK;
 }
 
@@ -92,7 +100,18 @@ GeoArrowErrorCode GeoArrowArrayViewInitFromSchema(struct GeoArrowArrayView* arra
   memset(array_view, 0, sizeof(struct GeoArrowArrayView));
   NANOARROW_RETURN_NOT_OK(
       GeoArrowSchemaViewInit(&array_view->schema_view, schema, error));
-  return GeoArrowArrayViewInitInternal(array_view);
+  NANOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitInternal(array_view));
+
+  // Quantized coordinates can't be decoded without the scale and offset from
+  // the extension metadata
+  if (GeoArrowCoordTypeIsQuantized(array_view->schema_view.coord_type)) {
+    struct GeoArrowMetadataView metadata_view;
+    NANOARROW_RETURN_NOT_OK(GeoArrowMetadataViewInit(
+        &metadata_view, array_view->schema_view.extension_metadata, error));
+    array_view->quantization = metadata_view.quantization;
+  }
+
+  return GEOARROW_OK;
 }
 
 static int GeoArrowArrayViewSetArrayInternal(struct GeoArrowArrayView* array_view,
@@ -113,7 +132,12 @@ static int GeoArrowArrayViewSetArrayInternal(struct GeoArrowArrayView* array_vie
       array_view->coords.n_coords = array->length;
     }
 
-    switch (array_view->schema_view.coord_type) {
+    array_view->coords_float.n_coords = array_view->coords.n_coords;
+    array_view->coords_int32.n_coords = array_view->coords.n_coords;
+    int is_float = GeoArrowCoordTypeIsFloat(array_view->schema_view.coord_type);
+    int is_int32 = GeoArrowCoordTypeIsQuantized(array_view->schema_view.coord_type);
+
+    switch (GeoArrowCoordTypeLayout(array_view->schema_view.coord_type)) {
       case GEOARROW_COORD_TYPE_SEPARATE:
         if (array->n_children != array_view->coords.n_values) {
           GeoArrowErrorSet(error,
@@ -133,8 +157,21 @@ static int GeoArrowArrayViewSetArrayInternal(struct GeoArrowArrayView* array_vie
             return EINVAL;
           }
 
-          array_view->coords.values[i] = ((const double*)array->children[i]->buffers[1]) +
-                                         array->children[i]->offset;
+          if (is_float) {
+            array_view->coords.values[i] = NULL;
+            array_view->coords_float.values[i] =
+                ((const float*)array->children[i]->buffers[1]) +
+                array->children[i]->offset;
+          } else if (is_int32) {
+            array_view->coords.values[i] = NULL;
+            array_view->coords_int32.values[i] =
+                ((const int32_t*)array->children[i]->buffers[1]) +
+                array->children[i]->offset;
+          } else {
+            array_view->coords.values[i] =
+                ((const double*)array->children[i]->buffers[1]) +
+                array->children[i]->offset;
+          }
         }
 
         break;
@@ -156,11 +193,23 @@ static int GeoArrowArrayViewSetArrayInternal(struct GeoArrowArrayView* array_vie
           return EINVAL;
         }
 
-        // Set the coord pointers to the first four doubles in the data buffers
-
+        // Set the coord pointers to the first four values in the data buffers
         for (int32_t i = 0; i < array_view->coords.n_values; i++) {
-          array_view->coords.values[i] = ((const double*)array->children[0]->buffers[1]) +
-                                         array->children[0]->offset + i;
+          if (is_float) {
+            array_view->coords.values[i] = NULL;
+            array_view->coords_float.values[i] =
+                ((const float*)array->children[0]->buffers[1]) +
+                array->children[0]->offset + i;
+          } else if (is_int32) {
+            array_view->coords.values[i] = NULL;
+            array_view->coords_int32.values[i] =
+                ((const int32_t*)array->children[0]->buffers[1]) +
+                array->children[0]->offset + i;
+          } else {
+            array_view->coords.values[i] =
+                ((const double*)array->children[0]->buffers[1]) +
+                array->children[0]->offset + i;
+          }
         }
 
         break;
@@ -277,6 +326,61 @@ static inline void GeoArrowCoordViewUpdate(const struct GeoArrowCoordView* src,
   dst->n_coords = length;
 }
 
+// Visitors only accept double coordinates, so float and quantized integer
+// coordinates are decoded in chunks of this many coordinates
+#define GEOARROW_DECODE_COORD_CHUNK_SIZE 64
+
+static GeoArrowErrorCode GeoArrowArrayViewVisitCoords(
+    const struct GeoArrowArrayView* array_view, int64_t offset, int64_t n_coords,
+    struct GeoArrowCoordView* coords, struct GeoArrowVisitor* v) {
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  int is_float = GeoArrowCoordTypeIsFloat(coord_type);
+  int is_int32 = GeoArrowCoordTypeIsQuantized(coord_type);
+  if (!is_float && !is_int32) {
+    GeoArrowCoordViewUpdate(&array_view->coords, coords, offset, n_coords);
+    return v->coords(v, coords);
+  }
+
+  int32_t n_values = array_view->coords.n_values;
+  double values[GEOARROW_DECODE_COORD_CHUNK_SIZE * 8];
+
+  struct GeoArrowCoordView chunk;
+  chunk.n_values = n_values;
+  chunk.coords_stride = n_values;
+  for (int32_t j = 0; j < n_values; j++) {
+    chunk.values[j] = values + j;
+  }
+
+  for (int64_t start = 0; start < n_coords; start += GEOARROW_DECODE_COORD_CHUNK_SIZE) {
+    chunk.n_coords = n_coords - start;
+    if (chunk.n_coords > GEOARROW_DECODE_COORD_CHUNK_SIZE) {
+      chunk.n_coords = GEOARROW_DECODE_COORD_CHUNK_SIZE;
+    }
+
+    if (is_float) {
+      const struct GeoArrowFloatCoordView* src = &array_view->coords_float;
+      for (int64_t i = 0; i < chunk.n_coords; i++) {
+        for (int32_t j = 0; j < n_values; j++) {
+          values[i * n_values + j] =
+              GEOARROW_COORD_VIEW_VALUE(src, offset + start + i, j);
+        }
+      }
+    } else {
+      const struct GeoArrowInt32CoordView* src = &array_view->coords_int32;
+      for (int32_t j = 0; j < n_values; j++) {
+        GeoArrowDequantizeOrdinates(&GEOARROW_COORD_VIEW_VALUE(src, offset + start, j),
+                                    src->coords_stride, values + j, n_values,
+                                    chunk.n_coords, array_view->quantization.scale[j],
+                                    array_view->quantization.offset[j]);
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(v->coords(v, &chunk));
+  }
+
+  return GEOARROW_OK;
+}
+
 static GeoArrowErrorCode GeoArrowArrayViewVisitNativePoint(
     const struct GeoArrowArrayView* array_view, int64_t offset, int64_t length,
     struct GeoArrowVisitor* v) {
@@ -288,19 +392,14 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativePoint(
         ArrowBitGet(array_view->validity_bitmap, array_view->offset[0] + offset + i)) {
       NANOARROW_RETURN_NOT_OK(v->geom_start(v, GEOARROW_GEOMETRY_TYPE_POINT,
                                             array_view->schema_view.dimensions));
-      GeoArrowCoordViewUpdate(&array_view->coords, &coords,
-                              array_view->offset[0] + offset + i, 1);
-      NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+      NANOARROW_RETURN_NOT_OK(GeoArrowArrayViewVisitCoords(
+          array_view, array_view->offset[0] + offset + i, 1, &coords, v));
       NANOARROW_RETURN_NOT_OK(v->geom_end(v));
     } else {
       NANOARROW_RETURN_NOT_OK(v->null_feat(v));
     }
 
     NANOARROW_RETURN_NOT_OK(v->feat_end(v));
-
-    for (int j = 0; j < coords.n_values; j++) {
-      coords.values[j] += coords.coords_stride;
-    }
   }
 
   return GEOARROW_OK;
@@ -323,8 +422,8 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativeLinestring(
       n_coords =
           array_view->offsets[0][array_view->offset[0] + offset + i + 1] - coord_offset;
       coord_offset += array_view->offset[1];
-      GeoArrowCoordViewUpdate(&array_view->coords, &coords, coord_offset, n_coords);
-      NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowArrayViewVisitCoords(array_view, coord_offset, n_coords, &coords, v));
       NANOARROW_RETURN_NOT_OK(v->geom_end(v));
     } else {
       NANOARROW_RETURN_NOT_OK(v->null_feat(v));
@@ -361,8 +460,8 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativePolygon(
         coord_offset = array_view->offsets[1][ring_offset + j];
         n_coords = array_view->offsets[1][ring_offset + j + 1] - coord_offset;
         coord_offset += array_view->offset[2];
-        GeoArrowCoordViewUpdate(&array_view->coords, &coords, coord_offset, n_coords);
-        NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+        NANOARROW_RETURN_NOT_OK(
+            GeoArrowArrayViewVisitCoords(array_view, coord_offset, n_coords, &coords, v));
         NANOARROW_RETURN_NOT_OK(v->ring_end(v));
       }
 
@@ -397,8 +496,8 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativeMultipoint(
       for (int64_t j = 0; j < n_coords; j++) {
         NANOARROW_RETURN_NOT_OK(v->geom_start(v, GEOARROW_GEOMETRY_TYPE_POINT,
                                               array_view->schema_view.dimensions));
-        GeoArrowCoordViewUpdate(&array_view->coords, &coords, coord_offset + j, 1);
-        NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+        NANOARROW_RETURN_NOT_OK(
+            GeoArrowArrayViewVisitCoords(array_view, coord_offset + j, 1, &coords, v));
         NANOARROW_RETURN_NOT_OK(v->geom_end(v));
       }
       NANOARROW_RETURN_NOT_OK(v->geom_end(v));
@@ -438,8 +537,8 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativeMultilinestring(
         coord_offset = array_view->offsets[1][linestring_offset + j];
         n_coords = array_view->offsets[1][linestring_offset + j + 1] - coord_offset;
         coord_offset += array_view->offset[2];
-        GeoArrowCoordViewUpdate(&array_view->coords, &coords, coord_offset, n_coords);
-        NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+        NANOARROW_RETURN_NOT_OK(
+            GeoArrowArrayViewVisitCoords(array_view, coord_offset, n_coords, &coords, v));
         NANOARROW_RETURN_NOT_OK(v->geom_end(v));
       }
 
@@ -490,8 +589,8 @@ static GeoArrowErrorCode GeoArrowArrayViewVisitNativeMultipolygon(
           coord_offset = array_view->offsets[2][ring_offset + k];
           n_coords = array_view->offsets[2][ring_offset + k + 1] - coord_offset;
           coord_offset += array_view->offset[3];
-          GeoArrowCoordViewUpdate(&array_view->coords, &coords, coord_offset, n_coords);
-          NANOARROW_RETURN_NOT_OK(v->coords(v, &coords));
+          NANOARROW_RETURN_NOT_OK(GeoArrowArrayViewVisitCoords(
+              array_view, coord_offset, n_coords, &coords, v));
           NANOARROW_RETURN_NOT_OK(v->ring_end(v));
         }
 
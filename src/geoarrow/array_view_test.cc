@@ -39,12 +39,16 @@ TEST_P(TypeParameterizedTestFixture, ArrayViewTestInitType) {
               kNumDimensions[array_view.schema_view.dimensions]);
   }
 
-  if (array_view.schema_view.coord_type == GEOARROW_COORD_TYPE_SEPARATE) {
+  if (GeoArrowCoordTypeLayout(array_view.schema_view.coord_type) ==
+      GEOARROW_COORD_TYPE_SEPARATE) {
     EXPECT_EQ(array_view.coords.coords_stride, 1);
   } else {
     EXPECT_EQ(array_view.coords.coords_stride,
               kNumDimensions[array_view.schema_view.dimensions]);
   }
+
+  EXPECT_EQ(array_view.coords_float.n_values, array_view.coords.n_values);
+  EXPECT_EQ(array_view.coords_float.coords_stride, array_view.coords.coords_stride);
 }
 
 TEST_P(TypeParameterizedTestFixture, ArrayViewTestInitSchema) {
@@ -111,7 +115,12 @@ INSTANTIATE_TEST_SUITE_P(
         GEOARROW_TYPE_INTERLEAVED_LINESTRING_ZM, GEOARROW_TYPE_INTERLEAVED_POLYGON_ZM,
         GEOARROW_TYPE_INTERLEAVED_MULTIPOINT_ZM,
         GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM,
-        GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM));
+        GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM,
+
+        GEOARROW_TYPE_FLOAT_POINT, GEOARROW_TYPE_FLOAT_LINESTRING_Z,
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON_ZM, GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_ZM));
 
 TEST(ArrayViewTest, ArrayViewTestSetArrayErrors) {
   struct GeoArrowArrayView array_view;
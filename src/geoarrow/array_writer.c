@@ -9,6 +9,8 @@ struct GeoArrowArrayWriterPrivate {
   struct GeoArrowNativeWriter native_writer;
   struct GeoArrowWKTWriter wkt_writer;
   struct GeoArrowWKBWriter wkb_writer;
+  // Used to count the elements of WKB input in GeoArrowArrayWriterReserve()
+  struct GeoArrowWKBReader wkb_reader;
   enum GeoArrowType type;
 };
 
@@ -56,7 +58,21 @@ GeoArrowErrorCode GeoArrowArrayWriterInitFromSchema(struct GeoArrowArrayWriter*
                                                     const struct ArrowSchema* schema) {
   struct GeoArrowSchemaView schema_view;
   NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, NULL));
-  return GeoArrowArrayWriterInitFromType(writer, schema_view.type);
+  if (!GeoArrowCoordTypeIsQuantized(schema_view.coord_type)) {
+    return GeoArrowArrayWriterInitFromType(writer, schema_view.type);
+  }
+
+  // Quantized coordinates are encoded using the scale and offset in the metadata
+  struct GeoArrowMetadataView metadata_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowMetadataViewInit(&metadata_view, schema_view.extension_metadata, NULL));
+  NANOARROW_RETURN_NOT_OK(GeoArrowArrayWriterInitFromType(writer, schema_view.type));
+
+  struct GeoArrowArrayWriterPrivate* private_data =
+      (struct GeoArrowArrayWriterPrivate*)writer->private_data;
+  GeoArrowNativeWriterSetQuantization(&private_data->native_writer,
+                                      &metadata_view.quantization);
+  return GEOARROW_OK;
 }
 
 GeoArrowErrorCode GeoArrowArrayWriterSetPrecision(struct GeoArrowArrayWriter* writer,
@@ -87,6 +103,179 @@ GeoArrowErrorCode GeoArrowArrayWriterSetFlatMultipoint(struct GeoArrowArrayWrite
   return GEOARROW_OK;
 }
 
+void GeoArrowArrayWriterSetStatistics(struct GeoArrowArrayWriter* writer,
+                                      struct GeoArrowStatistics* stats) {
+  struct GeoArrowArrayWriterPrivate* private_data =
+      (struct GeoArrowArrayWriterPrivate*)writer->private_data;
+
+  switch (private_data->type) {
+    case GEOARROW_TYPE_WKT:
+      GeoArrowWKTWriterSetStatistics(&private_data->wkt_writer, stats);
+      break;
+    case GEOARROW_TYPE_WKB:
+      GeoArrowWKBWriterSetStatistics(&private_data->wkb_writer, stats);
+      break;
+    default:
+      GeoArrowNativeWriterSetStatistics(&private_data->native_writer, stats);
+      break;
+  }
+}
+
+// Counts the features, parts, rings, and coordinates (see
+// GeoArrowNativeWriterReserve()) of native features from their offsets
+static GeoArrowErrorCode GeoArrowArrayWriterCountNative(
+    const struct GeoArrowArrayView* array_view, int64_t offset, int64_t length,
+    int64_t* counts) {
+  // n[0] is the number of features and n[level + 1] is the number of children at
+  // the next level of nesting
+  int64_t n[4] = {length, 0, 0, 0};
+  int64_t start = array_view->offset[0] + offset;
+  int64_t end = start + length;
+  for (int32_t level = 0; level < array_view->n_offsets; level++) {
+    const int32_t* offsets = array_view->offsets[level];
+    n[level + 1] = (int64_t)offsets[end] - offsets[start];
+    int64_t next_start = offsets[start] + array_view->offset[level + 1];
+    end = offsets[end] + array_view->offset[level + 1];
+    start = next_start;
+  }
+
+  counts[0] = length;
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      counts[1] = n[0];
+      counts[3] = n[0];
+      break;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      counts[1] = n[0];
+      counts[3] = n[1];
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      counts[1] = n[0];
+      counts[2] = n[1];
+      counts[3] = n[2];
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      counts[1] = n[1];
+      counts[3] = n[1];
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      counts[1] = n[1];
+      counts[3] = n[2];
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      counts[1] = n[1];
+      counts[2] = n[2];
+      counts[3] = n[3];
+      break;
+    default:
+      return ENOTSUP;
+  }
+
+  return GEOARROW_OK;
+}
+
+// Counts the features, parts, rings, and coordinates of WKB features by reading
+// their headers (i.e., without decoding coordinates)
+static GeoArrowErrorCode GeoArrowArrayWriterCountWKB(
+    struct GeoArrowWKBReader* reader, const struct GeoArrowArrayView* array_view,
+    int64_t offset, int64_t length, int64_t* counts) {
+  struct GeoArrowBufferView value;
+  struct GeoArrowWKBSummary summary;
+
+  counts[0] = length;
+  for (int64_t i = array_view->offset[0] + offset;
+       i < (array_view->offset[0] + offset + length); i++) {
+    if (array_view->validity_bitmap != NULL &&
+        !ArrowBitGet(array_view->validity_bitmap, i)) {
+      continue;
+    }
+
+    value.data = array_view->data + array_view->offsets[0][i];
+    value.size_bytes = array_view->offsets[0][i + 1] - array_view->offsets[0][i];
+    GEOARROW_RETURN_NOT_OK(GeoArrowWKBReaderScan(reader, value, &summary, NULL));
+
+    switch (summary.geometry_type) {
+      case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+        counts[1] += summary.size;
+        break;
+      default:
+        counts[1]++;
+        break;
+    }
+
+    counts[2] += summary.num_rings;
+    counts[3] += summary.num_coords;
+  }
+
+  return GEOARROW_OK;
+}
+
+static GeoArrowErrorCode GeoArrowArrayWriterReserveNative(
+    struct GeoArrowArrayWriterPrivate* private_data,
+    const struct GeoArrowArrayView* array_view, int64_t offset, int64_t length) {
+  int64_t counts[4] = {0, 0, 0, 0};
+  int result;
+
+  // Points only need the number of features
+  if (GeoArrowGeometryTypeFromType(private_data->type) == GEOARROW_GEOMETRY_TYPE_POINT) {
+    return GeoArrowNativeWriterReserve(&private_data->native_writer, length, 0, 0, 0);
+  }
+
+  switch (array_view->schema_view.type) {
+    case GEOARROW_TYPE_WKB:
+      if (private_data->wkb_reader.private_data == NULL) {
+        GEOARROW_RETURN_NOT_OK(GeoArrowWKBReaderInit(&private_data->wkb_reader));
+      }
+
+      result = GeoArrowArrayWriterCountWKB(&private_data->wkb_reader, array_view, offset,
+                                           length, counts);
+      break;
+    case GEOARROW_TYPE_WKT:
+    case GEOARROW_TYPE_LARGE_WKT:
+    case GEOARROW_TYPE_LARGE_WKB:
+    case GEOARROW_TYPE_WKT_VIEW:
+    case GEOARROW_TYPE_WKB_VIEW:
+      return GEOARROW_OK;
+    default:
+      result = GeoArrowArrayWriterCountNative(array_view, offset, length, counts);
+      break;
+  }
+
+  // Input that can't be counted (e.g., invalid WKB) is reported when it is visited
+  if (result != GEOARROW_OK) {
+    return GEOARROW_OK;
+  }
+
+  return GeoArrowNativeWriterReserve(&private_data->native_writer, counts[0], counts[1],
+                                     counts[2], counts[3]);
+}
+
+GeoArrowErrorCode GeoArrowArrayWriterReserve(struct GeoArrowArrayWriter* writer,
+                                             const struct GeoArrowArrayView* array_view,
+                                             int64_t offset, int64_t length) {
+  struct GeoArrowArrayWriterPrivate* private_data =
+      (struct GeoArrowArrayWriterPrivate*)writer->private_data;
+
+  int64_t size_bytes;
+  int result;
+  switch (private_data->type) {
+    case GEOARROW_TYPE_WKT:
+      return GEOARROW_OK;
+    case GEOARROW_TYPE_WKB:
+      result = GeoArrowArrayViewWKBSize(array_view, offset, length, &size_bytes);
+      if (result == ENOTSUP) {
+        return GEOARROW_OK;
+      }
+
+      NANOARROW_RETURN_NOT_OK(result);
+      return GeoArrowWKBWriterReserve(&private_data->wkb_writer, length, size_bytes);
+    default:
+      return GeoArrowArrayWriterReserveNative(private_data, array_view, offset, length);
+  }
+}
+
 GeoArrowErrorCode GeoArrowArrayWriterInitVisitor(struct GeoArrowArrayWriter* writer,
                                                  struct GeoArrowVisitor* v) {
   struct GeoArrowArrayWriterPrivate* private_data =
@@ -136,6 +325,10 @@ void GeoArrowArrayWriterReset(struct GeoArrowArrayWriter* writer) {
     GeoArrowNativeWriterReset(&private_data->native_writer);
   }
 
+  if (private_data->wkb_reader.private_data != NULL) {
+    GeoArrowWKBReaderReset(&private_data->wkb_reader);
+  }
+
   ArrowFree(private_data);
   writer->private_data = NULL;
 }
@@ -1,5 +1,8 @@
 
 #include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -113,3 +116,117 @@ TEST(ArrayWriterTest, ArrayWriterTestGeoArrow) {
   array.release(&array);
   GeoArrowArrayWriterReset(&writer);
 }
+
+TEST(ArrayWriterTest, ArrayWriterTestReserve) {
+  std::vector<std::string> polygons = {
+      "POLYGON ((0 0, 1 0, 0 1, 0 0))", "", "POLYGON EMPTY",
+      "POLYGON ((0 0, 1 0, 0 1, 0 0), (0 0, 1 0, 0 1, 0 0))"};
+  std::vector<std::string> multipolygons = {
+      "MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)), ((0 0, 1 0, 0 1, 0 0), "
+      "(0 0, 1 0, 0 1, 0 0)))",
+      "", "MULTIPOLYGON EMPTY", "MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))"};
+  std::vector<std::string> linestrings = {"LINESTRING (0 1, 2 3)", "",
+                                          "LINESTRING (0 1, 2 3, 4 5)"};
+  std::vector<std::string> points = {"POINT (0 1)", "", "POINT EMPTY"};
+
+  struct Case {
+    enum GeoArrowType in_type;
+    enum GeoArrowType out_type;
+    std::vector<std::string> wkt;
+  };
+
+  std::vector<Case> cases = {
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_POLYGON, polygons},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_MULTIPOLYGON, polygons},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_MULTIPOLYGON, multipolygons},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_LINESTRING, linestrings},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_MULTILINESTRING, linestrings},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_MULTIPOINT, points},
+      {GEOARROW_TYPE_WKB, GEOARROW_TYPE_POINT, points},
+      {GEOARROW_TYPE_POLYGON, GEOARROW_TYPE_MULTIPOLYGON, polygons},
+      {GEOARROW_TYPE_MULTIPOLYGON, GEOARROW_TYPE_MULTIPOLYGON_Z, multipolygons},
+      {GEOARROW_TYPE_LINESTRING, GEOARROW_TYPE_MULTILINESTRING, linestrings},
+      {GEOARROW_TYPE_POINT, GEOARROW_TYPE_MULTIPOINT, points},
+      {GEOARROW_TYPE_MULTIPOLYGON, GEOARROW_TYPE_WKB, multipolygons}};
+
+  for (const auto& item : cases) {
+    SCOPED_TRACE(std::to_string(item.in_type) + " -> " + std::to_string(item.out_type));
+
+    struct ArrowArray array;
+    ASSERT_NO_FATAL_FAILURE(MakeNativeArray(item.in_type, item.wkt, &array));
+
+    struct GeoArrowArrayReader reader;
+    const struct GeoArrowArrayView* array_view;
+    ASSERT_EQ(GeoArrowArrayReaderInitFromType(&reader, item.in_type), GEOARROW_OK);
+    ASSERT_EQ(GeoArrowArrayReaderSetArray(&reader, &array, nullptr), GEOARROW_OK);
+    ASSERT_EQ(GeoArrowArrayReaderArrayView(&reader, &array_view), GEOARROW_OK);
+
+    struct GeoArrowArrayWriter writer;
+    struct GeoArrowVisitor v;
+    struct GeoArrowStatistics stats;
+    memset(&stats, 0, sizeof(stats));
+    ASSERT_EQ(GeoArrowArrayWriterInitFromType(&writer, item.out_type), GEOARROW_OK);
+    GeoArrowArrayWriterSetStatistics(&writer, &stats);
+    ASSERT_EQ(GeoArrowArrayWriterInitVisitor(&writer, &v), GEOARROW_OK);
+
+    // Visiting reserved features should never reallocate the offset, coordinate, or
+    // data buffers (the WKB writer's validity bitmap is allocated on the first null)
+    int64_t length = array.length;
+    for (int64_t offset : {0, 1}) {
+      ASSERT_EQ(GeoArrowArrayWriterReserve(&writer, array_view, offset, length - offset),
+                GEOARROW_OK);
+      int64_t num_reallocations = stats.num_reallocations;
+      ASSERT_EQ(GeoArrowArrayReaderVisit(&reader, offset, length - offset, &v),
+                GEOARROW_OK);
+      EXPECT_EQ(stats.num_reallocations - num_reallocations,
+                item.out_type == GEOARROW_TYPE_WKB && offset == 0);
+    }
+
+    struct ArrowArray out;
+    ASSERT_EQ(GeoArrowArrayWriterFinish(&writer, &out, nullptr), GEOARROW_OK);
+    EXPECT_EQ(out.length, 2 * length - 1);
+
+    // Check that the output round trips
+    WKXTester tester;
+    GeoArrowArrayReaderReset(&reader);
+    ASSERT_EQ(GeoArrowArrayReaderInitFromType(&reader, item.out_type), GEOARROW_OK);
+    ASSERT_EQ(GeoArrowArrayReaderSetArray(&reader, &out, nullptr), GEOARROW_OK);
+    ASSERT_EQ(GeoArrowArrayReaderVisit(&reader, 0, length, tester.WKTVisitor()),
+              GEOARROW_OK);
+    std::vector<std::string> values = tester.WKTValues("");
+    for (int64_t i = 0; i < length; i++) {
+      if (item.wkt[i].empty() ||
+          GeoArrowGeometryTypeFromType(item.out_type) == GEOARROW_GEOMETRY_TYPE_POINT) {
+        continue;
+      }
+
+      EXPECT_NE(values[i], "") << item.wkt[i];
+    }
+
+    out.release(&out);
+    GeoArrowArrayWriterReset(&writer);
+    GeoArrowArrayReaderReset(&reader);
+    array.release(&array);
+  }
+}
+
+TEST(ArrayWriterTest, ArrayWriterTestReserveUncountable) {
+  struct GeoArrowArrayWriter writer;
+  struct GeoArrowArrayView array_view;
+
+  // Invalid WKB is not an error until it is visited
+  ASSERT_EQ(GeoArrowArrayWriterInitFromType(&writer, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_WKB), GEOARROW_OK);
+  uint8_t invalid_wkb[] = {0x01, 0x02};
+  int32_t offsets[] = {0, 2};
+  array_view.offsets[0] = offsets;
+  array_view.data = invalid_wkb;
+  array_view.length[0] = 1;
+  EXPECT_EQ(GeoArrowArrayWriterReserve(&writer, &array_view, 0, 1), GEOARROW_OK);
+
+  // WKT input is not counted
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowArrayWriterReserve(&writer, &array_view, 0, 0), GEOARROW_OK);
+  GeoArrowArrayWriterReset(&writer);
+}
@@ -0,0 +1,200 @@
+
+#include <math.h>
+#include <stddef.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Bounds of non-planar edges
+//
+// Coordinates are longitude and latitude and the bounds account for each edge being
+// a great circle: the latitude range includes the northernmost or southernmost point
+// of an edge and the longitude range is the smallest one containing every edge,
+// which wraps (i.e., xmin > xmax) when it crosses the antimeridian. A ring that winds
+// around a pole extends the bounds to that pole (assuming that shells are wound
+// counterclockwise).
+
+static const double kGeoArrowBoundsDegToRad = 0.017453292519943295;
+
+// Returns non-zero if the longitude x is within [lo, hi], which wraps if lo > hi
+static int bounds_lon_contains(double lo, double hi, double x) {
+  return lo <= hi ? (x >= lo && x <= hi) : (x >= lo || x <= hi);
+}
+
+// Returns the distance travelling east from longitude a to longitude b
+static double bounds_lon_distance(double a, double b) {
+  double d = b - a;
+  return d >= 0 ? d : d + 360;
+}
+
+// Extends the longitude range such that it contains [lo, hi] (which may wrap),
+// choosing the smaller of the two possible results for disjoint ranges
+static void bounds_lon_union(struct GeoArrowSphericalBounds* bounds, double lo,
+                             double hi) {
+  double* out_lo = &bounds->min_values[0];
+  double* out_hi = &bounds->max_values[0];
+
+  if (*out_lo == INFINITY) {
+    *out_lo = lo;
+    *out_hi = hi;
+    return;
+  }
+
+  int contains_lo = bounds_lon_contains(*out_lo, *out_hi, lo);
+  int contains_hi = bounds_lon_contains(*out_lo, *out_hi, hi);
+  if (contains_lo && contains_hi) {
+    // Either the current range contains [lo, hi] or their union is everything
+    int out_wraps = *out_lo > *out_hi;
+    int wraps = lo > hi;
+    int contained;
+    if (!out_wraps) {
+      contained = !wraps;
+    } else if (wraps) {
+      contained = lo >= *out_lo && hi <= *out_hi;
+    } else {
+      contained = !(lo <= *out_hi && hi >= *out_lo);
+    }
+
+    if (!contained) {
+      *out_lo = -180;
+      *out_hi = 180;
+    }
+  } else if (contains_lo) {
+    *out_hi = hi;
+  } else if (contains_hi) {
+    *out_lo = lo;
+  } else if (bounds_lon_contains(lo, hi, *out_lo)) {
+    *out_lo = lo;
+    *out_hi = hi;
+  } else if (bounds_lon_distance(hi, *out_lo) < bounds_lon_distance(*out_hi, lo)) {
+    *out_lo = lo;
+  } else {
+    *out_hi = hi;
+  }
+}
+
+static void bounds_lat_update(struct GeoArrowSphericalBounds* bounds, double lat) {
+  if (lat < bounds->min_values[1]) {
+    bounds->min_values[1] = lat;
+  }
+
+  if (lat > bounds->max_values[1]) {
+    bounds->max_values[1] = lat;
+  }
+}
+
+static void bounds_point(struct GeoArrowSphericalBounds* bounds, double lon, double lat) {
+  lon = remainder(lon, 360);
+  bounds_lon_union(bounds, lon, lon);
+  bounds_lat_update(bounds, lat);
+}
+
+// Bounds the great circle arc between two points. The arc reaches its northernmost
+// and southernmost points where the plane of the great circle is closest to the
+// poles, so those are added if they lie between the endpoints.
+static void bounds_edge(struct GeoArrowSphericalBounds* bounds, double lon1, double lat1,
+                        double lon2, double lat2) {
+  double dlon = remainder(lon2 - lon1, 360);
+  bounds->path_dlon += dlon;
+  lon1 = remainder(lon1, 360);
+  lon2 = remainder(lon2, 360);
+  if (dlon >= 0) {
+    bounds_lon_union(bounds, lon1, lon2);
+  } else {
+    bounds_lon_union(bounds, lon2, lon1);
+  }
+
+  double p1[3], p2[3];
+  double cos_lat1 = cos(lat1 * kGeoArrowBoundsDegToRad);
+  double cos_lat2 = cos(lat2 * kGeoArrowBoundsDegToRad);
+  p1[0] = cos_lat1 * cos(lon1 * kGeoArrowBoundsDegToRad);
+  p1[1] = cos_lat1 * sin(lon1 * kGeoArrowBoundsDegToRad);
+  p1[2] = sin(lat1 * kGeoArrowBoundsDegToRad);
+  p2[0] = cos_lat2 * cos(lon2 * kGeoArrowBoundsDegToRad);
+  p2[1] = cos_lat2 * sin(lon2 * kGeoArrowBoundsDegToRad);
+  p2[2] = sin(lat2 * kGeoArrowBoundsDegToRad);
+
+  double n[3] = {p1[1] * p2[2] - p1[2] * p2[1], p1[2] * p2[0] - p1[0] * p2[2],
+                 p1[0] * p2[1] - p1[1] * p2[0]};
+  double n2 = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+  if (n2 == 0) {
+    return;
+  }
+
+  // The projection of the north pole onto the plane of the great circle
+  double t[3] = {-n[2] * n[0] / n2, -n[2] * n[1] / n2, 1 - n[2] * n[2] / n2};
+  double t_norm = sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+  if (t_norm == 0) {
+    return;
+  }
+
+  for (int sign = -1; sign <= 1; sign += 2) {
+    double e[3] = {sign * t[0], sign * t[1], sign * t[2]};
+    // e is on the arc if it is on the same side of p1 and p2 as the arc
+    double c1[3] = {p1[1] * e[2] - p1[2] * e[1], p1[2] * e[0] - p1[0] * e[2],
+                    p1[0] * e[1] - p1[1] * e[0]};
+    double c2[3] = {e[1] * p2[2] - e[2] * p2[1], e[2] * p2[0] - e[0] * p2[2],
+                    e[0] * p2[1] - e[1] * p2[0]};
+    if ((c1[0] * n[0] + c1[1] * n[1] + c1[2] * n[2]) > 0 &&
+        (c2[0] * n[0] + c2[1] * n[1] + c2[2] * n[2]) > 0) {
+      bounds_lat_update(bounds, asin(e[2] / t_norm) / kGeoArrowBoundsDegToRad);
+    }
+  }
+}
+
+void GeoArrowSphericalBoundsInit(struct GeoArrowSphericalBounds* bounds) {
+  bounds->min_values[0] = INFINITY;
+  bounds->min_values[1] = INFINITY;
+  bounds->max_values[0] = -INFINITY;
+  bounds->max_values[1] = -INFINITY;
+  bounds->path_active = 0;
+  bounds->path_is_ring = 0;
+  bounds->path_n_coords = 0;
+  bounds->path_lon = 0;
+  bounds->path_lat = 0;
+  bounds->path_dlon = 0;
+}
+
+void GeoArrowSphericalBoundsPathStart(struct GeoArrowSphericalBounds* bounds,
+                                      int is_ring) {
+  bounds->path_active = 1;
+  bounds->path_is_ring = is_ring;
+  bounds->path_n_coords = 0;
+  bounds->path_dlon = 0;
+}
+
+void GeoArrowSphericalBoundsAppend(struct GeoArrowSphericalBounds* bounds,
+                                   const struct GeoArrowCoordView* coords) {
+  double lon, lat;
+  for (int64_t i = 0; i < coords->n_coords; i++) {
+    lon = GEOARROW_COORD_VIEW_VALUE(coords, i, 0);
+    lat = GEOARROW_COORD_VIEW_VALUE(coords, i, 1);
+    if (!bounds->path_active) {
+      bounds_point(bounds, lon, lat);
+      continue;
+    }
+
+    if (bounds->path_n_coords == 0) {
+      bounds_point(bounds, lon, lat);
+    } else {
+      bounds_lat_update(bounds, lat);
+      bounds_edge(bounds, bounds->path_lon, bounds->path_lat, lon, lat);
+    }
+
+    bounds->path_lon = lon;
+    bounds->path_lat = lat;
+    bounds->path_n_coords++;
+  }
+}
+
+void GeoArrowSphericalBoundsPathEnd(struct GeoArrowSphericalBounds* bounds) {
+  bounds->path_active = 0;
+
+  // A ring whose longitudes wind once around the globe contains a pole
+  if (bounds->path_is_ring && fabs(bounds->path_dlon) > 180) {
+    bounds->min_values[0] = -180;
+    bounds->max_values[0] = 180;
+    bounds_lat_update(bounds, bounds->path_dlon > 0 ? 90 : -90);
+  }
+}
@@ -0,0 +1,72 @@
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+
+static void AppendCoords(struct GeoArrowSphericalBounds* bounds, const double* lon,
+                         const double* lat, int64_t n_coords) {
+  struct GeoArrowCoordView coords;
+  coords.values[0] = lon;
+  coords.values[1] = lat;
+  coords.n_coords = n_coords;
+  coords.n_values = 2;
+  coords.coords_stride = 1;
+  GeoArrowSphericalBoundsAppend(bounds, &coords);
+}
+
+TEST(BoundsTest, BoundsSphericalEmpty) {
+  struct GeoArrowSphericalBounds bounds;
+  GeoArrowSphericalBoundsInit(&bounds);
+  EXPECT_EQ(bounds.min_values[0], INFINITY);
+  EXPECT_EQ(bounds.min_values[1], INFINITY);
+  EXPECT_EQ(bounds.max_values[0], -INFINITY);
+  EXPECT_EQ(bounds.max_values[1], -INFINITY);
+}
+
+TEST(BoundsTest, BoundsSphericalPoints) {
+  struct GeoArrowSphericalBounds bounds;
+  GeoArrowSphericalBoundsInit(&bounds);
+
+  // Points on either side of the antimeridian wrap
+  double lon[] = {170, -170};
+  double lat[] = {10, 20};
+  AppendCoords(&bounds, lon, lat, 2);
+  EXPECT_EQ(bounds.min_values[0], 170);
+  EXPECT_EQ(bounds.max_values[0], -170);
+  EXPECT_EQ(bounds.min_values[1], 10);
+  EXPECT_EQ(bounds.max_values[1], 20);
+}
+
+TEST(BoundsTest, BoundsSphericalEdge) {
+  struct GeoArrowSphericalBounds bounds;
+  GeoArrowSphericalBoundsInit(&bounds);
+
+  // The great circle between two points at 45 degrees north bulges poleward, and
+  // coordinates of the same linestring may be appended in more than one call
+  double lon[] = {-45, 45};
+  double lat[] = {45, 45};
+  GeoArrowSphericalBoundsPathStart(&bounds, 0);
+  AppendCoords(&bounds, lon, lat, 1);
+  AppendCoords(&bounds, lon + 1, lat + 1, 1);
+  GeoArrowSphericalBoundsPathEnd(&bounds);
+  EXPECT_EQ(bounds.min_values[0], -45);
+  EXPECT_EQ(bounds.max_values[0], 45);
+  EXPECT_EQ(bounds.min_values[1], 45);
+  EXPECT_NEAR(bounds.max_values[1], 54.7356103172, 1e-9);
+}
+
+TEST(BoundsTest, BoundsSphericalRingAroundPole) {
+  struct GeoArrowSphericalBounds bounds;
+  GeoArrowSphericalBoundsInit(&bounds);
+
+  double lon[] = {0, 90, 180, -90, 0};
+  double lat[] = {80, 80, 80, 80, 80};
+  GeoArrowSphericalBoundsPathStart(&bounds, 1);
+  AppendCoords(&bounds, lon, lat, 5);
+  GeoArrowSphericalBoundsPathEnd(&bounds);
+  EXPECT_EQ(bounds.min_values[0], -180);
+  EXPECT_EQ(bounds.max_values[0], 180);
+  EXPECT_EQ(bounds.min_values[1], 80);
+  EXPECT_EQ(bounds.max_values[1], 90);
+}
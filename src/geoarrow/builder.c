@@ -17,6 +17,9 @@ struct BuilderPrivate {
   // might be NULL.
   struct ArrowBitmap* validity;
   struct ArrowBuffer* buffers[9];
+
+  // Optional statistics to update (NULL if not collecting statistics)
+  struct GeoArrowStatistics* stats;
 };
 
 static ArrowErrorCode GeoArrowBuilderInitArrayAndCachePointers(
@@ -47,6 +50,8 @@ static ArrowErrorCode GeoArrowBuilderInitArrayAndCachePointers(
   builder->view.coords.capacity_coords = 0;
   for (int i = 0; i < 4; i++) {
     builder->view.coords.values[i] = NULL;
+    builder->view.coords_float.values[i] = NULL;
+    builder->view.coords_int32.values[i] = NULL;
   }
 
   return GEOARROW_OK;
@@ -89,8 +94,12 @@ static GeoArrowErrorCode GeoArrowBuilderInitInternal(struct GeoArrowBuilder* bui
   // that never change.
   builder->view.coords.n_values = array_view.coords.n_values;
   builder->view.coords.coords_stride = array_view.coords.coords_stride;
+  builder->view.coords_float.n_values = array_view.coords_float.n_values;
+  builder->view.coords_float.coords_stride = array_view.coords_float.coords_stride;
+  builder->view.coords_int32.n_values = array_view.coords_int32.n_values;
+  builder->view.coords_int32.coords_stride = array_view.coords_int32.coords_stride;
   builder->view.n_offsets = array_view.n_offsets;
-  switch (builder->view.schema_view.coord_type) {
+  switch (GeoArrowCoordTypeLayout(builder->view.schema_view.coord_type)) {
     case GEOARROW_COORD_TYPE_SEPARATE:
       builder->view.n_buffers = 1 + array_view.n_offsets + array_view.coords.n_values;
       break;
@@ -118,6 +127,7 @@ GeoArrowErrorCode GeoArrowBuilderInitFromType(struct GeoArrowBuilder* builder,
   memset(builder, 0, sizeof(struct GeoArrowBuilder));
   NANOARROW_RETURN_NOT_OK(
       GeoArrowSchemaViewInitFromType(&builder->view.schema_view, type));
+  GeoArrowQuantizationInitDefault(&builder->view.quantization);
   return GeoArrowBuilderInitInternal(builder);
 }
 
@@ -127,6 +137,12 @@ GeoArrowErrorCode GeoArrowBuilderInitFromSchema(struct GeoArrowBuilder* builder,
   memset(builder, 0, sizeof(struct GeoArrowBuilder));
   NANOARROW_RETURN_NOT_OK(
       GeoArrowSchemaViewInit(&builder->view.schema_view, schema, error));
+
+  struct GeoArrowMetadataView metadata_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowMetadataViewInit(
+      &metadata_view, builder->view.schema_view.extension_metadata, error));
+  builder->view.quantization = metadata_view.quantization;
+
   return GeoArrowBuilderInitInternal(builder);
 }
 
@@ -142,6 +158,11 @@ GeoArrowErrorCode GeoArrowBuilderReserveBuffer(struct GeoArrowBuilder* builder,
   // Use nanoarrow's reserve
   NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer_src, additional_size_bytes));
 
+  if (private->stats != NULL &&
+      buffer_src->capacity_bytes != builder->view.buffers[i].capacity_bytes) {
+    private->stats->num_reallocations++;
+  }
+
   // Sync any changes back to the builder's view
   builder->view.buffers[i].data.data = buffer_src->data;
   builder->view.buffers[i].capacity_bytes = buffer_src->capacity_bytes;
@@ -197,6 +218,12 @@ GeoArrowErrorCode GeoArrowBuilderSetOwnedBuffer(
   return GEOARROW_OK;
 }
 
+void GeoArrowBuilderSetStatistics(struct GeoArrowBuilder* builder,
+                                  struct GeoArrowStatistics* stats) {
+  struct BuilderPrivate* private = (struct BuilderPrivate*)builder->private_data;
+  private->stats = stats;
+}
+
 static void GeoArrowSetArrayLengthFromBufferLength(struct GeoArrowSchemaView* schema_view,
                                                    struct _GeoArrowFindBufferResult* res,
                                                    int64_t size_bytes);
@@ -212,11 +239,13 @@ GeoArrowErrorCode GeoArrowBuilderFinish(struct GeoArrowBuilder* builder,
   struct GeoArrowWritableCoordView* writable_view = &builder->view.coords;
   int64_t last_buffer = builder->view.n_buffers - 1;
   int n_values = writable_view->n_values;
+  int64_t ordinate_size =
+      GeoArrowCoordTypeOrdinateSize(builder->view.schema_view.coord_type);
   int64_t size_by_coords;
 
-  switch (builder->view.schema_view.coord_type) {
+  switch (GeoArrowCoordTypeLayout(builder->view.schema_view.coord_type)) {
     case GEOARROW_COORD_TYPE_INTERLEAVED:
-      size_by_coords = writable_view->size_coords * sizeof(double) * n_values;
+      size_by_coords = writable_view->size_coords * ordinate_size * n_values;
       if (size_by_coords > builder->view.buffers[last_buffer].size_bytes) {
         builder->view.buffers[last_buffer].size_bytes = size_by_coords;
       }
@@ -224,7 +253,7 @@ GeoArrowErrorCode GeoArrowBuilderFinish(struct GeoArrowBuilder* builder,
 
     case GEOARROW_COORD_TYPE_SEPARATE:
       for (int64_t i = last_buffer - n_values + 1; i <= last_buffer; i++) {
-        size_by_coords = writable_view->size_coords * sizeof(double);
+        size_by_coords = writable_view->size_coords * ordinate_size;
         if (size_by_coords > builder->view.buffers[i].size_bytes) {
           builder->view.buffers[i].size_bytes = size_by_coords;
         }
@@ -261,6 +290,12 @@ GeoArrowErrorCode GeoArrowBuilderFinish(struct GeoArrowBuilder* builder,
   // Set the struct or fixed-size list container length
   GeoArrowSetCoordContainerLength(builder);
 
+  if (private->stats != NULL) {
+    for (int64_t i = 0; i < builder->view.n_buffers; i++) {
+      private->stats->bytes_written += private->buffers[i]->size_bytes;
+    }
+  }
+
   // Call finish building, which will flush the buffer pointers into the array
   // and validate sizes.
   NANOARROW_RETURN_NOT_OK(
@@ -358,7 +393,8 @@ static void GeoArrowSetArrayLengthFromBufferLength(struct GeoArrowSchemaView* sc
     res->array->length = (size_bytes / sizeof(int32_t)) - 1;
   } else {
     // This is a data buffer
-    res->array->length = size_bytes / sizeof(double);
+    res->array->length =
+        size_bytes / GeoArrowCoordTypeOrdinateSize(schema_view->coord_type);
   }
 }
 
@@ -368,7 +404,7 @@ static void GeoArrowSetCoordContainerLength(struct GeoArrowBuilder* builder) {
   // At this point all the array lengths should be set except for the
   // fixed-size list or struct parent to the coordinate array(s).
   int scale = -1;
-  switch (builder->view.schema_view.coord_type) {
+  switch (GeoArrowCoordTypeLayout(builder->view.schema_view.coord_type)) {
     case GEOARROW_COORD_TYPE_SEPARATE:
       scale = 1;
       break;
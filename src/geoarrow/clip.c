@@ -0,0 +1,565 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Clips native input with double coordinates to a rectangle (xmin, ymin, xmax, ymax;
+// inclusive). Points outside the box are removed (a POINT becomes POINT EMPTY),
+// linestrings are clipped segment by segment (Liang-Barsky) and may split into
+// several parts (linestrings are written as multilinestrings), and polygon rings are
+// clipped against each edge of the box in turn (Sutherland-Hodgman). Rings that
+// collapse are removed, along with their polygon if the shell collapses. Z and M are
+// interpolated along clipped segments. As with any Sutherland-Hodgman clip, a concave
+// ring that leaves and re-enters the box is written as a single ring with degenerate
+// edges along the boundary of the box.
+//
+// The bounding box of each feature is computed first: features entirely inside the
+// box are written as-is and features entirely outside are written as EMPTY without
+// visiting any segments. For features that cross the box, the same check is applied
+// to each linestring or ring before clipping it.
+
+struct GeoArrowClipperPrivate {
+  double box[4];
+  enum GeoArrowGeometryType geometry_type;
+  // Scratch space for clipped linestrings and rings (interleaved coordinates)
+  struct ArrowBuffer coords;
+  struct ArrowBuffer coords_tmp;
+  struct ArrowBuffer part_offsets;
+};
+
+enum GeoArrowClipRelation {
+  GEOARROW_CLIP_OUTSIDE = 0,
+  GEOARROW_CLIP_INSIDE,
+  GEOARROW_CLIP_PARTIAL
+};
+
+static enum GeoArrowClipRelation clip_relation(const double* box,
+                                               const struct GeoArrowCoordView* coords,
+                                               int64_t start, int64_t end) {
+  double xmin = INFINITY;
+  double xmax = -INFINITY;
+  double ymin = INFINITY;
+  double ymax = -INFINITY;
+  for (int64_t i = start; i < end; i++) {
+    double x = GEOARROW_COORD_VIEW_VALUE(coords, i, 0);
+    double y = GEOARROW_COORD_VIEW_VALUE(coords, i, 1);
+    xmin = x < xmin ? x : xmin;
+    xmax = x > xmax ? x : xmax;
+    ymin = y < ymin ? y : ymin;
+    ymax = y > ymax ? y : ymax;
+  }
+
+  // Also true for empty input
+  if (xmin > box[2] || xmax < box[0] || ymin > box[3] || ymax < box[1]) {
+    return GEOARROW_CLIP_OUTSIDE;
+  }
+
+  if (xmin >= box[0] && xmax <= box[2] && ymin >= box[1] && ymax <= box[3]) {
+    return GEOARROW_CLIP_INSIDE;
+  }
+
+  return GEOARROW_CLIP_PARTIAL;
+}
+
+static inline int clip_point_inside(const double* box, double x, double y) {
+  return x >= box[0] && x <= box[2] && y >= box[1] && y <= box[3];
+}
+
+static int clip_write_coords(struct GeoArrowVisitor* v,
+                             const struct GeoArrowCoordView* coords, int64_t start,
+                             int64_t n) {
+  if (n == 0) {
+    return GEOARROW_OK;
+  }
+
+  struct GeoArrowCoordView view = *coords;
+  view.n_coords = n;
+  for (int j = 0; j < coords->n_values; j++) {
+    view.values[j] = coords->values[j] + start * coords->coords_stride;
+  }
+
+  return v->coords(v, &view);
+}
+
+static int clip_write_scratch(struct GeoArrowVisitor* v, const double* values,
+                              int n_values, int64_t n) {
+  struct GeoArrowCoordView view;
+  view.n_coords = n;
+  view.n_values = n_values;
+  view.coords_stride = n_values;
+  for (int j = 0; j < n_values; j++) {
+    view.values[j] = values + j;
+  }
+
+  return v->coords(v, &view);
+}
+
+// Clips the segment starting at (x0, y0) with direction (dx, dy) to the box
+// (Liang-Barsky), returning zero if no part of it is inside
+static inline int clip_segment(const double* box, double x0, double y0, double dx,
+                               double dy, double* t0, double* t1) {
+  double p[4] = {-dx, dx, -dy, dy};
+  double q[4] = {x0 - box[0], box[2] - x0, y0 - box[1], box[3] - y0};
+  *t0 = 0;
+  *t1 = 1;
+  for (int k = 0; k < 4; k++) {
+    if (p[k] == 0) {
+      if (q[k] < 0) {
+        return 0;
+      }
+
+      continue;
+    }
+
+    double r = q[k] / p[k];
+    if (p[k] < 0) {
+      if (r > *t1) {
+        return 0;
+      }
+
+      *t0 = r > *t0 ? r : *t0;
+    } else {
+      if (r < *t0) {
+        return 0;
+      }
+
+      *t1 = r < *t1 ? r : *t1;
+    }
+  }
+
+  return 1;
+}
+
+// Writes the coordinate at t along the segment starting at coordinate i to out.
+// Interpolated coordinates are clamped to the box such that they are never outside
+// it because of rounding.
+static inline void clip_interpolate(const double* box,
+                                    const struct GeoArrowCoordView* coords, int64_t i,
+                                    double t, double* out) {
+  if (t == 0 || t == 1) {
+    for (int j = 0; j < coords->n_values; j++) {
+      out[j] = GEOARROW_COORD_VIEW_VALUE(coords, i + (t == 1), j);
+    }
+
+    return;
+  }
+
+  for (int j = 0; j < coords->n_values; j++) {
+    double a = GEOARROW_COORD_VIEW_VALUE(coords, i, j);
+    double b = GEOARROW_COORD_VIEW_VALUE(coords, i + 1, j);
+    out[j] = a + t * (b - a);
+  }
+
+  out[0] = out[0] < box[0] ? box[0] : (out[0] > box[2] ? box[2] : out[0]);
+  out[1] = out[1] < box[1] ? box[1] : (out[1] > box[3] ? box[3] : out[1]);
+}
+
+// Writes each part of the linestring [start, end) that is inside the box as a
+// LINESTRING
+static int clip_path(struct GeoArrowClipperPrivate* clip, struct GeoArrowVisitor* v,
+                     const struct GeoArrowCoordView* coords, int64_t start, int64_t end,
+                     enum GeoArrowClipRelation relation,
+                     enum GeoArrowDimensions dimensions) {
+  if (relation == GEOARROW_CLIP_PARTIAL) {
+    relation = clip_relation(clip->box, coords, start, end);
+  }
+
+  if (relation == GEOARROW_CLIP_OUTSIDE) {
+    return GEOARROW_OK;
+  } else if (relation == GEOARROW_CLIP_INSIDE) {
+    NANOARROW_RETURN_NOT_OK(
+        v->geom_start(v, GEOARROW_GEOMETRY_TYPE_LINESTRING, dimensions));
+    NANOARROW_RETURN_NOT_OK(clip_write_coords(v, coords, start, end - start));
+    return v->geom_end(v);
+  }
+
+  // Each segment adds at most two coordinates and starts at most one part
+  int n_values = coords->n_values;
+  int64_t n = end - start;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+      &clip->coords, 2 * n * n_values * (int64_t)sizeof(double), 0));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferResize(&clip->part_offsets, (n + 1) * (int64_t)sizeof(int64_t), 0));
+  double* out = (double*)clip->coords.data;
+  int64_t* part_offsets = (int64_t*)clip->part_offsets.data;
+
+  int64_t n_out = 0;
+  int64_t n_parts = 0;
+  int part_open = 0;
+  double t0, t1;
+  for (int64_t i = start; i < (end - 1); i++) {
+    double x0 = GEOARROW_COORD_VIEW_VALUE(coords, i, 0);
+    double y0 = GEOARROW_COORD_VIEW_VALUE(coords, i, 1);
+    double dx = GEOARROW_COORD_VIEW_VALUE(coords, i + 1, 0) - x0;
+    double dy = GEOARROW_COORD_VIEW_VALUE(coords, i + 1, 1) - y0;
+
+    // Segments that only touch the box are not written
+    if (!clip_segment(clip->box, x0, y0, dx, dy, &t0, &t1) ||
+        (t0 == t1 && (dx != 0 || dy != 0))) {
+      part_open = 0;
+      continue;
+    }
+
+    if (!part_open) {
+      part_offsets[n_parts++] = n_out;
+      clip_interpolate(clip->box, coords, i, t0, out + n_out * n_values);
+      n_out++;
+      part_open = 1;
+    }
+
+    clip_interpolate(clip->box, coords, i, t1, out + n_out * n_values);
+    n_out++;
+    part_open = t1 == 1;
+  }
+
+  part_offsets[n_parts] = n_out;
+
+  for (int64_t k = 0; k < n_parts; k++) {
+    NANOARROW_RETURN_NOT_OK(
+        v->geom_start(v, GEOARROW_GEOMETRY_TYPE_LINESTRING, dimensions));
+    NANOARROW_RETURN_NOT_OK(
+        clip_write_scratch(v, out + part_offsets[k] * n_values, n_values,
+                           part_offsets[k + 1] - part_offsets[k]));
+    NANOARROW_RETURN_NOT_OK(v->geom_end(v));
+  }
+
+  return GEOARROW_OK;
+}
+
+static int clip_coord_equal(const double* a, const double* b, int n_values) {
+  for (int j = 0; j < n_values; j++) {
+    if (a[j] != b[j]) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+// Appends coord to the n_out coordinates in out unless it repeats the last one, which
+// happens when a ring vertex lies on the clip boundary. Returns the new n_out.
+static int64_t clip_ring_append(double* out, int64_t n_out, const double* coord,
+                                int n_values) {
+  if (n_out > 0 && clip_coord_equal(out + (n_out - 1) * n_values, coord, n_values)) {
+    return n_out;
+  }
+
+  memcpy(out + n_out * n_values, coord, n_values * sizeof(double));
+  return n_out + 1;
+}
+
+// Clips the ring in (n_in coordinates, not closed) to one edge of the box
+// (Sutherland-Hodgman), writing at most 2 * n_in coordinates to out without
+// consecutive duplicates
+static int64_t clip_ring_edge(const double* in, int64_t n_in, double* out, int n_values,
+                              int axis, double bound, int keep_below) {
+  int64_t n_out = 0;
+  const double* prev = in + (n_in - 1) * n_values;
+  int prev_inside = keep_below ? prev[axis] <= bound : prev[axis] >= bound;
+  for (int64_t k = 0; k < n_in; k++) {
+    const double* cur = in + k * n_values;
+    int cur_inside = keep_below ? cur[axis] <= bound : cur[axis] >= bound;
+
+    if (cur_inside != prev_inside) {
+      double t = (bound - prev[axis]) / (cur[axis] - prev[axis]);
+      double intersection[4];
+      for (int j = 0; j < n_values; j++) {
+        intersection[j] = prev[j] + t * (cur[j] - prev[j]);
+      }
+
+      intersection[axis] = bound;
+      n_out = clip_ring_append(out, n_out, intersection, n_values);
+    }
+
+    if (cur_inside) {
+      n_out = clip_ring_append(out, n_out, cur, n_values);
+    }
+
+    prev = cur;
+    prev_inside = cur_inside;
+  }
+
+  // The ring wraps around, so the last coordinate must not repeat the first either
+  while (n_out > 1 && clip_coord_equal(out + (n_out - 1) * n_values, out, n_values)) {
+    n_out--;
+  }
+
+  return n_out;
+}
+
+// Sets out to the coordinates of the ring [start, end) clipped to the box, which are
+// either a view of the input or of scratch space that is valid until the next call.
+// out->n_coords is zero if the ring is outside the box or collapsed.
+static int clip_ring(struct GeoArrowClipperPrivate* clip,
+                     const struct GeoArrowCoordView* coords, int64_t start, int64_t end,
+                     enum GeoArrowClipRelation relation, struct GeoArrowCoordView* out) {
+  int n_values = coords->n_values;
+  if (relation == GEOARROW_CLIP_PARTIAL) {
+    relation = clip_relation(clip->box, coords, start, end);
+  }
+
+  if (relation == GEOARROW_CLIP_INSIDE) {
+    *out = *coords;
+    out->n_coords = end - start;
+    for (int j = 0; j < n_values; j++) {
+      out->values[j] = coords->values[j] + start * coords->coords_stride;
+    }
+
+    return GEOARROW_OK;
+  } else if (relation == GEOARROW_CLIP_OUTSIDE || (end - start) < 4) {
+    out->n_coords = 0;
+    return GEOARROW_OK;
+  }
+
+  // Copy the ring without its closing coordinate into scratch space, then clip it
+  // to each edge of the box alternating between the two scratch buffers
+  int64_t n = end - start - 1;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferResize(&clip->coords, n * n_values * (int64_t)sizeof(double), 0));
+  double* values = (double*)clip->coords.data;
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      values[i * n_values + j] = GEOARROW_COORD_VIEW_VALUE(coords, start + i, j);
+    }
+  }
+
+  struct ArrowBuffer* buffers[] = {&clip->coords, &clip->coords_tmp};
+  for (int edge = 0; edge < 4 && n > 0; edge++) {
+    struct ArrowBuffer* src = buffers[edge % 2];
+    struct ArrowBuffer* dst = buffers[(edge + 1) % 2];
+    NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+        dst, (2 * n + 1) * n_values * (int64_t)sizeof(double), 0));
+    n = clip_ring_edge((const double*)src->data, n, (double*)dst->data, n_values,
+                       edge % 2, clip->box[edge], edge >= 2);
+  }
+
+  if (n < 3) {
+    out->n_coords = 0;
+    return GEOARROW_OK;
+  }
+
+  // Close the ring
+  values = (double*)clip->coords.data;
+  memcpy(values + n * n_values, values, n_values * sizeof(double));
+
+  out->n_coords = n + 1;
+  out->n_values = n_values;
+  out->coords_stride = n_values;
+  for (int j = 0; j < n_values; j++) {
+    out->values[j] = values + j;
+  }
+
+  return GEOARROW_OK;
+}
+
+// Writes polygon i whose rings are given by the offsets at level. Nothing is written
+// if the shell is outside the box (or collapses) unless always_write is set, in which
+// case POLYGON EMPTY is written.
+static int clip_polygon(struct GeoArrowClipperPrivate* clip, struct GeoArrowVisitor* v,
+                        const struct GeoArrowArrayView* array_view, int level, int64_t i,
+                        enum GeoArrowClipRelation relation, int always_write) {
+  enum GeoArrowDimensions dimensions = array_view->schema_view.dimensions;
+  int64_t ring_start, ring_end, coord_start, coord_end;
+  GeoArrowArrayViewChildRange(array_view, level, i, &ring_start, &ring_end);
+
+  int started = 0;
+  if (always_write) {
+    NANOARROW_RETURN_NOT_OK(
+        v->geom_start(v, GEOARROW_GEOMETRY_TYPE_POLYGON, dimensions));
+    started = 1;
+  }
+
+  struct GeoArrowCoordView ring;
+  for (int64_t j = ring_start; j < ring_end; j++) {
+    GeoArrowArrayViewChildRange(array_view, level + 1, j, &coord_start, &coord_end);
+    NANOARROW_RETURN_NOT_OK(
+        clip_ring(clip, &array_view->coords, coord_start, coord_end, relation, &ring));
+    if (ring.n_coords == 0) {
+      if (j == ring_start) {
+        break;
+      }
+
+      continue;
+    }
+
+    if (!started) {
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_POLYGON, dimensions));
+      started = 1;
+    }
+
+    NANOARROW_RETURN_NOT_OK(v->ring_start(v));
+    NANOARROW_RETURN_NOT_OK(v->coords(v, &ring));
+    NANOARROW_RETURN_NOT_OK(v->ring_end(v));
+  }
+
+  if (started) {
+    return v->geom_end(v);
+  }
+
+  return GEOARROW_OK;
+}
+
+static int clip_feature(struct GeoArrowClipperPrivate* clip, struct GeoArrowVisitor* v,
+                        const struct GeoArrowArrayView* array_view, int64_t i) {
+  const struct GeoArrowCoordView* coords = &array_view->coords;
+  enum GeoArrowDimensions dimensions = array_view->schema_view.dimensions;
+
+  // Resolve the coordinates of the whole feature
+  int64_t start = i;
+  int64_t end = i + 1;
+  for (int level = 0; level < array_view->n_offsets; level++) {
+    start = array_view->offsets[level][start] + array_view->offset[level + 1];
+    end = array_view->offsets[level][end] + array_view->offset[level + 1];
+  }
+
+  enum GeoArrowClipRelation relation = clip_relation(clip->box, coords, start, end);
+  if (relation == GEOARROW_CLIP_OUTSIDE) {
+    NANOARROW_RETURN_NOT_OK(v->geom_start(v, clip->geometry_type, dimensions));
+    return v->geom_end(v);
+  }
+
+  int64_t part_start, part_end, coord_start, coord_end;
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_POINT, dimensions));
+      NANOARROW_RETURN_NOT_OK(clip_write_coords(v, coords, i, 1));
+      return v->geom_end(v);
+
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT: {
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_MULTIPOINT, dimensions));
+      if (relation == GEOARROW_CLIP_INSIDE) {
+        NANOARROW_RETURN_NOT_OK(clip_write_coords(v, coords, start, end - start));
+        return v->geom_end(v);
+      }
+
+      // Write runs of points inside the box
+      int64_t run_start = start;
+      for (int64_t j = start; j < end; j++) {
+        if (!clip_point_inside(clip->box, GEOARROW_COORD_VIEW_VALUE(coords, j, 0),
+                               GEOARROW_COORD_VIEW_VALUE(coords, j, 1))) {
+          NANOARROW_RETURN_NOT_OK(clip_write_coords(v, coords, run_start, j - run_start));
+          run_start = j + 1;
+        }
+      }
+
+      NANOARROW_RETURN_NOT_OK(clip_write_coords(v, coords, run_start, end - run_start));
+      return v->geom_end(v);
+    }
+
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_MULTILINESTRING, dimensions));
+      NANOARROW_RETURN_NOT_OK(
+          clip_path(clip, v, coords, start, end, relation, dimensions));
+      return v->geom_end(v);
+
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_MULTILINESTRING, dimensions));
+      GeoArrowArrayViewChildRange(array_view, 0, i, &part_start, &part_end);
+      for (int64_t j = part_start; j < part_end; j++) {
+        GeoArrowArrayViewChildRange(array_view, 1, j, &coord_start, &coord_end);
+        NANOARROW_RETURN_NOT_OK(
+            clip_path(clip, v, coords, coord_start, coord_end, relation, dimensions));
+      }
+      return v->geom_end(v);
+
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      return clip_polygon(clip, v, array_view, 0, i, relation, 1);
+
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      NANOARROW_RETURN_NOT_OK(
+          v->geom_start(v, GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON, dimensions));
+      GeoArrowArrayViewChildRange(array_view, 0, i, &part_start, &part_end);
+      for (int64_t j = part_start; j < part_end; j++) {
+        NANOARROW_RETURN_NOT_OK(clip_polygon(clip, v, array_view, 1, j, relation, 0));
+      }
+      return v->geom_end(v);
+
+    default:
+      return ENOTSUP;
+  }
+}
+
+GeoArrowErrorCode GeoArrowClipperInit(struct GeoArrowClipper* clipper,
+                                      const double* box, struct GeoArrowError* error) {
+  if (!(box[0] <= box[2]) || !(box[1] <= box[3])) {
+    GeoArrowErrorSet(error, "Expected xmin <= xmax and ymin <= ymax");
+    return EINVAL;
+  }
+
+  struct GeoArrowClipperPrivate* private_data =
+      (struct GeoArrowClipperPrivate*)ArrowMalloc(sizeof(struct GeoArrowClipperPrivate));
+  if (private_data == NULL) {
+    GeoArrowErrorSet(error, "Failed to allocate GeoArrowClipperPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowClipperPrivate));
+  memcpy(private_data->box, box, sizeof(private_data->box));
+  ArrowBufferInit(&private_data->coords);
+  ArrowBufferInit(&private_data->coords_tmp);
+  ArrowBufferInit(&private_data->part_offsets);
+
+  clipper->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowClipperVisit(struct GeoArrowClipper* clipper,
+                                       const struct GeoArrowArrayView* array_view,
+                                       int64_t offset, int64_t length,
+                                       struct GeoArrowVisitor* v) {
+  struct GeoArrowClipperPrivate* private_data =
+      (struct GeoArrowClipperPrivate*)clipper->private_data;
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      private_data->geometry_type = GEOARROW_GEOMETRY_TYPE_MULTILINESTRING;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      private_data->geometry_type = array_view->schema_view.geometry_type;
+      break;
+    default:
+      return ENOTSUP;
+  }
+
+  if (GeoArrowCoordTypeOrdinateSize(array_view->schema_view.coord_type) !=
+      (int64_t)sizeof(double)) {
+    return ENOTSUP;
+  }
+
+  for (int64_t i = 0; i < length; i++) {
+    int64_t raw_i = array_view->offset[0] + offset + i;
+    GEOARROW_RETURN_NOT_OK(v->feat_start(v));
+    if (array_view->validity_bitmap != NULL &&
+        !ArrowBitGet(array_view->validity_bitmap, raw_i)) {
+      GEOARROW_RETURN_NOT_OK(v->null_feat(v));
+    } else {
+      GEOARROW_RETURN_NOT_OK(clip_feature(private_data, v, array_view, raw_i));
+    }
+
+    GEOARROW_RETURN_NOT_OK(v->feat_end(v));
+  }
+
+  return GEOARROW_OK;
+}
+
+void GeoArrowClipperReset(struct GeoArrowClipper* clipper) {
+  struct GeoArrowClipperPrivate* private_data =
+      (struct GeoArrowClipperPrivate*)clipper->private_data;
+  ArrowBufferReset(&private_data->coords);
+  ArrowBufferReset(&private_data->coords_tmp);
+  ArrowBufferReset(&private_data->part_offsets);
+  ArrowFree(private_data);
+  clipper->private_data = NULL;
+}
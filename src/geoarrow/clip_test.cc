@@ -0,0 +1,117 @@
+#include <errno.h>
+#include <math.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+TEST(ClipTest, ClipInitErrors) {
+  struct GeoArrowClipper clipper;
+  struct GeoArrowError error;
+
+  double inverted[] = {10, 0, 0, 10};
+  EXPECT_EQ(GeoArrowClipperInit(&clipper, inverted, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected xmin <= xmax and ymin <= ymax");
+
+  double nan_box[] = {0, NAN, 10, 10};
+  EXPECT_EQ(GeoArrowClipperInit(&clipper, nan_box, &error), EINVAL);
+}
+
+TEST(ClipTest, ClipVisit) {
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowClipper clipper;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_LINESTRING,
+      {"LINESTRING (1 1, 2 2)", "", "LINESTRING (-10 5, 10 5, 20 5)",
+       "LINESTRING (0 20, 10 20)", "LINESTRING (-5 5, 5 5, 5 20, 8 20, 8 5, 15 5)"},
+      &array));
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+
+  double box[] = {0, 0, 10, 10};
+  ASSERT_EQ(GeoArrowClipperInit(&clipper, box, &error), GEOARROW_OK);
+
+  // Linestrings are written as multilinestrings because they may split
+  WKXTester tester;
+  EXPECT_EQ(GeoArrowClipperVisit(&clipper, &array_view, 0, 5, tester.WKTVisitor()),
+            GEOARROW_OK);
+  EXPECT_EQ(tester.WKTValues("<null value>"),
+            std::vector<std::string>(
+                {"MULTILINESTRING ((1 1, 2 2))", "<null value>",
+                 "MULTILINESTRING ((0 5, 10 5))", "MULTILINESTRING EMPTY",
+                 "MULTILINESTRING ((0 5, 5 5, 5 10), (8 10, 8 5, 10 5))"}));
+
+  // Features are relative to the start of the array view
+  EXPECT_EQ(GeoArrowClipperVisit(&clipper, &array_view, 2, 2, tester.WKTVisitor()),
+            GEOARROW_OK);
+  EXPECT_EQ(tester.WKTValues("<null value>"),
+            std::vector<std::string>(
+                {"MULTILINESTRING ((0 5, 10 5))", "MULTILINESTRING EMPTY"}));
+
+  GeoArrowClipperReset(&clipper);
+  array.release(&array);
+}
+
+TEST(ClipTest, ClipVisitPolygonCorner) {
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowClipper clipper;
+  struct GeoArrowError error;
+
+  // The diagonal edge passes exactly through the box corner (0.5 0.5), which must
+  // appear only once in the output
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_POLYGON,
+      {"POLYGON ((0 0, 4 0, 4 4, 0 0))", "POLYGON ((0.5 0.5, 3 0.5, 3 3, 0.5 0.5))"},
+      &array));
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_POLYGON),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+
+  double box[] = {0.5, 0.5, 3.5, 3};
+  ASSERT_EQ(GeoArrowClipperInit(&clipper, box, &error), GEOARROW_OK);
+
+  WKXTester tester;
+  EXPECT_EQ(GeoArrowClipperVisit(&clipper, &array_view, 0, 2, tester.WKTVisitor()),
+            GEOARROW_OK);
+  EXPECT_EQ(tester.WKTValues("<null value>"),
+            std::vector<std::string>(
+                {"POLYGON ((3.5 3, 3 3, 0.5 0.5, 3.5 0.5, 3.5 3))",
+                 "POLYGON ((0.5 0.5, 3 0.5, 3 3, 0.5 0.5))"}));
+
+  GeoArrowClipperReset(&clipper);
+  array.release(&array);
+}
+
+TEST(ClipTest, ClipVisitNotSupported) {
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowClipper clipper;
+  struct GeoArrowError error;
+  WKXTester tester;
+
+  double box[] = {0, 0, 10, 10};
+  ASSERT_EQ(GeoArrowClipperInit(&clipper, box, &error), GEOARROW_OK);
+
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(GEOARROW_TYPE_FLOAT_POINT, {"POINT (0 1)"}, &array));
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_FLOAT_POINT),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowClipperVisit(&clipper, &array_view, 0, 1, tester.WKTVisitor()),
+            ENOTSUP);
+  EXPECT_TRUE(tester.WKTValues().empty());
+
+  GeoArrowClipperReset(&clipper);
+  array.release(&array);
+}
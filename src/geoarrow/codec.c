@@ -0,0 +1,757 @@
+
+#include <errno.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Encoded buffers start with these bytes followed by a one-byte format version
+static const uint8_t kGeoArrowCodecMagic[4] = {'G', 'A', 'C', 'C'};
+#define GEOARROW_CODEC_VERSION 1
+
+// magic, version, has_validity, two reserved bytes, type, element counts for
+// each level of nesting, and the quantization scale and offset
+#define GEOARROW_CODEC_HEADER_SIZE (4 + 1 + 1 + 2 + 4 + 4 * 8 + 8 * 8)
+
+// Values are bit-packed in blocks of this many values, each of which is
+// prefixed by a single byte containing the bit width of the block
+#define GEOARROW_CODEC_BLOCK_SIZE 128
+
+struct GeoArrowCodecPrivate {
+  struct ArrowBuffer encoded;
+};
+
+// A decoded header plus the number of elements at each level of nesting
+// (i.e., the number of features, parts, rings, and coordinates)
+struct GeoArrowCodecLayout {
+  struct GeoArrowCodecHeader header;
+  struct GeoArrowSchemaView schema_view;
+  int32_t n_offsets;
+  int64_t counts[4];
+};
+
+struct GeoArrowCodecReader {
+  const uint8_t* data;
+  int64_t size_bytes;
+  int64_t pos;
+};
+
+// Iterates over the coordinate indices at which a new linestring or ring starts
+// (where the delta encoding resets)
+struct GeoArrowCodecRingStarts {
+  const int32_t* offsets;
+  int32_t base;
+  int64_t n;
+  int64_t i;
+  int64_t next;
+};
+
+GeoArrowErrorCode GeoArrowCodecInit(struct GeoArrowCodec* codec) {
+  struct GeoArrowCodecPrivate* private_data =
+      (struct GeoArrowCodecPrivate*)ArrowMalloc(sizeof(struct GeoArrowCodecPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowBufferInit(&private_data->encoded);
+  codec->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+void GeoArrowCodecReset(struct GeoArrowCodec* codec) {
+  struct GeoArrowCodecPrivate* private_data =
+      (struct GeoArrowCodecPrivate*)codec->private_data;
+  if (private_data != NULL) {
+    ArrowBufferReset(&private_data->encoded);
+    ArrowFree(private_data);
+    codec->private_data = NULL;
+  }
+}
+
+static inline void GeoArrowCodecRingStartsInit(struct GeoArrowCodecRingStarts* starts,
+                                               const int32_t* offsets, int64_t n) {
+  starts->offsets = offsets;
+  starts->base = n > 0 ? offsets[0] : 0;
+  starts->n = n;
+  starts->i = 0;
+  starts->next = n > 0 ? 0 : -1;
+}
+
+static inline int GeoArrowCodecRingStartsCheck(struct GeoArrowCodecRingStarts* starts,
+                                               int64_t j) {
+  if (starts->next != j) {
+    return 0;
+  }
+
+  // Skip over empty rings
+  while (starts->next == j) {
+    starts->i++;
+    starts->next = starts->i < starts->n
+                       ? (int64_t)starts->offsets[starts->i] - starts->base
+                       : -1;
+  }
+
+  return 1;
+}
+
+// Returns the index within the block starting at coordinate j at which the next
+// ring starts (or chunk_size if the next ring does not start within this block)
+static inline int64_t GeoArrowCodecRingStartsRunEnd(
+    const struct GeoArrowCodecRingStarts* starts, int64_t j, int64_t chunk_size) {
+  if (starts->next < 0 || starts->next >= (j + chunk_size)) {
+    return chunk_size;
+  }
+
+  return starts->next - j;
+}
+
+static inline int64_t GeoArrowCodecBlockLength(int64_t n_remaining) {
+  return n_remaining < GEOARROW_CODEC_BLOCK_SIZE ? n_remaining
+                                                : GEOARROW_CODEC_BLOCK_SIZE;
+}
+
+static inline uint32_t GeoArrowCodecZigZag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline uint32_t GeoArrowCodecUnZigZag(uint32_t value) {
+  return (value >> 1) ^ (0U - (value & 1U));
+}
+
+static GeoArrowErrorCode GeoArrowCodecAppendBlock(struct ArrowBuffer* out,
+                                                  const uint32_t* values, int64_t n) {
+  uint32_t all_bits = 0;
+  for (int64_t i = 0; i < n; i++) {
+    all_bits |= values[i];
+  }
+
+  uint8_t width = 0;
+  while (all_bits != 0) {
+    width++;
+    all_bits >>= 1;
+  }
+
+  int64_t n_words = (n * width + 63) / 64;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, 1 + n_words * 8));
+  ArrowBufferAppendUnsafe(out, &width, sizeof(uint8_t));
+  if (n_words == 0) {
+    return GEOARROW_OK;
+  }
+
+  uint64_t words[GEOARROW_CODEC_BLOCK_SIZE / 2];
+  memset(words, 0, (size_t)n_words * sizeof(uint64_t));
+  for (int64_t i = 0; i < n; i++) {
+    int64_t bit = i * width;
+    int64_t k = bit / 64;
+    int shift = (int)(bit % 64);
+    words[k] |= (uint64_t)values[i] << shift;
+    if ((shift + width) > 64) {
+      words[k + 1] |= (uint64_t)values[i] >> (64 - shift);
+    }
+  }
+
+  ArrowBufferAppendUnsafe(out, words, n_words * (int64_t)sizeof(uint64_t));
+  return GEOARROW_OK;
+}
+
+// Unpack n values of width bits from data, which must have at least 8 readable
+// bytes past the last byte containing packed values. Each value is read with a
+// single unaligned 64-bit load such that loops with a constant width are short and
+// branch-free.
+static inline void GeoArrowCodecUnpack(const uint8_t* data, uint32_t* values, int64_t n,
+                                       int width) {
+  uint64_t mask = ((uint64_t)1 << width) - 1;
+  uint64_t word;
+  for (int64_t i = 0; i < n; i++) {
+    int64_t bit = i * width;
+    memcpy(&word, data + bit / 8, sizeof(uint64_t));
+    values[i] = (uint32_t)((word >> (bit % 8)) & mask);
+  }
+}
+
+static GeoArrowErrorCode GeoArrowCodecReadBlock(struct GeoArrowCodecReader* reader,
+                                                uint32_t* values, int64_t n,
+                                                struct GeoArrowError* error) {
+  if (reader->pos >= reader->size_bytes) {
+    GeoArrowErrorSet(error, "Unexpected end of encoded buffer");
+    return EINVAL;
+  }
+
+  int width = reader->data[reader->pos++];
+  if (width > 32) {
+    GeoArrowErrorSet(error, "Invalid bit width %d in encoded buffer", width);
+    return EINVAL;
+  }
+
+  if (width == 0) {
+    memset(values, 0, (size_t)n * sizeof(uint32_t));
+    return GEOARROW_OK;
+  }
+
+  int64_t n_words = (n * width + 63) / 64;
+  if ((reader->size_bytes - reader->pos) < (n_words * 8)) {
+    GeoArrowErrorSet(error, "Unexpected end of encoded buffer");
+    return EINVAL;
+  }
+
+  // Packed values are copied to a zero-padded buffer such that
+  // GeoArrowCodecUnpack() may read past the last packed byte
+  uint8_t packed[GEOARROW_CODEC_BLOCK_SIZE * 4 + 8];
+  memcpy(packed, reader->data + reader->pos, (size_t)n_words * sizeof(uint64_t));
+  memset(packed + n_words * 8, 0, sizeof(uint64_t));
+  reader->pos += n_words * 8;
+
+  // Dispatch to a loop with a constant width so that the compiler can unroll it
+  switch (width) {
+#define GEOARROW_CODEC_UNPACK_CASE(w)   \
+  case w:                               \
+    GeoArrowCodecUnpack(packed, values, n, w); \
+    break
+    GEOARROW_CODEC_UNPACK_CASE(1);
+    GEOARROW_CODEC_UNPACK_CASE(2);
+    GEOARROW_CODEC_UNPACK_CASE(3);
+    GEOARROW_CODEC_UNPACK_CASE(4);
+    GEOARROW_CODEC_UNPACK_CASE(5);
+    GEOARROW_CODEC_UNPACK_CASE(6);
+    GEOARROW_CODEC_UNPACK_CASE(7);
+    GEOARROW_CODEC_UNPACK_CASE(8);
+    GEOARROW_CODEC_UNPACK_CASE(9);
+    GEOARROW_CODEC_UNPACK_CASE(10);
+    GEOARROW_CODEC_UNPACK_CASE(11);
+    GEOARROW_CODEC_UNPACK_CASE(12);
+    GEOARROW_CODEC_UNPACK_CASE(13);
+    GEOARROW_CODEC_UNPACK_CASE(14);
+    GEOARROW_CODEC_UNPACK_CASE(15);
+    GEOARROW_CODEC_UNPACK_CASE(16);
+    GEOARROW_CODEC_UNPACK_CASE(17);
+    GEOARROW_CODEC_UNPACK_CASE(18);
+    GEOARROW_CODEC_UNPACK_CASE(19);
+    GEOARROW_CODEC_UNPACK_CASE(20);
+    GEOARROW_CODEC_UNPACK_CASE(21);
+    GEOARROW_CODEC_UNPACK_CASE(22);
+    GEOARROW_CODEC_UNPACK_CASE(23);
+    GEOARROW_CODEC_UNPACK_CASE(24);
+    GEOARROW_CODEC_UNPACK_CASE(25);
+    GEOARROW_CODEC_UNPACK_CASE(26);
+    GEOARROW_CODEC_UNPACK_CASE(27);
+    GEOARROW_CODEC_UNPACK_CASE(28);
+    GEOARROW_CODEC_UNPACK_CASE(29);
+    GEOARROW_CODEC_UNPACK_CASE(30);
+    GEOARROW_CODEC_UNPACK_CASE(31);
+    GEOARROW_CODEC_UNPACK_CASE(32);
+#undef GEOARROW_CODEC_UNPACK_CASE
+    default:
+      break;
+  }
+
+  return GEOARROW_OK;
+}
+
+static void GeoArrowCodecAppendHeader(struct ArrowBuffer* out,
+                                      const struct GeoArrowCodecLayout* layout) {
+  uint8_t version = GEOARROW_CODEC_VERSION;
+  uint8_t has_validity = layout->header.has_validity != 0;
+  uint16_t reserved = 0;
+  int32_t type = (int32_t)layout->header.type;
+
+  ArrowBufferAppendUnsafe(out, kGeoArrowCodecMagic, sizeof(kGeoArrowCodecMagic));
+  ArrowBufferAppendUnsafe(out, &version, sizeof(uint8_t));
+  ArrowBufferAppendUnsafe(out, &has_validity, sizeof(uint8_t));
+  ArrowBufferAppendUnsafe(out, &reserved, sizeof(uint16_t));
+  ArrowBufferAppendUnsafe(out, &type, sizeof(int32_t));
+  ArrowBufferAppendUnsafe(out, layout->counts, sizeof(layout->counts));
+  ArrowBufferAppendUnsafe(out, layout->header.quantization.scale,
+                          sizeof(layout->header.quantization.scale));
+  ArrowBufferAppendUnsafe(out, layout->header.quantization.offset,
+                          sizeof(layout->header.quantization.offset));
+}
+
+static GeoArrowErrorCode GeoArrowCodecReadLayout(struct GeoArrowBufferView encoded,
+                                                 struct GeoArrowCodecLayout* layout,
+                                                 struct GeoArrowError* error) {
+  if (encoded.size_bytes < GEOARROW_CODEC_HEADER_SIZE ||
+      memcmp(encoded.data, kGeoArrowCodecMagic, sizeof(kGeoArrowCodecMagic)) != 0) {
+    GeoArrowErrorSet(error, "Buffer is not a GeoArrow-encoded coordinate buffer");
+    return EINVAL;
+  }
+
+  const uint8_t* data = encoded.data + sizeof(kGeoArrowCodecMagic);
+  if (data[0] != GEOARROW_CODEC_VERSION) {
+    GeoArrowErrorSet(error, "Unsupported encoded coordinate buffer version %d",
+                     (int)data[0]);
+    return EINVAL;
+  }
+
+  layout->header.has_validity = data[1] != 0;
+  data += 4;
+
+  int32_t type;
+  memcpy(&type, data, sizeof(int32_t));
+  data += sizeof(int32_t);
+  memcpy(layout->counts, data, sizeof(layout->counts));
+  data += sizeof(layout->counts);
+  memcpy(layout->header.quantization.scale, data,
+         sizeof(layout->header.quantization.scale));
+  data += sizeof(layout->header.quantization.scale);
+  memcpy(layout->header.quantization.offset, data,
+         sizeof(layout->header.quantization.offset));
+
+  GEOARROW_RETURN_NOT_OK(
+      GeoArrowSchemaViewInitFromType(&layout->schema_view, (enum GeoArrowType)type));
+  switch (layout->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      layout->n_offsets = 0;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      layout->n_offsets = 1;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      layout->n_offsets = 2;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      layout->n_offsets = 3;
+      break;
+    default:
+      GeoArrowErrorSet(error, "Unexpected type in encoded coordinate buffer");
+      return EINVAL;
+  }
+
+  for (int i = 0; i < 4; i++) {
+    if (layout->counts[i] < 0 || (i > layout->n_offsets && layout->counts[i] != 0)) {
+      GeoArrowErrorSet(error, "Invalid element count in encoded coordinate buffer");
+      return EINVAL;
+    }
+  }
+
+  layout->header.type = (enum GeoArrowType)type;
+  layout->header.length = layout->counts[0];
+  layout->header.n_coords = layout->counts[layout->n_offsets];
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowCodecReadHeader(struct GeoArrowBufferView encoded,
+                                          struct GeoArrowCodecHeader* header,
+                                          struct GeoArrowError* error) {
+  struct GeoArrowCodecLayout layout;
+  GEOARROW_RETURN_NOT_OK(GeoArrowCodecReadLayout(encoded, &layout, error));
+  *header = layout.header;
+  return GEOARROW_OK;
+}
+
+static GeoArrowErrorCode GeoArrowCodecEncodeValidity(
+    struct ArrowBuffer* out, const struct GeoArrowArrayView* array_view) {
+  int64_t offset = array_view->offset[0];
+  int64_t length = array_view->length[0];
+  int64_t n_bytes = (length + 7) / 8;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(out, n_bytes));
+
+  if ((offset % 8) == 0) {
+    ArrowBufferAppendUnsafe(out, array_view->validity_bitmap + offset / 8, n_bytes);
+    return GEOARROW_OK;
+  }
+
+  uint8_t* bits = out->data + out->size_bytes;
+  memset(bits, 0, (size_t)n_bytes);
+  for (int64_t i = 0; i < length; i++) {
+    ArrowBitSetTo(bits, i, ArrowBitGet(array_view->validity_bitmap, offset + i));
+  }
+
+  out->size_bytes += n_bytes;
+  return GEOARROW_OK;
+}
+
+static GeoArrowErrorCode GeoArrowCodecEncodeLengths(struct ArrowBuffer* out,
+                                                    const int32_t* offsets,
+                                                    int64_t n) {
+  uint32_t values[GEOARROW_CODEC_BLOCK_SIZE];
+  for (int64_t i = 0; i < n; i += GEOARROW_CODEC_BLOCK_SIZE) {
+    int64_t chunk_size = GeoArrowCodecBlockLength(n - i);
+    for (int64_t j = 0; j < chunk_size; j++) {
+      values[j] = (uint32_t)(offsets[i + j + 1] - offsets[i + j]);
+    }
+
+    NANOARROW_RETURN_NOT_OK(GeoArrowCodecAppendBlock(out, values, chunk_size));
+  }
+
+  return GEOARROW_OK;
+}
+
+// Load chunk_size quantized ordinates for dimension i starting at the absolute
+// coordinate index start
+static void GeoArrowCodecLoadOrdinates(const struct GeoArrowArrayView* array_view,
+                                       const struct GeoArrowQuantization* quantization,
+                                       int i, int64_t start, int64_t chunk_size,
+                                       int32_t* out) {
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+
+  if (GeoArrowCoordTypeIsQuantized(coord_type)) {
+    const struct GeoArrowInt32CoordView* coords = &array_view->coords_int32;
+    const int32_t* src = coords->values[i] + start * coords->coords_stride;
+    for (int64_t j = 0; j < chunk_size; j++) {
+      out[j] = src[j * coords->coords_stride];
+    }
+  } else if (GeoArrowCoordTypeIsFloat(coord_type)) {
+    const struct GeoArrowFloatCoordView* coords = &array_view->coords_float;
+    const float* src = coords->values[i] + start * coords->coords_stride;
+    double values[GEOARROW_CODEC_BLOCK_SIZE];
+    for (int64_t j = 0; j < chunk_size; j++) {
+      values[j] = src[j * coords->coords_stride];
+    }
+
+    GeoArrowQuantizeOrdinates(values, 1, out, 1, chunk_size, quantization->scale[i],
+                              quantization->offset[i]);
+  } else {
+    const struct GeoArrowCoordView* coords = &array_view->coords;
+    GeoArrowQuantizeOrdinates(coords->values[i] + start * coords->coords_stride,
+                              coords->coords_stride, out, 1, chunk_size,
+                              quantization->scale[i], quantization->offset[i]);
+  }
+}
+
+static GeoArrowErrorCode GeoArrowCodecEncodeOrdinates(
+    struct ArrowBuffer* out, const struct GeoArrowArrayView* array_view,
+    const struct GeoArrowQuantization* quantization,
+    const struct GeoArrowCodecLayout* layout, const int32_t* ring_offsets,
+    int64_t coord_start, int i) {
+  int64_t n_coords = layout->counts[layout->n_offsets];
+  int64_t n_rings = layout->n_offsets > 0 ? layout->counts[layout->n_offsets - 1] : 0;
+
+  struct GeoArrowCodecRingStarts starts;
+  GeoArrowCodecRingStartsInit(&starts, ring_offsets, n_rings);
+
+  int32_t ordinates[GEOARROW_CODEC_BLOCK_SIZE];
+  uint32_t values[GEOARROW_CODEC_BLOCK_SIZE];
+  uint32_t previous = 0;
+  for (int64_t j = 0; j < n_coords; j += GEOARROW_CODEC_BLOCK_SIZE) {
+    int64_t chunk_size = GeoArrowCodecBlockLength(n_coords - j);
+    GeoArrowCodecLoadOrdinates(array_view, quantization, i, coord_start + j, chunk_size,
+                               ordinates);
+
+    int64_t k = 0;
+    while (k < chunk_size) {
+      if (GeoArrowCodecRingStartsCheck(&starts, j + k)) {
+        previous = 0;
+      }
+
+      int64_t run_end = GeoArrowCodecRingStartsRunEnd(&starts, j, chunk_size);
+      for (; k < run_end; k++) {
+        uint32_t current = (uint32_t)ordinates[k];
+        values[k] = GeoArrowCodecZigZag((int32_t)(current - previous));
+        previous = current;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(GeoArrowCodecAppendBlock(out, values, chunk_size));
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowCodecEncode(struct GeoArrowCodec* codec,
+                                      const struct GeoArrowArrayView* array_view,
+                                      const struct GeoArrowQuantization* quantization,
+                                      struct GeoArrowBufferView* out,
+                                      struct GeoArrowError* error) {
+  struct GeoArrowCodecPrivate* private_data =
+      (struct GeoArrowCodecPrivate*)codec->private_data;
+  const struct GeoArrowSchemaView* schema_view = &array_view->schema_view;
+
+  switch (schema_view->geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      break;
+    default:
+      GeoArrowErrorSet(error, "Can't encode array with type %d", (int)schema_view->type);
+      return EINVAL;
+  }
+
+  int n_values;
+  if (GeoArrowCoordTypeIsQuantized(schema_view->coord_type)) {
+    quantization = &array_view->quantization;
+    n_values = array_view->coords_int32.n_values;
+  } else if (quantization == NULL) {
+    GeoArrowErrorSet(error, "Quantization is required to encode %s coordinates",
+                     GeoArrowCoordTypeIsFloat(schema_view->coord_type) ? "float"
+                                                                       : "double");
+    return EINVAL;
+  } else if (GeoArrowCoordTypeIsFloat(schema_view->coord_type)) {
+    n_values = array_view->coords_float.n_values;
+  } else {
+    n_values = array_view->coords.n_values;
+  }
+
+  for (int i = 0; i < n_values; i++) {
+    if (quantization->scale[i] == 0) {
+      GeoArrowErrorSet(error, "Quantization scale must be non-zero");
+      return EINVAL;
+    }
+  }
+
+  // Compute the range of elements referenced at each level of nesting
+  struct GeoArrowCodecLayout layout;
+  memset(&layout, 0, sizeof(layout));
+  layout.header.type = schema_view->type;
+  layout.header.has_validity = array_view->validity_bitmap != NULL;
+  layout.header.quantization = *quantization;
+  layout.n_offsets = array_view->n_offsets;
+
+  int64_t start[4];
+  start[0] = array_view->offset[0];
+  layout.counts[0] = array_view->length[0];
+  for (int32_t i = 0; i < array_view->n_offsets; i++) {
+    const int32_t* offsets = array_view->offsets[i] + start[i];
+    start[i + 1] = array_view->offset[i + 1] + offsets[0];
+    layout.counts[i + 1] = offsets[layout.counts[i]] - offsets[0];
+  }
+
+  struct ArrowBuffer* encoded = &private_data->encoded;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(encoded, 0, 0));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(encoded, GEOARROW_CODEC_HEADER_SIZE));
+  GeoArrowCodecAppendHeader(encoded, &layout);
+
+  if (layout.header.has_validity) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowCodecEncodeValidity(encoded, array_view));
+  }
+
+  for (int32_t i = 0; i < layout.n_offsets; i++) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowCodecEncodeLengths(
+        encoded, array_view->offsets[i] + start[i], layout.counts[i]));
+  }
+
+  const int32_t* ring_offsets = NULL;
+  if (layout.n_offsets > 0) {
+    ring_offsets =
+        array_view->offsets[layout.n_offsets - 1] + start[layout.n_offsets - 1];
+  }
+
+  for (int i = 0; i < n_values; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowCodecEncodeOrdinates(encoded, array_view, quantization, &layout,
+                                     ring_offsets, start[layout.n_offsets], i));
+  }
+
+  out->data = encoded->data;
+  out->size_bytes = encoded->size_bytes;
+  return GEOARROW_OK;
+}
+
+static void GeoArrowCodecFreeBuffer(uint8_t* ptr, int64_t size, void* private_data) {
+  GEOARROW_UNUSED(size);
+  GEOARROW_UNUSED(private_data);
+  ArrowFree(ptr);
+}
+
+// Allocate a buffer and transfer its ownership to the builder
+static GeoArrowErrorCode GeoArrowCodecAllocateBuffer(struct GeoArrowBuilder* builder,
+                                                     int64_t i, int64_t size_bytes,
+                                                     uint8_t** out) {
+  *out = NULL;
+  if (size_bytes == 0) {
+    return GEOARROW_OK;
+  }
+
+  uint8_t* data = (uint8_t*)ArrowMalloc(size_bytes);
+  if (data == NULL) {
+    return ENOMEM;
+  }
+
+  struct GeoArrowBufferView value;
+  value.data = data;
+  value.size_bytes = size_bytes;
+  GeoArrowErrorCode result =
+      GeoArrowBuilderSetOwnedBuffer(builder, i, value, &GeoArrowCodecFreeBuffer, NULL);
+  if (result != GEOARROW_OK) {
+    ArrowFree(data);
+    return result;
+  }
+
+  *out = data;
+  return GEOARROW_OK;
+}
+
+static GeoArrowErrorCode GeoArrowCodecDecodeOffsets(struct GeoArrowCodecReader* reader,
+                                                    int64_t n, int64_t n_children,
+                                                    int32_t* out,
+                                                    struct GeoArrowError* error) {
+  uint32_t values[GEOARROW_CODEC_BLOCK_SIZE];
+  int64_t offset = 0;
+  out[0] = 0;
+  for (int64_t i = 0; i < n; i += GEOARROW_CODEC_BLOCK_SIZE) {
+    int64_t chunk_size = GeoArrowCodecBlockLength(n - i);
+    GEOARROW_RETURN_NOT_OK(GeoArrowCodecReadBlock(reader, values, chunk_size, error));
+    for (int64_t j = 0; j < chunk_size; j++) {
+      offset += values[j];
+      if (offset > n_children) {
+        break;
+      }
+
+      out[i + j + 1] = (int32_t)offset;
+    }
+  }
+
+  if (offset != n_children) {
+    GeoArrowErrorSet(error, "Encoded offsets do not match the number of child elements");
+    return EINVAL;
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowCodecDecode(struct GeoArrowCodec* codec,
+                                      struct GeoArrowBufferView encoded,
+                                      struct GeoArrowBuilder* builder,
+                                      struct GeoArrowError* error) {
+  GEOARROW_UNUSED(codec);
+
+  struct GeoArrowCodecLayout layout;
+  GEOARROW_RETURN_NOT_OK(GeoArrowCodecReadLayout(encoded, &layout, error));
+
+  const struct GeoArrowSchemaView* schema_view = &builder->view.schema_view;
+  if (schema_view->geometry_type != layout.schema_view.geometry_type ||
+      schema_view->dimensions != layout.schema_view.dimensions) {
+    GeoArrowErrorSet(error,
+                     "Can't decode encoded array with type %d into builder with type %d",
+                     (int)layout.header.type, (int)schema_view->type);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < builder->view.n_buffers; i++) {
+    if (builder->view.buffers[i].size_bytes != 0) {
+      GeoArrowErrorSet(error, "Can't decode into a builder that is not empty");
+      return EINVAL;
+    }
+  }
+
+  enum GeoArrowCoordType coord_type = schema_view->coord_type;
+  int is_quantized = GeoArrowCoordTypeIsQuantized(coord_type);
+  int is_float = GeoArrowCoordTypeIsFloat(coord_type);
+  int n_values = builder->view.coords.n_values;
+  const struct GeoArrowQuantization* quantization = &layout.header.quantization;
+
+  if (is_quantized) {
+    n_values = builder->view.coords_int32.n_values;
+    for (int i = 0; i < n_values; i++) {
+      if (builder->view.quantization.scale[i] != quantization->scale[i] ||
+          builder->view.quantization.offset[i] != quantization->offset[i]) {
+        GeoArrowErrorSet(error,
+                         "Builder quantization does not match encoded quantization");
+        return EINVAL;
+      }
+    }
+  } else if (is_float) {
+    n_values = builder->view.coords_float.n_values;
+  }
+
+  struct GeoArrowCodecReader reader;
+  reader.data = encoded.data;
+  reader.size_bytes = encoded.size_bytes;
+  reader.pos = GEOARROW_CODEC_HEADER_SIZE;
+
+  uint8_t* buffer;
+  if (layout.header.has_validity) {
+    int64_t n_bytes = (layout.counts[0] + 7) / 8;
+    if ((reader.size_bytes - reader.pos) < n_bytes) {
+      GeoArrowErrorSet(error, "Unexpected end of encoded buffer");
+      return EINVAL;
+    }
+
+    GEOARROW_RETURN_NOT_OK(GeoArrowCodecAllocateBuffer(builder, 0, n_bytes, &buffer));
+    if (n_bytes > 0) {
+      memcpy(buffer, reader.data + reader.pos, (size_t)n_bytes);
+    }
+
+    reader.pos += n_bytes;
+  }
+
+  const int32_t* ring_offsets = NULL;
+  for (int32_t i = 0; i < layout.n_offsets; i++) {
+    if (layout.counts[i + 1] > INT32_MAX) {
+      GeoArrowErrorSet(error, "Encoded array is too large to decode");
+      return EINVAL;
+    }
+
+    GEOARROW_RETURN_NOT_OK(GeoArrowCodecAllocateBuffer(
+        builder, 1 + i, (layout.counts[i] + 1) * (int64_t)sizeof(int32_t), &buffer));
+    GEOARROW_RETURN_NOT_OK(GeoArrowCodecDecodeOffsets(
+        &reader, layout.counts[i], layout.counts[i + 1], (int32_t*)buffer, error));
+    ring_offsets = (const int32_t*)buffer;
+  }
+
+  // Allocate the coordinate buffers and compute where each dimension is written
+  int64_t n_coords = layout.counts[layout.n_offsets];
+  int64_t n_rings = layout.n_offsets > 0 ? layout.counts[layout.n_offsets - 1] : 0;
+  int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(coord_type);
+  int64_t first_coord_buffer = 1 + layout.n_offsets;
+  uint8_t* dst[4];
+  int64_t dst_stride;
+  if (GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_INTERLEAVED) {
+    GEOARROW_RETURN_NOT_OK(GeoArrowCodecAllocateBuffer(
+        builder, first_coord_buffer, n_coords * n_values * ordinate_size, &buffer));
+    for (int i = 0; i < n_values; i++) {
+      dst[i] = buffer + i * ordinate_size;
+    }
+
+    dst_stride = n_values;
+  } else {
+    for (int i = 0; i < n_values; i++) {
+      GEOARROW_RETURN_NOT_OK(GeoArrowCodecAllocateBuffer(
+          builder, first_coord_buffer + i, n_coords * ordinate_size, &dst[i]));
+    }
+
+    dst_stride = 1;
+  }
+
+  int32_t ordinates[GEOARROW_CODEC_BLOCK_SIZE];
+  uint32_t values[GEOARROW_CODEC_BLOCK_SIZE];
+  double decoded[GEOARROW_CODEC_BLOCK_SIZE];
+  struct GeoArrowCodecRingStarts starts;
+  for (int i = 0; i < n_values; i++) {
+    GeoArrowCodecRingStartsInit(&starts, ring_offsets, n_rings);
+    double scale = quantization->scale[i];
+    double offset = quantization->offset[i];
+    uint32_t previous = 0;
+
+    for (int64_t j = 0; j < n_coords; j += GEOARROW_CODEC_BLOCK_SIZE) {
+      int64_t chunk_size = GeoArrowCodecBlockLength(n_coords - j);
+      GEOARROW_RETURN_NOT_OK(GeoArrowCodecReadBlock(&reader, values, chunk_size, error));
+
+      int64_t k = 0;
+      while (k < chunk_size) {
+        if (GeoArrowCodecRingStartsCheck(&starts, j + k)) {
+          previous = 0;
+        }
+
+        int64_t run_end = GeoArrowCodecRingStartsRunEnd(&starts, j, chunk_size);
+        for (; k < run_end; k++) {
+          previous += GeoArrowCodecUnZigZag(values[k]);
+          ordinates[k] = (int32_t)previous;
+        }
+      }
+
+      if (is_quantized) {
+        int32_t* out = (int32_t*)dst[i] + j * dst_stride;
+        for (int64_t k = 0; k < chunk_size; k++) {
+          out[k * dst_stride] = ordinates[k];
+        }
+      } else if (is_float) {
+        float* out = (float*)dst[i] + j * dst_stride;
+        GeoArrowDequantizeOrdinates(ordinates, 1, decoded, 1, chunk_size, scale, offset);
+        for (int64_t k = 0; k < chunk_size; k++) {
+          out[k * dst_stride] = (float)decoded[k];
+        }
+      } else {
+        GeoArrowDequantizeOrdinates(ordinates, 1, (double*)dst[i] + j * dst_stride,
+                                    dst_stride, chunk_size, scale, offset);
+      }
+    }
+  }
+
+  return GEOARROW_OK;
+}
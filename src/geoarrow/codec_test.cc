@@ -0,0 +1,329 @@
+
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+static std::vector<std::string> DecodeToWKT(struct GeoArrowBufferView encoded,
+                                            enum GeoArrowType type) {
+  struct GeoArrowCodec codec;
+  struct GeoArrowBuilder builder;
+  struct GeoArrowError error;
+  struct ArrowArray array;
+
+  EXPECT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowBuilderInitFromType(&builder, type), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowCodecDecode(&codec, encoded, &builder, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(GeoArrowBuilderFinish(&builder, &array, &error), GEOARROW_OK)
+      << error.message;
+  GeoArrowBuilderReset(&builder);
+  GeoArrowCodecReset(&codec);
+
+  std::vector<std::string> out = FormatWKT(type, &array);
+  array.release(&array);
+  return out;
+}
+
+class CodecTypeParameterizedTestFixture
+    : public ::testing::TestWithParam<enum GeoArrowType> {};
+
+TEST_P(CodecTypeParameterizedTestFixture, CodecTestRoundtrip) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+
+  std::vector<std::string> wkts;
+  switch (schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      wkts = {"POINT (0.125 1)", "", "POINT (-1000.5 123456.875)", "POINT (2 3)"};
+      break;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      wkts = {"LINESTRING (0.125 1, 2 3, -4 5.5)", "", "LINESTRING EMPTY",
+              "LINESTRING (1000 1000, 1000.5 999.75)"};
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      wkts = {"POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0), (0.25 0.25, 0.5 0.25, 0.25 0.5, "
+              "0.25 0.25))",
+              "", "POLYGON EMPTY", "POLYGON ((10 10, 11 10, 10 11, 10 10))"};
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      wkts = {"MULTIPOINT ((0 1), (2 3))", "", "MULTIPOINT EMPTY",
+              "MULTIPOINT ((-4.5 5))"};
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      wkts = {"MULTILINESTRING ((0 1, 2 3), (4 5, 6 7, 8 9))", "",
+              "MULTILINESTRING EMPTY", "MULTILINESTRING ((-1 -2, -3 -4))"};
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      wkts = {"MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5), (5.25 5.25, "
+              "5.5 5.25, 5.5 5.5, 5.25 5.25)))",
+              "", "MULTIPOLYGON EMPTY", "MULTIPOLYGON (((10 10, 11 10, 10 11, 10 10)))"};
+      break;
+    default:
+      FAIL();
+  }
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, type), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[0] = 0.125;
+  quantization.scale[1] = 0.125;
+
+  struct GeoArrowCodec codec;
+  struct GeoArrowError error;
+  struct GeoArrowBufferView encoded;
+  ASSERT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &array_view, &quantization, &encoded, &error),
+            GEOARROW_OK)
+      << error.message;
+
+  struct GeoArrowCodecHeader header;
+  ASSERT_EQ(GeoArrowCodecReadHeader(encoded, &header, &error), GEOARROW_OK);
+  EXPECT_EQ(header.type, type);
+  EXPECT_EQ(header.length, 4);
+  EXPECT_EQ(header.n_coords, array_view.coords.n_coords);
+  EXPECT_TRUE(header.has_validity);
+  EXPECT_EQ(header.quantization.scale[0], 0.125);
+
+  // Decode into a builder with the original type and into one with each of the
+  // other coordinate types
+  for (auto coord_type : {GEOARROW_COORD_TYPE_SEPARATE, GEOARROW_COORD_TYPE_INTERLEAVED,
+                          GEOARROW_COORD_TYPE_SEPARATE_FLOAT,
+                          GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT}) {
+    enum GeoArrowType type_out = GeoArrowMakeType(
+        schema_view.geometry_type, schema_view.dimensions, coord_type);
+    SCOPED_TRACE(std::to_string(type_out));
+    EXPECT_EQ(DecodeToWKT(encoded, type_out), FormatWKT(type, &array));
+  }
+
+  // Sliced input only encodes the referenced features
+  array.offset = 2;
+  array.length = 2;
+  struct GeoArrowArrayView sliced_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&sliced_view, type), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&sliced_view, &array, nullptr), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &sliced_view, &quantization, &encoded, &error),
+            GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(GeoArrowCodecReadHeader(encoded, &header, &error), GEOARROW_OK);
+  EXPECT_EQ(header.length, 2);
+  EXPECT_EQ(DecodeToWKT(encoded, type), FormatWKT(type, &array));
+
+  GeoArrowCodecReset(&codec);
+  array.release(&array);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CodecTest, CodecTypeParameterizedTestFixture,
+    ::testing::Values(GEOARROW_TYPE_POINT, GEOARROW_TYPE_LINESTRING,
+                      GEOARROW_TYPE_POLYGON, GEOARROW_TYPE_MULTIPOINT,
+                      GEOARROW_TYPE_MULTILINESTRING, GEOARROW_TYPE_MULTIPOLYGON,
+                      GEOARROW_TYPE_INTERLEAVED_POINT,
+                      GEOARROW_TYPE_INTERLEAVED_LINESTRING,
+                      GEOARROW_TYPE_FLOAT_POLYGON));
+
+TEST(CodecTest, CodecTestInt32) {
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[0] = 1e-7;
+  quantization.scale[1] = 1e-7;
+
+  // Build a quantized array with coordinates that span the full int32 range
+  struct GeoArrowNativeWriter writer;
+  struct GeoArrowVisitor v;
+  struct ArrowArray array;
+  WKXTester tester;
+  ASSERT_EQ(GeoArrowNativeWriterInit(&writer, GEOARROW_TYPE_INT32_LINESTRING),
+            GEOARROW_OK);
+  GeoArrowNativeWriterSetQuantization(&writer, &quantization);
+  GeoArrowNativeWriterInitVisitor(&writer, &v);
+  tester.ReadWKT("LINESTRING (-179.9999999 -89.9999999, 179.9999999 89.9999999, 0 0)",
+                 &v);
+  ASSERT_EQ(GeoArrowNativeWriterFinish(&writer, &array, nullptr), GEOARROW_OK);
+  GeoArrowNativeWriterReset(&writer);
+
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_INT32_LINESTRING),
+            GEOARROW_OK);
+  array_view.quantization = quantization;
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  // The array's own quantization is used for quantized input
+  struct GeoArrowCodec codec;
+  struct GeoArrowError error;
+  struct GeoArrowBufferView encoded;
+  ASSERT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &array_view, nullptr, &encoded, &error),
+            GEOARROW_OK)
+      << error.message;
+
+  // Decoding into a builder with a different quantization fails
+  struct GeoArrowBuilder builder;
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_INT32_LINESTRING),
+            GEOARROW_OK);
+  EXPECT_EQ(GeoArrowCodecDecode(&codec, encoded, &builder, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Builder quantization does not match encoded quantization");
+
+  // ...but with the same quantization the stored values are copied exactly
+  builder.view.quantization = quantization;
+  ASSERT_EQ(GeoArrowCodecDecode(&codec, encoded, &builder, &error), GEOARROW_OK)
+      << error.message;
+  struct ArrowArray array_out;
+  ASSERT_EQ(GeoArrowBuilderFinish(&builder, &array_out, &error), GEOARROW_OK);
+  GeoArrowBuilderReset(&builder);
+
+  struct GeoArrowArrayView array_view_out;
+  ASSERT_EQ(
+      GeoArrowArrayViewInitFromType(&array_view_out, GEOARROW_TYPE_INT32_LINESTRING),
+      GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view_out, &array_out, nullptr), GEOARROW_OK);
+  ASSERT_EQ(array_view_out.coords_int32.n_coords, 3);
+  for (int i = 0; i < 2; i++) {
+    for (int64_t j = 0; j < 3; j++) {
+      EXPECT_EQ(array_view_out.coords_int32.values[i][j],
+                array_view.coords_int32.values[i][j]);
+    }
+  }
+
+  EXPECT_EQ(array_view_out.coords_int32.values[0][0], -1799999999);
+  EXPECT_EQ(array_view_out.coords_int32.values[0][1], 1799999999);
+
+  GeoArrowCodecReset(&codec);
+  array.release(&array);
+  array_out.release(&array_out);
+}
+
+TEST(CodecTest, CodecTestCompression) {
+  // A long, smooth linestring should compress to a fraction of its size
+  std::string wkt = "LINESTRING (";
+  for (int i = 0; i < 1000; i++) {
+    if (i > 0) {
+      wkt += ", ";
+    }
+    wkt += std::to_string(-122.0 + i * 0.0001) + " " + std::to_string(49.0 + i * 0.0002);
+  }
+  wkt += ")";
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_LINESTRING, {wkt}, &array));
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[0] = 1e-7;
+  quantization.scale[1] = 1e-7;
+
+  struct GeoArrowCodec codec;
+  struct GeoArrowBufferView encoded;
+  ASSERT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &array_view, &quantization, &encoded, nullptr),
+            GEOARROW_OK);
+  EXPECT_LT(encoded.size_bytes, 1000 * 2 * 8 / 4);
+
+  GeoArrowCodecReset(&codec);
+  array.release(&array);
+}
+
+TEST(CodecTest, CodecTestErrors) {
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(GEOARROW_TYPE_LINESTRING, {"LINESTRING (0 1, 2 3)"}, &array));
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  struct GeoArrowCodec codec;
+  struct GeoArrowError error;
+  struct GeoArrowBufferView encoded;
+  ASSERT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+
+  // Double coordinates require a quantization
+  EXPECT_EQ(GeoArrowCodecEncode(&codec, &array_view, nullptr, &encoded, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Quantization is required to encode double coordinates");
+
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[1] = 0;
+  EXPECT_EQ(GeoArrowCodecEncode(&codec, &array_view, &quantization, &encoded, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Quantization scale must be non-zero");
+
+  GeoArrowQuantizationInitDefault(&quantization);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &array_view, &quantization, &encoded, &error),
+            GEOARROW_OK);
+  std::vector<uint8_t> bytes(encoded.data, encoded.data + encoded.size_bytes);
+
+  // Mismatched builder type
+  struct GeoArrowBuilder builder;
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_POINT), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowCodecDecode(&codec, encoded, &builder, &error), EINVAL);
+  GeoArrowBuilderReset(&builder);
+
+  // Truncated input
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  struct GeoArrowBufferView truncated = {bytes.data(),
+                                         static_cast<int64_t>(bytes.size() - 1)};
+  EXPECT_EQ(GeoArrowCodecDecode(&codec, truncated, &builder, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Unexpected end of encoded buffer");
+  GeoArrowBuilderReset(&builder);
+
+  // Not an encoded buffer
+  bytes[0] = 'x';
+  struct GeoArrowCodecHeader header;
+  struct GeoArrowBufferView invalid = {bytes.data(), static_cast<int64_t>(bytes.size())};
+  EXPECT_EQ(GeoArrowCodecReadHeader(invalid, &header, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Buffer is not a GeoArrow-encoded coordinate buffer");
+
+  GeoArrowCodecReset(&codec);
+  array.release(&array);
+}
+
+TEST(CodecTest, CodecTestZM) {
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM,
+      {"MULTILINESTRING ZM ((0 1 2 3, 4 5 6 7), (8 9 10 11, 12 13 14 15))"}, &array));
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view,
+                                          GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.offset[2] = 1000;
+  quantization.scale[3] = 0.5;
+
+  struct GeoArrowCodec codec;
+  struct GeoArrowError error;
+  struct GeoArrowBufferView encoded;
+  ASSERT_EQ(GeoArrowCodecInit(&codec), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowCodecEncode(&codec, &array_view, &quantization, &encoded, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(DecodeToWKT(encoded, GEOARROW_TYPE_MULTILINESTRING_ZM),
+            std::vector<std::string>(
+                {"MULTILINESTRING ZM ((0 1 2 3, 4 5 6 7), (8 9 10 11, 12 13 14 15))"}));
+
+  GeoArrowCodecReset(&codec);
+  array.release(&array);
+}
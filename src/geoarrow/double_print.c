@@ -1,13 +1,98 @@
-
 #include "geoarrow/geoarrow_type.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+
+// Values whose shortest round-trip representation has at most this many decimal
+// places (e.g., integers or the millimetre-rounded values common in projected data)
+// are printed without ryu/snprintf(). Below kGeoArrowPrintFastMax the distance
+// between adjacent doubles is less than 10^-kGeoArrowPrintFastMaxDecimals, so at
+// most one such decimal can round to a given double and it is the shortest.
+#define GEOARROW_PRINT_FAST_MAX_DECIMALS 3
+static const double kGeoArrowPrintFastMax = 1e12;
+static const double kGeoArrowPrintFastPow10[] = {1, 10, 100, 1000};
+
+static inline int64_t GeoArrowPrintUInt64(uint64_t value, char* result) {
+  char digits[20];
+  int64_t n_digits = 0;
+  do {
+    digits[n_digits++] = (char)('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  for (int64_t i = 0; i < n_digits; i++) {
+    result[i] = digits[n_digits - i - 1];
+  }
+
+  return n_digits;
+}
+
+// Returns the number of characters written or 0 if f can't be printed this way
+static inline int64_t GeoArrowPrintDoubleFast(double f, uint32_t precision,
+                                              char* result) {
+  if (!(f > -kGeoArrowPrintFastMax && f < kGeoArrowPrintFastMax)) {
+    return 0;
+  }
+
+  uint32_t max_decimals = precision < GEOARROW_PRINT_FAST_MAX_DECIMALS
+                              ? precision
+                              : GEOARROW_PRINT_FAST_MAX_DECIMALS;
+  for (uint32_t k = 0; k <= max_decimals; k++) {
+    double scaled = f * kGeoArrowPrintFastPow10[k];
+    int64_t m = (int64_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    if (((double)m / kGeoArrowPrintFastPow10[k]) != f) {
+      continue;
+    }
+
+    // Like ryu, never print negative zero
+    int64_t n_chars = 0;
+    if (m < 0) {
+      result[n_chars++] = '-';
+      m = -m;
+    }
+
+    if (k == 0) {
+      return n_chars + GeoArrowPrintUInt64((uint64_t)m, result + n_chars);
+    }
+
+    // Because k is the smallest number of decimals that works, the last decimal
+    // digit is never zero
+    uint64_t divisor = (uint64_t)kGeoArrowPrintFastPow10[k];
+    n_chars += GeoArrowPrintUInt64((uint64_t)m / divisor, result + n_chars);
+    result[n_chars++] = '.';
+    uint64_t decimals = (uint64_t)m % divisor;
+    for (uint32_t j = k; j > 0; j--) {
+      result[n_chars + j - 1] = (char)('0' + decimals % 10);
+      decimals /= 10;
+    }
+
+    return n_chars + k;
+  }
+
+  return 0;
+}
 
 #if defined(GEOARROW_USE_RYU) && GEOARROW_USE_RYU
 
 #include "ryu/ryu.h"
 
-int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result) {
+static inline int64_t GeoArrowPrintDoubleInternal(double f, uint32_t precision,
+                                                  char* result) {
+  int64_t n_chars = GeoArrowPrintDoubleFast(f, precision, result);
+  if (n_chars > 0) {
+    return n_chars;
+  }
+
+  if (precision == (uint32_t)GEOARROW_PRECISION_SHORTEST) {
+    // Without a precision limit, fixed notation writes all significant digits
+    // (at most 17), which for very small values would include many leading zeroes
+    if (f > 1.0e17 || f < -1.0e17 || (f > -1.0e-5 && f < 1.0e-5 && f != 0)) {
+      return GeoArrowd2sexp_buffered_n(f, 17, result);
+    } else {
+      return GeoArrowd2sfixed_buffered_n(f, precision, result);
+    }
+  }
+
   // Use exponential to serialize very large numbers in scientific notation
   // and ignore user precision for these cases.
   if (f > 1.0e17 || f < -1.0e17) {
@@ -21,13 +106,31 @@ int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result) {
 
 #else
 
-int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result) {
+static inline int64_t GeoArrowPrintDoubleInternal(double f, uint32_t precision,
+                                                  char* result) {
+  int64_t n_chars = GeoArrowPrintDoubleFast(f, precision, result);
+  if (n_chars > 0) {
+    return n_chars;
+  }
+
+  // Use the first number of significant digits that round trips
+  if (precision == (uint32_t)GEOARROW_PRECISION_SHORTEST) {
+    for (int digits = 15; digits < 17; digits++) {
+      n_chars = snprintf(result, 40, "%.*g", digits, f);
+      if (strtod(result, NULL) == f) {
+        return n_chars;
+      }
+    }
+
+    return snprintf(result, 40, "%.17g", f);
+  }
+
   // For very large numbers, use scientific notation ignoring user precision
   if (f > 1.0e17 || f < -1.0e17) {
     return snprintf(result, 40, "%0.*e", 16, f);
   }
 
-  int64_t n_chars = snprintf(result, 40, "%0.*f", precision, f);
+  n_chars = snprintf(result, 40, "%0.*f", precision, f);
   if (n_chars > 39) {
     n_chars = 39;
   }
@@ -48,3 +151,30 @@ int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result) {
 }
 
 #endif
+
+int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result) {
+  return GeoArrowPrintDoubleInternal(f, precision, result);
+}
+
+int64_t GeoArrowPrintCoords(const struct GeoArrowCoordView* coords, int64_t offset,
+                            int64_t n_coords, uint32_t precision, char* result) {
+  char* out = result;
+  int32_t n_values = coords->n_values;
+  for (int64_t i = offset; i < (offset + n_coords); i++) {
+    if (i != offset) {
+      out[0] = ',';
+      out[1] = ' ';
+      out += 2;
+    }
+
+    out += GeoArrowPrintDoubleInternal(GEOARROW_COORD_VIEW_VALUE(coords, i, 0), precision,
+                                       out);
+    for (int32_t j = 1; j < n_values; j++) {
+      *out++ = ' ';
+      out += GeoArrowPrintDoubleInternal(GEOARROW_COORD_VIEW_VALUE(coords, i, j),
+                                         precision, out);
+    }
+  }
+
+  return out - result;
+}
@@ -0,0 +1,313 @@
+#include <errno.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Exploding a multi-geometry array is a change to its outermost offsets only: the
+// parts of every row are already stored contiguously as the rows of the child array
+// (e.g., the polygon array of a multipolygon array). The output is that child array
+// sliced to the range referenced by the parent's offsets, so no offset, validity, or
+// coordinate buffers are copied. Collecting is the reverse: when the rows of each
+// group are already contiguous, the input becomes the child of a new list array and
+// only the outer offsets are written.
+
+static enum GeoArrowGeometryType GeoArrowExplodeGeometryType(
+    enum GeoArrowGeometryType geometry_type) {
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return GEOARROW_GEOMETRY_TYPE_POINT;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return GEOARROW_GEOMETRY_TYPE_LINESTRING;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      return GEOARROW_GEOMETRY_TYPE_POLYGON;
+    default:
+      return GEOARROW_GEOMETRY_TYPE_GEOMETRY;
+  }
+}
+
+// Populates parent_indices with the row of array_view that each part belongs to,
+// skipping the parts of null rows if skip_null is set
+static GeoArrowErrorCode GeoArrowExplodeParentIndices(
+    const struct GeoArrowArrayView* array_view, int skip_null,
+    struct ArrowArray* parent_indices) {
+  const int32_t* offsets = array_view->offsets[0] + array_view->offset[0];
+  int64_t n_parts = array_view->last_offset[0] - array_view->first_offset[0];
+
+  GEOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(parent_indices, NANOARROW_TYPE_INT64));
+  struct ArrowBuffer* buffer = ArrowArrayBuffer(parent_indices, 1);
+  int result = ArrowBufferReserve(buffer, n_parts * (int64_t)sizeof(int64_t));
+  if (result != GEOARROW_OK) {
+    parent_indices->release(parent_indices);
+    return result;
+  }
+
+  int64_t* out = (int64_t*)buffer->data;
+  int64_t n_out = 0;
+  for (int64_t i = 0; i < array_view->length[0]; i++) {
+    if (skip_null &&
+        !ArrowBitGet(array_view->validity_bitmap, array_view->offset[0] + i)) {
+      continue;
+    }
+
+    for (int32_t j = offsets[i]; j < offsets[i + 1]; j++) {
+      out[n_out++] = i;
+    }
+  }
+
+  buffer->size_bytes = n_out * (int64_t)sizeof(int64_t);
+  parent_indices->length = n_out;
+  parent_indices->null_count = 0;
+  result = ArrowArrayFinishBuildingDefault(parent_indices, NULL);
+  if (result != GEOARROW_OK) {
+    parent_indices->release(parent_indices);
+  }
+
+  return result;
+}
+
+GeoArrowErrorCode GeoArrowArrayExplode(struct ArrowArray* array, enum GeoArrowType type,
+                                       struct ArrowArray* out,
+                                       struct ArrowArray* parent_indices,
+                                       struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+
+  enum GeoArrowGeometryType geometry_type =
+      GeoArrowExplodeGeometryType(array_view.schema_view.geometry_type);
+  if (geometry_type == GEOARROW_GEOMETRY_TYPE_GEOMETRY ||
+      array_view.schema_view.coord_type == GEOARROW_COORD_TYPE_UNKNOWN) {
+    GeoArrowErrorSet(error, "Can't explode non-multi type %d", (int)type);
+    return EINVAL;
+  }
+
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, array, error));
+
+  // Null rows usually have no parts; however, they are allowed to refer to a
+  // non-empty range of the child array, in which case the parts of the non-null rows
+  // must be copied
+  const int32_t* offsets = array_view.offsets[0] + array_view.offset[0];
+  int has_null_parts = 0;
+  if (array->null_count != 0 && array_view.validity_bitmap != NULL) {
+    for (int64_t i = 0; i < array_view.length[0]; i++) {
+      if (!ArrowBitGet(array_view.validity_bitmap, array_view.offset[0] + i) &&
+          offsets[i + 1] != offsets[i]) {
+        has_null_parts = 1;
+        break;
+      }
+    }
+  }
+
+  struct ArrowArray indices;
+  GEOARROW_RETURN_NOT_OK(
+      GeoArrowExplodeParentIndices(&array_view, has_null_parts, &indices));
+
+  if (has_null_parts) {
+    enum GeoArrowType child_type =
+        GeoArrowMakeType(geometry_type, array_view.schema_view.dimensions,
+                         array_view.schema_view.coord_type);
+    int64_t n_rows = indices.length;
+    int64_t* child_rows = (int64_t*)ArrowMalloc(
+        (n_rows > 0 ? n_rows : 1) * (int64_t)sizeof(int64_t));
+    if (child_rows == NULL) {
+      indices.release(&indices);
+      return ENOMEM;
+    }
+
+    int64_t n_out = 0;
+    for (int64_t i = 0; i < array_view.length[0]; i++) {
+      if (!ArrowBitGet(array_view.validity_bitmap, array_view.offset[0] + i)) {
+        continue;
+      }
+
+      for (int32_t j = offsets[i]; j < offsets[i + 1]; j++) {
+        child_rows[n_out++] = j;
+      }
+    }
+
+    int result = GeoArrowArrayTake(array->children[0], child_type, child_rows, n_out,
+                                   out, error);
+    ArrowFree(child_rows);
+    if (result != GEOARROW_OK) {
+      indices.release(&indices);
+      return result;
+    }
+
+    array->release(array);
+    ArrowArrayMove(&indices, parent_indices);
+    return GEOARROW_OK;
+  }
+
+  // Otherwise, the child is moved out of the parent and sliced. Parents only release
+  // children that have not already been released.
+  struct ArrowArray child;
+  ArrowArrayMove(array->children[0], &child);
+  array->release(array);
+
+  child.offset += array_view.first_offset[0];
+  child.length = array_view.last_offset[0] - array_view.first_offset[0];
+  if (child.null_count != 0) {
+    child.null_count = -1;
+  }
+
+  ArrowArrayMove(&child, out);
+  ArrowArrayMove(&indices, parent_indices);
+  return GEOARROW_OK;
+}
+
+// Wraps child (whose storage must be child_type) in a list array of n_groups rows
+// with the given offsets, taking ownership of child on success
+static GeoArrowErrorCode GeoArrowCollectMakeList(struct ArrowArray* child,
+                                                 enum GeoArrowType type,
+                                                 const int32_t* offsets, int64_t n_groups,
+                                                 struct ArrowArray* out) {
+  struct ArrowSchema schema;
+  struct ArrowArray tmp;
+  GEOARROW_RETURN_NOT_OK(GeoArrowSchemaInit(&schema, type));
+  int result = ArrowArrayInitFromSchema(&tmp, &schema, NULL);
+  schema.release(&schema);
+  GEOARROW_RETURN_NOT_OK(result);
+
+  result = ArrowBufferAppend(ArrowArrayBuffer(&tmp, 1), offsets,
+                             (n_groups + 1) * (int64_t)sizeof(int32_t));
+  if (result == GEOARROW_OK) {
+    tmp.length = n_groups;
+    tmp.null_count = 0;
+    result = ArrowArrayFinishBuilding(&tmp, NANOARROW_VALIDATION_LEVEL_NONE, NULL);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  // Replace the (empty) child only after the list was finished such that nanoarrow
+  // does not attempt to finish building a child array that it did not allocate
+  tmp.children[0]->release(tmp.children[0]);
+  ArrowArrayMove(child, tmp.children[0]);
+  ArrowArrayMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowArrayCollect(struct ArrowArray* array, enum GeoArrowType type,
+                                       const int64_t* group_ids, int64_t n_groups,
+                                       struct ArrowArray* out,
+                                       struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+
+  enum GeoArrowGeometryType geometry_type = array_view.schema_view.geometry_type;
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      if (array_view.schema_view.coord_type != GEOARROW_COORD_TYPE_UNKNOWN) {
+        break;
+      }
+      // fall through
+    default:
+      GeoArrowErrorSet(error, "Can't collect type %d", (int)type);
+      return EINVAL;
+  }
+
+  if (n_groups < 0 || (group_ids == NULL && n_groups < 1)) {
+    GeoArrowErrorSet(error, "Can't collect into %ld groups", (long)n_groups);
+    return EINVAL;
+  }
+
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, array, error));
+
+  enum GeoArrowType multi_type = GeoArrowMakeType(
+      (enum GeoArrowGeometryType)(geometry_type + 3), array_view.schema_view.dimensions,
+      array_view.schema_view.coord_type);
+
+  // Count the rows in each group and check whether the input can be used as-is
+  // (i.e., no rows are dropped and the rows of each group are contiguous)
+  int32_t* offsets = (int32_t*)ArrowMalloc((n_groups + 1) * (int64_t)sizeof(int32_t));
+  if (offsets == NULL) {
+    return ENOMEM;
+  }
+
+  memset(offsets, 0, (size_t)(n_groups + 1) * sizeof(int32_t));
+  const uint8_t* validity = array->null_count != 0 ? array_view.validity_bitmap : NULL;
+  int is_grouped = 1;
+  int64_t last_group = 0;
+  int64_t n_rows = 0;
+  for (int64_t i = 0; i < array_view.length[0]; i++) {
+    int64_t group = group_ids == NULL ? 0 : group_ids[i];
+    if (group >= n_groups) {
+      GeoArrowErrorSet(error, "Group %ld is out of range for %ld groups", (long)group,
+                       (long)n_groups);
+      ArrowFree(offsets);
+      return EINVAL;
+    }
+
+    if (group < 0 ||
+        (validity != NULL && !ArrowBitGet(validity, array_view.offset[0] + i))) {
+      is_grouped = 0;
+      continue;
+    }
+
+    is_grouped = is_grouped && group >= last_group;
+    last_group = group;
+    offsets[group + 1]++;
+    n_rows++;
+  }
+
+  if (n_rows > INT32_MAX) {
+    GeoArrowErrorSet(error, "Can't collect more than %d rows", (int)INT32_MAX);
+    ArrowFree(offsets);
+    return EOVERFLOW;
+  }
+
+  for (int64_t i = 0; i < n_groups; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  int result;
+  if (is_grouped) {
+    result = GeoArrowCollectMakeList(array, multi_type, offsets, n_groups, out);
+    ArrowFree(offsets);
+    return result;
+  }
+
+  // Otherwise, gather the kept rows in group order
+  int64_t* indices = (int64_t*)ArrowMalloc((n_rows > 0 ? n_rows : 1) *
+                                           (int64_t)sizeof(int64_t));
+  int32_t* positions =
+      (int32_t*)ArrowMalloc((n_groups > 0 ? n_groups : 1) * (int64_t)sizeof(int32_t));
+  if (indices == NULL || positions == NULL) {
+    ArrowFree(indices);
+    ArrowFree(positions);
+    ArrowFree(offsets);
+    return ENOMEM;
+  }
+
+  memcpy(positions, offsets, (size_t)n_groups * sizeof(int32_t));
+  for (int64_t i = 0; i < array_view.length[0]; i++) {
+    int64_t group = group_ids == NULL ? 0 : group_ids[i];
+    if (group < 0 ||
+        (validity != NULL && !ArrowBitGet(validity, array_view.offset[0] + i))) {
+      continue;
+    }
+
+    indices[positions[group]++] = i;
+  }
+
+  struct ArrowArray child;
+  result = GeoArrowArrayTake(array, type, indices, n_rows, &child, error);
+  ArrowFree(indices);
+  ArrowFree(positions);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowCollectMakeList(&child, multi_type, offsets, n_groups, out);
+    if (result != GEOARROW_OK) {
+      child.release(&child);
+    }
+  }
+
+  ArrowFree(offsets);
+  GEOARROW_RETURN_NOT_OK(result);
+  array->release(array);
+  return GEOARROW_OK;
+}
@@ -0,0 +1,324 @@
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+static std::vector<int64_t> Int64Values(const struct ArrowArray* array) {
+  const int64_t* values = reinterpret_cast<const int64_t*>(array->buffers[1]);
+  return std::vector<int64_t>(values + array->offset,
+                              values + array->offset + array->length);
+}
+
+// Part i of a multi-geometry as the WKT of its simple geometry type
+static std::string PartWKT(enum GeoArrowGeometryType geometry_type, int i) {
+  std::string x = std::to_string(i * 10);
+  std::string y = std::to_string(i * 10 + 1);
+  std::string x1 = std::to_string(i * 10 + 2);
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return "POINT (" + x + " " + y + ")";
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return "LINESTRING (" + x + " " + y + ", " + x1 + " " + y + ")";
+    default:
+      return "POLYGON ((" + x + " " + y + ", " + x1 + " " + y + ", " + x + " " + x1 +
+             ", " + x + " " + y + "))";
+  }
+}
+
+// A multi-geometry of the given parts (e.g., MULTIPOINT ((0 1), (10 11)))
+static std::string MultiWKT(enum GeoArrowGeometryType geometry_type,
+                            const std::vector<int>& parts) {
+  std::string prefix;
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      prefix = "MULTIPOINT";
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      prefix = "MULTILINESTRING";
+      break;
+    default:
+      prefix = "MULTIPOLYGON";
+      break;
+  }
+
+  if (parts.empty()) {
+    return prefix + " EMPTY";
+  }
+
+  std::string out = prefix + " (";
+  for (size_t i = 0; i < parts.size(); i++) {
+    std::string part = PartWKT(geometry_type, parts[i]);
+    out += (i > 0 ? ", " : "") + part.substr(part.find('('));
+  }
+
+  return out + ")";
+}
+
+class ExplodeTypeParameterizedTestFixture
+    : public ::testing::TestWithParam<enum GeoArrowType> {};
+
+TEST_P(ExplodeTypeParameterizedTestFixture, ExplodeTestZeroCopy) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+  enum GeoArrowGeometryType geometry_type = schema_view.geometry_type;
+  enum GeoArrowType part_type =
+      GeoArrowMakeType(static_cast<enum GeoArrowGeometryType>(geometry_type - 3),
+                       schema_view.dimensions, schema_view.coord_type);
+
+  std::vector<std::string> wkts = {MultiWKT(geometry_type, {0, 1}), "",
+                                   MultiWKT(geometry_type, {}),
+                                   MultiWKT(geometry_type, {2}),
+                                   MultiWKT(geometry_type, {3, 4, 5})};
+  std::vector<std::string> part_wkts;
+  for (int i = 0; i < 6; i++) {
+    part_wkts.push_back(PartWKT(geometry_type, i));
+  }
+
+  struct ArrowArray parts;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(part_type, part_wkts, &parts));
+  std::vector<std::string> expected = FormatWKT(part_type, &parts);
+  parts.release(&parts);
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+
+  // Keep track of the innermost buffers to check that they were not copied
+  struct ArrowArray* level = &array;
+  while (level->n_children == 1 && level->children[0]->n_children > 0) {
+    level = level->children[0];
+  }
+  const void* coords_buffer = level->children[0]->buffers[1];
+
+  struct ArrowArray out;
+  struct ArrowArray parent_indices;
+  struct GeoArrowError error;
+  ASSERT_EQ(GeoArrowArrayExplode(&array, type, &out, &parent_indices, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(FormatWKT(part_type, &out), expected);
+  EXPECT_EQ(Int64Values(&parent_indices), std::vector<int64_t>({0, 0, 3, 4, 4, 4}));
+
+  level = &out;
+  while (level->n_children == 1 && level->children[0]->n_children > 0) {
+    level = level->children[0];
+  }
+  EXPECT_EQ(level->children[0]->buffers[1], coords_buffer);
+  out.release(&out);
+  parent_indices.release(&parent_indices);
+
+  // Check a slice
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+  array.offset = 3;
+  array.length = 2;
+  array.null_count = 0;
+  ASSERT_EQ(GeoArrowArrayExplode(&array, type, &out, &parent_indices, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(part_type, &out),
+            std::vector<std::string>(expected.begin() + 2, expected.end()));
+  EXPECT_EQ(Int64Values(&parent_indices), std::vector<int64_t>({0, 1, 1, 1}));
+  out.release(&out);
+  parent_indices.release(&parent_indices);
+
+  // ...and an empty slice
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+  array.length = 0;
+  ASSERT_EQ(GeoArrowArrayExplode(&array, type, &out, &parent_indices, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.length, 0);
+  EXPECT_EQ(parent_indices.length, 0);
+  out.release(&out);
+  parent_indices.release(&parent_indices);
+}
+
+TEST_P(ExplodeTypeParameterizedTestFixture, ExplodeTestCollect) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+  enum GeoArrowGeometryType geometry_type = schema_view.geometry_type;
+  enum GeoArrowType part_type =
+      GeoArrowMakeType(static_cast<enum GeoArrowGeometryType>(geometry_type - 3),
+                       schema_view.dimensions, schema_view.coord_type);
+
+  std::vector<std::string> part_wkts;
+  for (int i = 0; i < 6; i++) {
+    part_wkts.push_back(PartWKT(geometry_type, i));
+  }
+
+  std::vector<std::string> multi_wkts = {
+      MultiWKT(geometry_type, {0, 1}), MultiWKT(geometry_type, {}),
+      MultiWKT(geometry_type, {2}), MultiWKT(geometry_type, {3, 4, 5})};
+  struct ArrowArray multi;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, multi_wkts, &multi));
+  std::vector<std::string> expected = FormatWKT(type, &multi);
+  multi.release(&multi);
+
+  // Sorted group ids: the parts become the child of the output without a copy
+  struct ArrowArray parts;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(part_type, part_wkts, &parts));
+  struct ArrowArray* level = &parts;
+  while (level->n_children == 1 && level->children[0]->n_children > 0) {
+    level = level->children[0];
+  }
+  const void* coords_buffer = level->children[0]->buffers[1];
+
+  std::vector<int64_t> group_ids = {0, 0, 2, 3, 3, 3};
+  ASSERT_EQ(GeoArrowArrayCollect(&parts, part_type, group_ids.data(), 4, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(parts.release, nullptr);
+  EXPECT_EQ(FormatWKT(type, &out), expected);
+
+  level = &out;
+  while (level->n_children == 1 && level->children[0]->n_children > 0) {
+    level = level->children[0];
+  }
+  EXPECT_EQ(level->children[0]->buffers[1], coords_buffer);
+  out.release(&out);
+
+  // Unsorted group ids and dropped rows: the parts are gathered
+  std::vector<std::string> shuffled_wkts = {part_wkts[3], part_wkts[0], "",
+                                            part_wkts[4], part_wkts[2], part_wkts[1],
+                                            part_wkts[5], part_wkts[1]};
+  group_ids = {3, 0, 1, 3, 2, 0, 3, -1};
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(part_type, shuffled_wkts, &parts));
+  ASSERT_EQ(GeoArrowArrayCollect(&parts, part_type, group_ids.data(), 4, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(parts.release, nullptr);
+  EXPECT_EQ(FormatWKT(type, &out), expected);
+  out.release(&out);
+
+  // Without group ids, all rows are collected into one
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(type, {MultiWKT(geometry_type, {0, 1, 2, 3, 4, 5})}, &multi));
+  expected = FormatWKT(type, &multi);
+  multi.release(&multi);
+
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(part_type, part_wkts, &parts));
+  ASSERT_EQ(GeoArrowArrayCollect(&parts, part_type, nullptr, 1, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(type, &out), expected);
+  out.release(&out);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExplodeTest, ExplodeTypeParameterizedTestFixture,
+                         ::testing::Values(GEOARROW_TYPE_MULTIPOINT,
+                                           GEOARROW_TYPE_MULTILINESTRING,
+                                           GEOARROW_TYPE_MULTIPOLYGON,
+                                           GEOARROW_TYPE_INTERLEAVED_MULTIPOINT,
+                                           GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_Z,
+                                           GEOARROW_TYPE_FLOAT_MULTILINESTRING));
+
+TEST(ExplodeTest, ExplodeTestNullRowWithParts) {
+  struct GeoArrowBuilder builder;
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct ArrowArray parent_indices;
+  struct GeoArrowError error;
+
+  // Build the array for [MULTIPOINT ((0 1)), null, MULTIPOINT ((3 4))] where the null
+  // row refers to two points
+  uint8_t validity = 0x05;
+  std::vector<int32_t> offsets = {0, 1, 3, 4};
+  std::vector<double> xs = {0, 1, 2, 3};
+  std::vector<double> ys = {1, 2, 3, 4};
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_MULTIPOINT),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderAppendBuffer(&builder, 0, {{&validity}, 1}), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderAppendBuffer(
+                &builder, 1,
+                {{reinterpret_cast<const uint8_t*>(offsets.data())},
+                 4 * sizeof(int32_t)}),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderAppendBuffer(
+                &builder, 2,
+                {{reinterpret_cast<const uint8_t*>(xs.data())}, 4 * sizeof(double)}),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderAppendBuffer(
+                &builder, 3,
+                {{reinterpret_cast<const uint8_t*>(ys.data())}, 4 * sizeof(double)}),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderFinish(&builder, &array, nullptr), GEOARROW_OK);
+  GeoArrowBuilderReset(&builder);
+  array.null_count = 1;
+
+  ASSERT_EQ(GeoArrowArrayExplode(&array, GEOARROW_TYPE_MULTIPOINT, &out,
+                                 &parent_indices, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(FormatWKT(GEOARROW_TYPE_POINT, &out),
+            std::vector<std::string>({"POINT (0 1)", "POINT (3 4)"}));
+  EXPECT_EQ(Int64Values(&parent_indices), std::vector<int64_t>({0, 2}));
+
+  out.release(&out);
+  parent_indices.release(&parent_indices);
+}
+
+TEST(ExplodeTest, ExplodeTestCollectErrors) {
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)", "POINT (2 3)"}, &array));
+
+  std::vector<int64_t> group_ids = {0, 2};
+  EXPECT_EQ(GeoArrowArrayCollect(&array, GEOARROW_TYPE_POINT, group_ids.data(), 2, &out,
+                                 &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Group 2 is out of range for 2 groups");
+
+  EXPECT_EQ(GeoArrowArrayCollect(&array, GEOARROW_TYPE_POINT, nullptr, 0, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't collect into 0 groups");
+
+  EXPECT_EQ(GeoArrowArrayCollect(&array, GEOARROW_TYPE_MULTIPOINT, nullptr, 1, &out,
+                                 &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't collect type 4");
+
+  // The input should not have been released
+  ASSERT_NE(array.release, nullptr);
+  array.release(&array);
+}
+
+TEST(ExplodeTest, ExplodeTestErrors) {
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct ArrowArray parent_indices;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)"}, &array));
+
+  EXPECT_EQ(
+      GeoArrowArrayExplode(&array, GEOARROW_TYPE_POINT, &out, &parent_indices, &error),
+      EINVAL);
+  EXPECT_STREQ(error.message, "Can't explode non-multi type 1");
+  EXPECT_EQ(
+      GeoArrowArrayExplode(&array, GEOARROW_TYPE_WKB, &out, &parent_indices, &error),
+      EINVAL);
+
+  // Type that doesn't match the array
+  EXPECT_EQ(GeoArrowArrayExplode(&array, GEOARROW_TYPE_MULTIPOLYGON, &out,
+                                 &parent_indices, &error),
+            EINVAL);
+
+  // The input should not have been released
+  ASSERT_NE(array.release, nullptr);
+  array.release(&array);
+}
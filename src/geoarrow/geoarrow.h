@@ -41,8 +41,22 @@ GeoArrowErrorCode GeoArrowErrorSet(struct GeoArrowError* error, const char* fmt,
 GeoArrowErrorCode GeoArrowFromChars(const char* first, const char* last, double* out);
 
 /// \brief Print a double to a buffer
+///
+/// Prints f using at most precision digits after the decimal point (or, for
+/// GEOARROW_PRECISION_SHORTEST, the fewest digits that parse back to f). No more
+/// than 40 characters are written to result.
 int64_t GeoArrowPrintDouble(double f, uint32_t precision, char* result);
 
+/// \brief Print a run of coordinates to a buffer
+///
+/// Prints n_coords coordinates of coords starting at offset as they would appear
+/// in well-known text (i.e., ordinates separated by a space and coordinates
+/// separated by ", ") using the same formatting as GeoArrowPrintDouble(). The
+/// caller must ensure that result has room for 41 * coords->n_values + 1
+/// characters per coordinate. Returns the number of characters written.
+int64_t GeoArrowPrintCoords(const struct GeoArrowCoordView* coords, int64_t offset,
+                            int64_t n_coords, uint32_t precision, char* result);
+
 /// @}
 
 /// \defgroup geoarrow-schema Data type creation and inspection
@@ -91,6 +105,11 @@ GeoArrowErrorCode GeoArrowMetadataViewInit(struct GeoArrowMetadataView* metadata
                                            struct GeoArrowError* error);
 
 /// \brief Serialize parsed metadata into JSON
+///
+/// Returns the number of characters required to serialize metadata_view, writing
+/// them (and a null terminator if there is room) if that many fit into n. Returns -1
+/// if metadata_view can't be represented as JSON (e.g., because a quantization scale
+/// or offset is NaN or infinite).
 int64_t GeoArrowMetadataSerialize(const struct GeoArrowMetadataView* metadata_view,
                                   char* out, int64_t n);
 
@@ -201,6 +220,13 @@ GeoArrowErrorCode GeoArrowBuilderSetOwnedBuffer(
     void (*custom_free)(uint8_t* ptr, int64_t size, void* private_data),
     void* private_data);
 
+/// \brief Accumulate reallocation and output size counts into stats
+///
+/// Pass NULL to stop collecting statistics. The caller is responsible for keeping
+/// stats valid for the lifetime of the builder.
+void GeoArrowBuilderSetStatistics(struct GeoArrowBuilder* builder,
+                                  struct GeoArrowStatistics* stats);
+
 /// \brief Finish an ArrowArray containing the built input
 ///
 /// This function can be called more than once to support multiple batches.
@@ -211,6 +237,531 @@ GeoArrowErrorCode GeoArrowBuilderFinish(struct GeoArrowBuilder* builder,
 /// \brief Free resources held by a GeoArrowBuilder
 void GeoArrowBuilderReset(struct GeoArrowBuilder* builder);
 
+/// \brief Interleave ordinates stored in separate buffers
+///
+/// Copies ordinate j of coordinate i from src[j][i] to dst[i * n_values + j].
+/// Ordinates are copied without being interpreted such that this works for any
+/// ordinate_size of 4 (float or int32) or 8 (double) bytes.
+GeoArrowErrorCode GeoArrowInterleaveOrdinates(const void* const* src, void* dst,
+                                              int64_t n_coords, int n_values,
+                                              int64_t ordinate_size);
+
+/// \brief Separate interleaved ordinates into one buffer per dimension
+///
+/// The inverse of GeoArrowInterleaveOrdinates().
+GeoArrowErrorCode GeoArrowDeinterleaveOrdinates(const void* src, void* const* dst,
+                                                int64_t n_coords, int n_values,
+                                                int64_t ordinate_size);
+
+/// \brief Convert a native array between separated and interleaved coordinates
+///
+/// Converts array, whose storage must be the given native type, to the type with the
+/// same geometry type, dimensions, and ordinate storage but the other coordinate
+/// layout (e.g., GEOARROW_TYPE_POINT to GEOARROW_TYPE_INTERLEAVED_POINT). Validity
+/// and offset buffers are reused without being copied and only the coordinates are
+/// transposed. On success, ownership of array is transferred to out; otherwise,
+/// array is not modified.
+GeoArrowErrorCode GeoArrowArrayTransposeCoords(struct ArrowArray* array,
+                                               enum GeoArrowType type,
+                                               struct ArrowArray* out,
+                                               struct GeoArrowError* error);
+
+/// \brief Drop the Z and/or M dimension from a native array
+///
+/// Converts array, whose storage must be the given native type, to the type with the
+/// same geometry type and coordinate type but the given dimensions (e.g.,
+/// GEOARROW_TYPE_POINT_ZM to GEOARROW_TYPE_POINT_M). For separated coordinates, no
+/// buffers are copied: the output references the input's validity, offset, and
+/// coordinate buffers and keeps the input alive until it is released. For
+/// interleaved coordinates, validity and offset buffers are reused and the kept
+/// ordinates are copied. Quantized ordinates are not modified, so any quantization
+/// in the extension metadata must be updated by the caller if a Z dimension is
+/// dropped from XYZM input. On success, ownership of array is transferred to out;
+/// otherwise, array is not modified.
+GeoArrowErrorCode GeoArrowArrayProjectDimensions(struct ArrowArray* array,
+                                                 enum GeoArrowType type,
+                                                 enum GeoArrowDimensions dimensions,
+                                                 struct ArrowArray* out,
+                                                 struct GeoArrowError* error);
+
+/// \brief Select rows of a native or serialized array by index
+///
+/// Populates out with the rows of array, whose storage must be the given native type
+/// or GEOARROW_TYPE_WKB or GEOARROW_TYPE_WKT, at each of the n_indices indices (which
+/// may repeat or appear in any order). The size of the output is computed before any
+/// buffers are allocated and consecutive indices are copied as a single run. Returns
+/// EINVAL if any index is out of range.
+GeoArrowErrorCode GeoArrowArrayTake(const struct ArrowArray* array,
+                                    enum GeoArrowType type, const int64_t* indices,
+                                    int64_t n_indices, struct ArrowArray* out,
+                                    struct GeoArrowError* error);
+
+/// \brief Select rows of a native or serialized array using a bitmap
+///
+/// Like GeoArrowArrayTake() except rows are selected using selection, a bitmap of
+/// array->length bits in which a set bit i selects row i of array.
+GeoArrowErrorCode GeoArrowArrayFilter(const struct ArrowArray* array,
+                                      enum GeoArrowType type, const uint8_t* selection,
+                                      struct ArrowArray* out,
+                                      struct GeoArrowError* error);
+
+/// \brief Concatenate native or serialized arrays
+///
+/// Populates out with the rows of each of the n_arrays arrays, whose storage must all
+/// be the given native type or GEOARROW_TYPE_WKB or GEOARROW_TYPE_WKT. The size of the
+/// output is computed from the offsets of each input before any buffers are allocated
+/// and the buffers of each input are appended without re-visiting its features.
+GeoArrowErrorCode GeoArrowArrayConcat(const struct ArrowArray* const* arrays,
+                                      int64_t n_arrays, enum GeoArrowType type,
+                                      struct ArrowArray* out,
+                                      struct GeoArrowError* error);
+
+/// \brief Unnest the parts of a multipoint, multilinestring, or multipolygon array
+///
+/// Populates out with the point, linestring, or polygon array (respectively) of the
+/// parts of array, whose storage must be the given native multi type, and
+/// parent_indices with an int64 array of the row in array that each part belongs to.
+/// The output shares the offset, validity, and coordinate buffers of the input:
+/// only the outermost offsets are dropped. Parts of null rows are not included. On
+/// success, ownership of array is transferred to out; otherwise, array is not
+/// modified.
+GeoArrowErrorCode GeoArrowArrayExplode(struct ArrowArray* array, enum GeoArrowType type,
+                                       struct ArrowArray* out,
+                                       struct ArrowArray* parent_indices,
+                                       struct GeoArrowError* error);
+
+/// \brief Collect the rows of a point, linestring, or polygon array by group
+///
+/// Populates out with a multipoint, multilinestring, or multipolygon array
+/// (respectively) of n_groups rows whose row i contains the rows of array, whose
+/// storage must be the given native type, for which group_ids is i (in their
+/// original order). Rows whose group id is negative and null rows are dropped. If
+/// group_ids is NULL, all rows belong to group 0. When no rows are dropped and the
+/// group ids are sorted, array becomes the child of out without being copied;
+/// otherwise, the rows are gathered with GeoArrowArrayTake(). On success, ownership of
+/// array is transferred to out; otherwise, array is not modified.
+GeoArrowErrorCode GeoArrowArrayCollect(struct ArrowArray* array, enum GeoArrowType type,
+                                       const int64_t* group_ids, int64_t n_groups,
+                                       struct ArrowArray* out,
+                                       struct GeoArrowError* error);
+
+/// \brief Initialize a transform of the given type with the identity matrix
+void GeoArrowTransformInit(struct GeoArrowTransform* transform,
+                           enum GeoArrowTransformType type);
+
+/// \brief Set an affine transform from a 6 or 12 parameter matrix
+///
+/// values are given as a, b, d, e, xoff, yoff (for a two-dimensional transform that
+/// leaves Z as-is) or a, b, c, d, e, f, g, h, i, xoff, yoff, zoff (see
+/// struct GeoArrowTransform). Returns EINVAL for any other n_values.
+GeoArrowErrorCode GeoArrowTransformSetAffine(struct GeoArrowTransform* transform,
+                                             const double* values, int n_values);
+
+/// \brief Apply a transform to n_coords coordinates with the given dimensions
+///
+/// Reads ordinate j of coordinate i from src[j][i * src_stride] and writes it to
+/// dst[j][i * dst_stride], such that both separated (stride 1) and interleaved
+/// (stride n_values with pointers into the same buffer) coordinates are supported.
+/// dst may be the same as src to transform coordinates in place. The loops have no
+/// data-dependent branches such that the compiler can vectorize them.
+GeoArrowErrorCode GeoArrowTransformOrdinates(const struct GeoArrowTransform* transform,
+                                             const double* const* src,
+                                             int64_t src_stride, double* const* dst,
+                                             int64_t dst_stride, int64_t n_coords,
+                                             enum GeoArrowDimensions dimensions);
+
+/// \brief Transform the coordinates of a native array in place
+///
+/// Applies transform to every coordinate in the coordinate array of array, whose
+/// storage must be the given native type with double coordinates, writing the
+/// result over the input. No buffers are allocated or copied, so the caller must
+/// own array and be the only holder of a reference to its coordinate buffers. For a
+/// sliced point array only the coordinates in the slice are transformed; for other
+/// types, every coordinate in the coordinate child is transformed.
+GeoArrowErrorCode GeoArrowArrayTransformInPlace(struct ArrowArray* array,
+                                                enum GeoArrowType type,
+                                                const struct GeoArrowTransform* transform,
+                                                struct GeoArrowError* error);
+
+/// \brief Append the transformed coordinates of a native array to a builder
+///
+/// Applies transform to every coordinate in the coordinate array of array_view,
+/// which must have double coordinates, and appends the result to the coordinates
+/// of builder, which must have the same coordinate type. Offset and validity
+/// buffers are not modified and can be copied to builder as-is. Returns EINVAL for
+/// any other input.
+GeoArrowErrorCode GeoArrowTransformAppendCoords(
+    const struct GeoArrowTransform* transform,
+    const struct GeoArrowArrayView* array_view, struct GeoArrowBuilder* builder);
+
+/// \brief Transform coordinates on their way to another visitor
+///
+/// Use GeoArrowTransformFilterInit() and GeoArrowTransformFilterInitVisitor() to
+/// transform the coordinates of input that can't be transformed from its buffers
+/// (e.g., serialized or sliced input). Coordinates are transformed in chunks and
+/// every other callback is forwarded as-is.
+struct GeoArrowTransformFilter {
+  /// \brief The coordinate operation
+  struct GeoArrowTransform transform;
+
+  /// \brief The dimensions of the current geometry (implementation-specific)
+  enum GeoArrowDimensions dimensions;
+
+  /// \brief The visitor that receives the transformed coordinates
+  struct GeoArrowVisitor next;
+};
+
+/// \brief Initialize a GeoArrowTransformFilter forwarding to next
+///
+/// next is copied and must remain valid for as long as the filter is used.
+void GeoArrowTransformFilterInit(struct GeoArrowTransformFilter* filter,
+                                 const struct GeoArrowTransform* transform,
+                                 const struct GeoArrowVisitor* next);
+
+/// \brief Populate a GeoArrowVisitor pointing to this filter
+void GeoArrowTransformFilterInitVisitor(struct GeoArrowTransformFilter* filter,
+                                        struct GeoArrowVisitor* v);
+
+/// @}
+
+/// \defgroup geoarrow-codec Coordinate compression
+///
+/// The GeoArrowCodec compresses the offsets and coordinates of a native array
+/// into a single compact buffer for transport (e.g., between processes that
+/// exchange batches as opaque bytes) and decompresses them back into a
+/// GeoArrowBuilder. Coordinates are quantized to int32 (or used as-is for arrays
+/// that are already stored as quantized int32), delta encoded such that the
+/// delta resets at the start of each linestring or ring, zigzag encoded, and
+/// bit-packed in blocks of 128 values. Offsets are stored as bit-packed element
+/// lengths. Ordinates that can't be quantized (e.g., the NaN ordinates of an
+/// empty point) are encoded as zero. The encoded buffer uses the native byte
+/// order of the machine that wrote it.
+///
+/// @{
+
+/// \brief Compressed coordinate encoder/decoder
+struct GeoArrowCodec {
+  /// \brief Implementation-specific data
+  void* private_data;
+};
+
+/// \brief Information stored at the start of an encoded buffer
+struct GeoArrowCodecHeader {
+  /// \brief The type of the array that was encoded
+  enum GeoArrowType type;
+
+  /// \brief The number of features in the encoded array
+  int64_t length;
+
+  /// \brief The number of coordinates in the encoded array
+  int64_t n_coords;
+
+  /// \brief Non-zero if the encoded array contained a validity bitmap
+  int32_t has_validity;
+
+  /// \brief The scale and offset used to quantize coordinates
+  struct GeoArrowQuantization quantization;
+};
+
+/// \brief Initialize the memory of a GeoArrowCodec
+///
+/// If GEOARROW_OK is returned, the caller is responsible for calling
+/// GeoArrowCodecReset().
+GeoArrowErrorCode GeoArrowCodecInit(struct GeoArrowCodec* codec);
+
+/// \brief Compress the offsets, validity, and coordinates of a native array
+///
+/// For arrays with double or float coordinates, quantization specifies how
+/// ordinates are rounded to integers and must not be NULL. For arrays stored as
+/// quantized int32, the stored values and the array's own quantization are used
+/// and quantization is ignored. On success, out points to memory owned by the
+/// codec that remains valid until the next call to GeoArrowCodecEncode() or
+/// GeoArrowCodecReset().
+GeoArrowErrorCode GeoArrowCodecEncode(struct GeoArrowCodec* codec,
+                                      const struct GeoArrowArrayView* array_view,
+                                      const struct GeoArrowQuantization* quantization,
+                                      struct GeoArrowBufferView* out,
+                                      struct GeoArrowError* error);
+
+/// \brief Read the header of a buffer written by GeoArrowCodecEncode()
+GeoArrowErrorCode GeoArrowCodecReadHeader(struct GeoArrowBufferView encoded,
+                                          struct GeoArrowCodecHeader* header,
+                                          struct GeoArrowError* error);
+
+/// \brief Decompress a buffer written by GeoArrowCodecEncode() into a builder
+///
+/// The builder must be empty and must have the same geometry type and dimensions
+/// as the encoded array; however, its coordinate type may differ. Builders with
+/// quantized int32 coordinates receive the stored integers directly and must use
+/// the same quantization as the encoded array. Decoded buffers are transferred to
+/// the builder using GeoArrowBuilderSetOwnedBuffer() such that the result can be
+/// obtained with GeoArrowBuilderFinish().
+GeoArrowErrorCode GeoArrowCodecDecode(struct GeoArrowCodec* codec,
+                                      struct GeoArrowBufferView encoded,
+                                      struct GeoArrowBuilder* builder,
+                                      struct GeoArrowError* error);
+
+/// \brief Free resources held by a GeoArrowCodec
+void GeoArrowCodecReset(struct GeoArrowCodec* codec);
+
+/// @}
+
+/// \defgroup geoarrow-mvt Mapbox Vector Tile encoding
+///
+/// The GeoArrowMVTWriter encodes native arrays as the features of a Mapbox Vector
+/// Tile layer, writing geometry command streams directly from the coordinates
+/// without an intermediate WKB or WKT representation. Coordinates must already be
+/// in tile space (e.g., via GeoArrowArrayTransformInPlace() with an affine
+/// transform that maps the tile's bounds to [0, extent]); they are rounded to the
+/// nearest integer, repeated coordinates are dropped, and rings are rewound such
+/// that exterior rings are clockwise and holes are counterclockwise in tile
+/// coordinates. Linestrings and rings that collapse after rounding are skipped, as
+/// are null and empty features. Attributes are passed through from the columns of a
+/// sibling struct array and deduplicated into the layer's values.
+///
+/// @{
+
+/// \brief Mapbox Vector Tile layer encoder
+struct GeoArrowMVTWriter {
+  /// \brief Implementation-specific data
+  void* private_data;
+};
+
+/// \brief Initialize the memory of a GeoArrowMVTWriter
+///
+/// The type must be a native point, linestring, polygon, or multi- type with
+/// double coordinates; only the x and y ordinates are encoded. If attributes is
+/// not NULL it must be a struct schema whose column names are used as the layer's
+/// keys and whose columns are boolean, integer, floating point, or string. If
+/// GEOARROW_OK is returned, the caller is responsible for calling
+/// GeoArrowMVTWriterReset().
+GeoArrowErrorCode GeoArrowMVTWriterInit(struct GeoArrowMVTWriter* writer,
+                                        enum GeoArrowType type, const char* layer_name,
+                                        uint32_t extent,
+                                        const struct ArrowSchema* attributes,
+                                        struct GeoArrowError* error);
+
+/// \brief Encode the features of a native array and its attributes
+///
+/// If the writer was initialized with an attribute schema, attributes must be a
+/// struct array with the same length as array; otherwise, it is ignored. Null
+/// attribute values are omitted from the feature's tags.
+GeoArrowErrorCode GeoArrowMVTWriterAppend(struct GeoArrowMVTWriter* writer,
+                                          const struct ArrowArray* array,
+                                          const struct ArrowArray* attributes,
+                                          struct GeoArrowError* error);
+
+/// \brief Write the layer containing all features appended so far
+///
+/// On success, out points to memory owned by the writer that contains the layer
+/// framed as a Tile.layers field, such that the output of several writers can be
+/// concatenated to form a tile. The memory remains valid until the next call to
+/// GeoArrowMVTWriterFinish() or GeoArrowMVTWriterReset(). The writer is cleared
+/// such that it can be reused to encode another layer with the same name.
+GeoArrowErrorCode GeoArrowMVTWriterFinish(struct GeoArrowMVTWriter* writer,
+                                          struct GeoArrowBufferView* out,
+                                          struct GeoArrowError* error);
+
+/// \brief Free resources held by a GeoArrowMVTWriter
+void GeoArrowMVTWriterReset(struct GeoArrowMVTWriter* writer);
+
+/// @}
+
+/// \defgroup geoarrow-bounds Bounds of non-planar edges
+///
+/// Accumulates the bounds of coordinates that are longitude and latitude in degrees
+/// such that the bounds contain every edge of each linestring or ring when edges are
+/// great circles (geodesics on the ellipsoid are bounded as great circles). The
+/// latitude range includes the northernmost or southernmost point of an edge. A ring
+/// that winds around a pole extends the bounds to that pole (assuming that shells
+/// are wound counterclockwise).
+///
+/// @{
+
+/// \brief Initialize empty bounds
+void GeoArrowSphericalBoundsInit(struct GeoArrowSphericalBounds* bounds);
+
+/// \brief Start a linestring (is_ring of 0) or ring whose coordinates are joined by edges
+void GeoArrowSphericalBoundsPathStart(struct GeoArrowSphericalBounds* bounds,
+                                      int is_ring);
+
+/// \brief Add coordinates to the bounds
+///
+/// Coordinates appended between GeoArrowSphericalBoundsPathStart() and
+/// GeoArrowSphericalBoundsPathEnd() (possibly in more than one call) are joined by
+/// edges; otherwise, they are bounded as points.
+void GeoArrowSphericalBoundsAppend(struct GeoArrowSphericalBounds* bounds,
+                                   const struct GeoArrowCoordView* coords);
+
+/// \brief End the current linestring or ring
+void GeoArrowSphericalBoundsPathEnd(struct GeoArrowSphericalBounds* bounds);
+
+/// @}
+
+/// \defgroup geoarrow-measure Per-feature measures
+///
+/// The GeoArrowMeasureWriter computes one value per feature (see
+/// GeoArrowMeasureType). Areas are unsigned (holes are subtracted from their shell)
+/// and the centroid is that of the highest-dimensional components of the feature
+/// (as in GEOS). For planar edges, lengths and areas are in the units of the
+/// coordinates. For other edge types, coordinates are longitude and latitude in
+/// degrees and lengths and areas are in meters and square meters: spherical edges
+/// are great circles on a sphere with the mean radius of the earth and other edges
+/// are geodesics on the WGS84 ellipsoid, whose areas are computed on the authalic
+/// sphere. The centroid is only defined for planar edges. Null features are null in
+/// the output; empty features have a length and area of zero and a centroid of
+/// POINT (nan nan).
+///
+/// @{
+
+/// \brief Per-feature measure writer
+struct GeoArrowMeasureWriter {
+  /// \brief Implementation-specific data
+  void* private_data;
+};
+
+/// \brief Initialize an ArrowSchema for the output of a GeoArrowMeasureWriter
+///
+/// Lengths and areas are doubles, counts are int64, and centroids are a
+/// GEOARROW_TYPE_POINT extension type with the given metadata (which may be NULL).
+/// Returns EINVAL for a centroid whose metadata specifies non-planar edges.
+GeoArrowErrorCode GeoArrowMeasureSchemaInit(struct ArrowSchema* schema,
+                                            enum GeoArrowMeasureType type,
+                                            const struct GeoArrowMetadataView* metadata);
+
+/// \brief Initialize the memory of a GeoArrowMeasureWriter
+///
+/// If GEOARROW_OK is returned, the caller is responsible for calling
+/// GeoArrowMeasureWriterReset().
+GeoArrowErrorCode GeoArrowMeasureWriterInit(struct GeoArrowMeasureWriter* writer,
+                                            enum GeoArrowMeasureType type,
+                                            enum GeoArrowEdgeType edge_type,
+                                            struct GeoArrowError* error);
+
+/// \brief Populate a GeoArrowVisitor pointing to this writer
+void GeoArrowMeasureWriterInitVisitor(struct GeoArrowMeasureWriter* writer,
+                                      struct GeoArrowVisitor* v);
+
+/// \brief Reserve space for additional_length features to be appended
+GeoArrowErrorCode GeoArrowMeasureWriterReserve(struct GeoArrowMeasureWriter* writer,
+                                               int64_t additional_length);
+
+/// \brief Measure the features offset to offset + length of an array without visiting
+///
+/// Native arrays with double coordinates are measured directly from the offset
+/// buffers and coordinate arrays. For GEOARROW_MEASURE_TYPE_NUM_COORDS and
+/// GEOARROW_MEASURE_TYPE_NUM_PARTS, any native array is measured from its offsets
+/// alone and GEOARROW_TYPE_WKB arrays are measured from their geometry headers.
+/// Returns ENOTSUP without appending anything for any other array, which must be
+/// visited instead.
+GeoArrowErrorCode GeoArrowMeasureWriterAppend(struct GeoArrowMeasureWriter* writer,
+                                              const struct GeoArrowArrayView* array_view,
+                                              int64_t offset, int64_t length,
+                                              struct GeoArrowError* error);
+
+/// \brief Finish an ArrowArray containing the values of the features appended so far
+///
+/// This function can be called more than once to support multiple batches.
+GeoArrowErrorCode GeoArrowMeasureWriterFinish(struct GeoArrowMeasureWriter* writer,
+                                              struct ArrowArray* array,
+                                              struct GeoArrowError* error);
+
+/// \brief Free resources held by a GeoArrowMeasureWriter
+void GeoArrowMeasureWriterReset(struct GeoArrowMeasureWriter* writer);
+
+/// @}
+
+/// \defgroup geoarrow-simplify Linestring and polygon simplification
+///
+/// The GeoArrowSimplifier removes coordinates of linestrings and polygon rings using
+/// the Douglas-Peucker algorithm (where tolerance is a distance) or the
+/// Visvalingam-Whyatt algorithm (where tolerance is an area). Only X and Y are
+/// considered and the first and last coordinates of every path are kept. Rings that
+/// collapse to fewer than four coordinates are removed (along with their polygon if
+/// the shell collapses) unless preserve_topology is nonzero. Points are not
+/// modified.
+///
+/// @{
+
+/// \brief Linestring and polygon ring simplifier
+struct GeoArrowSimplifier {
+  /// \brief Implementation-specific data
+  void* private_data;
+};
+
+/// \brief Initialize the memory of a GeoArrowSimplifier
+///
+/// Returns EINVAL for an unknown method or a tolerance that is negative or NaN. If
+/// GEOARROW_OK is returned, the caller is responsible for calling
+/// GeoArrowSimplifierReset().
+GeoArrowErrorCode GeoArrowSimplifierInit(struct GeoArrowSimplifier* simplifier,
+                                         enum GeoArrowSimplifyMethod method,
+                                         double tolerance, int preserve_topology,
+                                         struct GeoArrowError* error);
+
+/// \brief Populate a GeoArrowVisitor that simplifies features on their way to next
+///
+/// next is copied and must remain valid for as long as v is used. The coordinates of
+/// each linestring or ring are buffered until the end of the path; every other
+/// callback is forwarded as-is.
+void GeoArrowSimplifierInitVisitor(struct GeoArrowSimplifier* simplifier,
+                                   const struct GeoArrowVisitor* next,
+                                   struct GeoArrowVisitor* v);
+
+/// \brief Simplify a native array without visiting
+///
+/// Appends the simplified features of array_view to builder, which must have the
+/// same type and must not contain any features yet. Buffers of builder are reserved
+/// for the size of the input up front. Returns ENOTSUP without appending anything
+/// unless array_view is an unsliced linestring, polygon, multilinestring, or
+/// multipolygon array with double coordinates, which must be visited instead.
+GeoArrowErrorCode GeoArrowSimplifierAppend(struct GeoArrowSimplifier* simplifier,
+                                           const struct GeoArrowArrayView* array_view,
+                                           struct GeoArrowBuilder* builder);
+
+/// \brief Free resources held by a GeoArrowSimplifier
+void GeoArrowSimplifierReset(struct GeoArrowSimplifier* simplifier);
+
+/// @}
+
+/// \defgroup geoarrow-clip Clipping to a rectangle
+///
+/// The GeoArrowClipper clips native arrays with double coordinates to a rectangle
+/// given as xmin, ymin, xmax, ymax (inclusive). Points outside the box are removed
+/// (a POINT becomes POINT EMPTY), linestrings are clipped using Liang-Barsky and may
+/// be split into several parts (linestrings are written as multilinestrings), and
+/// polygon rings are clipped using Sutherland-Hodgman. Rings that collapse are
+/// removed, along with their polygon if the shell collapses. Z and M are interpolated
+/// along clipped segments. Features entirely inside or outside the box (according to
+/// their bounding box) are written as-is or as EMPTY without clipping.
+///
+/// @{
+
+/// \brief Rectangle clipper
+struct GeoArrowClipper {
+  /// \brief Implementation-specific data
+  void* private_data;
+};
+
+/// \brief Initialize the memory of a GeoArrowClipper
+///
+/// Returns EINVAL unless xmin <= xmax and ymin <= ymax. If GEOARROW_OK is returned,
+/// the caller is responsible for calling GeoArrowClipperReset().
+GeoArrowErrorCode GeoArrowClipperInit(struct GeoArrowClipper* clipper,
+                                      const double* box, struct GeoArrowError* error);
+
+/// \brief Clip the features offset to offset + length of a native array
+///
+/// Visits each clipped feature with v. Returns ENOTSUP without visiting anything for
+/// a box array or an array whose coordinates are not doubles.
+GeoArrowErrorCode GeoArrowClipperVisit(struct GeoArrowClipper* clipper,
+                                       const struct GeoArrowArrayView* array_view,
+                                       int64_t offset, int64_t length,
+                                       struct GeoArrowVisitor* v);
+
+/// \brief Free resources held by a GeoArrowClipper
+void GeoArrowClipperReset(struct GeoArrowClipper* clipper);
+
 /// @}
 
 /// \defgroup geoarrow-udf Function implementations
@@ -271,18 +822,69 @@ GeoArrowErrorCode GeoArrowScalarUdfFactoryInit(struct GeoArrowScalarUdfFactory*
 ///   Arrays with valid `GeoArrowType`s are supported. The type of the output is
 ///   controlled by the `type` option, specified as a `GeoArrowType` cast to integer.
 /// - format_wkt: A variation on as_wkt that supports options `precision`
+///   (use -1 for the shortest representation that round trips)
 ///   and `max_element_size_bytes`. This kernel is lazy and does not visit an entire
-///   feature beyond that required for `max_element_size_bytes`.
+///   feature beyond that required for `max_element_size_bytes`. With option
+///   `n_tasks` greater than 1, each batch is split into at most `n_tasks` ranges
+///   of rows that are formatted as independent tasks (see GeoArrowArrayFormatWKT()
+///   and GeoArrowKernelSetExecutor()); statistics for these batches only include
+///   batch, feature, and output byte counts.
 /// - unique_geometry_types_agg: An aggregate kernel that collects unique geometry
 ///   types in the input. The output is a single int32 array of ISO WKB type codes.
 /// - box: A scalar kernel that returns the 2-dimensional bounding box by feature.
 ///   the output bounding box is represented as a struct array with column order
 ///   xmin, xmax, ymin, ymax. Null features are recorded as a null item in the
-///   output; empty features are recorded as Inf, -Inf, Inf, -Inf.
+///   output; empty features are recorded as Inf, -Inf, Inf, -Inf. For input with
+///   non-planar edges, coordinates are treated as longitude/latitude and edges as
+///   great circles: bounds include the most poleward point of each edge and
+///   xmin > xmax for bounds that cross the antimeridian.
 /// - box_agg: An aggregate kernel that returns the 2-dimensional bounding box
 ///   containing all features of the input in the same form as the box kernel.
 ///   the result is always length one and is never null. For the purposes of this
 ///   kernel, nulls are treated as empty.
+/// - length, area: Scalar kernels that return the length (perimeter for
+///   polygons) or unsigned area of each feature as a double array. For input with
+///   non-planar edges, coordinates are treated as longitude/latitude and the result
+///   is in meters or square meters: spherical edges are great circles on a sphere with
+///   the mean radius of the earth and other edge types are geodesics on the WGS84
+///   ellipsoid (whose areas are computed on the authalic sphere).
+/// - centroid: A scalar kernel that returns the planar centroid of the
+///   highest-dimensional components of each feature as a geoarrow.point array.
+///   Empty features are recorded as POINT (nan nan).
+/// - num_coords, num_parts: Scalar kernels that return the number of coordinates or
+///   the number of parts (i.e., children of a multi geometry or collection, or one
+///   for a non-empty single geometry) of each feature as an int64 array. For native
+///   input these are computed from offsets without reading coordinates.
+///
+///   For all of these kernels, null features are recorded as a null item in the
+///   output and native input with double coordinates is processed without a visitor.
+/// - collect_agg: An aggregate kernel that collects all non-null features of a native
+///   point, linestring, or polygon input into a single multipoint, multilinestring,
+///   or multipolygon (respectively). See GeoArrowArrayCollect() to collect
+///   features by group.
+/// - affine: A scalar kernel that applies the affine transform given by the
+///   `matrix` option (6 or 12 comma-separated numbers; see
+///   GeoArrowTransformSetAffine()) to every coordinate. The output has the same type
+///   and metadata as the input.
+/// - to_web_mercator, from_web_mercator: Scalar kernels that project longitude and
+///   latitude to Web Mercator (EPSG:3857) coordinates or vice versa, updating the
+///   CRS of the output.
+///
+///   For these kernels, native input with double coordinates is processed without a
+///   visitor by copying the validity and offset buffers and writing only new
+///   coordinates. See GeoArrowArrayTransformInPlace() to avoid the copies.
+/// - simplify: A scalar kernel that simplifies linestrings and polygon rings using
+///   the Douglas-Peucker (`method` douglas_peucker, the default) or Visvalingam-Whyatt
+///   (`method` visvalingam) algorithm with the given `tolerance` (a distance or an
+///   area, respectively). Rings that collapse to fewer than four coordinates are
+///   removed (along with their polygon if the shell collapses) unless
+///   `preserve_topology` is 1. The output has the same type and metadata as the input.
+/// - clip_by_box: A scalar kernel that clips native input with double coordinates to
+///   the rectangle given by the `box` option (xmin, ymin, xmax, ymax). Linestrings
+///   are clipped using Liang-Barsky and may be split into several parts (linestring
+///   input is written as a multilinestring); polygons are clipped using
+///   Sutherland-Hodgman. Features entirely inside or outside the box (according to
+///   their bounding box) are written as-is or as EMPTY without clipping.
 ///
 /// @{
 
@@ -293,6 +895,50 @@ GeoArrowErrorCode GeoArrowScalarUdfFactoryInit(struct GeoArrowScalarUdfFactory*
 GeoArrowErrorCode GeoArrowKernelInit(struct GeoArrowKernel* kernel, const char* name,
                                      const char* options);
 
+/// \brief Collect GeoArrowStatistics while this kernel is executed
+///
+/// Must be called after GeoArrowKernelInit() and before the kernel's start()
+/// callback. Kernels for which statistics were not enabled are not affected
+/// in any way. Reader and writer level counts (e.g., coordinates visited or
+/// buffer reallocations) are only available for kernels that are implemented
+/// using a GeoArrowVisitor; other kernels report batches, features, null
+/// features, and timings. Returns EINVAL if statistics were already enabled for
+/// this kernel.
+GeoArrowErrorCode GeoArrowKernelEnableStatistics(struct GeoArrowKernel* kernel);
+
+/// \brief Copy the GeoArrowStatistics collected by a kernel into out
+///
+/// Returns EINVAL if GeoArrowKernelEnableStatistics() was not called.
+GeoArrowErrorCode GeoArrowKernelGetStatistics(struct GeoArrowKernel* kernel,
+                                              struct GeoArrowStatistics* out);
+
+/// \brief Run the independent tasks of a kernel using executor
+///
+/// Must be called after GeoArrowKernelInit() and before the kernel's start()
+/// callback; executor must outlive the kernel. Kernels that do not split their work
+/// into tasks (currently all kernels except format_wkt with `n_tasks` greater than 1)
+/// run sequentially as before. Returns EINVAL for kernels that can't accept an
+/// executor (e.g., void).
+GeoArrowErrorCode GeoArrowKernelSetExecutor(struct GeoArrowKernel* kernel,
+                                            struct GeoArrowExecutor* executor);
+
+/// \brief Apply a GeoArrowKernel to every batch of an ArrowArrayStream
+///
+/// Initializes out as a stream whose batches are the result of pushing each batch
+/// of input through the kernel identified by name. The kernel is started with the
+/// schema of input on the first call to get_schema() or get_next() and each call
+/// to get_next() pulls exactly one batch from input, such that streams can be
+/// chained without materializing more than one batch at a time. For aggregate
+/// kernels (i.e., those whose name ends in `_agg`), all of input is consumed by
+/// the first call to get_next(), which emits the result of finish().
+///
+/// If GEOARROW_OK is returned, ownership of input is transferred to out;
+/// otherwise, input is left untouched.
+GeoArrowErrorCode GeoArrowKernelStreamInit(struct ArrowArrayStream* out,
+                                           struct ArrowArrayStream* input,
+                                           const char* name, const char* options,
+                                           struct GeoArrowError* error);
+
 /// @}
 
 /// \defgroup geoarrow-geometry Zero-copy friendly scalar geometries
@@ -418,6 +1064,17 @@ GeoArrowErrorCode GeoArrowNativeWriterInit(struct GeoArrowNativeWriter* writer,
 GeoArrowErrorCode GeoArrowNativeWriterInitVisitor(struct GeoArrowNativeWriter* writer,
                                                   struct GeoArrowVisitor* v);
 
+/// \brief Reserve space for features to be appended to this writer
+///
+/// Ensures that features (including nulls) containing a total of parts child
+/// geometries of multi geometries (i.e., the points of a multipoint, linestrings of
+/// a multilinestring, or polygons of a multipolygon), rings polygon rings, and coords
+/// coordinates can be appended without reallocating the offset or coordinate
+/// buffers. Counts that do not apply to the output geometry type are ignored.
+GeoArrowErrorCode GeoArrowNativeWriterReserve(struct GeoArrowNativeWriter* writer,
+                                              int64_t features, int64_t parts,
+                                              int64_t rings, int64_t coords);
+
 /// \brief Append a GeoArrowGeometryView to this writer
 GeoArrowErrorCode GeoArrowNativeWriterAppend(struct GeoArrowNativeWriter* writer,
                                              struct GeoArrowGeometryView geom,
@@ -426,6 +1083,19 @@ GeoArrowErrorCode GeoArrowNativeWriterAppend(struct GeoArrowNativeWriter* writer
 /// \brief Append a null element to this writer
 GeoArrowErrorCode GeoArrowNativeWriterAppendNull(struct GeoArrowNativeWriter* writer);
 
+/// \brief Accumulate reallocation and output size counts into stats
+///
+/// Pass NULL to stop collecting statistics.
+void GeoArrowNativeWriterSetStatistics(struct GeoArrowNativeWriter* writer,
+                                       struct GeoArrowStatistics* stats);
+
+/// \brief Set the scale and offset used to encode quantized integer coordinates
+///
+/// Only used when the output type stores coordinates as quantized integers.
+/// Defaults to a scale of 1 and an offset of 0.
+void GeoArrowNativeWriterSetQuantization(
+    struct GeoArrowNativeWriter* writer, const struct GeoArrowQuantization* quantization);
+
 /// \brief Finish an ArrowArray containing elements from the visited input
 ///
 /// This function can be called more than once to support multiple batches.
@@ -448,6 +1118,9 @@ void GeoArrowNativeWriterReset(struct GeoArrowNativeWriter* writer);
 /// invalid WKT for locales other than the C locale.
 struct GeoArrowWKTWriter {
   /// \brief The number of significant digits to include in the output (default: 16)
+  ///
+  /// Use GEOARROW_PRECISION_SHORTEST to write the shortest representation of each
+  /// ordinate that round trips.
   int precision;
 
   /// \brief Set to 0 to use the verbose (but more valid) MULTIPOINT
@@ -477,6 +1150,12 @@ GeoArrowErrorCode GeoArrowWKTWriterInit(struct GeoArrowWKTWriter* writer);
 void GeoArrowWKTWriterInitVisitor(struct GeoArrowWKTWriter* writer,
                                   struct GeoArrowVisitor* v);
 
+/// \brief Accumulate reallocation and output size counts into stats
+///
+/// Pass NULL to stop collecting statistics.
+void GeoArrowWKTWriterSetStatistics(struct GeoArrowWKTWriter* writer,
+                                    struct GeoArrowStatistics* stats);
+
 /// \brief Finish an ArrowArray containing elements from the visited input
 ///
 /// This function can be called more than once to support multiple batches.
@@ -487,6 +1166,24 @@ GeoArrowErrorCode GeoArrowWKTWriterFinish(struct GeoArrowWKTWriter* writer,
 /// \brief Free resources held by a GeoArrowWKTWriter
 void GeoArrowWKTWriterReset(struct GeoArrowWKTWriter* writer);
 
+/// \brief Format an array as well-known text using independent tasks
+///
+/// Splits the rows of array, which may be of any type supported by the
+/// GeoArrowArrayReader, into at most n_tasks ranges. Each range is formatted with
+/// its own GeoArrowWKTWriter using the given precision and max_element_size_bytes
+/// (see GeoArrowWKTWriter) into its own buffers. The results are then stitched into
+/// out, which must be of type GEOARROW_TYPE_WKT or GEOARROW_TYPE_LARGE_WKT, with one
+/// copy of each range's values and rebased offsets. Both steps run their tasks
+/// using executor or sequentially if executor is NULL. Returns EOVERFLOW if the
+/// output of type GEOARROW_TYPE_WKT would contain more than 2 GB of text.
+GeoArrowErrorCode GeoArrowArrayFormatWKT(const struct ArrowArray* array,
+                                         enum GeoArrowType type, int precision,
+                                         int64_t max_element_size_bytes,
+                                         enum GeoArrowType out_type, int64_t n_tasks,
+                                         struct GeoArrowExecutor* executor,
+                                         struct ArrowArray* out,
+                                         struct GeoArrowError* error);
+
 /// \brief Well-known text reader
 struct GeoArrowWKTReader {
   void* private_data;
@@ -528,10 +1225,34 @@ GeoArrowErrorCode GeoArrowWKBWriterAppendNull(struct GeoArrowWKBWriter* writer);
 GeoArrowErrorCode GeoArrowWKBWriterAppend(struct GeoArrowWKBWriter* writer,
                                           struct GeoArrowGeometryView geom);
 
+/// \brief Reserve space for elements to be appended to this writer
+///
+/// Ensures that additional_length elements whose well-known binary totals
+/// additional_size_bytes can be written without reallocating the offset or data
+/// buffers (e.g., using a size computed by GeoArrowArrayViewWKBSize()).
+GeoArrowErrorCode GeoArrowWKBWriterReserve(struct GeoArrowWKBWriter* writer,
+                                           int64_t additional_length,
+                                           int64_t additional_size_bytes);
+
+/// \brief Compute the exact size of native features written as well-known binary
+///
+/// Computes the number of bytes a GeoArrowWKBWriter writes for the features offset to
+/// offset + length of array_view from its offset buffers alone (i.e., without
+/// visiting coordinates). Returns ENOTSUP for serialized and box arrays.
+GeoArrowErrorCode GeoArrowArrayViewWKBSize(const struct GeoArrowArrayView* array_view,
+                                           int64_t offset, int64_t length,
+                                           int64_t* size_bytes);
+
 /// \brief Populate a GeoArrowVisitor pointing to this writer
 void GeoArrowWKBWriterInitVisitor(struct GeoArrowWKBWriter* writer,
                                   struct GeoArrowVisitor* v);
 
+/// \brief Accumulate reallocation and output size counts into stats
+///
+/// Pass NULL to stop collecting statistics.
+void GeoArrowWKBWriterSetStatistics(struct GeoArrowWKBWriter* writer,
+                                    struct GeoArrowStatistics* stats);
+
 /// \brief Finish an ArrowArray containing elements from the visited input
 ///
 /// This function can be called more than once to support multiple batches.
@@ -567,6 +1288,17 @@ GeoArrowErrorCode GeoArrowWKBReaderRead(struct GeoArrowWKBReader* reader,
                                         struct GeoArrowGeometryView* out,
                                         struct GeoArrowError* error);
 
+/// \brief Summarize the structure of well-known binary without reading coordinates
+///
+/// Reads each geometry header and size and skips coordinate sequences by pointer
+/// arithmetic. This is considerably faster than GeoArrowWKBReaderRead() or
+/// GeoArrowWKBReaderVisit() for operations that only need geometry types or counts
+/// and validates the structure of src in the same way.
+GeoArrowErrorCode GeoArrowWKBReaderScan(struct GeoArrowWKBReader* reader,
+                                        struct GeoArrowBufferView src,
+                                        struct GeoArrowWKBSummary* out,
+                                        struct GeoArrowError* error);
+
 /// \brief Free resources held by a GeoArrowWKBWriter
 void GeoArrowWKBReaderReset(struct GeoArrowWKBReader* reader);
 
@@ -603,6 +1335,13 @@ GeoArrowErrorCode GeoArrowArrayReaderVisit(struct GeoArrowArrayReader* reader,
                                            int64_t offset, int64_t length,
                                            struct GeoArrowVisitor* v);
 
+/// \brief Accumulate batch, feature, coordinate, and input size counts into stats
+///
+/// Pass NULL to stop collecting statistics. When no statistics are set,
+/// GeoArrowArrayReaderVisit() calls the provided visitor directly.
+void GeoArrowArrayReaderSetStatistics(struct GeoArrowArrayReader* reader,
+                                      struct GeoArrowStatistics* stats);
+
 /// \brief Get a GeoArrowArrayView
 ///
 /// If there is a GeoArrowArrayView underlying this GeoArrowArrayReader, populates
@@ -649,6 +1388,25 @@ GeoArrowErrorCode GeoArrowArrayWriterSetPrecision(struct GeoArrowArrayWriter* wr
 GeoArrowErrorCode GeoArrowArrayWriterSetFlatMultipoint(struct GeoArrowArrayWriter* writer,
                                                        int flat_multipoint);
 
+/// \brief Accumulate reallocation and output size counts into stats
+///
+/// Pass NULL to stop collecting statistics.
+void GeoArrowArrayWriterSetStatistics(struct GeoArrowArrayWriter* writer,
+                                      struct GeoArrowStatistics* stats);
+
+/// \brief Reserve space for the output of visiting features of array_view
+///
+/// Pre-sizes the output buffers for the features offset to offset + length of
+/// array_view such that visiting them does not reallocate. For native output, the
+/// parts, rings, and coordinates of native input are counted from its offsets and
+/// those of GEOARROW_TYPE_WKB input are counted from its headers. For
+/// GEOARROW_TYPE_WKB output, the size of native input is computed from its offsets.
+/// For other combinations of input and output (or input that can't be counted),
+/// this function does nothing and returns GEOARROW_OK.
+GeoArrowErrorCode GeoArrowArrayWriterReserve(struct GeoArrowArrayWriter* writer,
+                                             const struct GeoArrowArrayView* array_view,
+                                             int64_t offset, int64_t length);
+
 /// \brief Populate a GeoArrowVisitor pointing to this writer
 GeoArrowErrorCode GeoArrowArrayWriterInitVisitor(struct GeoArrowArrayWriter* writer,
                                                  struct GeoArrowVisitor* v);
@@ -117,6 +117,15 @@ struct ArrowArrayStream {
 
 #define GEOARROW_UNUSED(expr) ((void)expr)
 
+/// \brief Precision requesting the shortest representation that round trips
+/// \ingroup geoarrow-utility
+///
+/// Use as the precision for GeoArrowPrintDouble(), GeoArrowPrintCoords(), or a
+/// GeoArrowWKTWriter to print each value with the fewest digits that parse back
+/// to the same double. Very small and very large values are printed using
+/// scientific notation.
+#define GEOARROW_PRECISION_SHORTEST -1
+
 // This section remaps the non-prefixed symbols to the prefixed symbols so that
 // code written against this build can be used independent of the value of
 // GEOARROW_NAMESPACE.
@@ -127,6 +136,7 @@ struct ArrowArrayStream {
 #define GeoArrowErrorSet _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowErrorSet)
 #define GeoArrowFromChars _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowFromChars)
 #define GeoArrowPrintDouble _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowPrintDouble)
+#define GeoArrowPrintCoords _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowPrintCoords)
 #define GeoArrowSchemaInit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSchemaInit)
 #define GeoArrowSchemaInitExtension \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSchemaInitExtension)
@@ -165,12 +175,96 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowBuilderAppendBuffer)
 #define GeoArrowBuilderSetOwnedBuffer \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowBuilderSetOwnedBuffer)
+#define GeoArrowBuilderSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowBuilderSetStatistics)
 #define GeoArrowBuilderFinish \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowBuilderFinish)
 #define GeoArrowBuilderReset _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowBuilderReset)
+#define GeoArrowInterleaveOrdinates \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowInterleaveOrdinates)
+#define GeoArrowDeinterleaveOrdinates \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowDeinterleaveOrdinates)
+#define GeoArrowArrayTransposeCoords \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayTransposeCoords)
+#define GeoArrowArrayProjectDimensions \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayProjectDimensions)
+#define GeoArrowArrayTake _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayTake)
+#define GeoArrowArrayFilter _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayFilter)
+#define GeoArrowArrayConcat _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayConcat)
+#define GeoArrowArrayExplode _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayExplode)
+#define GeoArrowArrayCollect _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayCollect)
+#define GeoArrowTransformInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformInit)
+#define GeoArrowTransformSetAffine \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformSetAffine)
+#define GeoArrowTransformOrdinates \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformOrdinates)
+#define GeoArrowArrayTransformInPlace \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayTransformInPlace)
+#define GeoArrowTransformAppendCoords \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformAppendCoords)
+#define GeoArrowTransformFilterInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformFilterInit)
+#define GeoArrowTransformFilterInitVisitor \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowTransformFilterInitVisitor)
+#define GeoArrowCodecInit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowCodecInit)
+#define GeoArrowCodecEncode _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowCodecEncode)
+#define GeoArrowCodecReadHeader \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowCodecReadHeader)
+#define GeoArrowCodecDecode _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowCodecDecode)
+#define GeoArrowCodecReset _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowCodecReset)
+#define GeoArrowMVTWriterInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMVTWriterInit)
+#define GeoArrowMVTWriterAppend \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMVTWriterAppend)
+#define GeoArrowMVTWriterFinish \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMVTWriterFinish)
+#define GeoArrowMVTWriterReset \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMVTWriterReset)
+#define GeoArrowSphericalBoundsInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSphericalBoundsInit)
+#define GeoArrowSphericalBoundsPathStart \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSphericalBoundsPathStart)
+#define GeoArrowSphericalBoundsAppend \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSphericalBoundsAppend)
+#define GeoArrowSphericalBoundsPathEnd \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSphericalBoundsPathEnd)
+#define GeoArrowMeasureSchemaInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureSchemaInit)
+#define GeoArrowMeasureWriterInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterInit)
+#define GeoArrowMeasureWriterInitVisitor \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterInitVisitor)
+#define GeoArrowMeasureWriterReserve \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterReserve)
+#define GeoArrowMeasureWriterAppend \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterAppend)
+#define GeoArrowMeasureWriterFinish \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterFinish)
+#define GeoArrowMeasureWriterReset \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowMeasureWriterReset)
+#define GeoArrowSimplifierInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSimplifierInit)
+#define GeoArrowSimplifierInitVisitor \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSimplifierInitVisitor)
+#define GeoArrowSimplifierAppend \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSimplifierAppend)
+#define GeoArrowSimplifierReset \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowSimplifierReset)
+#define GeoArrowClipperInit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowClipperInit)
+#define GeoArrowClipperVisit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowClipperVisit)
+#define GeoArrowClipperReset _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowClipperReset)
 #define GeoArrowScalarUdfFactoryInit \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowScalarUdfFactoryInit)
 #define GeoArrowKernelInit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowKernelInit)
+#define GeoArrowKernelEnableStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowKernelEnableStatistics)
+#define GeoArrowKernelGetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowKernelGetStatistics)
+#define GeoArrowKernelSetExecutor \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowKernelSetExecutor)
+#define GeoArrowKernelStreamInit \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowKernelStreamInit)
 #define GeoArrowGeometryInit _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowGeometryInit)
 #define GeoArrowGeometryReset \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowGeometryReset)
@@ -194,10 +288,16 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayViewVisitNative)
 #define GeoArrowNativeWriterInit \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterInit)
+#define GeoArrowNativeWriterReserve \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterReserve)
 #define GeoArrowNativeWriterAppend \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterAppend)
 #define GeoArrowNativeWriterAppendNull \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterAppendNull)
+#define GeoArrowNativeWriterSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterSetStatistics)
+#define GeoArrowNativeWriterSetQuantization \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterSetQuantization)
 #define GeoArrowNativeWriterInitVisitor \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowNativeWriterInitVisitor)
 #define GeoArrowNativeWriterFinish \
@@ -208,10 +308,14 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTWriterInit)
 #define GeoArrowWKTWriterInitVisitor \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTWriterInitVisitor)
+#define GeoArrowWKTWriterSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTWriterSetStatistics)
 #define GeoArrowWKTWriterFinish \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTWriterFinish)
 #define GeoArrowWKTWriterReset \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTWriterReset)
+#define GeoArrowArrayFormatWKT \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayFormatWKT)
 #define GeoArrowWKTReaderInit \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKTReaderInit)
 #define GeoArrowWKTReaderVisit \
@@ -226,6 +330,12 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBWriterAppend)
 #define GeoArrowWKBWriterAppendNull \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBWriterAppendNull)
+#define GeoArrowWKBWriterReserve \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBWriterReserve)
+#define GeoArrowArrayViewWKBSize \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayViewWKBSize)
+#define GeoArrowWKBWriterSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBWriterSetStatistics)
 #define GeoArrowWKBWriterFinish \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBWriterFinish)
 #define GeoArrowWKBWriterReset \
@@ -238,6 +348,8 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBReaderRead)
 #define GeoArrowWKBReaderReset \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBReaderReset)
+#define GeoArrowWKBReaderScan \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowWKBReaderScan)
 #define GeoArrowArrayReaderInitFromType \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayReaderInitFromType)
 #define GeoArrowArrayReaderInitFromSchema \
@@ -246,6 +358,8 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayReaderSetArray)
 #define GeoArrowArrayReaderVisit \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayReaderVisit)
+#define GeoArrowArrayReaderSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayReaderSetStatistics)
 #define GeoArrowArrayReaderArrayView \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayReaderArrayView)
 #define GeoArrowArrayReaderReset \
@@ -258,6 +372,10 @@ struct ArrowArrayStream {
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayWriterSetPrecision)
 #define GeoArrowArrayWriterSetFlatMultipoint \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayWriterSetFlatMultipoint)
+#define GeoArrowArrayWriterSetStatistics \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayWriterSetStatistics)
+#define GeoArrowArrayWriterReserve \
+  _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayWriterReserve)
 #define GeoArrowArrayWriterInitVisitor \
   _GEOARROW_MAKE_NAME(GEOARROW_NAMESPACE, GeoArrowArrayWriterInitVisitor)
 #define GeoArrowArrayWriterFinish \
@@ -382,6 +500,106 @@ enum GeoArrowType {
   GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM = 13005,
   GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM = 13006,
 
+  GEOARROW_TYPE_FLOAT_POINT = 20001,
+  GEOARROW_TYPE_FLOAT_LINESTRING = 20002,
+  GEOARROW_TYPE_FLOAT_POLYGON = 20003,
+  GEOARROW_TYPE_FLOAT_MULTIPOINT = 20004,
+  GEOARROW_TYPE_FLOAT_MULTILINESTRING = 20005,
+  GEOARROW_TYPE_FLOAT_MULTIPOLYGON = 20006,
+  GEOARROW_TYPE_FLOAT_POINT_Z = 21001,
+  GEOARROW_TYPE_FLOAT_LINESTRING_Z = 21002,
+  GEOARROW_TYPE_FLOAT_POLYGON_Z = 21003,
+  GEOARROW_TYPE_FLOAT_MULTIPOINT_Z = 21004,
+  GEOARROW_TYPE_FLOAT_MULTILINESTRING_Z = 21005,
+  GEOARROW_TYPE_FLOAT_MULTIPOLYGON_Z = 21006,
+  GEOARROW_TYPE_FLOAT_POINT_M = 22001,
+  GEOARROW_TYPE_FLOAT_LINESTRING_M = 22002,
+  GEOARROW_TYPE_FLOAT_POLYGON_M = 22003,
+  GEOARROW_TYPE_FLOAT_MULTIPOINT_M = 22004,
+  GEOARROW_TYPE_FLOAT_MULTILINESTRING_M = 22005,
+  GEOARROW_TYPE_FLOAT_MULTIPOLYGON_M = 22006,
+  GEOARROW_TYPE_FLOAT_POINT_ZM = 23001,
+  GEOARROW_TYPE_FLOAT_LINESTRING_ZM = 23002,
+  GEOARROW_TYPE_FLOAT_POLYGON_ZM = 23003,
+  GEOARROW_TYPE_FLOAT_MULTIPOINT_ZM = 23004,
+  GEOARROW_TYPE_FLOAT_MULTILINESTRING_ZM = 23005,
+  GEOARROW_TYPE_FLOAT_MULTIPOLYGON_ZM = 23006,
+
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT = 30001,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING = 30002,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON = 30003,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT = 30004,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING = 30005,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON = 30006,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_Z = 31001,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_Z = 31002,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_Z = 31003,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_Z = 31004,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_Z = 31005,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_Z = 31006,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_M = 32001,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_M = 32002,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M = 32003,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_M = 32004,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_M = 32005,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_M = 32006,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_ZM = 33001,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_ZM = 33002,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_ZM = 33003,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_ZM = 33004,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING_ZM = 33005,
+  GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_ZM = 33006,
+
+  GEOARROW_TYPE_INT32_POINT = 40001,
+  GEOARROW_TYPE_INT32_LINESTRING = 40002,
+  GEOARROW_TYPE_INT32_POLYGON = 40003,
+  GEOARROW_TYPE_INT32_MULTIPOINT = 40004,
+  GEOARROW_TYPE_INT32_MULTILINESTRING = 40005,
+  GEOARROW_TYPE_INT32_MULTIPOLYGON = 40006,
+  GEOARROW_TYPE_INT32_POINT_Z = 41001,
+  GEOARROW_TYPE_INT32_LINESTRING_Z = 41002,
+  GEOARROW_TYPE_INT32_POLYGON_Z = 41003,
+  GEOARROW_TYPE_INT32_MULTIPOINT_Z = 41004,
+  GEOARROW_TYPE_INT32_MULTILINESTRING_Z = 41005,
+  GEOARROW_TYPE_INT32_MULTIPOLYGON_Z = 41006,
+  GEOARROW_TYPE_INT32_POINT_M = 42001,
+  GEOARROW_TYPE_INT32_LINESTRING_M = 42002,
+  GEOARROW_TYPE_INT32_POLYGON_M = 42003,
+  GEOARROW_TYPE_INT32_MULTIPOINT_M = 42004,
+  GEOARROW_TYPE_INT32_MULTILINESTRING_M = 42005,
+  GEOARROW_TYPE_INT32_MULTIPOLYGON_M = 42006,
+  GEOARROW_TYPE_INT32_POINT_ZM = 43001,
+  GEOARROW_TYPE_INT32_LINESTRING_ZM = 43002,
+  GEOARROW_TYPE_INT32_POLYGON_ZM = 43003,
+  GEOARROW_TYPE_INT32_MULTIPOINT_ZM = 43004,
+  GEOARROW_TYPE_INT32_MULTILINESTRING_ZM = 43005,
+  GEOARROW_TYPE_INT32_MULTIPOLYGON_ZM = 43006,
+
+  GEOARROW_TYPE_INTERLEAVED_INT32_POINT = 50001,
+  GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING = 50002,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON = 50003,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT = 50004,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING = 50005,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON = 50006,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POINT_Z = 51001,
+  GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_Z = 51002,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_Z = 51003,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_Z = 51004,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_Z = 51005,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_Z = 51006,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POINT_M = 52001,
+  GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_M = 52002,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_M = 52003,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_M = 52004,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_M = 52005,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_M = 52006,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POINT_ZM = 53001,
+  GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING_ZM = 53002,
+  GEOARROW_TYPE_INTERLEAVED_INT32_POLYGON_ZM = 53003,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOINT_ZM = 53004,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTILINESTRING_ZM = 53005,
+  GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_ZM = 53006,
+
 };
 
 /// \brief Geometry type identifiers supported by GeoArrow
@@ -413,10 +631,19 @@ enum GeoArrowDimensions {
 
 /// \brief Coordinate types supported by GeoArrow
 /// \ingroup geoarrow-schema
+///
+/// Coordinates are stored as double by default; the _FLOAT variants store
+/// each ordinate as a 32-bit float using the same layout. The _INT32 variants
+/// store each ordinate as a quantized 32-bit integer that is decoded using the
+/// scale and offset of the GeoArrowQuantization in the extension metadata.
 enum GeoArrowCoordType {
   GEOARROW_COORD_TYPE_UNKNOWN = 0,
   GEOARROW_COORD_TYPE_SEPARATE = 1,
-  GEOARROW_COORD_TYPE_INTERLEAVED = 2
+  GEOARROW_COORD_TYPE_INTERLEAVED = 2,
+  GEOARROW_COORD_TYPE_SEPARATE_FLOAT = 3,
+  GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT = 4,
+  GEOARROW_COORD_TYPE_SEPARATE_INT32 = 5,
+  GEOARROW_COORD_TYPE_INTERLEAVED_INT32 = 6
 };
 
 /// \brief Edge types/interpolations supported by GeoArrow
@@ -583,6 +810,31 @@ struct GeoArrowGeometry {
   void* private_data;
 };
 
+/// \brief Structural summary of a well-known binary geometry
+///
+/// Populated by GeoArrowWKBReaderScan(), which reads geometry headers and sizes
+/// without decoding coordinates.
+struct GeoArrowWKBSummary {
+  /// \brief The geometry type of the outermost geometry
+  enum GeoArrowGeometryType geometry_type;
+
+  /// \brief The dimensions of the outermost geometry
+  enum GeoArrowDimensions dimensions;
+
+  /// \brief The size of the outermost geometry
+  ///
+  /// As in GeoArrowGeometryNode, this is the number of coordinates for a point or
+  /// linestring, the number of rings for a polygon, or the number of children for
+  /// a multi geometry or geometry collection.
+  uint32_t size;
+
+  /// \brief The number of polygon rings at any level of nesting
+  int64_t num_rings;
+
+  /// \brief The number of coordinates at any level of nesting
+  int64_t num_coords;
+};
+
 /// \brief Parsed view of an ArrowSchema representation of a GeoArrowType
 ///
 /// This structure can be initialized from an ArrowSchema or a GeoArrowType.
@@ -614,6 +866,82 @@ struct GeoArrowSchemaView {
   enum GeoArrowCoordType coord_type;
 };
 
+/// \brief Scale and offset used to decode quantized integer coordinates
+///
+/// Ordinates stored using one of the _INT32 GeoArrowCoordTypes are decoded as
+/// `stored * scale[j] + offset[j]` for dimension j.
+struct GeoArrowQuantization {
+  /// \brief The scale for each dimension (defaults to 1)
+  double scale[4];
+
+  /// \brief The offset for each dimension (defaults to 0)
+  double offset[4];
+};
+
+/// \brief Coordinate operations supported by GeoArrowTransformOrdinates()
+enum GeoArrowTransformType {
+  GEOARROW_TRANSFORM_AFFINE = 0,
+  GEOARROW_TRANSFORM_TO_WEB_MERCATOR = 1,
+  GEOARROW_TRANSFORM_FROM_WEB_MERCATOR = 2
+};
+
+/// \brief A coordinate operation applied to the X, Y, and (if present) Z ordinates
+///
+/// For GEOARROW_TRANSFORM_AFFINE, coordinates are transformed as
+/// `x' = a * x + b * y + c * z + xoff`, `y' = d * x + e * y + f * z + yoff`, and
+/// `z' = g * x + h * y + i * z + zoff`. For the Web Mercator transforms, X and Y are
+/// longitude and latitude in degrees or Web Mercator (EPSG:3857) meters and the
+/// matrix is not used. M values are never modified.
+struct GeoArrowTransform {
+  /// \brief The type of coordinate operation
+  enum GeoArrowTransformType type;
+
+  /// \brief The affine matrix as a, b, c, d, e, f, g, h, i, xoff, yoff, zoff
+  double matrix[12];
+};
+
+/// \brief Bounds of longitude/latitude coordinates joined by great circle edges
+///
+/// The longitude range is the smallest one containing every point and edge, which
+/// wraps (i.e., min_values[0] > max_values[0]) when it crosses the antimeridian.
+struct GeoArrowSphericalBounds {
+  /// \brief The minimum longitude and latitude (INFINITY if nothing was appended)
+  double min_values[2];
+
+  /// \brief The maximum longitude and latitude (-INFINITY if nothing was appended)
+  double max_values[2];
+
+  /// \brief The state of the current linestring or ring (implementation-specific)
+  int path_active;
+  int path_is_ring;
+  int64_t path_n_coords;
+  double path_lon;
+  double path_lat;
+  double path_dlon;
+};
+
+/// \brief Per-feature values computed by the GeoArrowMeasureWriter
+enum GeoArrowMeasureType {
+  /// \brief The total length of all linestrings and rings (double)
+  GEOARROW_MEASURE_TYPE_LENGTH = 1,
+  /// \brief The area of all polygons with holes subtracted (double)
+  GEOARROW_MEASURE_TYPE_AREA = 2,
+  /// \brief The centroid of the highest-dimensional components (point)
+  GEOARROW_MEASURE_TYPE_CENTROID = 3,
+  /// \brief The number of coordinates (int64)
+  GEOARROW_MEASURE_TYPE_NUM_COORDS = 4,
+  /// \brief The number of child geometries of a multi geometry or collection (int64)
+  GEOARROW_MEASURE_TYPE_NUM_PARTS = 5
+};
+
+/// \brief Algorithms supported by the GeoArrowSimplifier
+enum GeoArrowSimplifyMethod {
+  /// \brief Douglas-Peucker, whose tolerance is a distance
+  GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER = 0,
+  /// \brief Visvalingam-Whyatt, whose tolerance is an area
+  GEOARROW_SIMPLIFY_VISVALINGAM = 1
+};
+
 /// \brief Parsed view of GeoArrow extension metadata
 struct GeoArrowMetadataView {
   /// \brief A view of the serialized metadata if this was used to populate the view
@@ -631,6 +959,12 @@ struct GeoArrowMetadataView {
   /// it may contain the outer quotes and have escaped quotes inside it. Use
   /// GeoArrowUnescapeCrs() to sanitize this value if you need to pass it elsewhere.
   struct GeoArrowStringView crs;
+
+  /// \brief The quantization parameters represented by metadata
+  ///
+  /// Populated from the "scale" and "offset" keys. These are only used by
+  /// types whose coordinates are stored as quantized integers.
+  struct GeoArrowQuantization quantization;
 };
 
 /// \brief Union type representing a pointer to modifiable data
@@ -641,6 +975,7 @@ union GeoArrowWritableBufferViewData {
   uint8_t* as_uint8;
   int32_t* as_int32;
   double* as_double;
+  float* as_float;
 };
 
 /// \brief A view of a modifiable buffer
@@ -703,6 +1038,76 @@ struct GeoArrowWritableCoordView {
   int32_t coords_stride;
 };
 
+/// \brief A generic view of float coordinates from a GeoArrow array
+/// \ingroup geoarrow-array_view
+///
+/// Equivalent to the GeoArrowCoordView for arrays whose GeoArrowCoordType
+/// stores ordinates as float (e.g., GEOARROW_COORD_TYPE_SEPARATE_FLOAT).
+struct GeoArrowFloatCoordView {
+  /// \brief Pointers to the beginning of each coordinate buffer
+  const float* values[8];
+
+  /// \brief The number of coordinates in this view
+  int64_t n_coords;
+
+  /// \brief The number of pointers in the values array (i.e., number of dimensions)
+  int32_t n_values;
+
+  /// \brief The number of elements to advance a given value pointer to the next ordinate
+  int32_t coords_stride;
+};
+
+/// \brief A generic view of a writable vector of float coordinates
+///
+/// The number of coordinates and capacity for a builder whose GeoArrowCoordType
+/// stores ordinates as float are tracked by its GeoArrowWritableCoordView; this
+/// view only holds the pointers into which ordinates are written.
+struct GeoArrowWritableFloatCoordView {
+  /// \brief Pointers to the beginning of each coordinate buffer
+  float* values[8];
+
+  /// \brief The number of pointers in the values array (i.e., number of dimensions)
+  int32_t n_values;
+
+  /// \brief The number of elements to advance a given value pointer to the next ordinate
+  int32_t coords_stride;
+};
+
+/// \brief A generic view of quantized int32 coordinates from a GeoArrow array
+/// \ingroup geoarrow-array_view
+///
+/// Equivalent to the GeoArrowCoordView for arrays whose GeoArrowCoordType
+/// stores ordinates as quantized integers (e.g., GEOARROW_COORD_TYPE_SEPARATE_INT32).
+/// Values are stored without applying the GeoArrowQuantization.
+struct GeoArrowInt32CoordView {
+  /// \brief Pointers to the beginning of each coordinate buffer
+  const int32_t* values[8];
+
+  /// \brief The number of coordinates in this view
+  int64_t n_coords;
+
+  /// \brief The number of pointers in the values array (i.e., number of dimensions)
+  int32_t n_values;
+
+  /// \brief The number of elements to advance a given value pointer to the next ordinate
+  int32_t coords_stride;
+};
+
+/// \brief A generic view of a writable vector of quantized int32 coordinates
+///
+/// Like the GeoArrowWritableFloatCoordView, the number of coordinates and capacity
+/// are tracked by the builder's GeoArrowWritableCoordView.
+struct GeoArrowWritableInt32CoordView {
+  /// \brief Pointers to the beginning of each coordinate buffer
+  int32_t* values[8];
+
+  /// \brief The number of pointers in the values array (i.e., number of dimensions)
+  int32_t n_values;
+
+  /// \brief The number of elements to advance a given value pointer to the next ordinate
+  int32_t coords_stride;
+};
+
 /// \brief Generically get or set an ordinate from a GeoArrowWritableCoordView or
 /// a GeoArrowCoordView.
 /// \ingroup geoarrow-array_view
@@ -743,7 +1148,24 @@ struct GeoArrowArrayView {
   const uint8_t* data;
 
   /// \brief Generic view of the coordinates in this array
+  ///
+  /// For arrays whose coordinates are stored as float or quantized integers, the
+  /// values of this view are NULL and coords_float or coords_int32 should be used
+  /// to access ordinates.
   struct GeoArrowCoordView coords;
+
+  /// \brief Generic view of float coordinates in this array
+  ///
+  /// Only populated for arrays whose coordinates are stored as float.
+  struct GeoArrowFloatCoordView coords_float;
+
+  /// \brief Generic view of quantized int32 coordinates in this array
+  ///
+  /// Only populated for arrays whose coordinates are stored as quantized integers.
+  struct GeoArrowInt32CoordView coords_int32;
+
+  /// \brief The scale and offset used to decode coords_int32
+  struct GeoArrowQuantization quantization;
 };
 
 /// \brief Structured view of writable memory managed by the GeoArrowBuilder
@@ -765,7 +1187,21 @@ struct GeoArrowWritableArrayView {
   struct GeoArrowWritableBufferView buffers[9];
 
   /// \brief View of writable coordinate memory managed by the GeoArrowBuilder
+  ///
+  /// For builders whose coordinates are stored as float or quantized integers, the
+  /// values of this view are NULL and ordinates are written to coords_float or
+  /// coords_int32.
   struct GeoArrowWritableCoordView coords;
+
+  /// \brief View of writable float coordinate memory managed by the GeoArrowBuilder
+  struct GeoArrowWritableFloatCoordView coords_float;
+
+  /// \brief View of writable quantized int32 coordinate memory managed by the
+  /// GeoArrowBuilder
+  struct GeoArrowWritableInt32CoordView coords_int32;
+
+  /// \brief The scale and offset used to encode ordinates into coords_int32
+  struct GeoArrowQuantization quantization;
 };
 
 /// \brief Builder for GeoArrow-encoded arrays
@@ -940,6 +1376,47 @@ struct GeoArrowScalarUdfFactory {
   void* private_data;
 };
 
+/// \brief Counters and timings collected while reading, writing, or computing
+///
+/// Statistics are opt-in and are only collected by a GeoArrowKernel after
+/// GeoArrowKernelEnableStatistics() or by a reader/writer after the corresponding
+/// *SetStatistics() function was called with a non-NULL pointer. Values accumulate
+/// for as long as they are collected. Because readers and writers update the
+/// caller's structure directly, their statistics can be reset with memset();
+/// a kernel owns its statistics and they are only reset by releasing the kernel
+/// and initializing it again.
+struct GeoArrowStatistics {
+  /// \brief The number of arrays pushed into a kernel or set on a reader
+  int64_t num_batches;
+
+  /// \brief The number of features visited (including null features)
+  int64_t num_features;
+
+  /// \brief The number of null features visited
+  int64_t num_null_features;
+
+  /// \brief The number of coordinates emitted via the visitor's coords callback
+  int64_t num_coords;
+
+  /// \brief The number of bytes in the buffers of input arrays
+  int64_t bytes_read;
+
+  /// \brief The number of bytes in the buffers of output arrays
+  int64_t bytes_written;
+
+  /// \brief The number of times an output buffer had to grow
+  int64_t num_reallocations;
+
+  /// \brief Cumulative wall time spent in a kernel's start() in nanoseconds
+  int64_t start_ns;
+
+  /// \brief Cumulative wall time spent in a kernel's push_batch() in nanoseconds
+  int64_t push_batch_ns;
+
+  /// \brief Cumulative wall time spent in a kernel's finish() in nanoseconds
+  int64_t finish_ns;
+};
+
 /// \brief Generalized compute kernel
 ///
 /// Callers are responsible for calling the release callback when finished
@@ -974,6 +1451,23 @@ struct GeoArrowKernel {
   void* private_data;
 };
 
+/// \brief Run independent tasks, possibly concurrently
+///
+/// GeoArrow never creates threads itself: functions that can split their work into
+/// independent tasks accept a GeoArrowExecutor such that callers can run those tasks
+/// using their own thread pool.
+struct GeoArrowExecutor {
+  /// \brief Call task(task_data, i) once for each i in [0, n_tasks)
+  ///
+  /// Calls may be made concurrently, in any order, and from any thread; however,
+  /// all of them must have completed before this callback returns.
+  void (*parallel_for)(struct GeoArrowExecutor* executor, int64_t n_tasks,
+                       void (*task)(void* task_data, int64_t i), void* task_data);
+
+  /// \brief Opaque, implementation-specific data
+  void* private_data;
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,12 +49,9 @@ static inline enum GeoArrowGeometryType GeoArrowGeometryTypeFromType(
       break;
   }
 
-  int geometry_type = (int)type;
-  if (geometry_type >= GEOARROW_TYPE_INTERLEAVED_POINT) {
-    geometry_type -= 10000;
-  }
-
-  geometry_type = (int)geometry_type % 1000;
+  // The coordinate type is encoded in multiples of 10000 and the dimensions
+  // in multiples of 1000
+  int geometry_type = (int)type % 1000;
   if (geometry_type == GEOARROW_GEOMETRY_TYPE_BOX) {
     return GEOARROW_GEOMETRY_TYPE_BOX;
   } else if (geometry_type <= 6 && geometry_type >= 1) {
@@ -131,6 +128,14 @@ static inline const char* GeoArrowCoordTypeString(enum GeoArrowCoordType dimensi
       return "separate";
     case GEOARROW_COORD_TYPE_INTERLEAVED:
       return "interleaved";
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+      return "separate_float";
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+      return "interleaved_float";
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+      return "separate_int32";
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return "interleaved_int32";
     default:
       return "<not valid>";
   }
@@ -195,10 +200,7 @@ static inline enum GeoArrowDimensions GeoArrowDimensionsFromType(enum GeoArrowTy
       break;
   }
 
-  int type_int = (int)type;
-  if (type_int >= GEOARROW_TYPE_INTERLEAVED_POINT) {
-    type_int -= 10000;
-  }
+  int type_int = (int)type % 10000;
 
   switch (type_int / 1000) {
     case 0:
@@ -219,15 +221,112 @@ static inline enum GeoArrowDimensions GeoArrowDimensionsFromType(enum GeoArrowTy
 static inline enum GeoArrowCoordType GeoArrowCoordTypeFromType(enum GeoArrowType type) {
   if (type >= GEOARROW_TYPE_WKB) {
     return GEOARROW_COORD_TYPE_UNKNOWN;
-  } else if (type >= GEOARROW_TYPE_INTERLEAVED_POINT) {
-    return GEOARROW_COORD_TYPE_INTERLEAVED;
   } else if (type >= GEOARROW_TYPE_POINT) {
-    return GEOARROW_COORD_TYPE_SEPARATE;
+    return (enum GeoArrowCoordType)((int)type / 10000 + 1);
   } else {
     return GEOARROW_COORD_TYPE_UNKNOWN;
   }
 }
 
+/// \brief Returns the layout of a GeoArrowCoordType independent of how its
+/// ordinates are stored
+/// \ingroup geoarrow-schema
+///
+/// Returns GEOARROW_COORD_TYPE_SEPARATE or GEOARROW_COORD_TYPE_INTERLEAVED (or
+/// GEOARROW_COORD_TYPE_UNKNOWN for an unknown coordinate type).
+static inline enum GeoArrowCoordType GeoArrowCoordTypeLayout(
+    enum GeoArrowCoordType coord_type) {
+  switch (coord_type) {
+    case GEOARROW_COORD_TYPE_SEPARATE:
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+      return GEOARROW_COORD_TYPE_SEPARATE;
+    case GEOARROW_COORD_TYPE_INTERLEAVED:
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return GEOARROW_COORD_TYPE_INTERLEAVED;
+    default:
+      return GEOARROW_COORD_TYPE_UNKNOWN;
+  }
+}
+
+/// \brief Returns the number of bytes used to store one ordinate of a
+/// GeoArrowCoordType (or 0 for an unknown coordinate type)
+/// \ingroup geoarrow-schema
+static inline int64_t GeoArrowCoordTypeOrdinateSize(enum GeoArrowCoordType coord_type) {
+  switch (coord_type) {
+    case GEOARROW_COORD_TYPE_SEPARATE:
+    case GEOARROW_COORD_TYPE_INTERLEAVED:
+      return (int64_t)sizeof(double);
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+      return (int64_t)sizeof(float);
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return (int64_t)sizeof(int32_t);
+    default:
+      return 0;
+  }
+}
+
+/// \brief Returns non-zero if a GeoArrowCoordType stores ordinates as float
+/// \ingroup geoarrow-schema
+static inline int GeoArrowCoordTypeIsFloat(enum GeoArrowCoordType coord_type) {
+  return coord_type == GEOARROW_COORD_TYPE_SEPARATE_FLOAT ||
+         coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+}
+
+/// \brief Returns non-zero if a GeoArrowCoordType stores ordinates as quantized
+/// integers
+/// \ingroup geoarrow-schema
+static inline int GeoArrowCoordTypeIsQuantized(enum GeoArrowCoordType coord_type) {
+  return coord_type == GEOARROW_COORD_TYPE_SEPARATE_INT32 ||
+         coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_INT32;
+}
+
+/// \brief Initialize a GeoArrowQuantization with a scale of 1 and an offset of 0
+/// \ingroup geoarrow-schema
+static inline void GeoArrowQuantizationInitDefault(
+    struct GeoArrowQuantization* quantization) {
+  for (int j = 0; j < 4; j++) {
+    quantization->scale[j] = 1;
+    quantization->offset[j] = 0;
+  }
+}
+
+/// \brief Encode n ordinates as quantized integers
+/// \ingroup geoarrow-schema
+///
+/// Computes round((src - offset) / scale) for each ordinate, rounding half away
+/// from zero. Values outside the range of an int32_t are clamped and NaN values
+/// are encoded as 0. The loop body has no data-dependent branches so that the
+/// compiler can vectorize it when both strides are 1.
+static inline void GeoArrowQuantizeOrdinates(const double* src, int64_t src_stride,
+                                             int32_t* dst, int64_t dst_stride,
+                                             int64_t n, double scale, double offset) {
+  double inv_scale = 1.0 / scale;
+  for (int64_t i = 0; i < n; i++) {
+    double value = (src[i * src_stride] - offset) * inv_scale;
+    value = value == value ? value : 0.0;
+    value += value >= 0 ? 0.5 : -0.5;
+    value = value < -2147483648.0 ? -2147483648.0 : value;
+    value = value > 2147483647.0 ? 2147483647.0 : value;
+    dst[i * dst_stride] = (int32_t)value;
+  }
+}
+
+/// \brief Decode n quantized integer ordinates
+/// \ingroup geoarrow-schema
+///
+/// Computes src * scale + offset for each ordinate.
+static inline void GeoArrowDequantizeOrdinates(const int32_t* src, int64_t src_stride,
+                                               double* dst, int64_t dst_stride,
+                                               int64_t n, double scale, double offset) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i * dst_stride] = (double)src[i * src_stride] * scale + offset;
+  }
+}
+
 /// \brief Construct a GeometryType from a GeoArrowGeometryType, GeoArrowDimensions,
 /// and GeoArrowCoordType.
 /// \ingroup geoarrow-schema
@@ -283,6 +382,15 @@ static const int _GeoArrowkNumOffsets[] = {-1, 0, 1, 2, 1, 2, 3, -1};
 // Such that kNumDimensions[dimensions] gives the right answer
 static const int _GeoArrowkNumDimensions[] = {-1, 2, 3, 3, 4};
 
+// Sets start and end to the range of the children of item i at the given level of
+// offsets, where i and the result include the offset of their respective arrays
+static inline void GeoArrowArrayViewChildRange(const struct GeoArrowArrayView* array_view,
+                                               int level, int64_t i, int64_t* start,
+                                               int64_t* end) {
+  *start = array_view->offsets[level][i] + array_view->offset[level + 1];
+  *end = array_view->offsets[level][i + 1] + array_view->offset[level + 1];
+}
+
 static inline int GeoArrowBuilderBufferCheck(struct GeoArrowBuilder* builder, int64_t i,
                                              int64_t additional_size_bytes) {
   return builder->view.buffers[i].capacity_bytes >=
@@ -625,6 +733,62 @@ static inline void GeoArrowCoordViewCopy(const struct GeoArrowCoordView* src,
   }
 }
 
+// Like GeoArrowCoordViewCopy() but for a destination whose ordinates are stored
+// as float.
+static inline void GeoArrowCoordViewCopyFloat(const struct GeoArrowCoordView* src,
+                                              enum GeoArrowDimensions src_dim,
+                                              int64_t src_offset,
+                                              struct GeoArrowWritableFloatCoordView* dst,
+                                              enum GeoArrowDimensions dst_dim,
+                                              int64_t dst_offset, int64_t n) {
+  int dst_dim_map[4];
+  GeoArrowMapDimensions(src_dim, dst_dim, dst_dim_map);
+
+  double empty_value;
+  memcpy(&empty_value, _GeoArrowkEmptyPointCoords, sizeof(double));
+
+  for (int j = 0; j < dst->n_values; j++) {
+    if (dst_dim_map[j] == -1) {
+      for (int64_t i = 0; i < n; i++) {
+        GEOARROW_COORD_VIEW_VALUE(dst, dst_offset + i, j) = (float)empty_value;
+      }
+    } else {
+      for (int64_t i = 0; i < n; i++) {
+        GEOARROW_COORD_VIEW_VALUE(dst, dst_offset + i, j) =
+            (float)GEOARROW_COORD_VIEW_VALUE(src, src_offset + i, dst_dim_map[j]);
+      }
+    }
+  }
+}
+
+// Like GeoArrowCoordViewCopy() but for a destination whose ordinates are stored
+// as quantized integers. Dimensions in dst but not in src are encoded as 0.
+static inline void GeoArrowCoordViewCopyInt32(
+    const struct GeoArrowCoordView* src, enum GeoArrowDimensions src_dim,
+    int64_t src_offset, struct GeoArrowWritableInt32CoordView* dst,
+    enum GeoArrowDimensions dst_dim, int64_t dst_offset, int64_t n,
+    const struct GeoArrowQuantization* quantization) {
+  if (n == 0) {
+    return;
+  }
+
+  int dst_dim_map[4];
+  GeoArrowMapDimensions(src_dim, dst_dim, dst_dim_map);
+
+  for (int j = 0; j < dst->n_values; j++) {
+    if (dst_dim_map[j] == -1) {
+      for (int64_t i = 0; i < n; i++) {
+        GEOARROW_COORD_VIEW_VALUE(dst, dst_offset + i, j) = 0;
+      }
+    } else {
+      GeoArrowQuantizeOrdinates(
+          &GEOARROW_COORD_VIEW_VALUE(src, src_offset, dst_dim_map[j]),
+          src->coords_stride, &GEOARROW_COORD_VIEW_VALUE(dst, dst_offset, j),
+          dst->coords_stride, n, quantization->scale[j], quantization->offset[j]);
+    }
+  }
+}
+
 static inline int GeoArrowBuilderCoordsCheck(struct GeoArrowBuilder* builder,
                                              int64_t additional_size_coords) {
   return builder->view.coords.capacity_coords >=
@@ -634,9 +798,21 @@ static inline int GeoArrowBuilderCoordsCheck(struct GeoArrowBuilder* builder,
 static inline void GeoArrowBuilderCoordsAppendUnsafe(
     struct GeoArrowBuilder* builder, const struct GeoArrowCoordView* coords,
     enum GeoArrowDimensions dimensions, int64_t offset, int64_t n) {
-  GeoArrowCoordViewCopy(coords, dimensions, offset, &builder->view.coords,
-                        builder->view.schema_view.dimensions,
-                        builder->view.coords.size_coords, n);
+  if (GeoArrowCoordTypeIsFloat(builder->view.schema_view.coord_type)) {
+    GeoArrowCoordViewCopyFloat(coords, dimensions, offset, &builder->view.coords_float,
+                               builder->view.schema_view.dimensions,
+                               builder->view.coords.size_coords, n);
+  } else if (GeoArrowCoordTypeIsQuantized(builder->view.schema_view.coord_type)) {
+    GeoArrowCoordViewCopyInt32(coords, dimensions, offset, &builder->view.coords_int32,
+                               builder->view.schema_view.dimensions,
+                               builder->view.coords.size_coords, n,
+                               &builder->view.quantization);
+  } else {
+    GeoArrowCoordViewCopy(coords, dimensions, offset, &builder->view.coords,
+                          builder->view.schema_view.dimensions,
+                          builder->view.coords.size_coords, n);
+  }
+
   builder->view.coords.size_coords += n;
 }
 
@@ -708,28 +884,43 @@ static inline GeoArrowErrorCode GeoArrowBuilderCoordsReserve(
   }
 
   struct GeoArrowWritableCoordView* writable_view = &builder->view.coords;
+  struct GeoArrowWritableFloatCoordView* writable_float_view =
+      &builder->view.coords_float;
   int result;
   int64_t last_buffer = builder->view.n_buffers - 1;
   int n_values = writable_view->n_values;
+  enum GeoArrowCoordType coord_type = builder->view.schema_view.coord_type;
+  int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(coord_type);
+  int is_float = GeoArrowCoordTypeIsFloat(coord_type);
+  int is_int32 = GeoArrowCoordTypeIsQuantized(coord_type);
 
-  switch (builder->view.schema_view.coord_type) {
+  switch (GeoArrowCoordTypeLayout(coord_type)) {
     case GEOARROW_COORD_TYPE_INTERLEAVED:
       // Sync the coord view size back to the buffer size
       builder->view.buffers[last_buffer].size_bytes =
-          writable_view->size_coords * sizeof(double) * n_values;
+          writable_view->size_coords * ordinate_size * n_values;
 
       // Use the normal reserve
       result = GeoArrowBuilderReserveBuffer(
-          builder, last_buffer, additional_size_coords * sizeof(double) * n_values);
+          builder, last_buffer, additional_size_coords * ordinate_size * n_values);
       if (result != GEOARROW_OK) {
         return result;
       }
 
       // Sync the capacity and pointers back to the writable view
       writable_view->capacity_coords =
-          builder->view.buffers[last_buffer].capacity_bytes / sizeof(double) / n_values;
+          builder->view.buffers[last_buffer].capacity_bytes / ordinate_size / n_values;
       for (int i = 0; i < n_values; i++) {
-        writable_view->values[i] = builder->view.buffers[last_buffer].data.as_double + i;
+        if (is_float) {
+          writable_float_view->values[i] =
+              builder->view.buffers[last_buffer].data.as_float + i;
+        } else if (is_int32) {
+          builder->view.coords_int32.values[i] =
+              builder->view.buffers[last_buffer].data.as_int32 + i;
+        } else {
+          writable_view->values[i] =
+              builder->view.buffers[last_buffer].data.as_double + i;
+        }
       }
 
       return GEOARROW_OK;
@@ -737,11 +928,11 @@ static inline GeoArrowErrorCode GeoArrowBuilderCoordsReserve(
     case GEOARROW_COORD_TYPE_SEPARATE:
       for (int64_t i = last_buffer - n_values + 1; i <= last_buffer; i++) {
         // Sync the coord view size back to the buffer size
-        builder->view.buffers[i].size_bytes = writable_view->size_coords * sizeof(double);
+        builder->view.buffers[i].size_bytes = writable_view->size_coords * ordinate_size;
 
         // Use the normal reserve
         result = GeoArrowBuilderReserveBuffer(builder, i,
-                                              additional_size_coords * sizeof(double));
+                                              additional_size_coords * ordinate_size);
         if (result != GEOARROW_OK) {
           return result;
         }
@@ -749,10 +940,18 @@ static inline GeoArrowErrorCode GeoArrowBuilderCoordsReserve(
 
       // Sync the capacity and pointers back to the writable view
       writable_view->capacity_coords =
-          builder->view.buffers[last_buffer].capacity_bytes / sizeof(double);
+          builder->view.buffers[last_buffer].capacity_bytes / ordinate_size;
       for (int i = 0; i < n_values; i++) {
-        writable_view->values[i] =
-            builder->view.buffers[last_buffer - n_values + 1 + i].data.as_double;
+        if (is_float) {
+          writable_float_view->values[i] =
+              builder->view.buffers[last_buffer - n_values + 1 + i].data.as_float;
+        } else if (is_int32) {
+          builder->view.coords_int32.values[i] =
+              builder->view.buffers[last_buffer - n_values + 1 + i].data.as_int32;
+        } else {
+          writable_view->values[i] =
+              builder->view.buffers[last_buffer - n_values + 1 + i].data.as_double;
+        }
       }
 
       return GEOARROW_OK;
@@ -1,5 +1,6 @@
 
 #include <cmath>
+#include <limits>
 
 #include <gtest/gtest.h>
 
@@ -100,6 +101,146 @@ TEST(TypeInlineTest, TypeInlineTestMakeType) {
             GEOARROW_TYPE_MULTIPOLYGON_ZM);
 }
 
+TEST(TypeInlineTest, TypeInlineTestMakeTypeFloat) {
+  EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_POINT, GEOARROW_DIMENSIONS_XY,
+                             GEOARROW_COORD_TYPE_SEPARATE_FLOAT),
+            GEOARROW_TYPE_FLOAT_POINT);
+  EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON,
+                             GEOARROW_DIMENSIONS_XYZM,
+                             GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT),
+            GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_ZM);
+  EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_BOX, GEOARROW_DIMENSIONS_XY,
+                             GEOARROW_COORD_TYPE_SEPARATE_FLOAT),
+            GEOARROW_TYPE_UNINITIALIZED);
+
+  EXPECT_EQ(GeoArrowGeometryTypeFromType(GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M),
+            GEOARROW_GEOMETRY_TYPE_POLYGON);
+  EXPECT_EQ(GeoArrowDimensionsFromType(GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M),
+            GEOARROW_DIMENSIONS_XYM);
+  EXPECT_EQ(GeoArrowCoordTypeFromType(GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M),
+            GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT);
+  EXPECT_EQ(GeoArrowCoordTypeFromType(GEOARROW_TYPE_FLOAT_POINT_Z),
+            GEOARROW_COORD_TYPE_SEPARATE_FLOAT);
+
+  EXPECT_EQ(GeoArrowCoordTypeLayout(GEOARROW_COORD_TYPE_SEPARATE_FLOAT),
+            GEOARROW_COORD_TYPE_SEPARATE);
+  EXPECT_EQ(GeoArrowCoordTypeLayout(GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT),
+            GEOARROW_COORD_TYPE_INTERLEAVED);
+  EXPECT_EQ(GeoArrowCoordTypeOrdinateSize(GEOARROW_COORD_TYPE_SEPARATE), 8);
+  EXPECT_EQ(GeoArrowCoordTypeOrdinateSize(GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT), 4);
+  EXPECT_STREQ(GeoArrowCoordTypeString(GEOARROW_COORD_TYPE_SEPARATE_FLOAT),
+               "separate_float");
+}
+
+TEST(TypeInlineTest, TypeInlineTestCopyCoordsFloat) {
+  double x[] = {1, 2};
+  double y[] = {3, 4};
+  struct GeoArrowCoordView src;
+  src.values[0] = x;
+  src.values[1] = y;
+  src.n_coords = 2;
+  src.n_values = 2;
+  src.coords_stride = 1;
+
+  float out[6];
+  struct GeoArrowWritableFloatCoordView dst;
+  dst.values[0] = out;
+  dst.values[1] = out + 1;
+  dst.values[2] = out + 2;
+  dst.n_values = 3;
+  dst.coords_stride = 3;
+
+  GeoArrowCoordViewCopyFloat(&src, GEOARROW_DIMENSIONS_XY, 0, &dst,
+                             GEOARROW_DIMENSIONS_XYZ, 0, 2);
+  EXPECT_EQ(out[0], 1);
+  EXPECT_EQ(out[1], 3);
+  EXPECT_TRUE(std::isnan(out[2]));
+  EXPECT_EQ(out[3], 2);
+  EXPECT_EQ(out[4], 4);
+  EXPECT_TRUE(std::isnan(out[5]));
+}
+
+TEST(TypeInlineTest, TypeInlineTestMakeTypeInt32) {
+  EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_POINT, GEOARROW_DIMENSIONS_XY,
+                             GEOARROW_COORD_TYPE_SEPARATE_INT32),
+            GEOARROW_TYPE_INT32_POINT);
+  EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON,
+                             GEOARROW_DIMENSIONS_XYZM,
+                             GEOARROW_COORD_TYPE_INTERLEAVED_INT32),
+            GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_ZM);
+  EXPECT_EQ(GeoArrowCoordTypeFromType(GEOARROW_TYPE_INT32_POLYGON_M),
+            GEOARROW_COORD_TYPE_SEPARATE_INT32);
+
+  EXPECT_EQ(GeoArrowCoordTypeLayout(GEOARROW_COORD_TYPE_INTERLEAVED_INT32),
+            GEOARROW_COORD_TYPE_INTERLEAVED);
+  EXPECT_EQ(GeoArrowCoordTypeOrdinateSize(GEOARROW_COORD_TYPE_SEPARATE_INT32), 4);
+  EXPECT_TRUE(GeoArrowCoordTypeIsQuantized(GEOARROW_COORD_TYPE_SEPARATE_INT32));
+  EXPECT_FALSE(GeoArrowCoordTypeIsQuantized(GEOARROW_COORD_TYPE_SEPARATE_FLOAT));
+  EXPECT_TRUE(GeoArrowCoordTypeIsFloat(GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT));
+  EXPECT_FALSE(GeoArrowCoordTypeIsFloat(GEOARROW_COORD_TYPE_INTERLEAVED_INT32));
+  EXPECT_STREQ(GeoArrowCoordTypeString(GEOARROW_COORD_TYPE_INTERLEAVED_INT32),
+               "interleaved_int32");
+}
+
+TEST(TypeInlineTest, TypeInlineTestQuantizeOrdinates) {
+  double src[] = {10, 10.4, 10.6, 9.4, -1e20, 1e20, NAN};
+  int32_t out[7];
+  GeoArrowQuantizeOrdinates(src, 1, out, 1, 7, 0.5, 10);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[1], 1);
+  EXPECT_EQ(out[2], 1);
+  EXPECT_EQ(out[3], -1);
+  EXPECT_EQ(out[4], std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(out[5], std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(out[6], 0);
+
+  double decoded[3];
+  GeoArrowDequantizeOrdinates(out, 1, decoded, 1, 3, 0.5, 10);
+  EXPECT_EQ(decoded[0], 10);
+  EXPECT_EQ(decoded[1], 10.5);
+  EXPECT_EQ(decoded[2], 10.5);
+
+  // Strided input and output
+  double interleaved[] = {1, 100, 2, 200};
+  int32_t out_interleaved[4];
+  GeoArrowQuantizeOrdinates(interleaved + 1, 2, out_interleaved + 1, 2, 2, 100, 0);
+  EXPECT_EQ(out_interleaved[1], 1);
+  EXPECT_EQ(out_interleaved[3], 2);
+}
+
+TEST(TypeInlineTest, TypeInlineTestCopyCoordsInt32) {
+  double x[] = {1, 2};
+  double y[] = {3, 4};
+  struct GeoArrowCoordView src;
+  src.values[0] = x;
+  src.values[1] = y;
+  src.n_coords = 2;
+  src.n_values = 2;
+  src.coords_stride = 1;
+
+  int32_t out[6];
+  struct GeoArrowWritableInt32CoordView dst;
+  dst.values[0] = out;
+  dst.values[1] = out + 1;
+  dst.values[2] = out + 2;
+  dst.n_values = 3;
+  dst.coords_stride = 3;
+
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[1] = 0.1;
+  quantization.offset[0] = 1;
+
+  GeoArrowCoordViewCopyInt32(&src, GEOARROW_DIMENSIONS_XY, 0, &dst,
+                             GEOARROW_DIMENSIONS_XYZ, 0, 2, &quantization);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[1], 30);
+  EXPECT_EQ(out[2], 0);
+  EXPECT_EQ(out[3], 1);
+  EXPECT_EQ(out[4], 40);
+  EXPECT_EQ(out[5], 0);
+}
+
 TEST(TypeInlineTest, TypeInlineTestMakeTypeInvalidCoordType) {
   EXPECT_EQ(GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_POINT, GEOARROW_DIMENSIONS_XY,
                              GEOARROW_COORD_TYPE_UNKNOWN),
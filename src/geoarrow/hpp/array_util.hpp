@@ -25,6 +25,16 @@ namespace array_util {
 
 namespace internal {
 
+inline bool IsFloatCoordType(enum GeoArrowCoordType coord_type) {
+  return coord_type == GEOARROW_COORD_TYPE_SEPARATE_FLOAT ||
+         coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+}
+
+inline bool IsQuantizedCoordType(enum GeoArrowCoordType coord_type) {
+  return coord_type == GEOARROW_COORD_TYPE_SEPARATE_INT32 ||
+         coord_type == GEOARROW_COORD_TYPE_INTERLEAVED_INT32;
+}
+
 // The verbose bits of a random access iterator for simple outer + index-based
 // iteration. Requires that an implementation defineds value_type operator[]
 // and value_type operator*.
@@ -540,13 +550,40 @@ struct CoordSequence {
     return GEOARROW_OK;
   }
 
+  /// \brief Initialize from a GeoArrowFloatCoordView
+  GeoArrowErrorCode InitFrom(const struct GeoArrowFloatCoordView* view) {
+    if (static_cast<uint32_t>(view->n_values) < coord_size ||
+        !std::is_same<ordinate_type, float>::value) {
+      return EINVAL;
+    }
+
+    this->offset = 0;
+    this->length = view->n_coords;
+    this->stride = view->coords_stride;
+    for (uint32_t i = 0; i < coord_size; i++) {
+      this->InitValue(i, reinterpret_cast<const ordinate_type*>(view->values[i]));
+    }
+    return GEOARROW_OK;
+  }
+
   /// \brief Initialize from a GeoArrowArrayView
+  ///
+  /// The ordinate_type of this sequence must match the storage type of the
+  /// array's coordinates (i.e., float for float coordinate types).
   GeoArrowErrorCode InitFrom(const struct GeoArrowArrayView* view, int level = 0) {
     if (level != view->n_offsets) {
       return EINVAL;
     }
 
-    GEOARROW_RETURN_NOT_OK(InitFrom(&view->coords));
+    if (internal::IsFloatCoordType(view->schema_view.coord_type)) {
+      GEOARROW_RETURN_NOT_OK(InitFrom(&view->coords_float));
+    } else if (internal::IsQuantizedCoordType(view->schema_view.coord_type)) {
+      // Use a QuantizedCoordSequence to iterate over quantized coordinates
+      return EINVAL;
+    } else {
+      GEOARROW_RETURN_NOT_OK(InitFrom(&view->coords));
+    }
+
     this->offset = view->offset[level];
     this->length = view->length[level];
     return GEOARROW_OK;
@@ -658,6 +695,129 @@ struct CoordSequence {
   }
 };
 
+/// \brief View of a quantized GeoArrow coordinate sequence
+///
+/// Like the CoordSequence, but for coordinates whose ordinates are stored as
+/// quantized 32-bit integers. Ordinates are decoded as `stored * scale + offset`
+/// as each coordinate is accessed, such that iterating over quantized data does
+/// not require a full copy of the coordinates as double. Use this type as the
+/// Sequence parameter of the array types to iterate over quantized arrays (e.g.,
+/// `LinestringArray<XY<double>, QuantizedCoordSequence<XY<double>>>`).
+template <typename Coord>
+struct QuantizedCoordSequence {
+  /// \brief The C++ Coordinate type
+  using value_type = Coord;
+
+  /// \brief The C++ numeric type for decoded ordinates
+  using ordinate_type = typename value_type::value_type;
+
+  /// \brief The number of values in each coordinate
+  static constexpr uint32_t coord_size = Coord().size();
+
+  /// \brief The offset into values to apply
+  int64_t offset{};
+
+  /// \brief The number of coordinates in the sequence
+  int64_t length{};
+
+  /// \brief Pointers to the first stored ordinate values in each dimension
+  std::array<const int32_t*, coord_size> values{};
+
+  /// \brief The distance (in elements) between sequential coordinates in
+  /// each values array.
+  int64_t stride{};
+
+  /// \brief The scale applied to each dimension
+  std::array<ordinate_type, coord_size> scale{};
+
+  /// \brief The offset applied to each dimension (after scaling)
+  std::array<ordinate_type, coord_size> translate{};
+
+  /// \brief Initialize from a GeoArrowInt32CoordView and its quantization
+  GeoArrowErrorCode InitFrom(const struct GeoArrowInt32CoordView* view,
+                             const struct GeoArrowQuantization* quantization) {
+    if (static_cast<uint32_t>(view->n_values) < coord_size) {
+      return EINVAL;
+    }
+
+    this->offset = 0;
+    this->length = view->n_coords;
+    this->stride = view->coords_stride;
+    for (uint32_t i = 0; i < coord_size; i++) {
+      this->values[i] = view->values[i];
+      this->scale[i] = static_cast<ordinate_type>(quantization->scale[i]);
+      this->translate[i] = static_cast<ordinate_type>(quantization->offset[i]);
+    }
+    return GEOARROW_OK;
+  }
+
+  /// \brief Initialize from a GeoArrowArrayView
+  ///
+  /// The array must store its coordinates as quantized integers.
+  GeoArrowErrorCode InitFrom(const struct GeoArrowArrayView* view, int level = 0) {
+    if (level != view->n_offsets ||
+        !internal::IsQuantizedCoordType(view->schema_view.coord_type)) {
+      return EINVAL;
+    }
+
+    GEOARROW_RETURN_NOT_OK(InitFrom(&view->coords_int32, &view->quantization));
+    this->offset = view->offset[level];
+    this->length = view->length[level];
+    return GEOARROW_OK;
+  }
+
+  /// \brief Return a decoded coordinate at the given position
+  Coord coord(int64_t i) const {
+    Coord out;
+    for (size_t j = 0; j < out.size(); j++) {
+      out[j] = static_cast<ordinate_type>(values[j][(offset + i) * stride]) * scale[j] +
+               translate[j];
+    }
+    return out;
+  }
+
+  /// \brief Return the number of coordinates in the sequence
+  int64_t size() const { return length; }
+
+  /// \brief Return a new coordinate sequence that is a subset of this one
+  QuantizedCoordSequence<Coord> Slice(int64_t offset, int64_t length) const {
+    QuantizedCoordSequence<Coord> out = *this;
+    out.offset += offset;
+    out.length = length;
+    return out;
+  }
+
+  /// \brief Call func once for each decoded vertex in this sequence
+  template <typename CoordDst, typename Func>
+  void VisitVertices(Func&& func) const {
+    for (const auto vertex : *this) {
+      func(CoordCast<Coord, CoordDst>(vertex));
+    }
+  }
+
+  /// \brief Call func once for each sequential pair of decoded vertices
+  template <typename CoordDst, typename Func>
+  void VisitEdges(Func&& func) const {
+    if (this->length < 2) {
+      return;
+    }
+
+    auto it = begin();
+    CoordDst start = CoordCast<Coord, CoordDst>(*it);
+    ++it;
+    while (it != end()) {
+      CoordDst end = CoordCast<Coord, CoordDst>(*it);
+      func(start, end);
+      start = end;
+      ++it;
+    }
+  }
+
+  using const_iterator = internal::CoordSequenceIterator<QuantizedCoordSequence>;
+  const_iterator begin() const { return const_iterator(*this, 0); }
+  const_iterator end() const { return const_iterator(*this, length); }
+};
+
 /// \brief View of an unaligned GeoArrow coordinate sequence
 ///
 /// A view of zero or more coordinates. This data structure can handle either interleaved
@@ -719,7 +879,9 @@ struct UnalignedCoordSequence {
 
   /// \brief Initialize from a GeoArrowArrayView
   GeoArrowErrorCode InitFrom(const struct GeoArrowArrayView* view, int level = 0) {
-    if (level != view->n_offsets) {
+    if (level != view->n_offsets ||
+        internal::IsFloatCoordType(view->schema_view.coord_type) ||
+        internal::IsQuantizedCoordType(view->schema_view.coord_type)) {
       return EINVAL;
     }
 
@@ -1084,8 +1246,8 @@ struct Array {
 };
 
 /// \brief An Array of points
-template <typename Coord>
-struct PointArray : public Array<CoordSequence<Coord>> {
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
+struct PointArray : public Array<Sequence> {
   static constexpr enum GeoArrowGeometryType geometry_type = GEOARROW_GEOMETRY_TYPE_POINT;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
 
@@ -1094,7 +1256,7 @@ struct PointArray : public Array<CoordSequence<Coord>> {
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const { return this->value; }
+  Sequence Coords() const { return this->value; }
 
   /// \brief Return a new array that is a subset of this one
   ///
@@ -1157,8 +1319,8 @@ struct BoxArray : public Array<CoordSequence<typename Coord::box_type>> {
 };
 
 /// \brief An Array of linestrings
-template <typename Coord>
-struct LinestringArray : public Array<ListSequence<CoordSequence<Coord>>> {
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
+struct LinestringArray : public Array<ListSequence<Sequence>> {
   static constexpr enum GeoArrowGeometryType geometry_type =
       GEOARROW_GEOMETRY_TYPE_LINESTRING;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
@@ -1168,7 +1330,7 @@ struct LinestringArray : public Array<ListSequence<CoordSequence<Coord>>> {
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const { return this->value.ValidChildElements(); }
+  Sequence Coords() const { return this->value.ValidChildElements(); }
 
   /// \brief Return a new array that is a subset of this one
   ///
@@ -1180,8 +1342,8 @@ struct LinestringArray : public Array<ListSequence<CoordSequence<Coord>>> {
 };
 
 /// \brief An Array of polygons
-template <typename Coord>
-struct PolygonArray : public Array<ListSequence<ListSequence<CoordSequence<Coord>>>> {
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
+struct PolygonArray : public Array<ListSequence<ListSequence<Sequence>>> {
   static constexpr enum GeoArrowGeometryType geometry_type =
       GEOARROW_GEOMETRY_TYPE_POLYGON;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
@@ -1191,7 +1353,7 @@ struct PolygonArray : public Array<ListSequence<ListSequence<CoordSequence<Coord
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const {
+  Sequence Coords() const {
     return this->value.ValidChildElements().ValidChildElements();
   }
 
@@ -1205,8 +1367,8 @@ struct PolygonArray : public Array<ListSequence<ListSequence<CoordSequence<Coord
 };
 
 /// \brief An Array of multipoints
-template <typename Coord>
-struct MultipointArray : public Array<ListSequence<CoordSequence<Coord>>> {
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
+struct MultipointArray : public Array<ListSequence<Sequence>> {
   static constexpr enum GeoArrowGeometryType geometry_type =
       GEOARROW_GEOMETRY_TYPE_MULTIPOINT;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
@@ -1216,7 +1378,7 @@ struct MultipointArray : public Array<ListSequence<CoordSequence<Coord>>> {
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const { return this->value.ValidChildElements(); }
+  Sequence Coords() const { return this->value.ValidChildElements(); }
 
   /// \brief Return a new array that is a subset of this one
   ///
@@ -1236,9 +1398,9 @@ struct MultipointArray : public Array<ListSequence<CoordSequence<Coord>>> {
 };
 
 /// \brief An Array of multilinestrings
-template <typename Coord>
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
 struct MultiLinestringArray
-    : public Array<ListSequence<ListSequence<CoordSequence<Coord>>>> {
+    : public Array<ListSequence<ListSequence<Sequence>>> {
   static constexpr enum GeoArrowGeometryType geometry_type =
       GEOARROW_GEOMETRY_TYPE_MULTILINESTRING;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
@@ -1248,7 +1410,7 @@ struct MultiLinestringArray
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const {
+  Sequence Coords() const {
     return this->value.ValidChildElements().ValidChildElements();
   }
 
@@ -1262,9 +1424,9 @@ struct MultiLinestringArray
 };
 
 /// \brief An Array of multipolygons
-template <typename Coord>
+template <typename Coord, typename Sequence = CoordSequence<Coord>>
 struct MultiPolygonArray
-    : public Array<ListSequence<ListSequence<ListSequence<CoordSequence<Coord>>>>> {
+    : public Array<ListSequence<ListSequence<ListSequence<Sequence>>>> {
   static constexpr enum GeoArrowGeometryType geometry_type =
       GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON;
   static constexpr enum GeoArrowDimensions dimensions = Coord::dimensions;
@@ -1274,7 +1436,7 @@ struct MultiPolygonArray
   /// Note that in the presence of null values, some of the coordinates values
   /// are not present in the array (e.g., for the purposes of calculating aggregate
   /// statistics).
-  CoordSequence<Coord> Coords() const {
+  Sequence Coords() const {
     return this->value.ValidChildElements().ValidChildElements().ValidChildElements();
   }
 
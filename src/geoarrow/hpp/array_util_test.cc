@@ -10,6 +10,7 @@
 using geoarrow::array_util::CoordCast;
 using geoarrow::array_util::CoordSequence;
 using geoarrow::array_util::ListSequence;
+using geoarrow::array_util::QuantizedCoordSequence;
 using geoarrow::array_util::UnalignedCoordSequence;
 using XY = geoarrow::array_util::XY<double>;
 using XYZ = geoarrow::array_util::XYZ<double>;
@@ -686,6 +687,87 @@ TEST(GeoArrowHppTest, SetArrayLinestring) {
   }
 }
 
+TEST(GeoArrowHppTest, SetArrayFloatLinestring) {
+  using XYFloat = geoarrow::array_util::XY<float>;
+
+  for (const auto type :
+       {GEOARROW_TYPE_FLOAT_LINESTRING, GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING,
+        GEOARROW_TYPE_FLOAT_LINESTRING_ZM,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_ZM}) {
+    SCOPED_TRACE(geoarrow::GeometryDataType::Make(type).ToString());
+    geoarrow::ArrayWriter writer(type);
+    WKXTester tester;
+    tester.ReadWKT("LINESTRING (0 1, 2 3)", writer.visitor());
+    tester.ReadWKT("LINESTRING (4 5, 6 7, 8.5 9)", writer.visitor());
+
+    struct ArrowArray array;
+    writer.Finish(&array);
+
+    geoarrow::ArrayReader reader(type);
+    reader.SetArray(&array);
+
+    // A double sequence can't view float storage
+    geoarrow::array_util::LinestringArray<XY> double_array;
+    EXPECT_EQ(double_array.Init(reader.View().array_view()), EINVAL);
+
+    geoarrow::array_util::LinestringArray<XYFloat> native_array;
+    ASSERT_EQ(native_array.Init(reader.View().array_view()), GEOARROW_OK);
+    EXPECT_THAT(native_array.Coords(),
+                ::testing::ElementsAre(XYFloat{0, 1}, XYFloat{2, 3}, XYFloat{4, 5},
+                                       XYFloat{6, 7}, XYFloat{8.5, 9}));
+
+    auto sliced_coords = native_array.Slice(1, 1).Coords();
+    std::vector<float> sliced_x(sliced_coords.dbegin(0), sliced_coords.dend(0));
+    EXPECT_THAT(sliced_x, ::testing::ElementsAre(4, 6, 8.5));
+  }
+}
+
+TEST(GeoArrowHppTest, SetArrayQuantizedLinestring) {
+  struct GeoArrowQuantization quantization;
+  GeoArrowQuantizationInitDefault(&quantization);
+  quantization.scale[0] = 0.5;
+  quantization.scale[1] = 0.25;
+  quantization.offset[1] = 100;
+
+  for (const auto type :
+       {GEOARROW_TYPE_INT32_LINESTRING, GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING}) {
+    auto data_type =
+        geoarrow::GeometryDataType::Make(type).WithQuantization(quantization);
+    SCOPED_TRACE(data_type.ToString());
+
+    struct ArrowSchema schema;
+    data_type.InitSchema(&schema);
+
+    geoarrow::ArrayWriter writer(&schema);
+    WKXTester tester;
+    tester.ReadWKT("LINESTRING (0 100, 2 103)", writer.visitor());
+    tester.ReadWKT("LINESTRING (4 105, 6.5 107.25, 8 109)", writer.visitor());
+
+    struct ArrowArray array;
+    writer.Finish(&array);
+
+    geoarrow::ArrayReader reader(&schema);
+    reader.SetArray(&array);
+    schema.release(&schema);
+
+    // Quantized storage can only be viewed through a QuantizedCoordSequence
+    geoarrow::array_util::LinestringArray<XY> double_array;
+    EXPECT_EQ(double_array.Init(reader.View().array_view()), EINVAL);
+
+    geoarrow::array_util::LinestringArray<XY, QuantizedCoordSequence<XY>> native_array;
+    ASSERT_EQ(native_array.Init(reader.View().array_view()), GEOARROW_OK);
+    EXPECT_THAT(native_array.Coords(),
+                ::testing::ElementsAre(XY{0, 100}, XY{2, 103}, XY{4, 105},
+                                       XY{6.5, 107.25}, XY{8, 109}));
+
+    std::vector<XY> sliced;
+    for (const auto& coord : native_array.Slice(1, 1).Coords()) {
+      sliced.push_back(coord);
+    }
+    EXPECT_THAT(sliced, ::testing::ElementsAre(XY{4, 105}, XY{6.5, 107.25}, XY{8, 109}));
+  }
+}
+
 TEST(GeoArrowHppTest, SetArrayNullableLinestring) {
   geoarrow::ArrayWriter writer(GEOARROW_TYPE_LINESTRING);
   WKXTester tester;
@@ -0,0 +1,485 @@
+
+#ifndef GEOARROW_HPP_ARROW_COMPUTE_INCLUDED
+#define GEOARROW_HPP_ARROW_COMPUTE_INCLUDED
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <arrow/array.h>
+#include <arrow/builder.h>
+#include <arrow/c/bridge.h>
+#include <arrow/compute/api.h>
+#include <arrow/extension_type.h>
+#include <arrow/scalar.h>
+#include <arrow/type.h>
+
+#include "geoarrow/geoarrow.h"
+#include "geoarrow/hpp/internal.hpp"
+
+/// \defgroup hpp-arrow-compute Arrow C++ compute integration
+///
+/// Exposes the GeoArrowKernel implementations as arrow::compute functions such
+/// that they can be called with arrow::compute::CallFunction() or from an
+/// Acero plan. Call geoarrow::arrow::compute::RegisterFunctions() to add the
+/// following functions to a registry:
+///
+/// - geoarrow_as_geoarrow: Scalar function wrapping the as_geoarrow kernel. Requires
+///   the "type" option to be set to the integer value of the output GeoArrowType.
+/// - geoarrow_format_wkt: Scalar function wrapping the format_wkt kernel. Accepts
+///   the "precision" and "max_element_size_bytes" options.
+/// - geoarrow_box: Scalar function wrapping the box kernel.
+/// - geoarrow_box_agg: Scalar aggregate function wrapping the box_agg kernel.
+/// - geoarrow_unique_geometry_types_agg: Scalar aggregate function wrapping the
+///   unique_geometry_types_agg kernel whose result is a list<int32> scalar.
+///
+/// Input arrays must have a GeoArrow extension type. Each function call owns its own
+/// GeoArrowKernel. Because GeoArrowKernels are not thread safe, concurrent calls to a
+/// scalar kernel that share a KernelState (e.g., from a bound Acero expression) each
+/// take a kernel from a pool owned by that state, starting a new one when all of the
+/// pooled kernels are in use.
+///
+/// @{
+
+namespace geoarrow {
+
+namespace arrow {
+
+namespace compute {
+
+class KernelOptions;
+
+class KernelOptionsType : public ::arrow::compute::FunctionOptionsType {
+ public:
+  static const KernelOptionsType* GetInstance() {
+    static KernelOptionsType instance;
+    return &instance;
+  }
+
+  const char* type_name() const override { return "GeoArrowKernelOptions"; }
+  std::string Stringify(const ::arrow::compute::FunctionOptions& options) const override;
+  bool Compare(const ::arrow::compute::FunctionOptions& lhs,
+               const ::arrow::compute::FunctionOptions& rhs) const override;
+  std::unique_ptr<::arrow::compute::FunctionOptions> Copy(
+      const ::arrow::compute::FunctionOptions& options) const override;
+};
+
+/// \brief Key/value options forwarded to the GeoArrowKernel's start() callback
+class KernelOptions : public ::arrow::compute::FunctionOptions {
+ public:
+  explicit KernelOptions(std::map<std::string, std::string> values = {})
+      : ::arrow::compute::FunctionOptions(KernelOptionsType::GetInstance()),
+        values(std::move(values)) {}
+
+  static KernelOptions Defaults() { return KernelOptions(); }
+
+  /// \brief Encode values using the serialization used for ArrowSchema metadata
+  std::string Encode() const {
+    std::string out;
+    AppendInt32(&out, static_cast<int32_t>(values.size()));
+    for (const auto& item : values) {
+      AppendInt32(&out, static_cast<int32_t>(item.first.size()));
+      out += item.first;
+      AppendInt32(&out, static_cast<int32_t>(item.second.size()));
+      out += item.second;
+    }
+
+    return out;
+  }
+
+  std::map<std::string, std::string> values;
+
+ private:
+  static void AppendInt32(std::string* out, int32_t value) {
+    char bytes[sizeof(int32_t)];
+    std::memcpy(bytes, &value, sizeof(int32_t));
+    out->append(bytes, sizeof(int32_t));
+  }
+};
+
+inline std::string KernelOptionsType::Stringify(
+    const ::arrow::compute::FunctionOptions& options) const {
+  const auto& values = static_cast<const KernelOptions&>(options).values;
+  std::string out = "GeoArrowKernelOptions(";
+  for (auto it = values.begin(); it != values.end(); it++) {
+    if (it != values.begin()) {
+      out += ", ";
+    }
+    out += it->first + "=" + it->second;
+  }
+
+  return out + ")";
+}
+
+inline bool KernelOptionsType::Compare(
+    const ::arrow::compute::FunctionOptions& lhs,
+    const ::arrow::compute::FunctionOptions& rhs) const {
+  return static_cast<const KernelOptions&>(lhs).values ==
+         static_cast<const KernelOptions&>(rhs).values;
+}
+
+inline std::unique_ptr<::arrow::compute::FunctionOptions> KernelOptionsType::Copy(
+    const ::arrow::compute::FunctionOptions& options) const {
+  return std::unique_ptr<::arrow::compute::FunctionOptions>(
+      new KernelOptions(static_cast<const KernelOptions&>(options).values));
+}
+
+namespace internal {
+
+inline ::arrow::Status StatusFromErrorCode(GeoArrowErrorCode code,
+                                           const struct GeoArrowError& error,
+                                           const std::string& what) {
+  if (code == GEOARROW_OK) {
+    return ::arrow::Status::OK();
+  }
+
+  std::string message = what + " failed with errno " + std::to_string(code) + ": " +
+                        std::string(error.message);
+  switch (code) {
+    case ENOMEM:
+      return ::arrow::Status::OutOfMemory(message);
+    case ENOTSUP:
+      return ::arrow::Status::NotImplemented(message);
+    default:
+      return ::arrow::Status::Invalid(message);
+  }
+}
+
+using CombineAggregate = ::arrow::Result<::arrow::Datum> (*)(
+    const std::shared_ptr<::arrow::DataType>& type,
+    const std::vector<std::shared_ptr<::arrow::Array>>& results);
+
+struct KernelDeleter {
+  void operator()(struct GeoArrowKernel* kernel) const {
+    if (kernel->release != nullptr) {
+      kernel->release(kernel);
+    }
+    delete kernel;
+  }
+};
+
+using KernelPtr = std::unique_ptr<struct GeoArrowKernel, KernelDeleter>;
+
+class KernelState : public ::arrow::compute::KernelState {
+ public:
+  KernelPtr kernel;
+  std::shared_ptr<::arrow::DataType> kernel_type;
+  std::shared_ptr<::arrow::DataType> out_type;
+
+  // Scalar-only: started kernels that no ExecScalar() call is currently using.
+  // GeoArrowKernels are not thread safe, so each concurrent call takes its own
+  // kernel from this pool (starting a new one if it is empty) and returns it when
+  // the batch is done. The mutex guards only the pool.
+  std::mutex mutex;
+  std::vector<KernelPtr> idle;
+
+  // Aggregate-only: finished results of states merged into this one and the
+  // function used to combine them into the output scalar
+  std::vector<std::shared_ptr<::arrow::Array>> merged;
+  CombineAggregate combine{nullptr};
+
+  ::arrow::Status Start(const std::string& name, const ::arrow::DataType& type,
+                        const ::arrow::compute::FunctionOptions* options) {
+    name_ = name;
+    ARROW_RETURN_NOT_OK(::arrow::ExportType(type, &schema_.schema));
+    if (options != nullptr) {
+      encoded_options_ = static_cast<const KernelOptions*>(options)->Encode();
+    }
+
+    ::geoarrow::internal::SchemaHolder out_schema;
+    ARROW_ASSIGN_OR_RAISE(kernel, StartKernel(&out_schema.schema));
+    ARROW_ASSIGN_OR_RAISE(kernel_type, ::arrow::ImportType(&out_schema.schema));
+    out_type = kernel_type;
+    return ::arrow::Status::OK();
+  }
+
+  ::arrow::Result<KernelPtr> AcquireKernel() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!idle.empty()) {
+        KernelPtr out = std::move(idle.back());
+        idle.pop_back();
+        return out;
+      }
+    }
+
+    ::geoarrow::internal::SchemaHolder out_schema;
+    return StartKernel(&out_schema.schema);
+  }
+
+  void ReleaseKernel(KernelPtr kernel) {
+    std::lock_guard<std::mutex> lock(mutex);
+    idle.push_back(std::move(kernel));
+  }
+
+  ::arrow::Result<std::shared_ptr<::arrow::Array>> PushBatch(
+      struct GeoArrowKernel* kernel, const ::arrow::ArraySpan& span, bool aggregate) {
+    ::geoarrow::internal::ArrayHolder array;
+    ARROW_RETURN_NOT_OK(
+        ::arrow::ExportArray(*::arrow::MakeArray(span.ToArrayData()), &array.array));
+
+    ::geoarrow::internal::ArrayHolder out;
+    struct GeoArrowError error {};
+    GeoArrowErrorCode result = kernel->push_batch(
+        kernel, &array.array, aggregate ? nullptr : &out.array, &error);
+    ARROW_RETURN_NOT_OK(StatusFromErrorCode(result, error, "push_batch()"));
+    if (aggregate) {
+      return nullptr;
+    }
+
+    return ::arrow::ImportArray(&out.array, kernel_type);
+  }
+
+  ::arrow::Result<std::shared_ptr<::arrow::Array>> FinishAggregate() {
+    ::geoarrow::internal::ArrayHolder out;
+    struct GeoArrowError error {};
+    GeoArrowErrorCode result = kernel->finish(kernel.get(), &out.array, &error);
+    ARROW_RETURN_NOT_OK(StatusFromErrorCode(result, error, "finish()"));
+    return ::arrow::ImportArray(&out.array, kernel_type);
+  }
+
+ private:
+  std::string name_;
+  ::geoarrow::internal::SchemaHolder schema_;
+  std::string encoded_options_;
+
+  ::arrow::Result<KernelPtr> StartKernel(struct ArrowSchema* out_schema) {
+    KernelPtr out(new struct GeoArrowKernel());
+    GeoArrowErrorCode result = GeoArrowKernelInit(out.get(), name_.c_str(), nullptr);
+    if (result != GEOARROW_OK) {
+      return ::arrow::Status::NotImplemented("GeoArrowKernelInit('", name_,
+                                             "') failed with errno ", result);
+    }
+
+    struct GeoArrowError error {};
+    result = out->start(out.get(), &schema_.schema,
+                        encoded_options_.empty() ? nullptr : encoded_options_.data(),
+                        out_schema, &error);
+    ARROW_RETURN_NOT_OK(StatusFromErrorCode(result, error, name_ + " start()"));
+    return out;
+  }
+};
+
+inline ::arrow::Result<::arrow::TypeHolder> ResolveOutputType(
+    ::arrow::compute::KernelContext* ctx, const std::vector<::arrow::TypeHolder>& types) {
+  GEOARROW_UNUSED(types);
+  auto state = static_cast<KernelState*>(ctx->state());
+  if (state == nullptr) {
+    return ::arrow::Status::Invalid("GeoArrow kernel output type requires a KernelState");
+  }
+
+  return ::arrow::TypeHolder(state->out_type);
+}
+
+inline ::arrow::Status ExecScalar(::arrow::compute::KernelContext* ctx,
+                                  const ::arrow::compute::ExecSpan& batch,
+                                  ::arrow::compute::ExecResult* out) {
+  if (!batch[0].is_array()) {
+    return ::arrow::Status::NotImplemented("GeoArrow kernels require array input");
+  }
+
+  auto state = static_cast<KernelState*>(ctx->state());
+  ARROW_ASSIGN_OR_RAISE(KernelPtr kernel, state->AcquireKernel());
+  ARROW_ASSIGN_OR_RAISE(auto result,
+                        state->PushBatch(kernel.get(), batch[0].array, false));
+  state->ReleaseKernel(std::move(kernel));
+  out->value = result->data();
+  return ::arrow::Status::OK();
+}
+
+inline ::arrow::Status ConsumeAggregate(::arrow::compute::KernelContext* ctx,
+                                        const ::arrow::compute::ExecSpan& batch) {
+  if (!batch[0].is_array()) {
+    return ::arrow::Status::NotImplemented("GeoArrow kernels require array input");
+  }
+
+  auto state = static_cast<KernelState*>(ctx->state());
+  return state->PushBatch(state->kernel.get(), batch[0].array, true).status();
+}
+
+inline ::arrow::Status MergeAggregate(::arrow::compute::KernelContext* ctx,
+                                      ::arrow::compute::KernelState&& src,
+                                      ::arrow::compute::KernelState* dst) {
+  GEOARROW_UNUSED(ctx);
+  auto& src_state = static_cast<KernelState&>(src);
+  auto dst_state = static_cast<KernelState*>(dst);
+
+  ARROW_ASSIGN_OR_RAISE(auto src_result, src_state.FinishAggregate());
+  dst_state->merged.push_back(std::move(src_result));
+  for (auto& result : src_state.merged) {
+    dst_state->merged.push_back(std::move(result));
+  }
+
+  src_state.merged.clear();
+  return ::arrow::Status::OK();
+}
+
+inline ::arrow::Status FinalizeAggregate(::arrow::compute::KernelContext* ctx,
+                                         ::arrow::Datum* out) {
+  auto state = static_cast<KernelState*>(ctx->state());
+  ARROW_ASSIGN_OR_RAISE(auto result, state->FinishAggregate());
+  state->merged.push_back(std::move(result));
+  ARROW_ASSIGN_OR_RAISE(*out, state->combine(state->out_type, state->merged));
+  state->merged.clear();
+  return ::arrow::Status::OK();
+}
+
+inline ::arrow::Result<::arrow::Datum> CombineBox(
+    const std::shared_ptr<::arrow::DataType>& type,
+    const std::vector<std::shared_ptr<::arrow::Array>>& results) {
+  // Each result is a length-one box whose storage is struct<xmin, ymin, xmax, ymax>
+  const double inf = std::numeric_limits<double>::infinity();
+  double bounds[] = {inf, inf, -inf, -inf};
+  for (const auto& result : results) {
+    auto storage = result->type_id() == ::arrow::Type::EXTENSION
+                       ? static_cast<const ::arrow::ExtensionArray&>(*result).storage()
+                       : result;
+    const auto& box = static_cast<const ::arrow::StructArray&>(*storage);
+    for (int i = 0; i < 4; i++) {
+      const auto& values = static_cast<const ::arrow::DoubleArray&>(*box.field(i));
+      if (i < 2) {
+        bounds[i] = std::min(bounds[i], values.Value(0));
+      } else {
+        bounds[i] = std::max(bounds[i], values.Value(0));
+      }
+    }
+  }
+
+  ::arrow::ScalarVector fields;
+  for (double bound : bounds) {
+    fields.push_back(std::make_shared<::arrow::DoubleScalar>(bound));
+  }
+
+  if (type->id() == ::arrow::Type::EXTENSION) {
+    const auto& ext_type = static_cast<const ::arrow::ExtensionType&>(*type);
+    auto storage =
+        std::make_shared<::arrow::StructScalar>(fields, ext_type.storage_type());
+    return ::arrow::Datum(std::make_shared<::arrow::ExtensionScalar>(storage, type));
+  } else {
+    return ::arrow::Datum(std::make_shared<::arrow::StructScalar>(fields, type));
+  }
+}
+
+inline ::arrow::Result<::arrow::Datum> CombineUniqueGeometryTypes(
+    const std::shared_ptr<::arrow::DataType>& type,
+    const std::vector<std::shared_ptr<::arrow::Array>>& results) {
+  GEOARROW_UNUSED(type);
+  std::set<int32_t> geometry_types;
+  for (const auto& result : results) {
+    const auto& values = static_cast<const ::arrow::Int32Array&>(*result);
+    for (int64_t i = 0; i < values.length(); i++) {
+      geometry_types.insert(values.Value(i));
+    }
+  }
+
+  ::arrow::Int32Builder builder;
+  for (int32_t geometry_type : geometry_types) {
+    ARROW_RETURN_NOT_OK(builder.Append(geometry_type));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto values, builder.Finish());
+  return ::arrow::Datum(std::make_shared<::arrow::ListScalar>(values));
+}
+
+inline ::arrow::compute::KernelInit MakeKernelInit(std::string name,
+                                                   CombineAggregate combine) {
+  return [name, combine](::arrow::compute::KernelContext* ctx,
+                         const ::arrow::compute::KernelInitArgs& args)
+             -> ::arrow::Result<std::unique_ptr<::arrow::compute::KernelState>> {
+    GEOARROW_UNUSED(ctx);
+    std::unique_ptr<KernelState> state(new KernelState());
+    ARROW_RETURN_NOT_OK(state->Start(name, *args.inputs[0].type, args.options));
+    state->combine = combine;
+    // Scalar kernels draw from the pool, which starts out with the kernel used to
+    // resolve the output type
+    if (combine == nullptr) {
+      state->idle.push_back(std::move(state->kernel));
+    }
+
+    // The aggregate result of unique_geometry_types_agg is an array of any length
+    if (name == "unique_geometry_types_agg") {
+      state->out_type = ::arrow::list(state->kernel_type);
+    }
+
+    return std::unique_ptr<::arrow::compute::KernelState>(std::move(state));
+  };
+}
+
+}  // namespace internal
+
+/// \brief Register GeoArrow kernels as arrow::compute functions
+///
+/// If registry is nullptr, functions are added to the default function registry.
+inline ::arrow::Status RegisterFunctions(
+    ::arrow::compute::FunctionRegistry* registry = nullptr) {
+  if (registry == nullptr) {
+    registry = ::arrow::compute::GetFunctionRegistry();
+  }
+
+  static const KernelOptions kDefaultOptions = KernelOptions::Defaults();
+
+  ::arrow::compute::OutputType out_type(&internal::ResolveOutputType);
+
+  std::vector<std::pair<std::string, std::string>> scalar_kernels = {
+      {"as_geoarrow", "Convert geometries to a given GeoArrow type"},
+      {"format_wkt", "Format geometries as well-known text"},
+      {"box", "Compute the 2D bounding box of each geometry"}};
+
+  for (const auto& item : scalar_kernels) {
+    ::arrow::compute::FunctionDoc doc(item.second, "", {"geometry"},
+                                      "GeoArrowKernelOptions");
+    auto function = std::make_shared<::arrow::compute::ScalarFunction>(
+        "geoarrow_" + item.first, ::arrow::compute::Arity::Unary(), std::move(doc),
+        &kDefaultOptions);
+
+    ::arrow::compute::ScalarKernel kernel({::arrow::compute::InputType::Any()},
+                                          out_type, &internal::ExecScalar,
+                                          internal::MakeKernelInit(item.first, nullptr));
+    kernel.null_handling = ::arrow::compute::NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = ::arrow::compute::MemAllocation::NO_PREALLOCATE;
+    kernel.can_write_into_slices = false;
+    ARROW_RETURN_NOT_OK(function->AddKernel(std::move(kernel)));
+    ARROW_RETURN_NOT_OK(registry->AddFunction(std::move(function)));
+  }
+
+  std::vector<std::pair<std::string, internal::CombineAggregate>> aggregate_kernels = {
+      {"box_agg", &internal::CombineBox},
+      {"unique_geometry_types_agg", &internal::CombineUniqueGeometryTypes}};
+
+  for (const auto& item : aggregate_kernels) {
+    ::arrow::compute::FunctionDoc doc(
+        item.first == "box_agg" ? "Compute the 2D bounding box of all geometries"
+                                : "Compute the unique geometry types of all geometries",
+        "", {"geometry"}, "GeoArrowKernelOptions");
+    auto function = std::make_shared<::arrow::compute::ScalarAggregateFunction>(
+        "geoarrow_" + item.first, ::arrow::compute::Arity::Unary(), std::move(doc),
+        &kDefaultOptions);
+
+    ::arrow::compute::ScalarAggregateKernel kernel(
+        {::arrow::compute::InputType::Any()}, out_type,
+        internal::MakeKernelInit(item.first, item.second),
+        &internal::ConsumeAggregate, &internal::MergeAggregate,
+        &internal::FinalizeAggregate, /*ordered=*/false);
+    ARROW_RETURN_NOT_OK(function->AddKernel(std::move(kernel)));
+    ARROW_RETURN_NOT_OK(registry->AddFunction(std::move(function)));
+  }
+
+  return ::arrow::Status::OK();
+}
+
+}  // namespace compute
+
+}  // namespace arrow
+
+}  // namespace geoarrow
+
+/// @}
+
+#endif
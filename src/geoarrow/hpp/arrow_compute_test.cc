@@ -0,0 +1,206 @@
+
+#include <stdexcept>
+#include <thread>
+
+#include <arrow/array.h>
+#include <arrow/builder.h>
+#include <arrow/chunked_array.h>
+#include <arrow/compute/api.h>
+#include <arrow/compute/expression.h>
+#include <gtest/gtest.h>
+
+#include "arrow_compute.hpp"
+#include "arrow_extension_type.hpp"
+
+using namespace arrow;
+
+void ASSERT_ARROW_OK(Status status) {
+  if (!status.ok()) {
+    throw std::runtime_error(status.message());
+  }
+}
+
+using geoarrow::arrow::GeometryExtensionType;
+using geoarrow::arrow::compute::KernelOptions;
+
+KernelOptions Options(std::map<std::string, std::string> values) {
+  return KernelOptions(std::move(values));
+}
+
+class ArrowComputeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    registry_ = compute::FunctionRegistry::Make();
+    ASSERT_ARROW_OK(geoarrow::arrow::compute::RegisterFunctions(registry_.get()));
+    ctx_.reset(new compute::ExecContext(default_memory_pool(), nullptr, registry_.get()));
+  }
+
+  std::shared_ptr<ChunkedArray> MakeWKT(std::vector<std::vector<std::string>> chunks) {
+    auto maybe_type = GeometryExtensionType::Make(GEOARROW_TYPE_WKT);
+    ASSERT_ARROW_OK(maybe_type.status());
+
+    ArrayVector arrays;
+    for (const auto& chunk : chunks) {
+      StringBuilder builder;
+      for (const auto& item : chunk) {
+        if (item.empty()) {
+          ASSERT_ARROW_OK(builder.AppendNull());
+        } else {
+          ASSERT_ARROW_OK(builder.Append(item));
+        }
+      }
+
+      auto maybe_storage = builder.Finish();
+      ASSERT_ARROW_OK(maybe_storage.status());
+      arrays.push_back(
+          ExtensionType::WrapArray(maybe_type.ValueUnsafe(), maybe_storage.ValueUnsafe()));
+    }
+
+    return std::make_shared<ChunkedArray>(arrays, maybe_type.ValueUnsafe());
+  }
+
+  Datum Call(const std::string& name, const Datum& arg,
+             const KernelOptions& options = KernelOptions()) {
+    auto maybe_result = compute::CallFunction(name, {arg}, &options, ctx_.get());
+    ASSERT_ARROW_OK(maybe_result.status());
+    return maybe_result.ValueUnsafe();
+  }
+
+  std::shared_ptr<compute::FunctionRegistry> registry_;
+  std::unique_ptr<compute::ExecContext> ctx_;
+};
+
+TEST_F(ArrowComputeTest, ArrowComputeTestRegister) {
+  for (const auto& name : {"geoarrow_as_geoarrow", "geoarrow_format_wkt", "geoarrow_box",
+                           "geoarrow_box_agg", "geoarrow_unique_geometry_types_agg"}) {
+    EXPECT_TRUE(registry_->GetFunction(name).ok()) << name;
+  }
+
+  // Registering twice is an error
+  EXPECT_FALSE(geoarrow::arrow::compute::RegisterFunctions(registry_.get()).ok());
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestOptions) {
+  KernelOptions options = Options({{"precision", "2"}});
+  EXPECT_EQ(options.ToString(), "GeoArrowKernelOptions(precision=2)");
+  EXPECT_TRUE(options.Equals(*options.Copy()));
+  EXPECT_FALSE(options.Equals(KernelOptions()));
+
+  std::string encoded = options.Encode();
+  ASSERT_EQ(encoded.size(), 4 + 4 + 9 + 4 + 1);
+  EXPECT_EQ(encoded.substr(8, 9), "precision");
+  EXPECT_EQ(encoded.substr(21, 1), "2");
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestFormatWKT) {
+  auto wkt = MakeWKT({{"POINT (0.123 1)", ""}, {"LINESTRING (0 1, 2 3)"}});
+
+  Datum result = Call("geoarrow_format_wkt", wkt, Options({{"precision", "1"}}));
+  ASSERT_TRUE(result.is_chunked_array());
+  auto chunked = result.chunked_array();
+  ASSERT_EQ(chunked->num_chunks(), 2);
+  EXPECT_EQ(chunked->type()->id(), Type::STRING);
+
+  const auto& chunk0 = static_cast<const StringArray&>(*chunked->chunk(0));
+  EXPECT_EQ(chunk0.GetString(0), "POINT (0.1 1)");
+  EXPECT_TRUE(chunk0.IsNull(1));
+  const auto& chunk1 = static_cast<const StringArray&>(*chunked->chunk(1));
+  EXPECT_EQ(chunk1.GetString(0), "LINESTRING (0 1, 2 3)");
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestFormatWKTThreads) {
+  auto wkt = MakeWKT({{"POINT (0.123 1)", "", "LINESTRING (0 1, 2 3)"}});
+  auto schema = ::arrow::schema({field("geometry", wkt->type())});
+  compute::ExecBatch batch({wkt->chunk(0)}, wkt->length());
+
+  // A bound expression shares one KernelState among all threads that execute it
+  compute::Expression expr =
+      compute::call("geoarrow_format_wkt", {compute::field_ref("geometry")},
+                    Options({{"precision", "1"}}));
+  auto maybe_bound = expr.Bind(*schema, ctx_.get());
+  ASSERT_ARROW_OK(maybe_bound.status());
+  compute::Expression bound = maybe_bound.ValueUnsafe();
+
+  std::vector<std::string> errors(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < errors.size(); i++) {
+    threads.emplace_back([&, i] {
+      for (int j = 0; j < 100; j++) {
+        auto maybe_result = compute::ExecuteScalarExpression(bound, batch, ctx_.get());
+        if (!maybe_result.ok()) {
+          errors[i] = maybe_result.status().ToString();
+          return;
+        }
+
+        const auto& result =
+            static_cast<const StringArray&>(*maybe_result.ValueUnsafe().make_array());
+        if (result.GetString(0) != "POINT (0.1 1)" || !result.IsNull(1) ||
+            result.GetString(2) != "LINESTRING (0 1, 2 3)") {
+          errors[i] = "unexpected result";
+          return;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& error : errors) {
+    EXPECT_EQ(error, "");
+  }
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestAsGeoArrow) {
+  auto wkt = MakeWKT({{"POINT (0 1)", "POINT (2 3)"}, {""}});
+
+  Datum result = Call("geoarrow_as_geoarrow", wkt, Options({{"type", "1"}}));
+  ASSERT_TRUE(result.is_chunked_array());
+  auto chunked = result.chunked_array();
+  EXPECT_EQ(chunked->length(), 3);
+  EXPECT_EQ(chunked->null_count(), 1);
+
+  // Missing required option
+  KernelOptions defaults = KernelOptions::Defaults();
+  auto maybe_result =
+      compute::CallFunction("geoarrow_as_geoarrow", {wkt}, &defaults, ctx_.get());
+  EXPECT_TRUE(maybe_result.status().IsInvalid());
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestBox) {
+  auto wkt = MakeWKT({{"LINESTRING (0 1, 2 3)"}, {"POINT (-1 5)"}});
+
+  Datum result = Call("geoarrow_box", wkt);
+  ASSERT_TRUE(result.is_chunked_array());
+  EXPECT_EQ(result.chunked_array()->length(), 2);
+
+  result = Call("geoarrow_box_agg", wkt);
+  ASSERT_TRUE(result.is_scalar());
+  auto scalar = result.scalar();
+  if (scalar->type->id() == Type::EXTENSION) {
+    scalar = static_cast<const ExtensionScalar&>(*scalar).value;
+  }
+
+  const auto& box = static_cast<const StructScalar&>(*scalar);
+  ASSERT_EQ(box.value.size(), 4);
+  EXPECT_EQ(static_cast<const DoubleScalar&>(*box.value[0]).value, -1);
+  EXPECT_EQ(static_cast<const DoubleScalar&>(*box.value[1]).value, 1);
+  EXPECT_EQ(static_cast<const DoubleScalar&>(*box.value[2]).value, 2);
+  EXPECT_EQ(static_cast<const DoubleScalar&>(*box.value[3]).value, 5);
+}
+
+TEST_F(ArrowComputeTest, ArrowComputeTestUniqueGeometryTypes) {
+  auto wkt = MakeWKT({{"POINT (0 1)", "LINESTRING (0 1, 2 3)"}, {"POINT Z (0 1 2)"}});
+
+  Datum result = Call("geoarrow_unique_geometry_types_agg", wkt);
+  ASSERT_TRUE(result.is_scalar());
+  EXPECT_EQ(result.type()->ToString(), "list<item: int32>");
+
+  const auto& values = static_cast<const Int32Array&>(
+      *static_cast<const ListScalar&>(*result.scalar()).value);
+  ASSERT_EQ(values.length(), 3);
+  EXPECT_EQ(values.Value(0), 1);
+  EXPECT_EQ(values.Value(1), 2);
+  EXPECT_EQ(values.Value(2), 1001);
+}
@@ -158,6 +158,12 @@ class GeometryDataType {
     return GeometryDataType(schema_view_, metadata_view_copy);
   }
 
+  GeometryDataType WithQuantization(const struct GeoArrowQuantization& quantization) {
+    GeometryDataType new_type(*this);
+    new_type.metadata_view_.quantization = quantization;
+    return new_type;
+  }
+
   GeometryDataType WithCrsLonLat() {
     struct GeoArrowMetadataView metadata_view_copy = metadata_view_;
     GeoArrowMetadataSetLonLat(&metadata_view_copy);
@@ -232,6 +238,10 @@ class GeometryDataType {
 
   std::string extension_metadata() const {
     int64_t metadata_size = GeoArrowMetadataSerialize(&metadata_view_, nullptr, 0);
+    if (metadata_size < 0) {
+      throw ::geoarrow::Exception("Can't serialize non-finite quantization as JSON");
+    }
+
     char* out = reinterpret_cast<char*>(malloc(metadata_size));
     GeoArrowMetadataSerialize(&metadata_view_, out, metadata_size);
     std::string metadata(out, metadata_size);
@@ -264,6 +274,10 @@ class GeometryDataType {
 
   enum GeoArrowCrsType crs_type() const { return metadata_view_.crs_type; }
 
+  const struct GeoArrowQuantization& quantization() const {
+    return metadata_view_.quantization;
+  }
+
   std::string crs() const {
     int64_t len = GeoArrowUnescapeCrs(metadata_view_.crs, nullptr, 0);
     char* out = reinterpret_cast<char*>(malloc(len));
@@ -304,10 +318,18 @@ class GeometryDataType {
       modifiers.push_back(GeoArrowEdgeTypeString(edge_type()));
     }
 
-    if (coord_type() == GEOARROW_COORD_TYPE_INTERLEAVED) {
+    if (GeoArrowCoordTypeLayout(coord_type()) == GEOARROW_COORD_TYPE_INTERLEAVED) {
       modifiers.push_back("interleaved");
     }
 
+    if (GeoArrowCoordTypeIsFloat(coord_type())) {
+      modifiers.push_back("float");
+    }
+
+    if (GeoArrowCoordTypeIsQuantized(coord_type())) {
+      modifiers.push_back("int32");
+    }
+
     std::string type_prefix;
     for (const auto& modifier : modifiers) {
       type_prefix += modifier + " ";
@@ -353,6 +375,7 @@ class GeometryDataType {
     metadata_view_.crs_type = metadata_view.crs_type;
     metadata_view_.crs.data = crs_.data();
     metadata_view_.crs.size_bytes = crs_.size();
+    metadata_view_.quantization = metadata_view.quantization;
   }
 };
 
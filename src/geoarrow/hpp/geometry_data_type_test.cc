@@ -165,6 +165,26 @@ TEST(GeoArrowHppTest, InterleavedToString) {
             "interleaved geoarrow.point");
 }
 
+TEST(GeoArrowHppTest, FloatToString) {
+  EXPECT_EQ(
+      geoarrow::Point().WithCoordType(GEOARROW_COORD_TYPE_SEPARATE_FLOAT).ToString(),
+      "float geoarrow.point");
+  EXPECT_EQ(geoarrow::Linestring()
+                .WithCoordType(GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT)
+                .ToString(),
+            "interleaved float geoarrow.linestring");
+}
+
+TEST(GeoArrowHppTest, Int32ToString) {
+  EXPECT_EQ(
+      geoarrow::Point().WithCoordType(GEOARROW_COORD_TYPE_SEPARATE_INT32).ToString(),
+      "int32 geoarrow.point");
+  EXPECT_EQ(geoarrow::Linestring()
+                .WithCoordType(GEOARROW_COORD_TYPE_INTERLEAVED_INT32)
+                .ToString(),
+            "interleaved int32 geoarrow.linestring");
+}
+
 TEST(GeoArrowHppTest, NonPlanarToString) {
   EXPECT_EQ(geoarrow::Linestring().WithEdgeType(GEOARROW_EDGE_TYPE_SPHERICAL).ToString(),
             "spherical geoarrow.linestring");
@@ -12,30 +12,37 @@ namespace internal {
 
 /// \brief A template to resolve the coordinate type based on a dimensions constant
 ///
-/// This may change in the future if more coordinate storage options are added
-/// (e.g., float) or if the coordinate sequence is updated such that the Coord level
-/// of templating is no longer needed.
+/// The coord_type_of template can be used to resolve a coordinate type with an
+/// ordinate type other than double (e.g., for float coordinate storage).
 template <enum GeoArrowDimensions dimensions>
 struct DimensionTraits;
 
 template <>
 struct DimensionTraits<GEOARROW_DIMENSIONS_XY> {
-  using coord_type = array_util::XY<double>;
+  template <typename T>
+  using coord_type_of = array_util::XY<T>;
+  using coord_type = coord_type_of<double>;
 };
 
 template <>
 struct DimensionTraits<GEOARROW_DIMENSIONS_XYZ> {
-  using coord_type = array_util::XYZ<double>;
+  template <typename T>
+  using coord_type_of = array_util::XYZ<T>;
+  using coord_type = coord_type_of<double>;
 };
 
 template <>
 struct DimensionTraits<GEOARROW_DIMENSIONS_XYM> {
-  using coord_type = array_util::XYM<double>;
+  template <typename T>
+  using coord_type_of = array_util::XYM<T>;
+  using coord_type = coord_type_of<double>;
 };
 
 template <>
 struct DimensionTraits<GEOARROW_DIMENSIONS_XYZM> {
-  using coord_type = array_util::XYZM<double>;
+  template <typename T>
+  using coord_type_of = array_util::XYZM<T>;
+  using coord_type = coord_type_of<double>;
 };
 
 template <enum GeoArrowGeometryType geometry_type, enum GeoArrowDimensions dimensions>
@@ -47,7 +54,9 @@ struct ResolveArrayType;
   template <>                                                                 \
   struct ResolveArrayType<geometry_type, dimensions> {                        \
     using coord_type = typename DimensionTraits<dimensions>::coord_type;      \
-    using array_type = array_util::array_cls<coord_type>;                     \
+    template <typename Coord>                                                 \
+    using array_type_of = array_util::array_cls<Coord>;                       \
+    using array_type = array_type_of<coord_type>;                             \
   }
 
 #define _GEOARROW_SPECIALIZE_GEOMETRY_TYPE(geometry_type, array_cls)                  \
@@ -96,9 +105,14 @@ struct TypeTraits {
   static constexpr enum GeoArrowGeometryType geometry_type =
       static_cast<enum GeoArrowGeometryType>((type % 10000) % 1000);
 
-  using coord_type = typename internal::DimensionTraits<dimensions>::coord_type;
-  using array_type =
-      typename internal::ResolveArrayType<geometry_type, dimensions>::array_type;
+  static constexpr bool is_float = coord_type_id == GEOARROW_COORD_TYPE_SEPARATE_FLOAT ||
+                                   coord_type_id == GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+
+  using ordinate_type = typename std::conditional<is_float, float, double>::type;
+  using coord_type = typename internal::DimensionTraits<
+      dimensions>::template coord_type_of<ordinate_type>;
+  using array_type = typename internal::ResolveArrayType<
+      geometry_type, dimensions>::template array_type_of<coord_type>;
 };
 
 template <>
@@ -5,6 +5,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
 #include "nanoarrow/nanoarrow.h"
 
 #include "geoarrow/geoarrow.h"
@@ -106,6 +112,7 @@ struct GeoArrowGeometryTypesVisitorPrivate {
   enum GeoArrowGeometryType geometry_type;
   enum GeoArrowDimensions dimensions;
   uint64_t geometry_types_mask;
+  int scan_wkb;
 };
 
 struct GeoArrowBox2DPrivate {
@@ -115,6 +122,33 @@ struct GeoArrowBox2DPrivate {
   struct ArrowBitmap validity;
   struct ArrowBuffer values[4];
   int64_t null_count;
+  // Bounds of non-planar edges are accumulated separately
+  int is_spherical;
+  struct GeoArrowSphericalBounds spherical;
+};
+
+// The coordinate operation of the affine, to_web_mercator, and from_web_mercator
+// kernels and the filter that applies it to visited input on its way to the writer
+struct GeoArrowTransformKernelPrivate {
+  int active;
+  struct GeoArrowTransform transform;
+  struct GeoArrowTransformFilter filter;
+};
+
+struct GeoArrowSimplifyKernelPrivate {
+  int active;
+  struct GeoArrowSimplifier simplifier;
+};
+
+struct GeoArrowClipKernelPrivate {
+  int active;
+  struct GeoArrowClipper clipper;
+};
+
+struct GeoArrowFormatWKTPrivate {
+  // Batches are split into at most n_tasks ranges when n_tasks > 1
+  int64_t n_tasks;
+  enum GeoArrowType type;
 };
 
 struct GeoArrowVisitorKernelPrivate {
@@ -123,13 +157,23 @@ struct GeoArrowVisitorKernelPrivate {
   struct GeoArrowArrayReader reader;
   struct GeoArrowArrayWriter writer;
   struct GeoArrowWKTWriter wkt_writer;
+  struct GeoArrowWKBReader wkb_reader;
   struct GeoArrowGeometryTypesVisitorPrivate geometry_types_private;
   struct GeoArrowBox2DPrivate box2d_private;
+  enum GeoArrowMeasureType measure_type;
+  struct GeoArrowMeasureWriter measure_writer;
+  struct GeoArrowTransformKernelPrivate transform_private;
+  struct GeoArrowSimplifyKernelPrivate simplify_private;
+  struct GeoArrowClipKernelPrivate clip_private;
+  struct GeoArrowBuilder cast_builder;
+  struct GeoArrowFormatWKTPrivate format_wkt_private;
   int (*finish_push_batch)(struct GeoArrowVisitorKernelPrivate* private_data,
                            struct ArrowArray* out, struct GeoArrowError* error);
   int (*finish_start)(struct GeoArrowVisitorKernelPrivate* private_data,
                       struct ArrowSchema* schema, const char* options,
                       struct ArrowSchema* out, struct GeoArrowError* error);
+  struct GeoArrowStatistics* stats;
+  struct GeoArrowExecutor* executor;
 };
 
 static int kernel_get_arg_long(const char* options, const char* key, long* out,
@@ -152,6 +196,52 @@ static int kernel_get_arg_long(const char* options, const char* key, long* out,
   return NANOARROW_OK;
 }
 
+// Parses a comma-separated list of at most max_values numbers
+static int kernel_get_arg_doubles(const char* options, const char* key, double* out,
+                                  int max_values, int* n_values,
+                                  struct GeoArrowError* error) {
+  struct ArrowStringView value;
+  value.data = NULL;
+  value.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataGetValue(options, ArrowCharView(key), &value));
+  if (value.data == NULL) {
+    GeoArrowErrorSet(error, "Missing required parameter '%s'", key);
+    return EINVAL;
+  }
+
+  const char* item = value.data;
+  const char* end = value.data + value.size_bytes;
+  *n_values = 0;
+  while (item < end) {
+    const char* item_end = (const char*)memchr(item, ',', (size_t)(end - item));
+    if (item_end == NULL) {
+      item_end = end;
+    }
+
+    const char* first = item;
+    const char* last = item_end;
+    while (first < last && *first == ' ') {
+      first++;
+    }
+
+    while (last > first && last[-1] == ' ') {
+      last--;
+    }
+
+    if (*n_values == max_values ||
+        GeoArrowFromChars(first, last, out + *n_values) != GEOARROW_OK) {
+      GeoArrowErrorSet(error, "Invalid value for parameter '%s': '%.*s'", key,
+                       (int)value.size_bytes, value.data);
+      return EINVAL;
+    }
+
+    (*n_values)++;
+    item = item_end + 1;
+  }
+
+  return NANOARROW_OK;
+}
+
 static int finish_push_batch_do_nothing(struct GeoArrowVisitorKernelPrivate* private_data,
                                         struct ArrowArray* out,
                                         struct GeoArrowError* error) {
@@ -177,12 +267,32 @@ static void kernel_release_visitor(struct GeoArrowKernel* kernel) {
     GeoArrowWKTWriterReset(&private_data->wkt_writer);
   }
 
+  if (private_data->wkb_reader.private_data != NULL) {
+    GeoArrowWKBReaderReset(&private_data->wkb_reader);
+  }
+
+  if (private_data->cast_builder.private_data != NULL) {
+    GeoArrowBuilderReset(&private_data->cast_builder);
+  }
+
   for (int i = 0; i < 4; i++) {
     ArrowBufferReset(&private_data->box2d_private.values[i]);
   }
 
   ArrowBitmapReset(&private_data->box2d_private.validity);
 
+  if (private_data->measure_writer.private_data != NULL) {
+    GeoArrowMeasureWriterReset(&private_data->measure_writer);
+  }
+
+  if (private_data->simplify_private.simplifier.private_data != NULL) {
+    GeoArrowSimplifierReset(&private_data->simplify_private.simplifier);
+  }
+
+  if (private_data->clip_private.clipper.private_data != NULL) {
+    GeoArrowClipperReset(&private_data->clip_private.clipper);
+  }
+
   ArrowFree(private_data);
   kernel->release = NULL;
 }
@@ -195,6 +305,14 @@ static int kernel_push_batch(struct GeoArrowKernel* kernel, struct ArrowArray* a
   NANOARROW_RETURN_NOT_OK(
       GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
 
+  // For native input, some writers can compute the size of their output up front
+  const struct GeoArrowArrayView* array_view;
+  if (private_data->writer.private_data != NULL &&
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view) == GEOARROW_OK) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowArrayWriterReserve(&private_data->writer,
+                                                       array_view, 0, array->length));
+  }
+
   private_data->v.error = error;
   NANOARROW_RETURN_NOT_OK(GeoArrowArrayReaderVisit(&private_data->reader, 0,
                                                    array->length, &private_data->v));
@@ -226,212 +344,1182 @@ static int kernel_push_batch_by_feature(struct GeoArrowKernel* kernel,
   return private_data->finish_push_batch(private_data, out, error);
 }
 
-static int kernel_visitor_start(struct GeoArrowKernel* kernel, struct ArrowSchema* schema,
-                                const char* options, struct ArrowSchema* out,
-                                struct GeoArrowError* error) {
+// Kernels that only need the structure of each feature (e.g., geometry types or
+// counts) read the headers of WKB input with GeoArrowWKBReaderScan() instead of
+// visiting its coordinates. raw_i already includes the offset of the array view.
+static int kernel_scan_wkb(struct GeoArrowVisitorKernelPrivate* private_data,
+                           const struct GeoArrowArrayView* array_view, int64_t raw_i,
+                           struct GeoArrowWKBSummary* out, struct GeoArrowError* error) {
+  if (private_data->wkb_reader.private_data == NULL) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowWKBReaderInit(&private_data->wkb_reader));
+  }
+
+  struct GeoArrowBufferView value;
+  value.data = array_view->data + array_view->offsets[0][raw_i];
+  value.size_bytes = array_view->offsets[0][raw_i + 1] - array_view->offsets[0][raw_i];
+  return GeoArrowWKBReaderScan(&private_data->wkb_reader, value, out, error);
+}
+
+// unique_geometry_types_agg for WKB input (see coords_geometry_types() below)
+static int kernel_push_batch_unique_geometry_types_wkb(struct GeoArrowKernel* kernel,
+                                                       struct ArrowArray* array,
+                                                       struct ArrowArray* out,
+                                                       struct GeoArrowError* error) {
   struct GeoArrowVisitorKernelPrivate* private_data =
       (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
 
-  struct GeoArrowSchemaView schema_view;
-  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
+  const struct GeoArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view));
 
-  switch (schema_view.type) {
-    case GEOARROW_TYPE_UNINITIALIZED:
-      return EINVAL;
-    default:
-      NANOARROW_RETURN_NOT_OK(
-          GeoArrowArrayReaderInitFromSchema(&private_data->reader, schema, error));
-      if (private_data->visit_by_feature) {
-        kernel->push_batch = &kernel_push_batch_by_feature;
-      } else {
-        kernel->push_batch = &kernel_push_batch;
-      }
-      break;
+  struct GeoArrowWKBSummary summary;
+  int64_t num_null_features = 0;
+  int64_t num_coords = 0;
+  for (int64_t i = 0; i < array->length; i++) {
+    int64_t raw_i = array_view->offset[0] + i;
+    if (array_view->validity_bitmap != NULL &&
+        !ArrowBitGet(array_view->validity_bitmap, raw_i)) {
+      num_null_features++;
+      continue;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        kernel_scan_wkb(private_data, array_view, raw_i, &summary, error));
+    num_coords += summary.num_coords;
+
+    // EMPTY features are not counted as any particular geometry type
+    if (summary.num_coords > 0) {
+      int bitshift = summary.dimensions * 8 + summary.geometry_type;
+      uint64_t bitmask = ((uint64_t)1) << bitshift;
+      private_data->geometry_types_private.geometry_types_mask |= bitmask;
+    }
   }
 
-  return private_data->finish_start(private_data, schema, options, out, error);
-}
+  if (private_data->stats != NULL) {
+    private_data->stats->num_features += array->length;
+    private_data->stats->num_null_features += num_null_features;
+    private_data->stats->num_coords += num_coords;
+  }
 
-// Kernel visit_void_agg
-//
-// This kernel visits every feature and returns a single null item at the end.
-// This is useful for (1) testing and (2) validating well-known text or well-known
-// binary.
+  return private_data->finish_push_batch(private_data, out, error);
+}
 
-static int finish_start_visit_void_agg(struct GeoArrowVisitorKernelPrivate* private_data,
-                                       struct ArrowSchema* schema, const char* options,
-                                       struct ArrowSchema* out,
-                                       struct GeoArrowError* error) {
-  NANOARROW_UNUSED(private_data);
-  NANOARROW_UNUSED(schema);
-  NANOARROW_UNUSED(options);
-  NANOARROW_UNUSED(error);
+// Converting between double storage and float or quantized int32 storage of the same
+// geometry type, dimensions, and coordinate layout (or between separated and
+// interleaved coordinates with the same storage, or dropping Z and/or M) doesn't need
+// a visitor: validity and offsets are copied as-is and coordinates are converted with
+// a simple loop that the compiler can vectorize.
+static void kernel_cast_double_to_float(const double* src, float* dst, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i] = (float)src[i];
+  }
+}
 
-  return ArrowSchemaInitFromType(out, NANOARROW_TYPE_NA);
+static void kernel_cast_float_to_double(const float* src, double* dst, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i] = (double)src[i];
+  }
 }
 
-// Kernel format_wkt
-//
-// Visits every feature in the input and writes the corresponding well-known text output,
-// optionally specifying precision and max_element_size_bytes.
+static void kernel_copy_ordinates32(const uint32_t* src, int64_t src_stride,
+                                    uint32_t* dst, int64_t dst_stride, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i * dst_stride] = src[i * src_stride];
+  }
+}
 
-static int finish_start_format_wkt(struct GeoArrowVisitorKernelPrivate* private_data,
-                                   struct ArrowSchema* schema, const char* options,
-                                   struct ArrowSchema* out, struct GeoArrowError* error) {
-  NANOARROW_UNUSED(schema);
-  NANOARROW_UNUSED(options);
+static void kernel_copy_ordinates64(const uint64_t* src, int64_t src_stride,
+                                    uint64_t* dst, int64_t dst_stride, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i * dst_stride] = src[i * src_stride];
+  }
+}
 
-  long precision = private_data->wkt_writer.precision;
-  NANOARROW_RETURN_NOT_OK(
-      kernel_get_arg_long(options, "precision", &precision, 0, error));
-  private_data->wkt_writer.precision = (int)precision;
+// Returns the number of output ordinates if out_dimensions can be obtained by
+// dropping ordinates of in_dimensions (populating dim_map) or 0 otherwise
+static int kernel_project_dimensions(enum GeoArrowDimensions in_dimensions,
+                                     enum GeoArrowDimensions out_dimensions,
+                                     int* dim_map) {
+  int n_values;
+  switch (out_dimensions) {
+    case GEOARROW_DIMENSIONS_XY:
+      n_values = 2;
+      break;
+    case GEOARROW_DIMENSIONS_XYZ:
+    case GEOARROW_DIMENSIONS_XYM:
+      n_values = 3;
+      break;
+    case GEOARROW_DIMENSIONS_XYZM:
+      n_values = 4;
+      break;
+    default:
+      return 0;
+  }
 
-  long max_element_size_bytes = private_data->wkt_writer.max_element_size_bytes;
-  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "max_element_size_bytes",
-                                              &max_element_size_bytes, 0, error));
-  private_data->wkt_writer.max_element_size_bytes = max_element_size_bytes;
+  if (in_dimensions == GEOARROW_DIMENSIONS_UNKNOWN) {
+    return 0;
+  }
 
-  GeoArrowWKTWriterInitVisitor(&private_data->wkt_writer, &private_data->v);
+  GeoArrowMapDimensions(in_dimensions, out_dimensions, dim_map);
+  for (int j = 0; j < n_values; j++) {
+    if (dim_map[j] < 0) {
+      return 0;
+    }
+  }
 
-  NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(out, NANOARROW_TYPE_STRING));
-  return GEOARROW_OK;
+  return n_values;
 }
 
-static int finish_push_batch_format_wkt(struct GeoArrowVisitorKernelPrivate* private_data,
-                                        struct ArrowArray* out,
-                                        struct GeoArrowError* error) {
-  return GeoArrowWKTWriterFinish(&private_data->wkt_writer, out, error);
+static const void* kernel_coord_values(const struct GeoArrowArrayView* array_view,
+                                       int j) {
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  if (GeoArrowCoordTypeIsFloat(coord_type)) {
+    return array_view->coords_float.values[j];
+  } else if (GeoArrowCoordTypeIsQuantized(coord_type)) {
+    return array_view->coords_int32.values[j];
+  } else {
+    return array_view->coords.values[j];
+  }
 }
 
-// Kernel as_geoarrow
-//
-// Visits every feature in the input and writes an array of the specified type.
-// Takes option 'type' as the desired integer enum GeoArrowType.
+static void* kernel_writable_coord_values(struct GeoArrowBuilder* builder, int j) {
+  enum GeoArrowCoordType coord_type = builder->view.schema_view.coord_type;
+  if (GeoArrowCoordTypeIsFloat(coord_type)) {
+    return builder->view.coords_float.values[j];
+  } else if (GeoArrowCoordTypeIsQuantized(coord_type)) {
+    return builder->view.coords_int32.values[j];
+  } else {
+    return builder->view.coords.values[j];
+  }
+}
 
-static int finish_start_as_geoarrow(struct GeoArrowVisitorKernelPrivate* private_data,
-                                    struct ArrowSchema* schema, const char* options,
-                                    struct ArrowSchema* out,
-                                    struct GeoArrowError* error) {
-  long out_type_long;
-  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "type", &out_type_long, 1, error));
-  enum GeoArrowType out_type = (enum GeoArrowType)out_type_long;
+static int kernel_can_cast_coords(const struct GeoArrowArrayView* array_view) {
+  // Only unsliced input whose offsets start at zero can be copied as-is
+  for (int i = 0; i <= array_view->n_offsets; i++) {
+    if (array_view->offset[i] != 0) {
+      return 0;
+    }
+  }
 
-  if (private_data->writer.private_data != NULL) {
-    GeoArrowErrorSet(error, "Expected exactly one call to start(as_geoarrow)");
-    return EINVAL;
+  for (int i = 0; i < array_view->n_offsets; i++) {
+    if (array_view->length[i] > 0 && array_view->first_offset[i] != 0) {
+      return 0;
+    }
   }
 
-  NANOARROW_RETURN_NOT_OK(
-      GeoArrowArrayWriterInitFromType(&private_data->writer, out_type));
-  NANOARROW_RETURN_NOT_OK(
-      GeoArrowArrayWriterInitVisitor(&private_data->writer, &private_data->v));
+  return 1;
+}
 
-  struct ArrowSchema tmp;
-  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(&tmp, out_type));
+// Appends the validity and offset buffers of array_view, for which
+// kernel_can_cast_coords() must be true, to builder as-is
+static int kernel_cast_append_offsets(struct GeoArrowBuilder* builder,
+                                      const struct GeoArrowArrayView* array_view) {
+  struct GeoArrowBufferView buffer;
+  if (array_view->validity_bitmap != NULL) {
+    buffer.data = array_view->validity_bitmap;
+    buffer.size_bytes = _ArrowBytesForBits(array_view->length[0]);
+    NANOARROW_RETURN_NOT_OK(GeoArrowBuilderAppendBuffer(builder, 0, buffer));
+  }
 
-  int result = GeoArrowSchemaSetMetadataFrom(&tmp, schema);
-  if (result != GEOARROW_OK) {
-    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadataFrom() failed");
-    tmp.release(&tmp);
-    return result;
+  int32_t zero = 0;
+  for (int i = 0; i < array_view->n_offsets; i++) {
+    int64_t n_offsets = i == 0 ? array_view->length[0] : array_view->last_offset[i - 1];
+    if (n_offsets == 0) {
+      buffer.data = (const uint8_t*)&zero;
+      buffer.size_bytes = sizeof(int32_t);
+    } else {
+      buffer.data = (const uint8_t*)array_view->offsets[i];
+      buffer.size_bytes = (n_offsets + 1) * (int64_t)sizeof(int32_t);
+    }
+
+    NANOARROW_RETURN_NOT_OK(GeoArrowBuilderAppendBuffer(builder, 1 + i, buffer));
   }
 
-  ArrowSchemaMove(&tmp, out);
   return GEOARROW_OK;
 }
 
-static int finish_push_batch_as_geoarrow(
-    struct GeoArrowVisitorKernelPrivate* private_data, struct ArrowArray* out,
-    struct GeoArrowError* error) {
-  return GeoArrowArrayWriterFinish(&private_data->writer, out, error);
+static void kernel_cast_record_stats(struct GeoArrowStatistics* stats,
+                                     const struct GeoArrowArrayView* array_view,
+                                     const struct ArrowArray* array) {
+  stats->num_features += array->length;
+  stats->num_coords += array_view->coords.n_coords;
+  if (array_view->validity_bitmap != NULL) {
+    stats->num_null_features +=
+        array->length - ArrowBitCountSet(array_view->validity_bitmap,
+                                         array_view->offset[0], array->length);
+  }
 }
 
-// Kernel unique_geometry_types_agg
-//
-// This kernel collects all geometry type + dimension combinations in the
-// input. EMPTY values are not counted as any particular geometry type;
-// however, note that POINTs as represented in WKB or GeoArrow cannot be
-// EMPTY and this kernel does not check for the convention of EMPTY as
-// all coordinates == nan. This is mostly to facilitate choosing an appropriate
-// destination type (e.g., point, linestring, etc.). This visitor is not exposed as a
-// standalone visitor in the geoarrow.h header.
-//
-// The internals use GeoArrowDimensions * 8 + GeoArrowGeometryType as the
-// "key" for a given combination. This gives an integer between 0 and 39.
-// The types are accumulated in a uint64_t bitmask and translated into the
-// corresponding ISO WKB type codes at the end.
-static int32_t kGeoArrowGeometryTypeWkbValues[] = {
-    -1000, -999, -998, -997, -996, -995, -994, -993, 0,    1,    2,    3,    4,    5,
-    6,     7,    1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 2000, 2001, 2002, 2003,
-    2004,  2005, 2006, 2007, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007};
-
-static int feat_start_geometry_types(struct GeoArrowVisitor* v) {
+static int kernel_push_batch_cast_coords(struct GeoArrowKernel* kernel,
+                                         struct ArrowArray* array, struct ArrowArray* out,
+                                         struct GeoArrowError* error) {
   struct GeoArrowVisitorKernelPrivate* private_data =
-      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
-  private_data->geometry_types_private.geometry_type = GEOARROW_GEOMETRY_TYPE_GEOMETRY;
-  private_data->geometry_types_private.dimensions = GEOARROW_DIMENSIONS_UNKNOWN;
-  return GEOARROW_OK;
-}
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  struct GeoArrowBuilder* builder = &private_data->cast_builder;
 
-static int geom_start_geometry_types(struct GeoArrowVisitor* v,
-                                     enum GeoArrowGeometryType geometry_type,
-                                     enum GeoArrowDimensions dimensions) {
-  struct GeoArrowVisitorKernelPrivate* private_data =
-      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
 
-  // Only record the first seen geometry type/dimension combination
-  if (private_data->geometry_types_private.geometry_type ==
-      GEOARROW_GEOMETRY_TYPE_GEOMETRY) {
-    private_data->geometry_types_private.geometry_type = geometry_type;
-    private_data->geometry_types_private.dimensions = dimensions;
+  const struct GeoArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view));
+
+  if (!kernel_can_cast_coords(array_view)) {
+    // Fall back to the visitor-based writer, which handles any input
+    private_data->v.error = error;
+    NANOARROW_RETURN_NOT_OK(GeoArrowArrayReaderVisit(&private_data->reader, 0,
+                                                     array->length, &private_data->v));
+    return private_data->finish_push_batch(private_data, out, error);
   }
 
-  return GEOARROW_OK;
-}
-
-static int coords_geometry_types(struct GeoArrowVisitor* v,
-                                 const struct GeoArrowCoordView* coords) {
-  if (coords->n_coords > 0) {
-    struct GeoArrowVisitorKernelPrivate* private_data =
-        (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  NANOARROW_RETURN_NOT_OK(kernel_cast_append_offsets(builder, array_view));
+
+  int64_t n_coords = array_view->coords.n_coords;
+  NANOARROW_RETURN_NOT_OK(GeoArrowBuilderCoordsReserve(builder, n_coords));
+
+  enum GeoArrowCoordType in_coord_type = array_view->schema_view.coord_type;
+  enum GeoArrowCoordType out_coord_type = builder->view.schema_view.coord_type;
+  int n_values = array_view->coords.n_values;
+
+  enum GeoArrowDimensions in_dimensions = array_view->schema_view.dimensions;
+  enum GeoArrowDimensions out_dimensions = builder->view.schema_view.dimensions;
+
+  if (in_dimensions != out_dimensions) {
+    // The storage and layout are identical and only some ordinates are kept
+    int dim_map[4];
+    int n_out_values = kernel_project_dimensions(in_dimensions, out_dimensions, dim_map);
+    int64_t in_stride = array_view->coords.coords_stride;
+    int64_t out_stride = builder->view.coords.coords_stride;
+    for (int j = 0; j < n_out_values; j++) {
+      const void* src = kernel_coord_values(array_view, dim_map[j]);
+      void* dst = kernel_writable_coord_values(builder, j);
+      if (GeoArrowCoordTypeOrdinateSize(in_coord_type) == (int64_t)sizeof(uint32_t)) {
+        kernel_copy_ordinates32((const uint32_t*)src, in_stride, (uint32_t*)dst,
+                                out_stride, n_coords);
+      } else {
+        kernel_copy_ordinates64((const uint64_t*)src, in_stride, (uint64_t*)dst,
+                                out_stride, n_coords);
+      }
+    }
+  } else if (GeoArrowCoordTypeLayout(in_coord_type) !=
+             GeoArrowCoordTypeLayout(out_coord_type)) {
+    // The storage is identical and only the layout differs, so ordinates are
+    // transposed without being converted
+    const void* src[4];
+    void* dst[4];
+    for (int j = 0; j < n_values; j++) {
+      src[j] = kernel_coord_values(array_view, j);
+      dst[j] = kernel_writable_coord_values(builder, j);
+    }
 
-    // At the first coordinate, add the geometry type to the bitmask
-    int bitshift = private_data->geometry_types_private.dimensions * 8 +
-                   private_data->geometry_types_private.geometry_type;
-    uint64_t bitmask = ((uint64_t)1) << bitshift;
-    private_data->geometry_types_private.geometry_types_mask |= bitmask;
-    return EAGAIN;
+    int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(in_coord_type);
+    if (GeoArrowCoordTypeLayout(out_coord_type) == GEOARROW_COORD_TYPE_INTERLEAVED) {
+      NANOARROW_RETURN_NOT_OK(GeoArrowInterleaveOrdinates(src, dst[0], n_coords,
+                                                          n_values, ordinate_size));
+    } else {
+      NANOARROW_RETURN_NOT_OK(GeoArrowDeinterleaveOrdinates(src[0], dst, n_coords,
+                                                            n_values, ordinate_size));
+    }
+  } else if (GeoArrowCoordTypeIsQuantized(in_coord_type) ||
+             GeoArrowCoordTypeIsQuantized(out_coord_type)) {
+    // Each dimension has its own scale and offset, so quantized coordinates are
+    // always converted one dimension at a time
+    const struct GeoArrowQuantization* quantization;
+    for (int j = 0; j < n_values; j++) {
+      if (GeoArrowCoordTypeIsQuantized(out_coord_type)) {
+        quantization = &builder->view.quantization;
+        GeoArrowQuantizeOrdinates(array_view->coords.values[j],
+                                  array_view->coords.coords_stride,
+                                  builder->view.coords_int32.values[j],
+                                  builder->view.coords_int32.coords_stride, n_coords,
+                                  quantization->scale[j], quantization->offset[j]);
+      } else {
+        quantization = &array_view->quantization;
+        GeoArrowDequantizeOrdinates(array_view->coords_int32.values[j],
+                                    array_view->coords_int32.coords_stride,
+                                    builder->view.coords.values[j],
+                                    builder->view.coords.coords_stride, n_coords,
+                                    quantization->scale[j], quantization->offset[j]);
+      }
+    }
   } else {
-    return GEOARROW_OK;
+    // Interleaved coordinates are converted in one pass over all ordinates;
+    // separated coordinates are converted one dimension at a time
+    int is_interleaved =
+        GeoArrowCoordTypeLayout(out_coord_type) == GEOARROW_COORD_TYPE_INTERLEAVED;
+    int n_arrays = is_interleaved ? 1 : n_values;
+    int64_t n_per_array = is_interleaved ? n_coords * n_values : n_coords;
+    for (int i = 0; i < n_arrays; i++) {
+      if (GeoArrowCoordTypeIsFloat(out_coord_type)) {
+        kernel_cast_double_to_float(array_view->coords.values[i],
+                                    builder->view.coords_float.values[i], n_per_array);
+      } else {
+        kernel_cast_float_to_double(array_view->coords_float.values[i],
+                                    builder->view.coords.values[i], n_per_array);
+      }
+    }
   }
-}
 
-static int finish_start_unique_geometry_types_agg(
-    struct GeoArrowVisitorKernelPrivate* private_data, struct ArrowSchema* schema,
-    const char* options, struct ArrowSchema* out, struct GeoArrowError* error) {
-  NANOARROW_UNUSED(schema);
-  NANOARROW_UNUSED(options);
-  NANOARROW_UNUSED(error);
+  builder->view.coords.size_coords += n_coords;
 
-  private_data->v.feat_start = &feat_start_geometry_types;
-  private_data->v.geom_start = &geom_start_geometry_types;
-  private_data->v.coords = &coords_geometry_types;
-  private_data->v.private_data = private_data;
-  return ArrowSchemaInitFromType(out, NANOARROW_TYPE_INT32);
-}
+  if (private_data->stats != NULL) {
+    kernel_cast_record_stats(private_data->stats, array_view, array);
+  }
 
-static int kernel_finish_unique_geometry_types_agg(struct GeoArrowKernel* kernel,
-                                                   struct ArrowArray* out,
-                                                   struct GeoArrowError* error) {
-  NANOARROW_UNUSED(error);
+  NANOARROW_RETURN_NOT_OK(GeoArrowBuilderFinish(builder, out, error));
+  out->null_count = array->null_count;
+  return GEOARROW_OK;
+}
 
+// Kernel length + area + centroid + num_coords + num_parts
+//
+// Calculate measures by feature using the GeoArrowMeasureWriter. Input that can be
+// measured without a visitor (see GeoArrowMeasureWriterAppend()) is passed to the
+// writer directly; all other input (including WKT) is visited. Length and area use
+// the edge type of the input; the centroid is only defined for planar edges.
+
+static int kernel_push_batch_measure(struct GeoArrowKernel* kernel,
+                                     struct ArrowArray* array, struct ArrowArray* out,
+                                     struct GeoArrowError* error) {
   struct GeoArrowVisitorKernelPrivate* private_data =
       (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
-  uint64_t result_mask = private_data->geometry_types_private.geometry_types_mask;
 
-  int n_types = 0;
-  for (int i = 0; i < 40; i++) {
-    uint64_t bitmask = ((uint64_t)1) << i;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
+
+  const struct GeoArrowArrayView* array_view;
+  int result = GeoArrowArrayReaderArrayView(&private_data->reader, &array_view);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowMeasureWriterAppend(&private_data->measure_writer, array_view, 0,
+                                         array->length, error);
+  } else {
+    result = ENOTSUP;
+  }
+
+  if (result == ENOTSUP) {
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowMeasureWriterReserve(&private_data->measure_writer, array->length));
+    private_data->v.error = error;
+    NANOARROW_RETURN_NOT_OK(GeoArrowArrayReaderVisit(&private_data->reader, 0,
+                                                     array->length, &private_data->v));
+    return private_data->finish_push_batch(private_data, out, error);
+  } else if (result != GEOARROW_OK) {
+    return result;
+  }
+
+  // Counts never touch the coordinates of native input
+  if (private_data->stats != NULL) {
+    private_data->stats->num_features += array->length;
+    if (array_view->validity_bitmap != NULL) {
+      private_data->stats->num_null_features +=
+          array->length - ArrowBitCountSet(array_view->validity_bitmap,
+                                           array_view->offset[0], array->length);
+    }
+
+    if (private_data->measure_type != GEOARROW_MEASURE_TYPE_NUM_COORDS &&
+        private_data->measure_type != GEOARROW_MEASURE_TYPE_NUM_PARTS) {
+      private_data->stats->num_coords += array_view->coords.n_coords;
+    }
+  }
+
+  return private_data->finish_push_batch(private_data, out, error);
+}
+
+static int finish_start_measure(struct GeoArrowVisitorKernelPrivate* private_data,
+                                struct ArrowSchema* schema, const char* options,
+                                struct ArrowSchema* out, struct GeoArrowError* error) {
+  NANOARROW_UNUSED(options);
+  enum GeoArrowMeasureType type = private_data->measure_type;
+
+  // Counts don't depend on the edge type, so the input's metadata is only parsed
+  // for the other measures
+  struct GeoArrowMetadataView metadata;
+  struct GeoArrowMetadataView* metadata_ptr = NULL;
+  if (type != GEOARROW_MEASURE_TYPE_NUM_COORDS &&
+      type != GEOARROW_MEASURE_TYPE_NUM_PARTS) {
+    struct GeoArrowSchemaView schema_view;
+    NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowMetadataViewInit(&metadata, schema_view.extension_metadata, error));
+    metadata_ptr = &metadata;
+  }
+
+  enum GeoArrowEdgeType edge_type =
+      metadata_ptr != NULL ? metadata.edge_type : GEOARROW_EDGE_TYPE_PLANAR;
+  if (type == GEOARROW_MEASURE_TYPE_CENTROID && edge_type != GEOARROW_EDGE_TYPE_PLANAR) {
+    GeoArrowErrorSet(error, "centroid kernel does not support non-planar edges");
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowMeasureWriterInit(&private_data->measure_writer, type,
+                                                    edge_type, error));
+  GeoArrowMeasureWriterInitVisitor(&private_data->measure_writer, &private_data->v);
+  return GeoArrowMeasureSchemaInit(out, type, metadata_ptr);
+}
+
+static int finish_push_batch_measure(struct GeoArrowVisitorKernelPrivate* private_data,
+                                     struct ArrowArray* out,
+                                     struct GeoArrowError* error) {
+  return GeoArrowMeasureWriterFinish(&private_data->measure_writer, out, error);
+}
+
+// Kernel affine + to_web_mercator + from_web_mercator
+//
+// Apply a coordinate operation (see GeoArrowTransformOrdinates()) to every
+// coordinate. The affine kernel takes option 'matrix' as 6 or 12 comma-separated
+// numbers (see GeoArrowTransformSetAffine()). The output has the same type as the
+// input. For unsliced native input with double coordinates, validity and offset
+// buffers are copied as-is (the kernel does not own its input, so they can't be
+// moved) and only the coordinates are computed (see GeoArrowTransformAppendCoords());
+// all other input is visited and rewritten through a GeoArrowTransformFilter.
+// The Web Mercator kernels update the CRS of the output. Use
+// GeoArrowArrayTransformInPlace() to avoid any copies when the caller owns the input.
+
+static const char kGeoArrowCrsWebMercator[] = "EPSG:3857";
+
+static int kernel_push_batch_transform(struct GeoArrowKernel* kernel,
+                                       struct ArrowArray* array, struct ArrowArray* out,
+                                       struct GeoArrowError* error) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  struct GeoArrowBuilder* builder = &private_data->cast_builder;
+
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
+
+  const struct GeoArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view));
+
+  if (!kernel_can_cast_coords(array_view)) {
+    private_data->v.error = error;
+    NANOARROW_RETURN_NOT_OK(GeoArrowArrayReaderVisit(&private_data->reader, 0,
+                                                     array->length, &private_data->v));
+    return private_data->finish_push_batch(private_data, out, error);
+  }
+
+  NANOARROW_RETURN_NOT_OK(kernel_cast_append_offsets(builder, array_view));
+  NANOARROW_RETURN_NOT_OK(GeoArrowTransformAppendCoords(
+      &private_data->transform_private.transform, array_view, builder));
+
+  if (private_data->stats != NULL) {
+    kernel_cast_record_stats(private_data->stats, array_view, array);
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowBuilderFinish(builder, out, error));
+  out->null_count = array->null_count;
+  return GEOARROW_OK;
+}
+
+// Populates out with the extension type of the input and its metadata, updating the
+// CRS for the Web Mercator transforms
+static int schema_transform(const struct GeoArrowSchemaView* schema_view,
+                            enum GeoArrowTransformType transform_type,
+                            struct ArrowSchema* out, struct GeoArrowError* error) {
+  struct GeoArrowMetadataView metadata_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowMetadataViewInit(&metadata_view, schema_view->extension_metadata, error));
+
+  switch (transform_type) {
+    case GEOARROW_TRANSFORM_TO_WEB_MERCATOR:
+      metadata_view.crs.data = kGeoArrowCrsWebMercator;
+      metadata_view.crs.size_bytes = (int64_t)strlen(kGeoArrowCrsWebMercator);
+      metadata_view.crs_type = GEOARROW_CRS_TYPE_AUTHORITY_CODE;
+      metadata_view.edge_type = GEOARROW_EDGE_TYPE_PLANAR;
+      break;
+    case GEOARROW_TRANSFORM_FROM_WEB_MERCATOR:
+      GeoArrowMetadataSetLonLat(&metadata_view);
+      break;
+    default:
+      break;
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(out, schema_view->type));
+  int result = GeoArrowSchemaSetMetadata(out, &metadata_view);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadata() failed");
+    out->release(out);
+    return result;
+  }
+
+  return GEOARROW_OK;
+}
+
+static int finish_start_transform(struct GeoArrowVisitorKernelPrivate* private_data,
+                                  struct ArrowSchema* schema, const char* options,
+                                  struct ArrowSchema* out, struct GeoArrowError* error) {
+  struct GeoArrowTransformKernelPrivate* transform_private =
+      &private_data->transform_private;
+
+  if (private_data->writer.private_data != NULL) {
+    GeoArrowErrorSet(error, "Expected exactly one call to start()");
+    return EINVAL;
+  }
+
+  if (transform_private->transform.type == GEOARROW_TRANSFORM_AFFINE) {
+    double values[12];
+    int n_values;
+    NANOARROW_RETURN_NOT_OK(
+        kernel_get_arg_doubles(options, "matrix", values, 12, &n_values, error));
+    if (GeoArrowTransformSetAffine(&transform_private->transform, values, n_values) !=
+        GEOARROW_OK) {
+      GeoArrowErrorSet(error, "Expected 6 or 12 values for parameter 'matrix' but got %d",
+                       n_values);
+      return EINVAL;
+    }
+  }
+
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  if (schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX) {
+    GeoArrowErrorSet(error, "Can't transform coordinates of a box array");
+    return ENOTSUP;
+  }
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(
+      schema_transform(&schema_view, transform_private->transform.type, &tmp, error));
+
+  // The writer is used for serialized input, sliced native input, and native input
+  // with float or quantized coordinates
+  int result = GeoArrowArrayWriterInitFromSchema(&private_data->writer, &tmp);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitVisitor(&private_data->writer, &private_data->v);
+  }
+
+  if (result == GEOARROW_OK &&
+      GeoArrowCoordTypeOrdinateSize(schema_view.coord_type) == (int64_t)sizeof(double)) {
+    result = GeoArrowBuilderInitFromSchema(&private_data->cast_builder, &tmp, error);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  GeoArrowTransformFilterInit(&transform_private->filter, &transform_private->transform,
+                              &private_data->v);
+  GeoArrowTransformFilterInitVisitor(&transform_private->filter, &private_data->v);
+
+  ArrowSchemaMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+// Kernel simplify
+//
+// Simplify linestrings and polygon rings with a GeoArrowSimplifier using the
+// Douglas-Peucker algorithm (option 'method' douglas_peucker, the default) or the
+// Visvalingam-Whyatt algorithm (option 'method' visvalingam). Option 'tolerance' is a
+// distance for Douglas-Peucker and an area for Visvalingam-Whyatt; rings always keep
+// at least four coordinates if option 'preserve_topology' is 1.
+//
+// Unsliced native input with double coordinates is simplified directly from its
+// buffers (see GeoArrowSimplifierAppend()); all other input is visited. Scratch space
+// is reused across paths, features, and batches, so concurrent callers should each
+// use their own kernel.
+
+static int kernel_push_batch_simplify(struct GeoArrowKernel* kernel,
+                                      struct ArrowArray* array, struct ArrowArray* out,
+                                      struct GeoArrowError* error) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  struct GeoArrowBuilder* builder = &private_data->cast_builder;
+
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
+
+  const struct GeoArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view));
+
+  int result = GeoArrowSimplifierAppend(&private_data->simplify_private.simplifier,
+                                        array_view, builder);
+  if (result == ENOTSUP) {
+    private_data->v.error = error;
+    NANOARROW_RETURN_NOT_OK(GeoArrowArrayReaderVisit(&private_data->reader, 0,
+                                                     array->length, &private_data->v));
+    return private_data->finish_push_batch(private_data, out, error);
+  } else if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "Failed to simplify native array");
+    return result;
+  }
+
+  if (private_data->stats != NULL) {
+    kernel_cast_record_stats(private_data->stats, array_view, array);
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowBuilderFinish(builder, out, error));
+  out->null_count = array->null_count;
+  return GEOARROW_OK;
+}
+
+static int finish_start_simplify(struct GeoArrowVisitorKernelPrivate* private_data,
+                                 struct ArrowSchema* schema, const char* options,
+                                 struct ArrowSchema* out, struct GeoArrowError* error) {
+  struct GeoArrowSimplifyKernelPrivate* simplify_private =
+      &private_data->simplify_private;
+
+  if (private_data->writer.private_data != NULL) {
+    GeoArrowErrorSet(error, "Expected exactly one call to start()");
+    return EINVAL;
+  }
+
+  double tolerance;
+  int n_values;
+  NANOARROW_RETURN_NOT_OK(
+      kernel_get_arg_doubles(options, "tolerance", &tolerance, 1, &n_values, error));
+  if (n_values != 1 || !(tolerance >= 0)) {
+    GeoArrowErrorSet(error, "Expected a non-negative value for parameter 'tolerance'");
+    return EINVAL;
+  }
+
+  enum GeoArrowSimplifyMethod method_type;
+  struct ArrowStringView method;
+  method.data = NULL;
+  method.size_bytes = 0;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowMetadataGetValue(options, ArrowCharView("method"), &method));
+  if (method.data == NULL || (method.size_bytes == 15 &&
+                              strncmp(method.data, "douglas_peucker", 15) == 0)) {
+    method_type = GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER;
+  } else if (method.size_bytes == 11 && strncmp(method.data, "visvalingam", 11) == 0) {
+    method_type = GEOARROW_SIMPLIFY_VISVALINGAM;
+  } else {
+    GeoArrowErrorSet(error, "Invalid value for parameter 'method': '%.*s'",
+                     (int)method.size_bytes, method.data);
+    return EINVAL;
+  }
+
+  long preserve_topology = 0;
+  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "preserve_topology",
+                                              &preserve_topology, 0, error));
+
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  if (schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX) {
+    GeoArrowErrorSet(error, "Can't simplify a box array");
+    return ENOTSUP;
+  }
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(&tmp, schema_view.type));
+  int result = GeoArrowSchemaSetMetadataFrom(&tmp, schema);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadataFrom() failed");
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitFromSchema(&private_data->writer, &tmp);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitVisitor(&private_data->writer, &private_data->v);
+  }
+
+  if (result == GEOARROW_OK &&
+      GeoArrowCoordTypeOrdinateSize(schema_view.coord_type) == (int64_t)sizeof(double)) {
+    result = GeoArrowBuilderInitFromSchema(&private_data->cast_builder, &tmp, error);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowSimplifierInit(&simplify_private->simplifier, method_type,
+                                    tolerance, preserve_topology != 0, error);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  // The simplifier forwards to the writer's visitor, which it copies
+  struct GeoArrowVisitor writer_v = private_data->v;
+  GeoArrowSimplifierInitVisitor(&simplify_private->simplifier, &writer_v,
+                                &private_data->v);
+
+  ArrowSchemaMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+// Kernel clip_by_box
+//
+// Clips native input with double coordinates to the rectangle given by option 'box'
+// (xmin, ymin, xmax, ymax; inclusive) with a GeoArrowClipper, which writes each
+// feature to a GeoArrowNativeWriter via its visitor. Linestring input is written as a
+// multilinestring because clipped linestrings may split into several parts.
+
+static int kernel_push_batch_clip(struct GeoArrowKernel* kernel, struct ArrowArray* array,
+                                  struct ArrowArray* out, struct GeoArrowError* error) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  struct GeoArrowVisitor* v = &private_data->v;
+
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(&private_data->reader, array, error));
+
+  const struct GeoArrowArrayView* array_view;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderArrayView(&private_data->reader, &array_view));
+
+  v->error = error;
+  NANOARROW_RETURN_NOT_OK(GeoArrowClipperVisit(&private_data->clip_private.clipper,
+                                               array_view, 0, array->length, v));
+
+  if (private_data->stats != NULL) {
+    kernel_cast_record_stats(private_data->stats, array_view, array);
+  }
+
+  return private_data->finish_push_batch(private_data, out, error);
+}
+
+static int finish_start_clip(struct GeoArrowVisitorKernelPrivate* private_data,
+                             struct ArrowSchema* schema, const char* options,
+                             struct ArrowSchema* out, struct GeoArrowError* error) {
+  struct GeoArrowClipKernelPrivate* clip_private = &private_data->clip_private;
+
+  if (private_data->writer.private_data != NULL) {
+    GeoArrowErrorSet(error, "Expected exactly one call to start()");
+    return EINVAL;
+  }
+
+  double box[4];
+  int n_values;
+  NANOARROW_RETURN_NOT_OK(
+      kernel_get_arg_doubles(options, "box", box, 4, &n_values, error));
+  if (n_values != 4) {
+    GeoArrowErrorSet(error, "Expected 4 values for parameter 'box' but got %d",
+                     n_values);
+    return EINVAL;
+  }
+
+  if (!(box[0] <= box[2]) || !(box[1] <= box[3])) {
+    GeoArrowErrorSet(error, "Expected xmin <= xmax and ymin <= ymax for parameter 'box'");
+    return EINVAL;
+  }
+
+  // Linestrings may be split into several parts
+  enum GeoArrowGeometryType geometry_type;
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  switch (schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      geometry_type = GEOARROW_GEOMETRY_TYPE_MULTILINESTRING;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      geometry_type = schema_view.geometry_type;
+      break;
+    default:
+      GeoArrowErrorSet(error, "Can't clip array of type %d", (int)schema_view.type);
+      return ENOTSUP;
+  }
+
+  if (GeoArrowCoordTypeIsFloat(schema_view.coord_type) ||
+      GeoArrowCoordTypeIsQuantized(schema_view.coord_type)) {
+    GeoArrowErrorSet(error, "Can't clip array of type %d", (int)schema_view.type);
+    return ENOTSUP;
+  }
+
+  enum GeoArrowType out_type =
+      GeoArrowMakeType(geometry_type, schema_view.dimensions, schema_view.coord_type);
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(&tmp, out_type));
+  int result = GeoArrowSchemaSetMetadataFrom(&tmp, schema);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadataFrom() failed");
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitFromSchema(&private_data->writer, &tmp);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitVisitor(&private_data->writer, &private_data->v);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowClipperInit(&clip_private->clipper, box, error);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowSchemaMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+// Formats each batch of the format_wkt kernel with option n_tasks > 1 using
+// GeoArrowArrayFormatWKT() (see Kernel format_wkt below)
+static int kernel_push_batch_format_wkt_tasks(struct GeoArrowKernel* kernel,
+                                              struct ArrowArray* array,
+                                              struct ArrowArray* out,
+                                              struct GeoArrowError* error) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  struct GeoArrowFormatWKTPrivate* format = &private_data->format_wkt_private;
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowArrayFormatWKT(
+      array, format->type, private_data->wkt_writer.precision,
+      private_data->wkt_writer.max_element_size_bytes, GEOARROW_TYPE_WKT,
+      format->n_tasks, private_data->executor, out, error));
+
+  // The readers and writers used by each task are not visible to the kernel, so
+  // only batches, features, and output bytes are counted
+  if (private_data->stats != NULL) {
+    private_data->stats->num_batches++;
+    private_data->stats->num_features += out->length;
+    private_data->stats->num_null_features += out->null_count;
+    if (out->buffers[0] != NULL) {
+      private_data->stats->bytes_written += _ArrowBytesForBits(out->length);
+    }
+
+    const int32_t* offsets = (const int32_t*)out->buffers[1];
+    if (offsets != NULL) {
+      private_data->stats->bytes_written +=
+          (out->length + 1) * (int64_t)sizeof(int32_t) + offsets[out->length];
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+static int kernel_visitor_start(struct GeoArrowKernel* kernel, struct ArrowSchema* schema,
+                                const char* options, struct ArrowSchema* out,
+                                struct GeoArrowError* error) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+
+  switch (schema_view.type) {
+    case GEOARROW_TYPE_UNINITIALIZED:
+      return EINVAL;
+    default:
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowArrayReaderInitFromSchema(&private_data->reader, schema, error));
+      if (private_data->visit_by_feature) {
+        kernel->push_batch = &kernel_push_batch_by_feature;
+      } else {
+        kernel->push_batch = &kernel_push_batch;
+      }
+      break;
+  }
+
+  NANOARROW_RETURN_NOT_OK(
+      private_data->finish_start(private_data, schema, options, out, error));
+
+  // as_geoarrow may have opted in to casting coordinates without a visitor
+  if (private_data->cast_builder.private_data != NULL) {
+    kernel->push_batch = &kernel_push_batch_cast_coords;
+  }
+
+  // Geometry types of WKB input only need geometry headers
+  if (private_data->geometry_types_private.scan_wkb) {
+    kernel->push_batch = &kernel_push_batch_unique_geometry_types_wkb;
+  }
+
+  // Measures of native input are computed directly from offsets and coordinates
+  if (private_data->measure_writer.private_data != NULL) {
+    kernel->push_batch = &kernel_push_batch_measure;
+  }
+
+  // Transforms of native input with double coordinates only compute coordinates
+  if (private_data->transform_private.active &&
+      private_data->cast_builder.private_data != NULL) {
+    kernel->push_batch = &kernel_push_batch_transform;
+  }
+
+  if (private_data->simplify_private.active &&
+      private_data->cast_builder.private_data != NULL) {
+    kernel->push_batch = &kernel_push_batch_simplify;
+  }
+
+  // Clipping only accepts native input, whose features are clipped without a visitor
+  if (private_data->clip_private.active) {
+    kernel->push_batch = &kernel_push_batch_clip;
+  }
+
+  if (private_data->format_wkt_private.n_tasks > 1) {
+    kernel->push_batch = &kernel_push_batch_format_wkt_tasks;
+  }
+
+  if (private_data->stats != NULL) {
+    GeoArrowArrayReaderSetStatistics(&private_data->reader, private_data->stats);
+
+    if (private_data->cast_builder.private_data != NULL) {
+      GeoArrowBuilderSetStatistics(&private_data->cast_builder, private_data->stats);
+    }
+
+    if (private_data->writer.private_data != NULL) {
+      GeoArrowArrayWriterSetStatistics(&private_data->writer, private_data->stats);
+    }
+
+    if (private_data->wkt_writer.private_data != NULL) {
+      GeoArrowWKTWriterSetStatistics(&private_data->wkt_writer, private_data->stats);
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+// Kernel visit_void_agg
+//
+// This kernel visits every feature and returns a single null item at the end.
+// This is useful for (1) testing and (2) validating well-known text or well-known
+// binary.
+
+static int finish_start_visit_void_agg(struct GeoArrowVisitorKernelPrivate* private_data,
+                                       struct ArrowSchema* schema, const char* options,
+                                       struct ArrowSchema* out,
+                                       struct GeoArrowError* error) {
+  NANOARROW_UNUSED(private_data);
+  NANOARROW_UNUSED(schema);
+  NANOARROW_UNUSED(options);
+  NANOARROW_UNUSED(error);
+
+  return ArrowSchemaInitFromType(out, NANOARROW_TYPE_NA);
+}
+
+// Kernel format_wkt
+//
+// Visits every feature in the input and writes the corresponding well-known text output,
+// optionally specifying precision and max_element_size_bytes. With option n_tasks > 1,
+// each batch is instead split into at most n_tasks row ranges that are formatted by
+// GeoArrowArrayFormatWKT() using the executor set by GeoArrowKernelSetExecutor() (or
+// sequentially if none was set).
+
+static int finish_start_format_wkt(struct GeoArrowVisitorKernelPrivate* private_data,
+                                   struct ArrowSchema* schema, const char* options,
+                                   struct ArrowSchema* out, struct GeoArrowError* error) {
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  private_data->format_wkt_private.type = schema_view.type;
+
+  long n_tasks = 1;
+  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "n_tasks", &n_tasks, 0, error));
+  private_data->format_wkt_private.n_tasks = n_tasks;
+
+  long precision = private_data->wkt_writer.precision;
+  NANOARROW_RETURN_NOT_OK(
+      kernel_get_arg_long(options, "precision", &precision, 0, error));
+  private_data->wkt_writer.precision = (int)precision;
+
+  long max_element_size_bytes = private_data->wkt_writer.max_element_size_bytes;
+  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "max_element_size_bytes",
+                                              &max_element_size_bytes, 0, error));
+  private_data->wkt_writer.max_element_size_bytes = max_element_size_bytes;
+
+  GeoArrowWKTWriterInitVisitor(&private_data->wkt_writer, &private_data->v);
+
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(out, NANOARROW_TYPE_STRING));
+  return GEOARROW_OK;
+}
+
+static int finish_push_batch_format_wkt(struct GeoArrowVisitorKernelPrivate* private_data,
+                                        struct ArrowArray* out,
+                                        struct GeoArrowError* error) {
+  return GeoArrowWKTWriterFinish(&private_data->wkt_writer, out, error);
+}
+
+// Kernel as_geoarrow
+//
+// Visits every feature in the input and writes an array of the specified type.
+// Takes option 'type' as the desired integer enum GeoArrowType.
+
+// If only the coordinate storage type differs (i.e., double input and float or
+// quantized output or vice versa), only the coordinate layout differs (i.e.,
+// separated input and interleaved output or vice versa), or only dimensions are
+// dropped, coordinates can be cast directly
+static int finish_start_as_geoarrow_cast(
+    struct GeoArrowVisitorKernelPrivate* private_data, struct ArrowSchema* schema,
+    struct ArrowSchema* out_schema, struct GeoArrowError* error) {
+  struct GeoArrowSchemaView in_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&in_view, schema, error));
+  struct GeoArrowSchemaView out_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&out_view, out_schema, error));
+
+  int64_t in_ordinate_size = GeoArrowCoordTypeOrdinateSize(in_view.coord_type);
+  int64_t out_ordinate_size = GeoArrowCoordTypeOrdinateSize(out_view.coord_type);
+  int in_is_double = in_ordinate_size == (int64_t)sizeof(double);
+  int out_is_double = out_ordinate_size == (int64_t)sizeof(double);
+  int same_layout = GeoArrowCoordTypeLayout(in_view.coord_type) ==
+                    GeoArrowCoordTypeLayout(out_view.coord_type);
+  int same_storage =
+      GeoArrowCoordTypeIsFloat(in_view.coord_type) ==
+          GeoArrowCoordTypeIsFloat(out_view.coord_type) &&
+      GeoArrowCoordTypeIsQuantized(in_view.coord_type) ==
+          GeoArrowCoordTypeIsQuantized(out_view.coord_type);
+
+  int same_dimensions = in_view.dimensions == out_view.dimensions;
+  int dim_map[4];
+
+  int can_cast_storage = same_dimensions && same_layout && in_is_double != out_is_double;
+  int can_transpose = same_dimensions && !same_layout && same_storage;
+  // Quantized ordinates are excluded because the output's quantization is copied
+  // from the input's metadata and would not line up with the kept dimensions
+  int can_project =
+      !same_dimensions && same_layout && same_storage &&
+      !GeoArrowCoordTypeIsQuantized(in_view.coord_type) &&
+      kernel_project_dimensions(in_view.dimensions, out_view.dimensions, dim_map) > 0;
+  if (in_ordinate_size == 0 || out_ordinate_size == 0 ||
+      in_view.geometry_type != out_view.geometry_type ||
+      in_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX ||
+      !(can_cast_storage || can_transpose || can_project)) {
+    return GEOARROW_OK;
+  }
+
+  return GeoArrowBuilderInitFromSchema(&private_data->cast_builder, out_schema, error);
+}
+
+static int finish_start_as_geoarrow(struct GeoArrowVisitorKernelPrivate* private_data,
+                                    struct ArrowSchema* schema, const char* options,
+                                    struct ArrowSchema* out,
+                                    struct GeoArrowError* error) {
+  long out_type_long;
+  NANOARROW_RETURN_NOT_OK(kernel_get_arg_long(options, "type", &out_type_long, 1, error));
+  enum GeoArrowType out_type = (enum GeoArrowType)out_type_long;
+
+  if (private_data->writer.private_data != NULL) {
+    GeoArrowErrorSet(error, "Expected exactly one call to start(as_geoarrow)");
+    return EINVAL;
+  }
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(&tmp, out_type));
+
+  int result = GeoArrowSchemaSetMetadataFrom(&tmp, schema);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadataFrom() failed");
+    tmp.release(&tmp);
+    return result;
+  }
+
+  // Initializing the writer from the output schema picks up any quantization
+  // parameters from the extension metadata
+  result = GeoArrowArrayWriterInitFromSchema(&private_data->writer, &tmp);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayWriterInitVisitor(&private_data->writer, &private_data->v);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = finish_start_as_geoarrow_cast(private_data, schema, &tmp, error);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowSchemaMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+static int finish_push_batch_as_geoarrow(
+    struct GeoArrowVisitorKernelPrivate* private_data, struct ArrowArray* out,
+    struct GeoArrowError* error) {
+  return GeoArrowArrayWriterFinish(&private_data->writer, out, error);
+}
+
+// Kernel unique_geometry_types_agg
+//
+// This kernel collects all geometry type + dimension combinations in the
+// input. EMPTY values are not counted as any particular geometry type;
+// however, note that POINTs as represented in WKB or GeoArrow cannot be
+// EMPTY and this kernel does not check for the convention of EMPTY as
+// all coordinates == nan. This is mostly to facilitate choosing an appropriate
+// destination type (e.g., point, linestring, etc.). This visitor is not exposed as a
+// standalone visitor in the geoarrow.h header.
+//
+// WKB input is not visited: GeoArrowWKBReaderScan() reads the outermost geometry
+// type and dimensions and whether the feature has any coordinates from the geometry
+// headers.
+//
+// The internals use GeoArrowDimensions * 8 + GeoArrowGeometryType as the
+// "key" for a given combination. This gives an integer between 0 and 39.
+// The types are accumulated in a uint64_t bitmask and translated into the
+// corresponding ISO WKB type codes at the end.
+static int32_t kGeoArrowGeometryTypeWkbValues[] = {
+    -1000, -999, -998, -997, -996, -995, -994, -993, 0,    1,    2,    3,    4,    5,
+    6,     7,    1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 2000, 2001, 2002, 2003,
+    2004,  2005, 2006, 2007, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007};
+
+static int feat_start_geometry_types(struct GeoArrowVisitor* v) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  private_data->geometry_types_private.geometry_type = GEOARROW_GEOMETRY_TYPE_GEOMETRY;
+  private_data->geometry_types_private.dimensions = GEOARROW_DIMENSIONS_UNKNOWN;
+  return GEOARROW_OK;
+}
+
+static int geom_start_geometry_types(struct GeoArrowVisitor* v,
+                                     enum GeoArrowGeometryType geometry_type,
+                                     enum GeoArrowDimensions dimensions) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+
+  // Only record the first seen geometry type/dimension combination
+  if (private_data->geometry_types_private.geometry_type ==
+      GEOARROW_GEOMETRY_TYPE_GEOMETRY) {
+    private_data->geometry_types_private.geometry_type = geometry_type;
+    private_data->geometry_types_private.dimensions = dimensions;
+  }
+
+  return GEOARROW_OK;
+}
+
+static int coords_geometry_types(struct GeoArrowVisitor* v,
+                                 const struct GeoArrowCoordView* coords) {
+  if (coords->n_coords > 0) {
+    struct GeoArrowVisitorKernelPrivate* private_data =
+        (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+
+    // At the first coordinate, add the geometry type to the bitmask
+    int bitshift = private_data->geometry_types_private.dimensions * 8 +
+                   private_data->geometry_types_private.geometry_type;
+    uint64_t bitmask = ((uint64_t)1) << bitshift;
+    private_data->geometry_types_private.geometry_types_mask |= bitmask;
+    return EAGAIN;
+  } else {
+    return GEOARROW_OK;
+  }
+}
+
+static int finish_start_unique_geometry_types_agg(
+    struct GeoArrowVisitorKernelPrivate* private_data, struct ArrowSchema* schema,
+    const char* options, struct ArrowSchema* out, struct GeoArrowError* error) {
+  NANOARROW_UNUSED(options);
+
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  private_data->geometry_types_private.scan_wkb = schema_view.type == GEOARROW_TYPE_WKB;
+
+  private_data->v.feat_start = &feat_start_geometry_types;
+  private_data->v.geom_start = &geom_start_geometry_types;
+  private_data->v.coords = &coords_geometry_types;
+  private_data->v.private_data = private_data;
+  return ArrowSchemaInitFromType(out, NANOARROW_TYPE_INT32);
+}
+
+static int kernel_finish_unique_geometry_types_agg(struct GeoArrowKernel* kernel,
+                                                   struct ArrowArray* out,
+                                                   struct GeoArrowError* error) {
+  NANOARROW_UNUSED(error);
+
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+  uint64_t result_mask = private_data->geometry_types_private.geometry_types_mask;
+
+  int n_types = 0;
+  for (int i = 0; i < 40; i++) {
+    uint64_t bitmask = ((uint64_t)1) << i;
     n_types += (result_mask & bitmask) != 0;
   }
 
@@ -469,6 +1557,10 @@ static int kernel_finish_unique_geometry_types_agg(struct GeoArrowKernel* kernel
 //
 // Calculate bounding box values by feature or as an aggregate.
 // This visitor is not exposed as a standalone visitor in the geoarrow.h header.
+//
+// For non-planar edges, coordinates are longitude and latitude and the bounds
+// account for each edge being a great circle (see GeoArrowSphericalBounds), such
+// that xmin > xmax when the bounds cross the antimeridian.
 
 static ArrowErrorCode schema_box(struct ArrowSchema* schema,
                                  struct GeoArrowStringView extension_metadata,
@@ -476,12 +1568,6 @@ static ArrowErrorCode schema_box(struct ArrowSchema* schema,
   struct GeoArrowMetadataView metadata;
   NANOARROW_RETURN_NOT_OK(GeoArrowMetadataViewInit(&metadata, extension_metadata, error));
 
-  // This bounder only works for planar edges
-  if (metadata.edge_type != GEOARROW_EDGE_TYPE_PLANAR) {
-    GeoArrowErrorSet(error, "box kernel does not support non-planar edges");
-    return EINVAL;
-  }
-
   NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(schema, GEOARROW_TYPE_BOX));
   NANOARROW_RETURN_NOT_OK(GeoArrowSchemaSetMetadata(schema, &metadata));
   return GEOARROW_OK;
@@ -499,6 +1585,13 @@ static ArrowErrorCode array_box(struct ArrowArray* array) {
 }
 
 static ArrowErrorCode box_flush(struct GeoArrowVisitorKernelPrivate* private_data) {
+  if (private_data->box2d_private.is_spherical) {
+    memcpy(private_data->box2d_private.min_values,
+           private_data->box2d_private.spherical.min_values, 2 * sizeof(double));
+    memcpy(private_data->box2d_private.max_values,
+           private_data->box2d_private.spherical.max_values, 2 * sizeof(double));
+  }
+
   NANOARROW_RETURN_NOT_OK(ArrowBufferAppendDouble(
       &private_data->box2d_private.values[0], private_data->box2d_private.min_values[0]));
   NANOARROW_RETURN_NOT_OK(ArrowBufferAppendDouble(
@@ -524,28 +1617,93 @@ static ArrowErrorCode box_finish(struct GeoArrowVisitorKernelPrivate* private_da
 
   int64_t length = private_data->box2d_private.values[0].size_bytes / sizeof(double);
 
-  for (int i = 0; i < 4; i++) {
-    NANOARROW_RETURN_NOT_OK(
-        ArrowArraySetBuffer(tmp.children[i], 1, &private_data->box2d_private.values[i]));
-    tmp.children[i]->length = length;
+  for (int i = 0; i < 4; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArraySetBuffer(tmp.children[i], 1, &private_data->box2d_private.values[i]));
+    tmp.children[i]->length = length;
+  }
+
+  tmp.length = length;
+  if (private_data->box2d_private.null_count > 0) {
+    ArrowArraySetValidityBitmap(&tmp, &private_data->box2d_private.validity);
+  } else {
+    ArrowBitmapReset(&private_data->box2d_private.validity);
+  }
+
+  result = ArrowArrayFinishBuildingDefault(&tmp, ((struct ArrowError*)error));
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  tmp.null_count = private_data->box2d_private.null_count;
+  private_data->box2d_private.null_count = 0;
+  ArrowArrayMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+static int geom_start_box_spherical(struct GeoArrowVisitor* v,
+                                    enum GeoArrowGeometryType geometry_type,
+                                    enum GeoArrowDimensions dimensions) {
+  NANOARROW_UNUSED(dimensions);
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  if (geometry_type == GEOARROW_GEOMETRY_TYPE_LINESTRING) {
+    GeoArrowSphericalBoundsPathStart(&private_data->box2d_private.spherical, 0);
+  }
+
+  return GEOARROW_OK;
+}
+
+static int ring_start_box_spherical(struct GeoArrowVisitor* v) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  GeoArrowSphericalBoundsPathStart(&private_data->box2d_private.spherical, 1);
+  return GEOARROW_OK;
+}
+
+static int coords_box_spherical(struct GeoArrowVisitor* v,
+                                const struct GeoArrowCoordView* coords) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  GeoArrowSphericalBoundsAppend(&private_data->box2d_private.spherical, coords);
+  return GEOARROW_OK;
+}
+
+static int ring_end_box_spherical(struct GeoArrowVisitor* v) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  GeoArrowSphericalBoundsPathEnd(&private_data->box2d_private.spherical);
+  return GEOARROW_OK;
+}
+
+static int geom_end_box_spherical(struct GeoArrowVisitor* v) {
+  struct GeoArrowVisitorKernelPrivate* private_data =
+      (struct GeoArrowVisitorKernelPrivate*)v->private_data;
+  struct GeoArrowSphericalBounds* spherical = &private_data->box2d_private.spherical;
+  if (spherical->path_active && !spherical->path_is_ring) {
+    GeoArrowSphericalBoundsPathEnd(spherical);
   }
 
-  tmp.length = length;
-  if (private_data->box2d_private.null_count > 0) {
-    ArrowArraySetValidityBitmap(&tmp, &private_data->box2d_private.validity);
-  } else {
-    ArrowBitmapReset(&private_data->box2d_private.validity);
-  }
+  return GEOARROW_OK;
+}
 
-  result = ArrowArrayFinishBuildingDefault(&tmp, ((struct ArrowError*)error));
-  if (result != GEOARROW_OK) {
-    tmp.release(&tmp);
-    return result;
+// Installs the callbacks that bound coordinates with non-planar edges if required
+static ArrowErrorCode box_init_edges(struct GeoArrowVisitorKernelPrivate* private_data,
+                                     struct GeoArrowStringView extension_metadata,
+                                     struct GeoArrowError* error) {
+  struct GeoArrowMetadataView metadata;
+  NANOARROW_RETURN_NOT_OK(GeoArrowMetadataViewInit(&metadata, extension_metadata, error));
+  if (metadata.edge_type == GEOARROW_EDGE_TYPE_PLANAR) {
+    return GEOARROW_OK;
   }
 
-  tmp.null_count = private_data->box2d_private.null_count;
-  private_data->box2d_private.null_count = 0;
-  ArrowArrayMove(&tmp, out);
+  private_data->box2d_private.is_spherical = 1;
+  private_data->v.geom_start = &geom_start_box_spherical;
+  private_data->v.ring_start = &ring_start_box_spherical;
+  private_data->v.coords = &coords_box_spherical;
+  private_data->v.ring_end = &ring_end_box_spherical;
+  private_data->v.geom_end = &geom_end_box_spherical;
   return GEOARROW_OK;
 }
 
@@ -557,6 +1715,7 @@ static int feat_start_box(struct GeoArrowVisitor* v) {
   private_data->box2d_private.min_values[0] = INFINITY;
   private_data->box2d_private.min_values[1] = INFINITY;
   private_data->box2d_private.feat_null = 0;
+  GeoArrowSphericalBoundsInit(&private_data->box2d_private.spherical);
   return GEOARROW_OK;
 }
 
@@ -625,9 +1784,12 @@ static int finish_start_box_agg(struct GeoArrowVisitorKernelPrivate* private_dat
   private_data->box2d_private.min_values[0] = INFINITY;
   private_data->box2d_private.min_values[1] = INFINITY;
   private_data->box2d_private.feat_null = 0;
+  GeoArrowSphericalBoundsInit(&private_data->box2d_private.spherical);
 
   struct GeoArrowSchemaView schema_view;
   NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  NANOARROW_RETURN_NOT_OK(
+      box_init_edges(private_data, schema_view.extension_metadata, error));
   NANOARROW_RETURN_NOT_OK(schema_box(out, schema_view.extension_metadata, error));
   return GEOARROW_OK;
 }
@@ -656,6 +1818,8 @@ static int finish_start_box(struct GeoArrowVisitorKernelPrivate* private_data,
 
   struct GeoArrowSchemaView schema_view;
   NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  NANOARROW_RETURN_NOT_OK(
+      box_init_edges(private_data, schema_view.extension_metadata, error));
   NANOARROW_RETURN_NOT_OK(schema_box(out, schema_view.extension_metadata, error));
   return GEOARROW_OK;
 }
@@ -711,6 +1875,62 @@ static int GeoArrowInitVisitorKernelInternal(struct GeoArrowKernel* kernel,
   } else if (strcmp(name, "box_agg") == 0) {
     kernel->finish = &kernel_finish_box_agg;
     private_data->finish_start = &finish_start_box_agg;
+  } else if (strcmp(name, "length") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_measure;
+    private_data->finish_push_batch = &finish_push_batch_measure;
+    private_data->measure_type = GEOARROW_MEASURE_TYPE_LENGTH;
+  } else if (strcmp(name, "area") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_measure;
+    private_data->finish_push_batch = &finish_push_batch_measure;
+    private_data->measure_type = GEOARROW_MEASURE_TYPE_AREA;
+  } else if (strcmp(name, "centroid") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_measure;
+    private_data->finish_push_batch = &finish_push_batch_measure;
+    private_data->measure_type = GEOARROW_MEASURE_TYPE_CENTROID;
+  } else if (strcmp(name, "num_coords") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_measure;
+    private_data->finish_push_batch = &finish_push_batch_measure;
+    private_data->measure_type = GEOARROW_MEASURE_TYPE_NUM_COORDS;
+  } else if (strcmp(name, "num_parts") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_measure;
+    private_data->finish_push_batch = &finish_push_batch_measure;
+    private_data->measure_type = GEOARROW_MEASURE_TYPE_NUM_PARTS;
+  } else if (strcmp(name, "affine") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_transform;
+    private_data->finish_push_batch = &finish_push_batch_as_geoarrow;
+    private_data->transform_private.active = 1;
+    GeoArrowTransformInit(&private_data->transform_private.transform,
+                          GEOARROW_TRANSFORM_AFFINE);
+  } else if (strcmp(name, "to_web_mercator") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_transform;
+    private_data->finish_push_batch = &finish_push_batch_as_geoarrow;
+    private_data->transform_private.active = 1;
+    GeoArrowTransformInit(&private_data->transform_private.transform,
+                          GEOARROW_TRANSFORM_TO_WEB_MERCATOR);
+  } else if (strcmp(name, "from_web_mercator") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_transform;
+    private_data->finish_push_batch = &finish_push_batch_as_geoarrow;
+    private_data->transform_private.active = 1;
+    GeoArrowTransformInit(&private_data->transform_private.transform,
+                          GEOARROW_TRANSFORM_FROM_WEB_MERCATOR);
+  } else if (strcmp(name, "simplify") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_simplify;
+    private_data->finish_push_batch = &finish_push_batch_as_geoarrow;
+    private_data->simplify_private.active = 1;
+  } else if (strcmp(name, "clip_by_box") == 0) {
+    kernel->finish = &kernel_finish_void;
+    private_data->finish_start = &finish_start_clip;
+    private_data->finish_push_batch = &finish_push_batch_as_geoarrow;
+    private_data->clip_private.active = 1;
   }
 
   if (result != GEOARROW_OK) {
@@ -726,6 +1946,372 @@ static int GeoArrowInitVisitorKernelInternal(struct GeoArrowKernel* kernel,
   return GEOARROW_OK;
 }
 
+// Kernel collect_agg
+//
+// Appends the non-null rows of each batch directly to a single builder (push_batch
+// does not own its input, so each coordinate is copied exactly once) and, on
+// finish, collects them into a single multi-geometry using GeoArrowArrayCollect()
+// (which does not copy the accumulated rows again because none of them are null).
+
+struct GeoArrowCollectKernelPrivate {
+  enum GeoArrowType type;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowBuilder builder;
+  // The number of elements appended to the builder at each level
+  int64_t n_elements[4];
+};
+
+static int kernel_collect_agg_init_offsets(
+    struct GeoArrowCollectKernelPrivate* private_data) {
+  struct GeoArrowBufferView zero;
+  int32_t zero_value = 0;
+  zero.data = (const uint8_t*)&zero_value;
+  zero.size_bytes = sizeof(int32_t);
+  for (int level = 0; level < private_data->array_view.n_offsets; level++) {
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowBuilderAppendBuffer(&private_data->builder, 1 + level, zero));
+  }
+
+  memset(private_data->n_elements, 0, sizeof(private_data->n_elements));
+  return GEOARROW_OK;
+}
+
+// Appends rows [offset, offset + length) of the current array view to the builder,
+// rebasing offsets to the elements already appended
+static int kernel_collect_agg_append(struct GeoArrowCollectKernelPrivate* private_data,
+                                     int64_t offset, int64_t length,
+                                     struct GeoArrowError* error) {
+  const struct GeoArrowArrayView* array_view = &private_data->array_view;
+  struct GeoArrowBuilder* builder = &private_data->builder;
+  int n_offsets = array_view->n_offsets;
+
+  // lo and hi are the range of elements at each level referenced by the rows
+  int64_t lo = array_view->offset[0] + offset;
+  int64_t hi = lo + length;
+  for (int level = 0; level < n_offsets; level++) {
+    const int32_t* src = array_view->offsets[level];
+    if (private_data->n_elements[level + 1] + (src[hi] - src[lo]) > INT32_MAX) {
+      GeoArrowErrorSet(error, "Can't collect more than %d elements", (int)INT32_MAX);
+      return EOVERFLOW;
+    }
+
+    NANOARROW_RETURN_NOT_OK(GeoArrowBuilderReserveBuffer(
+        builder, 1 + level, (hi - lo) * (int64_t)sizeof(int32_t)));
+    struct GeoArrowWritableBufferView* buffer = &builder->view.buffers[1 + level];
+    int32_t* dst = (int32_t*)(buffer->data.as_uint8 + buffer->size_bytes);
+    int32_t delta = (int32_t)(private_data->n_elements[level + 1] - src[lo]);
+    for (int64_t k = lo; k < hi; k++) {
+      dst[k - lo] = src[k + 1] + delta;
+    }
+
+    buffer->size_bytes += (hi - lo) * (int64_t)sizeof(int32_t);
+    private_data->n_elements[level] += hi - lo;
+
+    int64_t child_offset = array_view->offset[level + 1];
+    hi = src[hi] + child_offset;
+    lo = src[lo] + child_offset;
+  }
+
+  int64_t n_coords = hi - lo;
+  private_data->n_elements[n_offsets] += n_coords;
+  if (n_coords == 0) {
+    return GEOARROW_OK;
+  }
+
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  int n_values = array_view->coords.n_values;
+  int is_interleaved =
+      GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_INTERLEAVED;
+  int64_t element_size =
+      GeoArrowCoordTypeOrdinateSize(coord_type) * (is_interleaved ? n_values : 1);
+
+  struct GeoArrowBufferView buffer;
+  buffer.size_bytes = n_coords * element_size;
+  for (int j = 0; j < (is_interleaved ? 1 : n_values); j++) {
+    buffer.data = (const uint8_t*)kernel_coord_values(array_view, j) + lo * element_size;
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowBuilderAppendBuffer(builder, 1 + n_offsets + j, buffer));
+  }
+
+  return GEOARROW_OK;
+}
+
+static int kernel_start_collect_agg(struct GeoArrowKernel* kernel,
+                                    struct ArrowSchema* schema, const char* options,
+                                    struct ArrowSchema* out,
+                                    struct GeoArrowError* error) {
+  NANOARROW_UNUSED(options);
+  struct GeoArrowCollectKernelPrivate* private_data =
+      (struct GeoArrowCollectKernelPrivate*)kernel->private_data;
+
+  struct GeoArrowSchemaView schema_view;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaViewInit(&schema_view, schema, error));
+  switch (schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      if (schema_view.coord_type != GEOARROW_COORD_TYPE_UNKNOWN) {
+        break;
+      }
+      // fall through
+    default:
+      GeoArrowErrorSet(error, "Can't collect type %d", (int)schema_view.type);
+      return EINVAL;
+  }
+
+  private_data->type = schema_view.type;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowArrayViewInitFromType(&private_data->array_view, schema_view.type));
+  GeoArrowBuilderReset(&private_data->builder);
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowBuilderInitFromType(&private_data->builder, schema_view.type));
+  NANOARROW_RETURN_NOT_OK(kernel_collect_agg_init_offsets(private_data));
+
+  enum GeoArrowType out_type = GeoArrowMakeType(
+      (enum GeoArrowGeometryType)(schema_view.geometry_type + 3), schema_view.dimensions,
+      schema_view.coord_type);
+
+  struct ArrowSchema tmp;
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(&tmp, out_type));
+  int result = GeoArrowSchemaSetMetadataFrom(&tmp, schema);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowSchemaSetMetadataFrom() failed");
+    tmp.release(&tmp);
+    return result;
+  }
+
+  ArrowSchemaMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+static int kernel_push_batch_collect_agg(struct GeoArrowKernel* kernel,
+                                         struct ArrowArray* array,
+                                         struct ArrowArray* out,
+                                         struct GeoArrowError* error) {
+  NANOARROW_UNUSED(out);
+  struct GeoArrowCollectKernelPrivate* private_data =
+      (struct GeoArrowCollectKernelPrivate*)kernel->private_data;
+  struct GeoArrowArrayView* array_view = &private_data->array_view;
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(array_view, array, error));
+  const uint8_t* validity = array->null_count != 0 ? array_view->validity_bitmap : NULL;
+
+  // Null rows are dropped while appending, so each run of non-null rows is
+  // appended at once
+  int64_t run_start = 0;
+  for (int64_t i = 0; validity != NULL && i < array->length; i++) {
+    if (!ArrowBitGet(validity, array_view->offset[0] + i)) {
+      if (i > run_start) {
+        NANOARROW_RETURN_NOT_OK(
+            kernel_collect_agg_append(private_data, run_start, i - run_start, error));
+      }
+
+      run_start = i + 1;
+    }
+  }
+
+  if (array->length > run_start) {
+    NANOARROW_RETURN_NOT_OK(kernel_collect_agg_append(
+        private_data, run_start, array->length - run_start, error));
+  }
+
+  return GEOARROW_OK;
+}
+
+static int kernel_finish_collect_agg(struct GeoArrowKernel* kernel,
+                                     struct ArrowArray* out,
+                                     struct GeoArrowError* error) {
+  struct GeoArrowCollectKernelPrivate* private_data =
+      (struct GeoArrowCollectKernelPrivate*)kernel->private_data;
+
+  struct ArrowArray combined;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowBuilderFinish(&private_data->builder, &combined, error));
+
+  // Prepare the builder for another round of batches
+  int result = kernel_collect_agg_init_offsets(private_data);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayCollect(&combined, private_data->type, NULL, 1, out, error);
+  }
+
+  if (result != GEOARROW_OK) {
+    combined.release(&combined);
+    return result;
+  }
+
+  return GEOARROW_OK;
+}
+
+static void kernel_release_collect_agg(struct GeoArrowKernel* kernel) {
+  struct GeoArrowCollectKernelPrivate* private_data =
+      (struct GeoArrowCollectKernelPrivate*)kernel->private_data;
+  GeoArrowBuilderReset(&private_data->builder);
+  ArrowFree(private_data);
+  kernel->release = NULL;
+}
+
+static int GeoArrowKernelInitCollectAgg(struct GeoArrowKernel* kernel) {
+  struct GeoArrowCollectKernelPrivate* private_data =
+      (struct GeoArrowCollectKernelPrivate*)ArrowMalloc(
+          sizeof(struct GeoArrowCollectKernelPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowCollectKernelPrivate));
+  private_data->type = GEOARROW_TYPE_UNINITIALIZED;
+
+  kernel->start = &kernel_start_collect_agg;
+  kernel->push_batch = &kernel_push_batch_collect_agg;
+  kernel->finish = &kernel_finish_collect_agg;
+  kernel->release = &kernel_release_collect_agg;
+  kernel->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+// Statistics
+//
+// GeoArrowKernelEnableStatistics() replaces the callbacks of an existing kernel with
+// ones that record timings around the original callbacks. For visitor-based kernels
+// the reader and writer(s) are also pointed at the statistics so that they can count
+// features, coordinates, bytes, and reallocations; for other kernels only input
+// batches and features are counted.
+
+struct GeoArrowStatisticsKernelPrivate {
+  struct GeoArrowKernel wrapped;
+  struct GeoArrowStatistics stats;
+  int is_visitor_kernel;
+};
+
+static int64_t GeoArrowStatisticsNowNs(void) {
+#if defined(_WIN32)
+  LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (int64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+  return (int64_t)((double)clock() * 1e9 / CLOCKS_PER_SEC);
+#endif
+}
+
+static int kernel_start_stats(struct GeoArrowKernel* kernel, struct ArrowSchema* schema,
+                              const char* options, struct ArrowSchema* out,
+                              struct GeoArrowError* error) {
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)kernel->private_data;
+
+  int64_t start = GeoArrowStatisticsNowNs();
+  int result = private_data->wrapped.start(&private_data->wrapped, schema, options, out,
+                                           error);
+  private_data->stats.start_ns += GeoArrowStatisticsNowNs() - start;
+  return result;
+}
+
+static int kernel_push_batch_stats(struct GeoArrowKernel* kernel,
+                                   struct ArrowArray* array, struct ArrowArray* out,
+                                   struct GeoArrowError* error) {
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)kernel->private_data;
+
+  if (!private_data->is_visitor_kernel) {
+    private_data->stats.num_batches++;
+    private_data->stats.num_features += array->length;
+    if (array->null_count > 0) {
+      private_data->stats.num_null_features += array->null_count;
+    }
+  }
+
+  int64_t start = GeoArrowStatisticsNowNs();
+  int result =
+      private_data->wrapped.push_batch(&private_data->wrapped, array, out, error);
+  private_data->stats.push_batch_ns += GeoArrowStatisticsNowNs() - start;
+  return result;
+}
+
+static int kernel_finish_stats(struct GeoArrowKernel* kernel, struct ArrowArray* out,
+                               struct GeoArrowError* error) {
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)kernel->private_data;
+
+  int64_t start = GeoArrowStatisticsNowNs();
+  int result = private_data->wrapped.finish(&private_data->wrapped, out, error);
+  private_data->stats.finish_ns += GeoArrowStatisticsNowNs() - start;
+  return result;
+}
+
+static void kernel_release_stats(struct GeoArrowKernel* kernel) {
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)kernel->private_data;
+  if (private_data->wrapped.release != NULL) {
+    private_data->wrapped.release(&private_data->wrapped);
+  }
+
+  ArrowFree(private_data);
+  kernel->release = NULL;
+}
+
+GeoArrowErrorCode GeoArrowKernelEnableStatistics(struct GeoArrowKernel* kernel) {
+  if (kernel->release == NULL || kernel->release == &kernel_release_stats) {
+    return EINVAL;
+  }
+
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)ArrowMalloc(
+          sizeof(struct GeoArrowStatisticsKernelPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowStatisticsKernelPrivate));
+  memcpy(&private_data->wrapped, kernel, sizeof(struct GeoArrowKernel));
+
+  if (kernel->release == &kernel_release_visitor) {
+    struct GeoArrowVisitorKernelPrivate* visitor_private =
+        (struct GeoArrowVisitorKernelPrivate*)kernel->private_data;
+    visitor_private->stats = &private_data->stats;
+    private_data->is_visitor_kernel = 1;
+  }
+
+  kernel->start = &kernel_start_stats;
+  kernel->push_batch = &kernel_push_batch_stats;
+  kernel->finish = &kernel_finish_stats;
+  kernel->release = &kernel_release_stats;
+  kernel->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowKernelGetStatistics(struct GeoArrowKernel* kernel,
+                                              struct GeoArrowStatistics* out) {
+  if (kernel->release != &kernel_release_stats) {
+    return EINVAL;
+  }
+
+  struct GeoArrowStatisticsKernelPrivate* private_data =
+      (struct GeoArrowStatisticsKernelPrivate*)kernel->private_data;
+  memcpy(out, &private_data->stats, sizeof(struct GeoArrowStatistics));
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowKernelSetExecutor(struct GeoArrowKernel* kernel,
+                                            struct GeoArrowExecutor* executor) {
+  // Kernels with statistics enabled wrap the original kernel
+  if (kernel->release == &kernel_release_stats) {
+    kernel = &((struct GeoArrowStatisticsKernelPrivate*)kernel->private_data)->wrapped;
+  }
+
+  if (kernel->release != &kernel_release_visitor) {
+    return EINVAL;
+  }
+
+  ((struct GeoArrowVisitorKernelPrivate*)kernel->private_data)->executor = executor;
+  return GEOARROW_OK;
+}
+
 GeoArrowErrorCode GeoArrowKernelInit(struct GeoArrowKernel* kernel, const char* name,
                                      const char* options) {
   NANOARROW_UNUSED(options);
@@ -748,7 +2334,210 @@ GeoArrowErrorCode GeoArrowKernelInit(struct GeoArrowKernel* kernel, const char*
     return GeoArrowInitVisitorKernelInternal(kernel, name);
   } else if (strcmp(name, "box_agg") == 0) {
     return GeoArrowInitVisitorKernelInternal(kernel, name);
+  } else if (strcmp(name, "length") == 0 || strcmp(name, "area") == 0 ||
+             strcmp(name, "centroid") == 0 || strcmp(name, "num_coords") == 0 ||
+             strcmp(name, "num_parts") == 0) {
+    return GeoArrowInitVisitorKernelInternal(kernel, name);
+  } else if (strcmp(name, "affine") == 0 || strcmp(name, "to_web_mercator") == 0 ||
+             strcmp(name, "from_web_mercator") == 0) {
+    return GeoArrowInitVisitorKernelInternal(kernel, name);
+  } else if (strcmp(name, "simplify") == 0) {
+    return GeoArrowInitVisitorKernelInternal(kernel, name);
+  } else if (strcmp(name, "clip_by_box") == 0) {
+    return GeoArrowInitVisitorKernelInternal(kernel, name);
+  } else if (strcmp(name, "collect_agg") == 0) {
+    return GeoArrowKernelInitCollectAgg(kernel);
   }
 
   return ENOTSUP;
 }
+
+// Kernel streams
+//
+// GeoArrowKernelStreamInit() wraps an input ArrowArrayStream such that each call to
+// get_next() pulls exactly one batch from the input and pushes it through the kernel.
+// The kernel is started lazily from the first call to get_schema() or get_next() so
+// that constructing a pipeline of streams does not touch the input.
+
+struct GeoArrowKernelStreamPrivate {
+  struct GeoArrowKernel kernel;
+  struct ArrowArrayStream input;
+  struct ArrowSchema schema;
+  char* options;
+  int is_agg;
+  int finished;
+  int start_result;
+  struct GeoArrowError error;
+};
+
+static int GeoArrowKernelStreamEnsureStarted(
+    struct GeoArrowKernelStreamPrivate* private_data) {
+  if (private_data->schema.release != NULL || private_data->start_result != GEOARROW_OK) {
+    return private_data->start_result;
+  }
+
+  struct ArrowSchema input_schema;
+  input_schema.release = NULL;
+  int result = private_data->input.get_schema(&private_data->input, &input_schema);
+  if (result != GEOARROW_OK) {
+    const char* input_error = private_data->input.get_last_error(&private_data->input);
+    GeoArrowErrorSet(&private_data->error, "input stream get_schema() failed: %s",
+                     input_error == NULL ? "" : input_error);
+    private_data->start_result = result;
+    return result;
+  }
+
+  result = private_data->kernel.start(&private_data->kernel, &input_schema,
+                                      private_data->options, &private_data->schema,
+                                      &private_data->error);
+  input_schema.release(&input_schema);
+  if (result != GEOARROW_OK) {
+    private_data->schema.release = NULL;
+    private_data->start_result = result;
+  }
+
+  return result;
+}
+
+static int kernel_stream_get_schema(struct ArrowArrayStream* stream,
+                                    struct ArrowSchema* out) {
+  struct GeoArrowKernelStreamPrivate* private_data =
+      (struct GeoArrowKernelStreamPrivate*)stream->private_data;
+  if (private_data->start_result == GEOARROW_OK) {
+    private_data->error.message[0] = '\0';
+  }
+
+  GEOARROW_RETURN_NOT_OK(GeoArrowKernelStreamEnsureStarted(private_data));
+  return ArrowSchemaDeepCopy(&private_data->schema, out);
+}
+
+static int kernel_stream_get_next(struct ArrowArrayStream* stream,
+                                  struct ArrowArray* out) {
+  struct GeoArrowKernelStreamPrivate* private_data =
+      (struct GeoArrowKernelStreamPrivate*)stream->private_data;
+  if (private_data->start_result == GEOARROW_OK) {
+    private_data->error.message[0] = '\0';
+  }
+
+  GEOARROW_RETURN_NOT_OK(GeoArrowKernelStreamEnsureStarted(private_data));
+
+  struct ArrowArray batch;
+  int result;
+  while (!private_data->finished) {
+    batch.release = NULL;
+    result = private_data->input.get_next(&private_data->input, &batch);
+    if (result != GEOARROW_OK) {
+      const char* input_error = private_data->input.get_last_error(&private_data->input);
+      GeoArrowErrorSet(&private_data->error, "input stream get_next() failed: %s",
+                       input_error == NULL ? "" : input_error);
+      return result;
+    }
+
+    if (batch.release == NULL) {
+      private_data->finished = 1;
+      if (private_data->is_agg) {
+        return private_data->kernel.finish(&private_data->kernel, out,
+                                           &private_data->error);
+      }
+
+      break;
+    }
+
+    if (private_data->is_agg) {
+      result = private_data->kernel.push_batch(&private_data->kernel, &batch, NULL,
+                                               &private_data->error);
+      batch.release(&batch);
+      GEOARROW_RETURN_NOT_OK(result);
+    } else {
+      result = private_data->kernel.push_batch(&private_data->kernel, &batch, out,
+                                               &private_data->error);
+      batch.release(&batch);
+      return result;
+    }
+  }
+
+  out->release = NULL;
+  return GEOARROW_OK;
+}
+
+static const char* kernel_stream_get_last_error(struct ArrowArrayStream* stream) {
+  struct GeoArrowKernelStreamPrivate* private_data =
+      (struct GeoArrowKernelStreamPrivate*)stream->private_data;
+  return private_data->error.message;
+}
+
+static void kernel_stream_release(struct ArrowArrayStream* stream) {
+  struct GeoArrowKernelStreamPrivate* private_data =
+      (struct GeoArrowKernelStreamPrivate*)stream->private_data;
+
+  if (private_data->kernel.release != NULL) {
+    private_data->kernel.release(&private_data->kernel);
+  }
+
+  if (private_data->input.release != NULL) {
+    private_data->input.release(&private_data->input);
+  }
+
+  if (private_data->schema.release != NULL) {
+    private_data->schema.release(&private_data->schema);
+  }
+
+  if (private_data->options != NULL) {
+    ArrowFree(private_data->options);
+  }
+
+  ArrowFree(private_data);
+  stream->release = NULL;
+}
+
+GeoArrowErrorCode GeoArrowKernelStreamInit(struct ArrowArrayStream* out,
+                                           struct ArrowArrayStream* input,
+                                           const char* name, const char* options,
+                                           struct GeoArrowError* error) {
+  struct GeoArrowKernel kernel;
+  int result = GeoArrowKernelInit(&kernel, name, options);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "GeoArrowKernelInit('%s') failed", name);
+    return result;
+  }
+
+  struct GeoArrowKernelStreamPrivate* private_data =
+      (struct GeoArrowKernelStreamPrivate*)ArrowMalloc(
+          sizeof(struct GeoArrowKernelStreamPrivate));
+  if (private_data == NULL) {
+    kernel.release(&kernel);
+    GeoArrowErrorSet(error, "Failed to allocate GeoArrowKernelStreamPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowKernelStreamPrivate));
+
+  // Options are serialized like ArrowSchema metadata and must outlive this call
+  // because the kernel is not started until the stream is first consumed.
+  if (options != NULL) {
+    int64_t options_size = ArrowMetadataSizeOf(options);
+    private_data->options = (char*)ArrowMalloc(options_size);
+    if (private_data->options == NULL) {
+      kernel.release(&kernel);
+      ArrowFree(private_data);
+      GeoArrowErrorSet(error, "Failed to allocate options");
+      return ENOMEM;
+    }
+
+    memcpy(private_data->options, options, (size_t)options_size);
+  }
+
+  size_t name_size = strlen(name);
+  private_data->is_agg = name_size >= 4 && strcmp(name + name_size - 4, "_agg") == 0;
+
+  memcpy(&private_data->kernel, &kernel, sizeof(struct GeoArrowKernel));
+  ArrowArrayStreamMove(input, &private_data->input);
+  private_data->schema.release = NULL;
+
+  out->get_schema = &kernel_stream_get_schema;
+  out->get_next = &kernel_stream_get_next;
+  out->get_last_error = &kernel_stream_get_last_error;
+  out->release = &kernel_stream_release;
+  out->private_data = private_data;
+  return GEOARROW_OK;
+}
@@ -1,11 +1,18 @@
 
 #include <errno.h>
 
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "geoarrow/geoarrow.h"
 #include "nanoarrow/nanoarrow.h"
 
+#include "geoarrow/wkx_testing.hpp"
+
 TEST(KernelTest, KernelTestVoid) {
   struct GeoArrowKernel kernel;
   struct GeoArrowError error;
@@ -779,3 +786,2042 @@ TEST(KernelTest, KernelTestBoxMetadata) {
   ArrowSchemaRelease(&schema_out);
   kernel.release(&kernel);
 }
+
+TEST(KernelTest, KernelTestStatisticsVoid) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowStatistics stats;
+
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema_in, NANOARROW_TYPE_NA), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromType(&array_in, NANOARROW_TYPE_NA), GEOARROW_OK);
+  array_in.length = 3;
+  array_in.null_count = 3;
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "void", nullptr), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), EINVAL);
+  ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowKernelEnableStatistics(&kernel), EINVAL);
+
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  EXPECT_EQ(array_out.length, 3);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.finish(&kernel, nullptr, &error), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_batches, 2);
+  EXPECT_EQ(stats.num_features, 6);
+  EXPECT_EQ(stats.num_null_features, 6);
+  EXPECT_EQ(stats.num_coords, 0);
+  EXPECT_GE(stats.start_ns, 0);
+  EXPECT_GE(stats.push_batch_ns, 0);
+  EXPECT_GE(stats.finish_ns, 0);
+
+  kernel.release(&kernel);
+  EXPECT_EQ(kernel.release, nullptr);
+
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestStatisticsAsGeoArrow) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowStatistics stats;
+
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array_in, &schema_in, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array_in), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array_in, ArrowCharView("LINESTRING (0 1, 2 3)")),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array_in, 1), GEOARROW_OK);
+  ASSERT_EQ(
+      ArrowArrayAppendString(&array_in, ArrowCharView("LINESTRING (4 5, 6 7, 8 9)")),
+      GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array_in, nullptr), GEOARROW_OK);
+  int64_t wkt_bytes = 1 + 4 * sizeof(int32_t) + 21 + 26;
+
+  struct ArrowBuffer buffer;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  ASSERT_EQ(
+      ArrowMetadataBuilderAppend(&buffer, ArrowCharView("type"), ArrowCharView("2")),
+      GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, reinterpret_cast<char*>(buffer.data),
+                         &schema_out, &error),
+            GEOARROW_OK);
+
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  EXPECT_EQ(array_out.length, 3);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.finish(&kernel, nullptr, &error), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_batches, 2);
+  EXPECT_EQ(stats.num_features, 6);
+  EXPECT_EQ(stats.num_null_features, 2);
+  EXPECT_EQ(stats.num_coords, 10);
+  EXPECT_EQ(stats.bytes_read, 2 * wkt_bytes);
+  // validity + offsets (4 int32s) + 5 xy coordinates, twice
+  EXPECT_EQ(stats.bytes_written, 2 * (1 + 4 * 4 + 5 * 2 * 8));
+  EXPECT_GT(stats.num_reallocations, 0);
+
+  kernel.release(&kernel);
+  EXPECT_EQ(kernel.release, nullptr);
+
+  ArrowBufferReset(&buffer);
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestStatisticsFormatWKT) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowStatistics stats;
+
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array_in, &schema_in, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array_in), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array_in, ArrowCharView("POINT (30 10)")),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array_in, 1), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array_in, nullptr), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "format_wkt", nullptr), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.finish(&kernel, nullptr, &error), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_batches, 1);
+  EXPECT_EQ(stats.num_features, 2);
+  EXPECT_EQ(stats.num_null_features, 1);
+  EXPECT_EQ(stats.num_coords, 1);
+  // validity + offsets (3 int32s) + "POINT (30 10)"
+  EXPECT_EQ(stats.bytes_written, 1 + 3 * 4 + 13);
+  EXPECT_GT(stats.num_reallocations, 0);
+
+  kernel.release(&kernel);
+  EXPECT_EQ(kernel.release, nullptr);
+
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+}
+
+// Runs tasks sequentially, counting calls
+static void CountingParallelFor(struct GeoArrowExecutor* executor, int64_t n_tasks,
+                                void (*task)(void* task_data, int64_t i),
+                                void* task_data) {
+  for (int64_t i = 0; i < n_tasks; i++) {
+    task(task_data, i);
+  }
+
+  (*reinterpret_cast<int64_t*>(executor->private_data))++;
+}
+
+static std::vector<std::string> FormatWKTKernel(struct ArrowSchema* schema_in,
+                                                struct ArrowArray* array_in,
+                                                const std::string& n_tasks,
+                                                struct GeoArrowExecutor* executor,
+                                                struct GeoArrowStatistics* stats) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_out;
+  std::vector<std::string> out;
+
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("precision"),
+                                       ArrowCharView("1")),
+            GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("max_element_size_bytes"),
+                                       ArrowCharView("16")),
+            GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("n_tasks"),
+                                       ArrowCharView(n_tasks.c_str())),
+            GEOARROW_OK);
+
+  EXPECT_EQ(GeoArrowKernelInit(&kernel, "format_wkt", nullptr), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  if (executor != nullptr) {
+    EXPECT_EQ(GeoArrowKernelSetExecutor(&kernel, executor), GEOARROW_OK);
+  }
+
+  EXPECT_EQ(kernel.start(&kernel, schema_in, reinterpret_cast<char*>(buffer.data),
+                         &schema_out, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(kernel.push_batch(&kernel, array_in, &array_out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(GeoArrowKernelGetStatistics(&kernel, stats), GEOARROW_OK);
+  kernel.release(&kernel);
+  ArrowBufferReset(&buffer);
+
+  struct ArrowArrayView array_view;
+  EXPECT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema_out, nullptr),
+            GEOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewSetArray(&array_view, &array_out, nullptr), GEOARROW_OK);
+  for (int64_t i = 0; i < array_out.length; i++) {
+    if (ArrowArrayViewIsNull(&array_view, i)) {
+      out.push_back("<null value>");
+    } else {
+      struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(&array_view, i);
+      out.push_back(std::string(item.data, item.size_bytes));
+    }
+  }
+
+  ArrowArrayViewReset(&array_view);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+  return out;
+}
+
+TEST(KernelTest, KernelTestFormatWKTTasks) {
+  struct ArrowSchema schema_in;
+  struct ArrowArray array_in;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array_in, &schema_in, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array_in), GEOARROW_OK);
+  for (int i = 0; i < 30; i++) {
+    if (i % 4 == 1) {
+      ASSERT_EQ(ArrowArrayAppendNull(&array_in, 1), GEOARROW_OK);
+    } else {
+      std::string wkt = "LINESTRING (" + std::to_string(i) + ".25 1, 2 3, 4 5)";
+      ASSERT_EQ(ArrowArrayAppendString(&array_in, ArrowCharView(wkt.c_str())),
+                GEOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array_in, nullptr), GEOARROW_OK);
+
+  struct GeoArrowStatistics stats_sequential;
+  std::vector<std::string> expected =
+      FormatWKTKernel(&schema_in, &array_in, "1", nullptr, &stats_sequential);
+  ASSERT_EQ(expected.size(), 30);
+  EXPECT_EQ(expected[0], "LINESTRING (0.2 ");
+  EXPECT_EQ(expected[1], "<null value>");
+
+  // Ranges are formatted sequentially without an executor
+  struct GeoArrowStatistics stats;
+  EXPECT_EQ(FormatWKTKernel(&schema_in, &array_in, "4", nullptr, &stats), expected);
+
+  int64_t n_calls = 0;
+  struct GeoArrowExecutor executor;
+  executor.parallel_for = &CountingParallelFor;
+  executor.private_data = &n_calls;
+  EXPECT_EQ(FormatWKTKernel(&schema_in, &array_in, "4", &executor, &stats), expected);
+  // One call to format the ranges and one call to stitch them
+  EXPECT_EQ(n_calls, 2);
+
+  EXPECT_EQ(stats.num_batches, 1);
+  EXPECT_EQ(stats.num_features, stats_sequential.num_features);
+  EXPECT_EQ(stats.num_null_features, stats_sequential.num_null_features);
+  EXPECT_EQ(stats.bytes_written, stats_sequential.bytes_written);
+
+  // Kernels that can't use an executor
+  struct GeoArrowKernel kernel;
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "void", nullptr), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowKernelSetExecutor(&kernel, &executor), EINVAL);
+  kernel.release(&kernel);
+
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestStatisticsAsGeoArrowNativeToWKB) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowStatistics stats;
+
+  struct ArrowSchema schema_wkt;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_wkt;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_wkt, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(&array_wkt, &schema_wkt, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&array_wkt), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(&array_wkt, ArrowCharView("LINESTRING (0 1, 2 3)")),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(&array_wkt, 1), GEOARROW_OK);
+  ASSERT_EQ(
+      ArrowArrayAppendString(&array_wkt, ArrowCharView("LINESTRING (4 5, 6 7, 8 9)")),
+      GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array_wkt, nullptr), GEOARROW_OK);
+
+  // Convert to a native linestring array first
+  struct ArrowBuffer buffer;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  ASSERT_EQ(
+      ArrowMetadataBuilderAppend(&buffer, ArrowCharView("type"), ArrowCharView("2")),
+      GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_wkt, reinterpret_cast<char*>(buffer.data),
+                         &schema_in, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_wkt, &array_in, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+  ArrowBufferReset(&buffer);
+
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("type"),
+                                       ArrowCharView("100001")),
+            GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, reinterpret_cast<char*>(buffer.data),
+                         &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  EXPECT_EQ(array_out.length, 3);
+  array_out.release(&array_out);
+  ASSERT_EQ(kernel.finish(&kernel, nullptr, &error), GEOARROW_OK);
+
+  // The size of the output is computed before visiting, so the offsets and values
+  // are allocated exactly once (plus the validity buffer on the first null)
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_reallocations, 3);
+  // validity + offsets (4 int32s) + two linestring headers with 5 xy coordinates
+  EXPECT_EQ(stats.bytes_written, 1 + 4 * 4 + 2 * 9 + 5 * 2 * 8);
+
+  kernel.release(&kernel);
+
+  ArrowBufferReset(&buffer);
+  schema_wkt.release(&schema_wkt);
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_wkt.release(&array_wkt);
+  array_in.release(&array_in);
+}
+
+static void MakeWKTStream(struct ArrowArrayStream* stream,
+                          std::vector<std::vector<std::string>> batches) {
+  struct ArrowSchema schema;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema, GEOARROW_TYPE_WKT), GEOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowBasicArrayStreamInit(stream, &schema, batches.size()), GEOARROW_OK);
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array, NANOARROW_TYPE_STRING), GEOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array), GEOARROW_OK);
+    for (const auto& item : batches[i]) {
+      ASSERT_EQ(ArrowArrayAppendString(&array, ArrowCharView(item.c_str())),
+                GEOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array, nullptr), GEOARROW_OK);
+    ArrowBasicArrayStreamSetArray(stream, i, &array);
+  }
+}
+
+TEST(KernelTest, KernelTestStreamPipeline) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream native;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"POINT (0 1)", "POINT (2 3)"}, {"POINT (4 5)"}});
+
+  struct ArrowBuffer buffer;
+  ASSERT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("type"),
+                                       ArrowCharView("1")),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native, &input, "as_geoarrow",
+                                     reinterpret_cast<const char*>(buffer.data), &error),
+            GEOARROW_OK);
+  // The options are copied by the stream
+  ArrowBufferReset(&buffer);
+  EXPECT_EQ(input.release, nullptr);
+
+  ASSERT_EQ(GeoArrowKernelStreamInit(&output, &native, "format_wkt", nullptr, &error),
+            GEOARROW_OK);
+
+  struct ArrowSchema schema;
+  ASSERT_EQ(output.get_schema(&output, &schema), GEOARROW_OK);
+  EXPECT_STREQ(schema.format, "u");
+  schema.release(&schema);
+
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView item;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_NE(array.release, nullptr);
+  ASSERT_EQ(array.length, 2);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "POINT (2 3)");
+  array.release(&array);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_NE(array.release, nullptr);
+  ASSERT_EQ(array.length, 1);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "POINT (4 5)");
+  array.release(&array);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  ArrowArrayViewReset(&array_view);
+  output.release(&output);
+}
+
+TEST(KernelTest, KernelTestStreamAgg) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"POINT (0 1)"}, {}, {"LINESTRING (2 3, 4 5)"}});
+  ASSERT_EQ(GeoArrowKernelStreamInit(&output, &input, "box_agg", nullptr, &error),
+            GEOARROW_OK);
+
+  // get_next() without get_schema() starts the kernel
+  struct ArrowArray array;
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_NE(array.release, nullptr);
+  ASSERT_EQ(array.length, 1);
+  ASSERT_EQ(array.n_children, 4);
+  EXPECT_EQ(reinterpret_cast<const double*>(array.children[0]->buffers[1])[0], 0);
+  EXPECT_EQ(reinterpret_cast<const double*>(array.children[1]->buffers[1])[0], 1);
+  EXPECT_EQ(reinterpret_cast<const double*>(array.children[2]->buffers[1])[0], 4);
+  EXPECT_EQ(reinterpret_cast<const double*>(array.children[3]->buffers[1])[0], 5);
+  array.release(&array);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  EXPECT_EQ(array.release, nullptr);
+
+  output.release(&output);
+}
+
+TEST(KernelTest, KernelTestStreamErrors) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"POINT (0 1)"}});
+
+  // Invalid kernel names leave the input untouched
+  EXPECT_EQ(GeoArrowKernelStreamInit(&output, &input, "not_a_kernel", nullptr, &error),
+            ENOTSUP);
+  ASSERT_NE(input.release, nullptr);
+
+  // Errors from start() surface when the stream is first consumed and are sticky
+  ASSERT_EQ(GeoArrowKernelStreamInit(&output, &input, "as_geoarrow", nullptr, &error),
+            GEOARROW_OK);
+
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  EXPECT_EQ(output.get_schema(&output, &schema), EINVAL);
+  EXPECT_STREQ(output.get_last_error(&output), "Missing required parameter 'type'");
+  EXPECT_EQ(output.get_next(&output, &array), EINVAL);
+  EXPECT_STREQ(output.get_last_error(&output), "Missing required parameter 'type'");
+
+  output.release(&output);
+}
+
+static std::string KernelTypeOption(enum GeoArrowType type) {
+  struct ArrowBuffer buffer;
+  std::string type_str = std::to_string(static_cast<int>(type));
+  EXPECT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("type"),
+                                       ArrowCharView(type_str.c_str())),
+            GEOARROW_OK);
+  std::string out(reinterpret_cast<char*>(buffer.data), buffer.size_bytes);
+  ArrowBufferReset(&buffer);
+  return out;
+}
+
+TEST(KernelTest, KernelTestAsGeoArrowFloat) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream native;
+  struct ArrowArrayStream native_float;
+  struct ArrowArrayStream native_double;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"LINESTRING (0 1, 2.5 3)", "LINESTRING EMPTY"},
+                         {"LINESTRING (4 5, 6 7, 8 9)"}});
+
+  // WKT -> double -> float (cast directly) -> double (cast directly) -> WKT
+  std::string options = KernelTypeOption(GEOARROW_TYPE_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native, &input, "as_geoarrow", options.data(),
+                                     &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_FLOAT_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native_float, &native, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native_double, &native_float, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowKernelStreamInit(&output, &native_double, "format_wkt", nullptr, &error),
+      GEOARROW_OK);
+
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView item;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 2);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "LINESTRING (0 1, 2.5 3)");
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "LINESTRING EMPTY");
+  array.release(&array);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 1);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "LINESTRING (4 5, 6 7, 8 9)");
+  array.release(&array);
+
+  ArrowArrayViewReset(&array_view);
+  output.release(&output);
+}
+
+TEST(KernelTest, KernelTestAsGeoArrowTranspose) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream native;
+  struct ArrowArrayStream interleaved;
+  struct ArrowArrayStream separated;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"POLYGON Z ((0 1 2, 3 4 5, 6 7 8, 0 1 2))", "POLYGON Z EMPTY"},
+                         {"POLYGON Z ((10 11 12, 13 14 15, 16 17 18, 10 11 12))"}});
+
+  // WKT -> separated -> interleaved (transposed directly) -> separated (transposed
+  // directly) -> WKT
+  std::string options = KernelTypeOption(GEOARROW_TYPE_POLYGON_Z);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native, &input, "as_geoarrow", options.data(),
+                                     &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_INTERLEAVED_POLYGON_Z);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&interleaved, &native, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_POLYGON_Z);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&separated, &interleaved, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&output, &separated, "format_wkt", nullptr, &error),
+            GEOARROW_OK);
+
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView item;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 2);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes),
+            "POLYGON Z ((0 1 2, 3 4 5, 6 7 8, 0 1 2))");
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "POLYGON Z EMPTY");
+  array.release(&array);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 1);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes),
+            "POLYGON Z ((10 11 12, 13 14 15, 16 17 18, 10 11 12))");
+  array.release(&array);
+
+  ArrowArrayViewReset(&array_view);
+  output.release(&output);
+}
+
+TEST(KernelTest, KernelTestAsGeoArrowProjectDimensions) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream native;
+  struct ArrowArrayStream native_m;
+  struct ArrowArrayStream interleaved;
+  struct ArrowArrayStream interleaved_xy;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"LINESTRING ZM (0 1 2 3, 4 5 6 7)", "LINESTRING ZM EMPTY"}});
+
+  // WKT -> XYZM -> XYM (projected directly) -> interleaved XYM -> interleaved XY
+  // (projected directly) -> WKT
+  std::string options = KernelTypeOption(GEOARROW_TYPE_LINESTRING_ZM);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native, &input, "as_geoarrow", options.data(),
+                                     &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_LINESTRING_M);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native_m, &native, "as_geoarrow", options.data(),
+                                     &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_INTERLEAVED_LINESTRING_M);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&interleaved, &native_m, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  options = KernelTypeOption(GEOARROW_TYPE_INTERLEAVED_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&interleaved_xy, &interleaved, "as_geoarrow",
+                                     options.data(), &error),
+            GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowKernelStreamInit(&output, &interleaved_xy, "format_wkt", nullptr, &error),
+      GEOARROW_OK);
+
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView item;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 2);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "LINESTRING (0 1, 4 5)");
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 1);
+  EXPECT_EQ(std::string(item.data, item.size_bytes), "LINESTRING EMPTY");
+  array.release(&array);
+
+  ArrowArrayViewReset(&array_view);
+  output.release(&output);
+}
+
+TEST(KernelTest, KernelTestAsGeoArrowFloatSliced) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  WKXTester tester;
+  struct GeoArrowNativeWriter writer;
+  struct GeoArrowVisitor v;
+  ASSERT_EQ(GeoArrowNativeWriterInit(&writer, GEOARROW_TYPE_INTERLEAVED_LINESTRING),
+            GEOARROW_OK);
+  GeoArrowNativeWriterInitVisitor(&writer, &v);
+  tester.ReadWKT("LINESTRING (0 1, 2 3)", &v);
+  tester.ReadWKT("LINESTRING (4 5, 6 7)", &v);
+  ASSERT_EQ(GeoArrowNativeWriterFinish(&writer, &array_in, &error), GEOARROW_OK);
+  GeoArrowNativeWriterReset(&writer);
+
+  // A sliced input can't be cast directly and falls back to the visitor
+  array_in.offset = 1;
+  array_in.length = 1;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_INTERLEAVED_LINESTRING),
+            GEOARROW_OK);
+  std::string options = KernelTypeOption(GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromSchema(&array_view, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(array_view.coords.n_coords, 2);
+  EXPECT_EQ(array_view.coords_float.values[0][0], 4);
+  EXPECT_EQ(array_view.coords_float.values[1][0], 5);
+  EXPECT_EQ(array_view.coords_float.values[0][2], 6);
+  EXPECT_EQ(array_view.coords_float.values[1][2], 7);
+
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+  array_out.release(&array_out);
+}
+
+TEST(KernelTest, KernelTestAsGeoArrowInt32) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_int32;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_int32;
+  struct ArrowArray array_out;
+
+  WKXTester tester;
+  struct GeoArrowNativeWriter writer;
+  struct GeoArrowVisitor v;
+  ASSERT_EQ(GeoArrowNativeWriterInit(&writer, GEOARROW_TYPE_LINESTRING), GEOARROW_OK);
+  GeoArrowNativeWriterInitVisitor(&writer, &v);
+  tester.ReadWKT("LINESTRING (0 1, 2.5 -3)", &v);
+  tester.ReadWKT("LINESTRING (4 5.5, 6 7, 8 9)", &v);
+  ASSERT_EQ(GeoArrowNativeWriterFinish(&writer, &array_in, &error), GEOARROW_OK);
+  GeoArrowNativeWriterReset(&writer);
+
+  // The quantization parameters travel with the input's extension metadata
+  struct GeoArrowMetadataView metadata;
+  ASSERT_EQ(GeoArrowMetadataViewInit(&metadata, {nullptr, 0}, &error), GEOARROW_OK);
+  metadata.quantization.scale[0] = 0.5;
+  metadata.quantization.scale[1] = 0.5;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowSchemaSetMetadata(&schema_in, &metadata), GEOARROW_OK);
+
+  // double -> int32 (quantized directly)
+  std::string options = KernelTypeOption(GEOARROW_TYPE_INT32_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_int32, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_int32, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromSchema(&array_view, &schema_int32, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(array_view.quantization.scale[0], 0.5);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_int32, &error), GEOARROW_OK);
+  ASSERT_EQ(array_view.coords.n_coords, 5);
+  EXPECT_EQ(array_view.coords_int32.values[0][1], 5);
+  EXPECT_EQ(array_view.coords_int32.values[1][1], -6);
+  EXPECT_EQ(array_view.coords_int32.values[1][2], 11);
+
+  // int32 -> double (dequantized directly)
+  options = KernelTypeOption(GEOARROW_TYPE_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_int32, options.data(), &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_int32, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(GeoArrowArrayViewInitFromSchema(&array_view, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(array_view.coords.n_coords, 5);
+  EXPECT_EQ(array_view.coords.values[0][1], 2.5);
+  EXPECT_EQ(array_view.coords.values[1][1], -3);
+  EXPECT_EQ(array_view.coords.values[1][2], 5.5);
+
+  // Visiting an int32 array decodes the coordinates
+  ASSERT_EQ(GeoArrowArrayViewInitFromSchema(&array_view, &schema_int32, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_int32, &error), GEOARROW_OK);
+  WKXTester output_tester;
+  ASSERT_EQ(
+      GeoArrowArrayViewVisitNative(&array_view, 0, 2, output_tester.WKTVisitor()),
+      GEOARROW_OK);
+  auto values = output_tester.WKTValues("<null value>");
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], "LINESTRING (0 1, 2.5 -3)");
+  EXPECT_EQ(values[1], "LINESTRING (4 5.5, 6 7, 8 9)");
+
+  schema_in.release(&schema_in);
+  schema_int32.release(&schema_int32);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+  array_int32.release(&array_int32);
+  array_out.release(&array_out);
+}
+
+TEST(KernelTest, KernelTestCollectAgg) {
+  struct GeoArrowError error;
+  struct ArrowArrayStream input;
+  struct ArrowArrayStream native;
+  struct ArrowArrayStream collected;
+  struct ArrowArrayStream output;
+
+  MakeWKTStream(&input, {{"LINESTRING (0 1, 2 3)"},
+                         {"LINESTRING EMPTY", "LINESTRING (4 5, 6 7, 8 9)"}});
+
+  std::string options = KernelTypeOption(GEOARROW_TYPE_INTERLEAVED_LINESTRING);
+  ASSERT_EQ(GeoArrowKernelStreamInit(&native, &input, "as_geoarrow", options.data(),
+                                     &error),
+            GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowKernelStreamInit(&collected, &native, "collect_agg", nullptr, &error),
+      GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowKernelStreamInit(&output, &collected, "format_wkt", nullptr, &error),
+      GEOARROW_OK);
+
+  struct ArrowArray array;
+  struct ArrowArrayView array_view;
+  struct ArrowStringView item;
+  ArrowArrayViewInitFromType(&array_view, NANOARROW_TYPE_STRING);
+
+  ASSERT_EQ(output.get_next(&output, &array), GEOARROW_OK);
+  ASSERT_EQ(array.length, 1);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+  item = ArrowArrayViewGetStringUnsafe(&array_view, 0);
+  EXPECT_EQ(std::string(item.data, item.size_bytes),
+            "MULTILINESTRING ((0 1, 2 3), EMPTY, (4 5, 6 7, 8 9))");
+  array.release(&array);
+
+  ArrowArrayViewReset(&array_view);
+  output.release(&output);
+
+  // Only point, linestring, and polygon input can be collected
+  struct GeoArrowKernel kernel;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "collect_agg", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't collect type 100003");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+}
+
+// Runs a measure kernel on one batch and flattens its output. Null items are NaN
+// and centroids are appended as x, y pairs.
+static void MeasureKernel(const std::string& name, struct ArrowSchema* schema_in,
+                          struct ArrowArray* array_in, std::vector<double>* values,
+                          std::vector<bool>* is_null,
+                          struct GeoArrowStatistics* stats = nullptr) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, name.c_str(), nullptr), GEOARROW_OK);
+  if (stats != nullptr) {
+    ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  }
+
+  ASSERT_EQ(kernel.start(&kernel, schema_in, nullptr, &schema_out, &error), GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(kernel.push_batch(&kernel, array_in, &array_out, &error), GEOARROW_OK)
+      << error.message;
+  if (stats != nullptr) {
+    ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, stats), GEOARROW_OK);
+  }
+
+  kernel.release(&kernel);
+
+  ASSERT_EQ(array_out.length, array_in->length);
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema_out, nullptr),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array_out, nullptr), GEOARROW_OK);
+
+  values->clear();
+  is_null->clear();
+  for (int64_t i = 0; i < array_out.length; i++) {
+    is_null->push_back(ArrowArrayViewIsNull(&array_view, i));
+    if (array_view.n_children == 2) {
+      values->push_back(ArrowArrayViewGetDoubleUnsafe(array_view.children[0], i));
+      values->push_back(ArrowArrayViewGetDoubleUnsafe(array_view.children[1], i));
+    } else {
+      values->push_back(ArrowArrayViewGetDoubleUnsafe(&array_view, i));
+    }
+  }
+
+  ArrowArrayViewReset(&array_view);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+}
+
+static void MakeWKTArray(struct ArrowSchema* schema, struct ArrowArray* array,
+                         const std::vector<std::string>& wkt) {
+  ASSERT_EQ(GeoArrowSchemaInitExtension(schema, GEOARROW_TYPE_WKT), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), GEOARROW_OK);
+  for (const auto& item : wkt) {
+    if (item.empty()) {
+      ASSERT_EQ(ArrowArrayAppendNull(array, 1), GEOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendString(array, ArrowCharView(item.c_str())), GEOARROW_OK);
+    }
+  }
+
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), GEOARROW_OK);
+}
+
+TEST(KernelTest, KernelTestMeasure) {
+  struct ArrowSchema schema_in;
+  struct ArrowArray array_in;
+  MakeWKTArray(&schema_in, &array_in,
+               {"POINT (1 2)", "LINESTRING (0 0, 3 4)",
+                "POLYGON ((0 0, 4 0, 4 4, 0 4, 0 0), (1 1, 1 2, 2 2, 2 1, 1 1))",
+                "MULTIPOINT (0 0, 2 4)", "MULTILINESTRING ((0 0, 1 0), (0 1, 0 3))",
+                "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 1, 0 0)), ((2 0, 2 1, 3 1, 3 0, 2 0)))",
+                "GEOMETRYCOLLECTION (POINT (10 10), LINESTRING (0 0, 0 2))",
+                "LINESTRING EMPTY", ""});
+
+  std::vector<double> values;
+  std::vector<bool> is_null;
+  std::vector<bool> expected_null = {false, false, false, false, false,
+                                     false, false, false, true};
+
+  MeasureKernel("length", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, expected_null);
+  values.pop_back();
+  EXPECT_EQ(values, std::vector<double>({0, 5, 20, 0, 3, 8, 2, 0}));
+
+  MeasureKernel("area", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, expected_null);
+  values.pop_back();
+  EXPECT_EQ(values, std::vector<double>({0, 0, 15, 0, 0, 2, 0, 0}));
+
+  MeasureKernel("num_coords", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, expected_null);
+  values.pop_back();
+  EXPECT_EQ(values, std::vector<double>({1, 2, 10, 2, 4, 10, 3, 0}));
+
+  MeasureKernel("num_parts", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, expected_null);
+  values.pop_back();
+  EXPECT_EQ(values, std::vector<double>({1, 1, 1, 2, 2, 2, 2, 0}));
+
+  MeasureKernel("centroid", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, expected_null);
+  std::vector<double> expected_centroid = {
+      1, 2, 1.5, 2, 30.5 / 15, 30.5 / 15, 1, 2, 0.5 / 3, 4.0 / 3, 1.5, 0.5, 0, 1};
+  for (size_t i = 0; i < expected_centroid.size(); i++) {
+    EXPECT_DOUBLE_EQ(values[i], expected_centroid[i]) << "value " << i;
+  }
+
+  EXPECT_TRUE(std::isnan(values[14]));
+  EXPECT_TRUE(std::isnan(values[15]));
+
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestMeasureNative) {
+  // Check that measures of native arrays (computed directly from buffers) are
+  // identical to those computed by visiting the same features as well-known text,
+  // including for sliced input
+  std::vector<std::pair<enum GeoArrowType, std::vector<std::string>>> cases = {
+      {GEOARROW_TYPE_POINT, {"POINT (0 1)", "", "POINT (2 3)", "POINT (4 5)"}},
+      {GEOARROW_TYPE_INTERLEAVED_LINESTRING,
+       {"LINESTRING (0 0, 1 1)", "", "LINESTRING EMPTY", "LINESTRING (0 0, 3 4, 3 0)"}},
+      {GEOARROW_TYPE_POLYGON,
+       {"POLYGON ((0 0, 1 0, 0 1, 0 0))", "",
+        "POLYGON ((0 0, 0 4, 4 4, 4 0, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        "POLYGON ((100 100, 101 100, 101 102, 100 100))"}},
+      {GEOARROW_TYPE_MULTIPOINT,
+       {"MULTIPOINT (0 0, 1 1)", "", "MULTIPOINT EMPTY", "MULTIPOINT (0 0, 3 4, 3 0)"}},
+      {GEOARROW_TYPE_MULTILINESTRING,
+       {"MULTILINESTRING ((0 0, 1 1))", "", "MULTILINESTRING ((0 0, 1 1), (2 2, 2 2))",
+        "MULTILINESTRING ((0 0, 3 4), (1 1, 1 2))"}},
+      {GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON,
+       {"MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))", "", "MULTIPOLYGON EMPTY",
+        "MULTIPOLYGON (((0 0, 0 4, 4 4, 4 0, 0 0), (1 1, 2 1, 2 2, 1 1)), "
+        "((10 10, 11 10, 11 11, 10 10)))"}}};
+
+  std::vector<std::string> kernels = {"length", "area", "centroid", "num_coords",
+                                      "num_parts"};
+
+  for (const auto& item : cases) {
+    SCOPED_TRACE(item.second[0]);
+    struct GeoArrowKernel kernel;
+    struct GeoArrowError error;
+    struct ArrowSchema schema_wkt;
+    struct ArrowArray array_wkt;
+    struct ArrowSchema schema_native;
+    struct ArrowArray array_native;
+    MakeWKTArray(&schema_wkt, &array_wkt, item.second);
+
+    std::string options = KernelTypeOption(item.first);
+    ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+    ASSERT_EQ(kernel.start(&kernel, &schema_wkt, options.data(), &schema_native, &error),
+              GEOARROW_OK);
+    ASSERT_EQ(kernel.push_batch(&kernel, &array_wkt, &array_native, &error),
+              GEOARROW_OK);
+    kernel.release(&kernel);
+
+    // Slice off the first element of both
+    array_wkt.offset = 1;
+    array_wkt.length--;
+    array_wkt.null_count = -1;
+    array_native.offset = 1;
+    array_native.length--;
+    array_native.null_count = -1;
+
+    for (const auto& name : kernels) {
+      SCOPED_TRACE(name);
+      std::vector<double> values_wkt, values_native;
+      std::vector<bool> is_null_wkt, is_null_native;
+      struct GeoArrowStatistics stats;
+      MeasureKernel(name, &schema_wkt, &array_wkt, &values_wkt, &is_null_wkt);
+      MeasureKernel(name, &schema_native, &array_native, &values_native,
+                    &is_null_native, &stats);
+      EXPECT_EQ(is_null_native, is_null_wkt);
+      EXPECT_EQ(stats.num_features, 3);
+      EXPECT_EQ(stats.num_null_features, 1);
+      ASSERT_EQ(values_native.size(), values_wkt.size());
+      for (size_t i = 0; i < values_wkt.size(); i++) {
+        if (std::isnan(values_wkt[i])) {
+          EXPECT_TRUE(std::isnan(values_native[i])) << "value " << i;
+        } else {
+          EXPECT_DOUBLE_EQ(values_native[i], values_wkt[i]) << "value " << i;
+        }
+      }
+    }
+
+    schema_wkt.release(&schema_wkt);
+    array_wkt.release(&array_wkt);
+    schema_native.release(&schema_native);
+    array_native.release(&array_native);
+  }
+}
+
+static std::vector<int32_t> UniqueGeometryTypes(
+    struct ArrowSchema* schema, struct ArrowArray* array,
+    struct GeoArrowStatistics* stats = nullptr) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_out;
+  std::vector<int32_t> out;
+
+  EXPECT_EQ(GeoArrowKernelInit(&kernel, "unique_geometry_types_agg", nullptr),
+            GEOARROW_OK);
+  if (stats != nullptr) {
+    EXPECT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  }
+
+  EXPECT_EQ(kernel.start(&kernel, schema, nullptr, &schema_out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(kernel.push_batch(&kernel, array, nullptr, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(kernel.finish(&kernel, &array_out, &error), GEOARROW_OK);
+  if (stats != nullptr) {
+    EXPECT_EQ(GeoArrowKernelGetStatistics(&kernel, stats), GEOARROW_OK);
+  }
+
+  kernel.release(&kernel);
+
+  const int32_t* values = reinterpret_cast<const int32_t*>(array_out.buffers[1]);
+  out.assign(values, values + array_out.length);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+  return out;
+}
+
+TEST(KernelTest, KernelTestScanWKB) {
+  // Check that kernels that only read the headers of WKB input give identical
+  // results to visiting the same features as well-known text, including for
+  // sliced input
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_wkt;
+  struct ArrowArray array_wkt;
+  struct ArrowSchema schema_wkb;
+  struct ArrowArray array_wkb;
+  MakeWKTArray(&schema_wkt, &array_wkt,
+               {"POINT (0 1)", "", "POINT Z (30 10 1)",
+                "LINESTRING Z (30 10 1, 0 0 2)", "LINESTRING M EMPTY",
+                "POLYGON ((0 0, 1 0, 0 1, 0 0), (0 0, 1 1, 0 0))",
+                "MULTIPOINT ZM (0 0 0 0, 1 1 1 1)", "MULTILINESTRING (EMPTY, (0 0, 1 1))",
+                "MULTIPOLYGON M (((0 0 0, 1 0 0, 0 1 0, 0 0 0)))",
+                "GEOMETRYCOLLECTION (POINT (0 1), GEOMETRYCOLLECTION (LINESTRING (0 0, "
+                "1 1), POLYGON ((0 0, 1 0, 0 1, 0 0))))",
+                "GEOMETRYCOLLECTION EMPTY", "", "MULTIPOLYGON EMPTY"});
+
+  std::string options = KernelTypeOption(GEOARROW_TYPE_WKB);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_wkt, options.data(), &schema_wkb, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_wkt, &array_wkb, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  // Slice off the first element of both
+  array_wkt.offset = 1;
+  array_wkt.length--;
+  array_wkt.null_count = -1;
+  array_wkb.offset = 1;
+  array_wkb.length--;
+  array_wkb.null_count = -1;
+
+  for (const auto& name : {"num_coords", "num_parts"}) {
+    SCOPED_TRACE(name);
+    std::vector<double> values_wkt, values_wkb;
+    std::vector<bool> is_null_wkt, is_null_wkb;
+    struct GeoArrowStatistics stats;
+    MeasureKernel(name, &schema_wkt, &array_wkt, &values_wkt, &is_null_wkt);
+    MeasureKernel(name, &schema_wkb, &array_wkb, &values_wkb, &is_null_wkb, &stats);
+    EXPECT_EQ(is_null_wkb, is_null_wkt);
+    EXPECT_EQ(stats.num_features, 12);
+    EXPECT_EQ(stats.num_null_features, 2);
+    EXPECT_EQ(values_wkb, values_wkt);
+  }
+
+  std::vector<int32_t> types_wkt = UniqueGeometryTypes(&schema_wkt, &array_wkt);
+  EXPECT_EQ(types_wkt, std::vector<int32_t>({3, 5, 7, 1001, 1002, 2006, 3004}));
+  struct GeoArrowStatistics stats;
+  EXPECT_EQ(UniqueGeometryTypes(&schema_wkb, &array_wkb, &stats), types_wkt);
+  EXPECT_EQ(stats.num_batches, 1);
+  EXPECT_EQ(stats.num_features, 12);
+  EXPECT_EQ(stats.num_null_features, 2);
+  EXPECT_EQ(stats.num_coords, 25);
+
+  // Invalid WKB is reported with the same error as when it is visited
+  uint8_t* data = reinterpret_cast<uint8_t*>(const_cast<void*>(array_wkb.buffers[2]));
+  const int32_t* offsets = reinterpret_cast<const int32_t*>(array_wkb.buffers[1]);
+  data[offsets[5] + 1] = 0xff;
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "unique_geometry_types_agg", nullptr),
+            GEOARROW_OK);
+  struct ArrowSchema schema_out;
+  ASSERT_EQ(kernel.start(&kernel, &schema_wkb, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(kernel.push_batch(&kernel, &array_wkb, nullptr, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected valid geometry type code but found 255 at byte 1");
+  schema_out.release(&schema_out);
+  kernel.release(&kernel);
+
+  schema_wkt.release(&schema_wkt);
+  array_wkt.release(&array_wkt);
+  schema_wkb.release(&schema_wkb);
+  array_wkb.release(&array_wkb);
+}
+
+TEST(KernelTest, KernelTestMeasureErrors) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+
+  struct GeoArrowMetadataView metadata;
+  GeoArrowMetadataViewInit(&metadata, {nullptr, 0}, nullptr);
+  metadata.edge_type = GEOARROW_EDGE_TYPE_SPHERICAL;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKB), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowSchemaSetMetadata(&schema_in, &metadata), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "centroid", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), EINVAL);
+  EXPECT_STREQ(error.message, "centroid kernel does not support non-planar edges");
+  kernel.release(&kernel);
+
+  // Counts don't depend on the edge type
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "num_coords", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  schema_out.release(&schema_out);
+  kernel.release(&kernel);
+
+  schema_in.release(&schema_in);
+}
+
+static void SetEdgeType(struct ArrowSchema* schema, enum GeoArrowEdgeType edge_type) {
+  struct GeoArrowMetadataView metadata;
+  GeoArrowMetadataViewInit(&metadata, {nullptr, 0}, nullptr);
+  metadata.edge_type = edge_type;
+  ASSERT_EQ(GeoArrowSchemaSetMetadata(schema, &metadata), GEOARROW_OK);
+}
+
+TEST(KernelTest, KernelTestMeasureSpherical) {
+  const double pi = 3.14159265358979323846;
+  const double radius = 6371008.8;
+  const double authalic_radius = 6371007.180918476;
+
+  struct ArrowSchema schema_in;
+  struct ArrowArray array_in;
+  MakeWKTArray(&schema_in, &array_in,
+               {"LINESTRING (0 0, 90 0)", "POLYGON ((0 0, 90 0, 0 90, 0 0))",
+                "POLYGON ((0 0, 0 90, 90 0, 0 0))", ""});
+
+  std::vector<double> values;
+  std::vector<bool> is_null;
+
+  SetEdgeType(&schema_in, GEOARROW_EDGE_TYPE_SPHERICAL);
+  MeasureKernel("length", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(is_null, std::vector<bool>({false, false, false, true}));
+  EXPECT_DOUBLE_EQ(values[0], radius * pi / 2);
+  EXPECT_DOUBLE_EQ(values[1], 3 * radius * pi / 2);
+
+  // Each polygon is one octant of the sphere regardless of winding order
+  MeasureKernel("area", &schema_in, &array_in, &values, &is_null);
+  EXPECT_EQ(values[0], 0);
+  EXPECT_DOUBLE_EQ(values[1], pi * radius * radius / 2);
+  EXPECT_DOUBLE_EQ(values[2], pi * radius * radius / 2);
+
+  // Along the equator the geodesic is the equator of the ellipsoid (Vincenty's
+  // formula is accurate to within a millimeter)
+  SetEdgeType(&schema_in, GEOARROW_EDGE_TYPE_VINCENTY);
+  MeasureKernel("length", &schema_in, &array_in, &values, &is_null);
+  EXPECT_NEAR(values[0], 6378137.0 * pi / 2, 1e-3);
+
+  MeasureKernel("area", &schema_in, &array_in, &values, &is_null);
+  EXPECT_DOUBLE_EQ(values[1], pi * authalic_radius * authalic_radius / 2);
+
+  // Long edges at high latitudes, whose triangles with the first coordinate of the
+  // ring have an excess larger than pi (reference values from Girard's theorem)
+  struct ArrowSchema schema_polar;
+  struct ArrowArray array_polar;
+  MakeWKTArray(&schema_polar, &array_polar,
+               {"POLYGON ((0 45, 120 45, -120 45, 0 45))",
+                "POLYGON ((0 60, 90 60, 180 60, -90 60, 0 60))",
+                "POLYGON ((0 80, 120 80, -120 80, 0 80))",
+                "POLYGON ((0 80, -120 80, 120 80, 0 80))",
+                "POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0))"});
+  SetEdgeType(&schema_polar, GEOARROW_EDGE_TYPE_SPHERICAL);
+  MeasureKernel("area", &schema_polar, &array_polar, &values, &is_null);
+  ASSERT_EQ(values.size(), 5);
+  EXPECT_NEAR(values[0] / 39239030234854.98, 1, 1e-9);
+  EXPECT_NEAR(values[1] / 23273769734432.83, 1, 1e-9);
+  EXPECT_NEAR(values[2] / 1620543667663.734, 1, 1e-9);
+  EXPECT_NEAR(values[3] / 1620543667663.734, 1, 1e-9);
+  EXPECT_NEAR(values[4] / 12364031909.47, 1, 1e-9);
+
+  // The ellipsoid uses the same formula on the authalic sphere
+  SetEdgeType(&schema_polar, GEOARROW_EDGE_TYPE_VINCENTY);
+  MeasureKernel("area", &schema_polar, &array_polar, &values, &is_null);
+  ASSERT_EQ(values.size(), 5);
+  EXPECT_NEAR(values[0] / 39239030234854.98, 1, 1e-2);
+  EXPECT_NEAR(values[2] / 1620543667663.734, 1, 1e-2);
+
+  schema_polar.release(&schema_polar);
+  array_polar.release(&array_polar);
+
+  // Native input uses the same edges
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_native;
+  struct ArrowArray array_native;
+  std::vector<double> values_native;
+  SetEdgeType(&schema_in, GEOARROW_EDGE_TYPE_SPHERICAL);
+  std::string options = KernelTypeOption(GEOARROW_TYPE_MULTIPOLYGON);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_native, &error),
+            GEOARROW_OK);
+  array_in.offset = 1;
+  array_in.length = 2;
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_native, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  MeasureKernel("area", &schema_in, &array_in, &values, &is_null);
+  MeasureKernel("area", &schema_native, &array_native, &values_native, &is_null);
+  EXPECT_DOUBLE_EQ(values_native[0], values[0]);
+  EXPECT_DOUBLE_EQ(values_native[1], values[1]);
+  MeasureKernel("length", &schema_in, &array_in, &values, &is_null);
+  MeasureKernel("length", &schema_native, &array_native, &values_native, &is_null);
+  EXPECT_DOUBLE_EQ(values_native[0], values[0]);
+  EXPECT_DOUBLE_EQ(values_native[1], values[1]);
+
+  schema_native.release(&schema_native);
+  array_native.release(&array_native);
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestBoxSpherical) {
+  const double pi = 3.14159265358979323846;
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  MakeWKTArray(&schema_in, &array_in,
+               {"POINT (10 20)", "LINESTRING (170 10, -170 10)",
+                "MULTIPOINT (170 0, -170 0)", "POLYGON ((0 80, 120 80, -120 80, 0 80))",
+                "LINESTRING (0 0, 10 0, 20 0)"});
+  SetEdgeType(&schema_in, GEOARROW_EDGE_TYPE_SPHERICAL);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "box", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  struct ArrowArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema_out, nullptr),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array_out, nullptr), GEOARROW_OK);
+
+  // The output carries the edge type of the input
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema_out, &error), GEOARROW_OK);
+  struct GeoArrowMetadataView metadata;
+  ASSERT_EQ(GeoArrowMetadataViewInit(&metadata, schema_view.extension_metadata, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(metadata.edge_type, GEOARROW_EDGE_TYPE_SPHERICAL);
+
+  std::vector<std::vector<double>> boxes;
+  for (int64_t i = 0; i < array_out.length; i++) {
+    boxes.push_back({ArrowArrayViewGetDoubleUnsafe(array_view.children[0], i),
+                     ArrowArrayViewGetDoubleUnsafe(array_view.children[1], i),
+                     ArrowArrayViewGetDoubleUnsafe(array_view.children[2], i),
+                     ArrowArrayViewGetDoubleUnsafe(array_view.children[3], i)});
+  }
+
+  EXPECT_EQ(boxes[0], std::vector<double>({10, 20, 10, 20}));
+
+  // Crosses the antimeridian and bulges toward the north pole
+  double bulge = std::atan(std::tan(10 * pi / 180) / std::cos(10 * pi / 180)) * 180 / pi;
+  EXPECT_EQ(boxes[1][0], 170);
+  EXPECT_EQ(boxes[1][1], 10);
+  EXPECT_EQ(boxes[1][2], -170);
+  EXPECT_NEAR(boxes[1][3], bulge, 1e-9);
+
+  EXPECT_EQ(boxes[2], std::vector<double>({170, 0, -170, 0}));
+
+  // Winds around the north pole
+  EXPECT_EQ(boxes[3][0], -180);
+  EXPECT_EQ(boxes[3][1], 80);
+  EXPECT_EQ(boxes[3][2], 180);
+  EXPECT_EQ(boxes[3][3], 90);
+
+  // Along the equator
+  EXPECT_EQ(boxes[4][0], 0);
+  EXPECT_NEAR(boxes[4][1], 0, 1e-12);
+  EXPECT_EQ(boxes[4][2], 20);
+  EXPECT_NEAR(boxes[4][3], 0, 1e-12);
+
+  ArrowArrayViewReset(&array_view);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+
+  // The aggregate takes the smaller of the two possible longitude ranges
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "box_agg", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  array_in.offset = 1;
+  array_in.length = 2;
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, nullptr, &error), GEOARROW_OK);
+  ASSERT_EQ(kernel.finish(&kernel, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(&array_view, &schema_out, nullptr),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(&array_view, &array_out, nullptr), GEOARROW_OK);
+  ASSERT_EQ(array_out.length, 1);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[0], 0), 170);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[1], 0), 0);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.children[2], 0), -170);
+  EXPECT_NEAR(ArrowArrayViewGetDoubleUnsafe(array_view.children[3], 0), bulge, 1e-9);
+
+  ArrowArrayViewReset(&array_view);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+}
+
+static std::string KernelMatrixOption(const std::string& matrix) {
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("matrix"),
+                                       ArrowCharView(matrix.c_str())),
+            GEOARROW_OK);
+  std::string out(reinterpret_cast<char*>(buffer.data), buffer.size_bytes);
+  ArrowBufferReset(&buffer);
+  return out;
+}
+
+// Runs a scalar kernel on array_in and returns the output as WKT (keeping the
+// output schema in schema_out)
+static void TransformKernel(const std::string& name, const char* options,
+                            struct ArrowSchema* schema_in, struct ArrowArray* array_in,
+                            struct ArrowSchema* schema_out,
+                            std::vector<std::string>* wkt) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, name.c_str(), nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, schema_in, options, schema_out, &error), GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(kernel.push_batch(&kernel, array_in, &array_out, &error), GEOARROW_OK)
+      << error.message;
+  kernel.release(&kernel);
+
+  WKXTester tester;
+  struct GeoArrowArrayReader reader;
+  ASSERT_EQ(GeoArrowArrayReaderInitFromSchema(&reader, schema_out, &error), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayReaderSetArray(&reader, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowArrayReaderVisit(&reader, 0, array_out.length, tester.WKTVisitor()),
+      GEOARROW_OK);
+  GeoArrowArrayReaderReset(&reader);
+  array_out.release(&array_out);
+
+  *wkt = tester.WKTValues("<null value>");
+}
+
+TEST(KernelTest, KernelTestAffine) {
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  std::vector<std::string> wkt;
+
+  std::vector<std::string> wkt_in = {
+      "POINT Z (1 2 3)", "LINESTRING M (0 0 5, 1 1 6)",
+      "MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)), ((10 10, 11 10, 10 11, 10 10)))", "",
+      "GEOMETRYCOLLECTION (POINT (1 1), LINESTRING EMPTY)"};
+  std::vector<std::string> expected = {
+      "POINT Z (12 32 3)", "LINESTRING M (10 20 5, 12 26 6)",
+      "MULTIPOLYGON (((10 20, 12 20, 10 26, 10 20)), ((30 80, 32 80, 30 86, 30 80)))",
+      "<null value>", "GEOMETRYCOLLECTION (POINT (12 26), LINESTRING EMPTY)"};
+
+  // Serialized input is visited
+  std::string options = KernelMatrixOption("2, 0, 0, 6, 10, 20");
+  ASSERT_NO_FATAL_FAILURE(MakeWKTArray(&schema_in, &array_in, wkt_in));
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("affine", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt, expected);
+
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema_out, nullptr), GEOARROW_OK);
+  EXPECT_EQ(schema_view.type, GEOARROW_TYPE_WKT);
+  schema_out.release(&schema_out);
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+
+  // Native input with double coordinates only writes coordinates, including with a
+  // 12 parameter matrix that modifies Z
+  for (auto type : {GEOARROW_TYPE_LINESTRING_Z, GEOARROW_TYPE_INTERLEAVED_LINESTRING_Z}) {
+    SCOPED_TRACE(std::to_string(type));
+    WKXTester tester;
+    struct GeoArrowNativeWriter writer;
+    struct GeoArrowVisitor v;
+    ASSERT_EQ(GeoArrowNativeWriterInit(&writer, type), GEOARROW_OK);
+    GeoArrowNativeWriterInitVisitor(&writer, &v);
+    tester.ReadWKT("LINESTRING Z (0 1 2, 3 4 5)", &v);
+    tester.ReadNulls(1, &v);
+    tester.ReadWKT("LINESTRING Z (6 7 8, 9 10 11)", &v);
+    ASSERT_EQ(GeoArrowNativeWriterFinish(&writer, &array_in, nullptr), GEOARROW_OK);
+    GeoArrowNativeWriterReset(&writer);
+    ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, type), GEOARROW_OK);
+
+    options = KernelMatrixOption("1,0,0,0,1,0,0,0,-1,0,0,100");
+    ASSERT_NO_FATAL_FAILURE(TransformKernel("affine", options.data(), &schema_in,
+                                            &array_in, &schema_out, &wkt));
+    EXPECT_EQ(wkt, std::vector<std::string>({"LINESTRING Z (0 1 98, 3 4 95)",
+                                             "<null value>",
+                                             "LINESTRING Z (6 7 92, 9 10 89)"}));
+    schema_out.release(&schema_out);
+
+    // A sliced input falls back to the visitor
+    array_in.offset = 2;
+    array_in.length = 1;
+    ASSERT_NO_FATAL_FAILURE(TransformKernel("affine", options.data(), &schema_in,
+                                            &array_in, &schema_out, &wkt));
+    EXPECT_EQ(wkt, std::vector<std::string>({"LINESTRING Z (6 7 92, 9 10 89)"}));
+    schema_out.release(&schema_out);
+
+    schema_in.release(&schema_in);
+    array_in.release(&array_in);
+  }
+}
+
+TEST(KernelTest, KernelTestWebMercator) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowSchemaView schema_view;
+  struct GeoArrowMetadataView metadata_view;
+  struct GeoArrowArrayView array_view;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  WKXTester tester;
+  struct GeoArrowNativeWriter writer;
+  struct GeoArrowVisitor v;
+  ASSERT_EQ(GeoArrowNativeWriterInit(&writer, GEOARROW_TYPE_INTERLEAVED_LINESTRING),
+            GEOARROW_OK);
+  GeoArrowNativeWriterInitVisitor(&writer, &v);
+  tester.ReadWKT("LINESTRING (0 0, 180 85.0511287798066)", &v);
+  ASSERT_EQ(GeoArrowNativeWriterFinish(&writer, &array_in, nullptr), GEOARROW_OK);
+  GeoArrowNativeWriterReset(&writer);
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_INTERLEAVED_LINESTRING),
+            GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "to_web_mercator", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema_out, nullptr), GEOARROW_OK);
+  EXPECT_EQ(schema_view.type, GEOARROW_TYPE_INTERLEAVED_LINESTRING);
+  ASSERT_EQ(
+      GeoArrowMetadataViewInit(&metadata_view, schema_view.extension_metadata, nullptr),
+      GEOARROW_OK);
+  EXPECT_EQ(metadata_view.crs_type, GEOARROW_CRS_TYPE_AUTHORITY_CODE);
+  EXPECT_EQ(std::string(metadata_view.crs.data, metadata_view.crs.size_bytes),
+            "\"EPSG:3857\"");
+
+  ASSERT_EQ(GeoArrowArrayViewInitFromSchema(&array_view, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(array_view.coords.n_coords, 2);
+  EXPECT_EQ(array_view.coords.values[0][0], 0);
+  EXPECT_EQ(array_view.coords.values[1][0], 0);
+  EXPECT_NEAR(array_view.coords.values[0][2], 20037508.342789244, 1e-6);
+  EXPECT_NEAR(array_view.coords.values[1][2], 20037508.342789244, 1e-6);
+
+  // The inverse recovers the input and sets the CRS to longitude/latitude
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+  ArrowSchemaMove(&schema_out, &schema_in);
+  ArrowArrayMove(&array_out, &array_in);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "from_web_mercator", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  kernel.release(&kernel);
+
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema_out, nullptr), GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowMetadataViewInit(&metadata_view, schema_view.extension_metadata, nullptr),
+      GEOARROW_OK);
+  EXPECT_EQ(metadata_view.crs_type, GEOARROW_CRS_TYPE_PROJJSON);
+
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array_out, &error), GEOARROW_OK);
+  EXPECT_EQ(array_view.coords.values[0][0], 0);
+  EXPECT_EQ(array_view.coords.values[1][0], 0);
+  EXPECT_NEAR(array_view.coords.values[0][2], 180, 1e-9);
+  EXPECT_NEAR(array_view.coords.values[1][2], 85.0511287798066, 1e-9);
+
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+  array_out.release(&array_out);
+}
+
+TEST(KernelTest, KernelTestAffineErrors) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKB), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "affine", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Missing required parameter 'matrix'");
+  kernel.release(&kernel);
+
+  std::string options = KernelMatrixOption("1,0,0,1,0,zero");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "affine", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Invalid value for parameter 'matrix': '1,0,0,1,0,zero'");
+  kernel.release(&kernel);
+
+  options = KernelMatrixOption("1,0,0,1");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "affine", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected 6 or 12 values for parameter 'matrix' but got 4");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_BOX), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "to_web_mercator", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), ENOTSUP);
+  EXPECT_STREQ(error.message, "Can't transform coordinates of a box array");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+}
+
+static std::string KernelSimplifyOptions(const std::string& tolerance,
+                                         const std::string& method = "",
+                                         bool preserve_topology = false) {
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("tolerance"),
+                                       ArrowCharView(tolerance.c_str())),
+            GEOARROW_OK);
+  if (!method.empty()) {
+    EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("method"),
+                                         ArrowCharView(method.c_str())),
+              GEOARROW_OK);
+  }
+
+  if (preserve_topology) {
+    EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("preserve_topology"),
+                                         ArrowCharView("1")),
+              GEOARROW_OK);
+  }
+
+  std::string out(reinterpret_cast<char*>(buffer.data), buffer.size_bytes);
+  ArrowBufferReset(&buffer);
+  return out;
+}
+
+TEST(KernelTest, KernelTestSimplify) {
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  std::vector<std::string> wkt;
+
+  ASSERT_NO_FATAL_FAILURE(MakeWKTArray(
+      &schema_in, &array_in,
+      {"POINT (1 2)", "", "LINESTRING (0 0, 1 0.1, 2 0, 3 0.1, 4 0)",
+       "LINESTRING Z (0 0 1, 1 0.1 2, 2 0 3, 2 2 4)", "LINESTRING EMPTY",
+       "POLYGON ((0 0, 5 0.1, 10 0, 10 10, 0 10, 0 0), (2 2, 2.1 2.1, 3 2, 2 2))",
+       "POLYGON ((0 0, 0.1 0, 0.1 0.1, 0 0), (0 0, 0.01 0, 0.01 0.01, 0 0))",
+       "MULTIPOLYGON (((0 0, 0.1 0, 0.1 0.1, 0 0)), ((0 0, 10 0, 10 10, 0 0)))",
+       "GEOMETRYCOLLECTION (POINT (0 0), LINESTRING (0 0, 1 0.1, 2 0))"}));
+
+  // Douglas-Peucker removes the hole and the polygons that collapse
+  std::string options = KernelSimplifyOptions("0.5");
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>(
+                     {"POINT (1 2)", "<null value>", "LINESTRING (0 0, 4 0)",
+                      "LINESTRING Z (0 0 1, 2 0 3, 2 2 4)", "LINESTRING EMPTY",
+                      "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))", "POLYGON EMPTY",
+                      "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 0)))",
+                      "GEOMETRYCOLLECTION (POINT (0 0), LINESTRING (0 0, 2 0))"}));
+
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema_out, nullptr), GEOARROW_OK);
+  EXPECT_EQ(schema_view.type, GEOARROW_TYPE_WKT);
+  schema_out.release(&schema_out);
+
+  // ...unless rings are preserved
+  options = KernelSimplifyOptions("0.5", "douglas_peucker", true);
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt[5],
+            "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2.1 2.1, 3 2, 2 2))");
+  EXPECT_EQ(wkt[6],
+            "POLYGON ((0 0, 0.1 0, 0.1 0.1, 0 0), (0 0, 0.01 0, 0.01 0.01, 0 0))");
+  EXPECT_EQ(wkt[7],
+            "MULTIPOLYGON (((0 0, 0.1 0, 0.1 0.1, 0 0)), ((0 0, 10 0, 10 10, 0 0)))");
+  schema_out.release(&schema_out);
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+
+  // Visvalingam-Whyatt uses the tolerance as an area
+  ASSERT_NO_FATAL_FAILURE(MakeWKTArray(&schema_in, &array_in,
+                                       {"LINESTRING (0 0, 1 0.1, 2 0, 3 3, 4 0)",
+                                        "POLYGON ((0 0, 10 0, 10 10, 5 10.1, 0 0))"}));
+  options = KernelSimplifyOptions("0.5", "visvalingam");
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>(
+                     {"LINESTRING (0 0, 2 0, 3 3, 4 0)",
+                      "POLYGON ((0 0, 10 0, 10 10, 5 10.1, 0 0))"}));
+  schema_out.release(&schema_out);
+
+  options = KernelSimplifyOptions("1000", "visvalingam");
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>({"LINESTRING (0 0, 4 0)", "POLYGON EMPTY"}));
+  schema_out.release(&schema_out);
+
+  options = KernelSimplifyOptions("1000", "visvalingam", true);
+  ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                          &array_in, &schema_out, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>(
+                     {"LINESTRING (0 0, 4 0)", "POLYGON ((0 0, 10 0, 5 10.1, 0 0))"}));
+  schema_out.release(&schema_out);
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+
+  // An empty path before any scratch space was allocated
+  ASSERT_NO_FATAL_FAILURE(MakeWKTArray(&schema_in, &array_in,
+                                       {"LINESTRING EMPTY", "POLYGON EMPTY",
+                                        "LINESTRING (0 0, 1 0.1, 2 0)"}));
+  for (const char* method : {"douglas_peucker", "visvalingam"}) {
+    options = KernelSimplifyOptions("0.5", method);
+    ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", options.data(), &schema_in,
+                                            &array_in, &schema_out, &wkt));
+    EXPECT_EQ(wkt, std::vector<std::string>(
+                       {"LINESTRING EMPTY", "POLYGON EMPTY", "LINESTRING (0 0, 2 0)"}));
+    schema_out.release(&schema_out);
+  }
+
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+}
+
+TEST(KernelTest, KernelTestSimplifyNative) {
+  // Check that simplifying native arrays (directly from buffers) is identical to
+  // simplifying the same features as well-known text, including for sliced input
+  std::vector<std::pair<enum GeoArrowType, std::vector<std::string>>> cases = {
+      {GEOARROW_TYPE_POINT, {"POINT (0 1)", "", "POINT (2 3)"}},
+      {GEOARROW_TYPE_LINESTRING,
+       {"LINESTRING (0 0, 1 0.1, 2 0)", "", "LINESTRING EMPTY",
+        "LINESTRING (0 0, 1 0.1, 2 0, 3 3, 4 0, 5 0.1)"}},
+      {GEOARROW_TYPE_LINESTRING, {"LINESTRING EMPTY", "LINESTRING (0 0, 1 0.1, 2 0)"}},
+      {GEOARROW_TYPE_INTERLEAVED_LINESTRING_Z,
+       {"LINESTRING Z (0 0 0, 1 0.1 1, 2 0 2)", "",
+        "LINESTRING Z (0 0 0, 1 0.1 1, 2 0 2, 3 3 3, 4 0 4)"}},
+      {GEOARROW_TYPE_POLYGON,
+       {"POLYGON ((0 0, 1 0, 0 1, 0 0))", "",
+        "POLYGON ((0 0, 0 4, 4 4, 4 0, 0 0), (1 1, 1.1 1.1, 2 1, 1 1))",
+        "POLYGON ((0 0, 0.1 0, 0.1 0.1, 0 0), (0 0, 0.01 0, 0.01 0.01, 0 0))",
+        "POLYGON ((100 100, 101 100, 101 102, 100 100))"}},
+      {GEOARROW_TYPE_MULTILINESTRING,
+       {"MULTILINESTRING ((0 0, 1 0.1, 2 0))", "",
+        "MULTILINESTRING ((0 0, 1 1), (2 2, 3 2.1, 4 2, 4 4))"}},
+      {GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON,
+       {"MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))", "", "MULTIPOLYGON EMPTY",
+        "MULTIPOLYGON (((0 0, 0 4, 4 4, 4 0, 0 0), (1 1, 1.1 1.1, 2 1, 1 1)), "
+        "((10 10, 10.1 10, 10.1 10.1, 10 10)), ((20 20, 25 20.1, 30 20, 20 30, 20 20)))",
+        "MULTIPOLYGON (((0 0, 0.1 0, 0.1 0.1, 0 0)))"}}};
+
+  std::vector<std::string> options = {
+      KernelSimplifyOptions("0.5"), KernelSimplifyOptions("0.5", "", true),
+      KernelSimplifyOptions("0.5", "visvalingam"),
+      KernelSimplifyOptions("0.5", "visvalingam", true)};
+
+  for (const auto& item : cases) {
+    SCOPED_TRACE(item.second[0]);
+    struct GeoArrowKernel kernel;
+    struct GeoArrowError error;
+    struct ArrowSchema schema_wkt;
+    struct ArrowArray array_wkt;
+    struct ArrowSchema schema_native;
+    struct ArrowArray array_native;
+    struct ArrowSchema schema_out;
+    MakeWKTArray(&schema_wkt, &array_wkt, item.second);
+
+    std::string type_options = KernelTypeOption(item.first);
+    ASSERT_EQ(GeoArrowKernelInit(&kernel, "as_geoarrow", nullptr), GEOARROW_OK);
+    ASSERT_EQ(kernel.start(&kernel, &schema_wkt, type_options.data(), &schema_native,
+                           &error),
+              GEOARROW_OK);
+    ASSERT_EQ(kernel.push_batch(&kernel, &array_wkt, &array_native, &error),
+              GEOARROW_OK);
+    kernel.release(&kernel);
+
+    for (int64_t offset = 0; offset < 2; offset++) {
+      array_wkt.offset = offset;
+      array_wkt.length = static_cast<int64_t>(item.second.size()) - offset;
+      array_wkt.null_count = -1;
+      array_native.offset = offset;
+      array_native.length = array_wkt.length;
+      array_native.null_count = -1;
+
+      for (const auto& option : options) {
+        std::vector<std::string> wkt, wkt_native;
+        ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", option.data(), &schema_wkt,
+                                                &array_wkt, &schema_out, &wkt));
+        schema_out.release(&schema_out);
+        ASSERT_NO_FATAL_FAILURE(TransformKernel("simplify", option.data(),
+                                                &schema_native, &array_native,
+                                                &schema_out, &wkt_native));
+        schema_out.release(&schema_out);
+        EXPECT_EQ(wkt_native, wkt) << "offset " << offset;
+      }
+    }
+
+    schema_wkt.release(&schema_wkt);
+    array_wkt.release(&array_wkt);
+    schema_native.release(&schema_native);
+    array_native.release(&array_native);
+  }
+}
+
+TEST(KernelTest, KernelTestSimplifyErrors) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_WKB), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "simplify", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Missing required parameter 'tolerance'");
+  kernel.release(&kernel);
+
+  std::string options = KernelSimplifyOptions("-1");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "simplify", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected a non-negative value for parameter 'tolerance'");
+  kernel.release(&kernel);
+
+  options = KernelSimplifyOptions("1", "lang");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "simplify", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Invalid value for parameter 'method': 'lang'");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_BOX), GEOARROW_OK);
+  options = KernelSimplifyOptions("1");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "simplify", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Can't simplify a box array");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+}
+
+static void CollectAgg(enum GeoArrowType type, const std::vector<std::string>& wkt,
+                       const std::vector<std::pair<int64_t, int64_t>>& slices,
+                       std::vector<std::string>* wkt_out) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, type), GEOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkt, &array_in));
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "collect_agg", nullptr), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error),
+            GEOARROW_OK);
+
+  // Push each slice of the input as its own batch
+  int64_t length = array_in.length;
+  for (const auto& slice : slices) {
+    array_in.offset = slice.first;
+    array_in.length = slice.second;
+    array_in.null_count = -1;
+    ASSERT_EQ(kernel.push_batch(&kernel, &array_in, nullptr, &error), GEOARROW_OK)
+        << error.message;
+  }
+
+  array_in.offset = 0;
+  array_in.length = length;
+  ASSERT_EQ(kernel.finish(&kernel, &array_out, &error), GEOARROW_OK) << error.message;
+  kernel.release(&kernel);
+
+  WKXTester tester;
+  struct GeoArrowArrayReader reader;
+  ASSERT_EQ(GeoArrowArrayReaderInitFromSchema(&reader, &schema_out, &error), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayReaderSetArray(&reader, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(
+      GeoArrowArrayReaderVisit(&reader, 0, array_out.length, tester.WKTVisitor()),
+      GEOARROW_OK);
+  GeoArrowArrayReaderReset(&reader);
+  *wkt_out = tester.WKTValues("<null value>");
+
+  schema_in.release(&schema_in);
+  array_in.release(&array_in);
+  schema_out.release(&schema_out);
+  array_out.release(&array_out);
+}
+
+TEST(KernelTest, KernelTestCollectAggSliced) {
+  // Null rows are dropped and sliced batches are appended relative to their offset
+  std::vector<std::string> wkt;
+  ASSERT_NO_FATAL_FAILURE(
+      CollectAgg(GEOARROW_TYPE_POINT, {"POINT (0 1)", "", "POINT (2 3)", "POINT (4 5)"},
+                 {{0, 4}, {1, 2}, {3, 0}}, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>(
+                     {"MULTIPOINT ((0 1), (2 3), (4 5), (2 3))"}));
+
+  ASSERT_NO_FATAL_FAILURE(CollectAgg(
+      GEOARROW_TYPE_INTERLEAVED_POLYGON,
+      {"POLYGON ((0 0, 1 0, 0 1, 0 0))", "", "POLYGON EMPTY",
+       "POLYGON ((0 0, 0 4, 4 4, 4 0, 0 0), (1 1, 2 1, 2 2, 1 1))"},
+      {{1, 3}, {0, 1}}, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>(
+                     {"MULTIPOLYGON (EMPTY, ((0 0, 0 4, 4 4, 4 0, 0 0), "
+                      "(1 1, 2 1, 2 2, 1 1)), ((0 0, 1 0, 0 1, 0 0)))"}));
+
+  // An aggregate with no batches is an empty collection
+  ASSERT_NO_FATAL_FAILURE(CollectAgg(GEOARROW_TYPE_LINESTRING, {}, {}, &wkt));
+  EXPECT_EQ(wkt, std::vector<std::string>({"MULTILINESTRING EMPTY"}));
+}
+
+static std::string KernelBoxOption(const std::string& box) {
+  struct ArrowBuffer buffer;
+  EXPECT_EQ(ArrowMetadataBuilderInit(&buffer, nullptr), GEOARROW_OK);
+  EXPECT_EQ(ArrowMetadataBuilderAppend(&buffer, ArrowCharView("box"),
+                                       ArrowCharView(box.c_str())),
+            GEOARROW_OK);
+  std::string out(reinterpret_cast<char*>(buffer.data), buffer.size_bytes);
+  ArrowBufferReset(&buffer);
+  return out;
+}
+
+TEST(KernelTest, KernelTestClipByBox) {
+  std::vector<std::tuple<enum GeoArrowType, std::vector<std::string>,
+                         std::vector<std::string>>>
+      cases = {
+          {GEOARROW_TYPE_POINT,
+           {"POINT (1 1)", "", "POINT (20 20)", "POINT (10 0)"},
+           {"POINT (1 1)", "<null value>", "POINT (nan nan)", "POINT (10 0)"}},
+          {GEOARROW_TYPE_MULTIPOINT,
+           {"MULTIPOINT (1 1, 20 20, 2 2, 3 30, 4 4)", "MULTIPOINT (20 20)"},
+           {"MULTIPOINT ((1 1), (2 2), (4 4))", "MULTIPOINT EMPTY"}},
+          {GEOARROW_TYPE_LINESTRING,
+           {"LINESTRING (1 1, 2 2)", "LINESTRING (-5 5, 15 5)",
+            "LINESTRING (5 5, 5 15, 8 15, 8 5)", "LINESTRING (20 20, 30 30)",
+            "LINESTRING (-5 5, 5 15)", ""},
+           {"MULTILINESTRING ((1 1, 2 2))", "MULTILINESTRING ((0 5, 10 5))",
+            "MULTILINESTRING ((5 5, 5 10), (8 10, 8 5))", "MULTILINESTRING EMPTY",
+            "MULTILINESTRING EMPTY", "<null value>"}},
+          {GEOARROW_TYPE_INTERLEAVED_LINESTRING_Z,
+           {"LINESTRING Z (-10 5 0, 10 5 20)"},
+           {"MULTILINESTRING Z ((0 5 10, 10 5 20))"}},
+          {GEOARROW_TYPE_MULTILINESTRING,
+           {"MULTILINESTRING ((1 1, 2 2), (20 20, 30 30), (-5 5, 5 5))"},
+           {"MULTILINESTRING ((1 1, 2 2), (0 5, 5 5))"}},
+          {GEOARROW_TYPE_POLYGON,
+           {"POLYGON ((-5 -5, 5 -5, 5 5, -5 5, -5 -5))",
+            "POLYGON ((-5 -5, 15 -5, 15 15, -5 15, -5 -5), (2 2, 3 2, 3 3, 2 2))",
+            "POLYGON ((20 20, 30 20, 30 30, 20 20))",
+            "POLYGON ((-5 -5, 15 -5, 15 15, -5 15, -5 -5), "
+            "(20 20, 21 20, 21 21, 20 20))"},
+           {"POLYGON ((0 0, 5 0, 5 5, 0 5, 0 0))",
+            "POLYGON ((0 10, 0 0, 10 0, 10 10, 0 10), (2 2, 3 2, 3 3, 2 2))",
+            "POLYGON EMPTY", "POLYGON ((0 10, 0 0, 10 0, 10 10, 0 10))"}},
+          {GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON,
+           {"MULTIPOLYGON (((20 20, 30 20, 30 30, 20 20)), ((1 1, 2 1, 2 2, 1 1)), "
+            "((5 -5, 15 -5, 15 5, 5 5, 5 -5)))"},
+           {"MULTIPOLYGON (((1 1, 2 1, 2 2, 1 1)), ((5 0, 10 0, 10 5, 5 5, 5 0)))"}}};
+
+  std::string options = KernelBoxOption("0, 0, 10, 10");
+  for (const auto& item : cases) {
+    SCOPED_TRACE(std::get<1>(item)[0]);
+    struct ArrowSchema schema_in;
+    struct ArrowSchema schema_out;
+    struct ArrowArray array_in;
+    std::vector<std::string> wkt;
+    ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, std::get<0>(item)), GEOARROW_OK);
+    ASSERT_NO_FATAL_FAILURE(
+        MakeNativeArray(std::get<0>(item), std::get<1>(item), &array_in));
+    ASSERT_NO_FATAL_FAILURE(TransformKernel("clip_by_box", options.data(), &schema_in,
+                                            &array_in, &schema_out, &wkt));
+    EXPECT_EQ(wkt, std::get<2>(item));
+    schema_out.release(&schema_out);
+
+    // Sliced input
+    if (array_in.length > 1) {
+      array_in.offset = 1;
+      array_in.length--;
+      array_in.null_count = -1;
+      ASSERT_NO_FATAL_FAILURE(TransformKernel("clip_by_box", options.data(), &schema_in,
+                                              &array_in, &schema_out, &wkt));
+      EXPECT_EQ(wkt, std::vector<std::string>(std::get<2>(item).begin() + 1,
+                                              std::get<2>(item).end()));
+      schema_out.release(&schema_out);
+    }
+
+    schema_in.release(&schema_in);
+    array_in.release(&array_in);
+  }
+}
+
+TEST(KernelTest, KernelTestClipByBoxStatistics) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct GeoArrowStatistics stats;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+  struct ArrowArray array_in;
+  struct ArrowArray array_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_LINESTRING,
+      {"LINESTRING (1 1, 2 2)", "", "LINESTRING (-10 5, 10 5, 20 5)"}, &array_in));
+
+  std::string options = KernelBoxOption("0, 0, 10, 10");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "clip_by_box", nullptr), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelEnableStatistics(&kernel), GEOARROW_OK);
+  ASSERT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_batches, 1);
+  EXPECT_EQ(stats.num_features, 3);
+  EXPECT_EQ(stats.num_null_features, 1);
+  EXPECT_EQ(stats.num_coords, 5);
+
+  // Nulls are counted relative to the offset of sliced input
+  array_out.release(&array_out);
+  array_in.offset = 1;
+  array_in.length = 1;
+  array_in.null_count = -1;
+  ASSERT_EQ(kernel.push_batch(&kernel, &array_in, &array_out, &error), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowKernelGetStatistics(&kernel, &stats), GEOARROW_OK);
+  EXPECT_EQ(stats.num_features, 4);
+  EXPECT_EQ(stats.num_null_features, 2);
+  EXPECT_EQ(stats.num_coords, 5);
+
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+  schema_out.release(&schema_out);
+  array_in.release(&array_in);
+  array_out.release(&array_out);
+}
+
+TEST(KernelTest, KernelTestClipByBoxErrors) {
+  struct GeoArrowKernel kernel;
+  struct GeoArrowError error;
+  struct ArrowSchema schema_in;
+  struct ArrowSchema schema_out;
+
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, GEOARROW_TYPE_POLYGON), GEOARROW_OK);
+
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "clip_by_box", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, nullptr, &schema_out, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Missing required parameter 'box'");
+  kernel.release(&kernel);
+
+  std::string options = KernelBoxOption("0, 0, 10");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "clip_by_box", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected 4 values for parameter 'box' but got 3");
+  kernel.release(&kernel);
+
+  options = KernelBoxOption("10, 0, 0, 10");
+  ASSERT_EQ(GeoArrowKernelInit(&kernel, "clip_by_box", nullptr), GEOARROW_OK);
+  EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected xmin <= xmax and ymin <= ymax for parameter 'box'");
+  kernel.release(&kernel);
+  schema_in.release(&schema_in);
+
+  options = KernelBoxOption("0, 0, 10, 10");
+  for (auto type : {GEOARROW_TYPE_WKB, GEOARROW_TYPE_BOX, GEOARROW_TYPE_FLOAT_POLYGON}) {
+    ASSERT_EQ(GeoArrowSchemaInitExtension(&schema_in, type), GEOARROW_OK);
+    ASSERT_EQ(GeoArrowKernelInit(&kernel, "clip_by_box", nullptr), GEOARROW_OK);
+    EXPECT_EQ(kernel.start(&kernel, &schema_in, options.data(), &schema_out, &error),
+              ENOTSUP);
+    EXPECT_EQ(std::string(error.message),
+              "Can't clip array of type " + std::to_string(static_cast<int>(type)));
+    kernel.release(&kernel);
+    schema_in.release(&schema_in);
+  }
+}
@@ -0,0 +1,928 @@
+
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Length + area + centroid + num_coords + num_parts
+//
+// Calculate measures by feature. Native input with double coordinates is measured
+// directly from the offset buffers and coordinate arrays; all other input (including
+// WKB and WKT) is visited. num_coords and num_parts only need offsets and never touch
+// coordinate memory for native input; for WKB input they only read geometry headers.
+// Areas are unsigned (holes are subtracted from their shell) and the centroid is that
+// of the highest-dimensional components of the feature (as in GEOS). Length and area
+// use the edge type of the input (see below); the centroid is only defined for planar
+// edges. Null features are recorded as a null item in the output; empty features
+// have a length and area of zero and a centroid of POINT (nan nan).
+
+// Accumulators for a single feature. Moments are sums of coordinates weighted by
+// area, segment length, or one (for points) so that the centroid can be computed
+// from the highest-dimensional components of the feature.
+struct GeoArrowMeasureFeature {
+  int feat_null;
+  int depth;
+  enum GeoArrowGeometryType geometry_type;
+  int64_t n_coords;
+  int64_t n_parts;
+  double length;
+  double area;
+  double area_x;
+  double area_y;
+  double line_x;
+  double line_y;
+  double point_x;
+  double point_y;
+};
+
+// Accumulators for a single linestring or ring. Coordinates are made relative to
+// the first coordinate of the path to avoid loss of precision for shoelace terms.
+struct GeoArrowMeasurePath {
+  int active;
+  int is_ring;
+  int ring_i;
+  int64_t n_coords;
+  double x0;
+  double y0;
+  double x1;
+  double y1;
+  double length;
+  double line_x;
+  double line_y;
+  double area2;
+  double area_x;
+  double area_y;
+};
+
+struct GeoArrowMeasurePrivate {
+  enum GeoArrowMeasureType type;
+  enum GeoArrowEdgeType edge_type;
+  struct GeoArrowMeasureFeature feature;
+  struct GeoArrowMeasurePath path;
+  struct GeoArrowWKBReader wkb_reader;
+  struct ArrowBitmap validity;
+  struct ArrowBuffer values[2];
+  int64_t null_count;
+};
+
+// Spherical and ellipsoidal edges
+//
+// Coordinates of geometries with non-planar edges are longitude and latitude in
+// degrees; lengths are in meters and areas are in square meters. Spherical edges are
+// great circles on a sphere with the mean radius of the earth. The other edge types
+// are geodesics on the WGS84 ellipsoid: lengths are computed with Vincenty's inverse
+// formula (falling back to a great circle for the nearly antipodal points for which it
+// does not converge) and areas are computed on the authalic sphere (i.e., the sphere
+// with the same surface area as the ellipsoid after mapping latitudes such that areas
+// are preserved).
+
+static const double kGeoArrowMeasurePi = 3.14159265358979323846;
+static const double kGeoArrowMeasureDegToRad = 0.017453292519943295;
+static const double kGeoArrowEarthRadius = 6371008.8;
+static const double kGeoArrowWGS84A = 6378137.0;
+static const double kGeoArrowWGS84F = 1.0 / 298.257223563;
+static const double kGeoArrowWGS84E = 0.08181919084262149;
+static const double kGeoArrowWGS84E2 = 0.0066943799901413165;
+static const double kGeoArrowWGS84Qp = 1.9955310875028376;
+static const double kGeoArrowAuthalicRadius = 6371007.180918476;
+
+// Returns the sum of the great circle distances between n coordinates in radians
+static double geodesic_length_spherical(const double* x, const double* y,
+                                        int64_t stride, int64_t n) {
+  double length = 0;
+  double lat1, lat2, sin_dlat, sin_dlon, h;
+  for (int64_t i = 1; i < n; i++) {
+    lat1 = y[(i - 1) * stride] * kGeoArrowMeasureDegToRad;
+    lat2 = y[i * stride] * kGeoArrowMeasureDegToRad;
+    sin_dlat = sin((lat2 - lat1) / 2);
+    sin_dlon = sin((x[i * stride] - x[(i - 1) * stride]) * kGeoArrowMeasureDegToRad / 2);
+    h = sin_dlat * sin_dlat + cos(lat1) * cos(lat2) * sin_dlon * sin_dlon;
+    length += 2 * asin(sqrt(h < 1 ? h : 1));
+  }
+
+  return length;
+}
+
+// Returns the distance in meters between two points on the WGS84 ellipsoid
+static double geodesic_vincenty(double lon1, double lat1, double lon2, double lat2) {
+  const double a = kGeoArrowWGS84A;
+  const double f = kGeoArrowWGS84F;
+  const double b = a * (1 - f);
+
+  double L = (lon2 - lon1) * kGeoArrowMeasureDegToRad;
+  double u1 = atan((1 - f) * tan(lat1 * kGeoArrowMeasureDegToRad));
+  double u2 = atan((1 - f) * tan(lat2 * kGeoArrowMeasureDegToRad));
+  double sin_u1 = sin(u1), cos_u1 = cos(u1);
+  double sin_u2 = sin(u2), cos_u2 = cos(u2);
+
+  double lambda = L;
+  double lambda_prev;
+  double sin_sigma, cos_sigma, sigma, sin_alpha, cos2_alpha, cos_2sigma_m, c;
+  int iterations = 0;
+  do {
+    double sin_lambda = sin(lambda), cos_lambda = cos(lambda);
+    double t1 = cos_u2 * sin_lambda;
+    double t2 = cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda;
+    sin_sigma = sqrt(t1 * t1 + t2 * t2);
+    if (sin_sigma == 0) {
+      return 0;
+    }
+
+    cos_sigma = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+    sigma = atan2(sin_sigma, cos_sigma);
+    sin_alpha = cos_u1 * cos_u2 * sin_lambda / sin_sigma;
+    cos2_alpha = 1 - sin_alpha * sin_alpha;
+    cos_2sigma_m = cos2_alpha != 0 ? cos_sigma - 2 * sin_u1 * sin_u2 / cos2_alpha : 0;
+    c = f / 16 * cos2_alpha * (4 + f * (4 - 3 * cos2_alpha));
+    lambda_prev = lambda;
+    double t3 = cos_2sigma_m + c * cos_sigma * (-1 + 2 * cos_2sigma_m * cos_2sigma_m);
+    lambda = L + (1 - c) * f * sin_alpha * (sigma + c * sin_sigma * t3);
+  } while (fabs(lambda - lambda_prev) > 1e-12 && ++iterations < 200);
+
+  if (iterations >= 200) {
+    double lon[] = {lon1, lon2};
+    double lat[] = {lat1, lat2};
+    return geodesic_length_spherical(lon, lat, 1, 2) * kGeoArrowEarthRadius;
+  }
+
+  double u_sq = cos2_alpha * (a * a - b * b) / (b * b);
+  double big_a =
+      1 + u_sq / 16384 * (4096 + u_sq * (-768 + u_sq * (320 - 175 * u_sq)));
+  double big_b = u_sq / 1024 * (256 + u_sq * (-128 + u_sq * (74 - 47 * u_sq)));
+  double delta_sigma =
+      big_b * sin_sigma *
+      (cos_2sigma_m +
+       big_b / 4 *
+           (cos_sigma * (-1 + 2 * cos_2sigma_m * cos_2sigma_m) -
+            big_b / 6 * cos_2sigma_m * (-3 + 4 * sin_sigma * sin_sigma) *
+                (-3 + 4 * cos_2sigma_m * cos_2sigma_m)));
+  return b * big_a * (sigma - delta_sigma);
+}
+
+// Returns the sum of the geodesic distances between n coordinates in meters
+static double geodesic_length_ellipsoidal(const double* x, const double* y,
+                                          int64_t stride, int64_t n) {
+  double length = 0;
+  for (int64_t i = 1; i < n; i++) {
+    length += geodesic_vincenty(x[(i - 1) * stride], y[(i - 1) * stride], x[i * stride],
+                                y[i * stride]);
+  }
+
+  return length;
+}
+
+// Maps a geodetic latitude in radians to the authalic sphere
+static double geodesic_authalic_latitude(double lat) {
+  const double e = kGeoArrowWGS84E;
+  const double e2 = kGeoArrowWGS84E2;
+  double s = sin(lat);
+  double q =
+      (1 - e2) * (s / (1 - e2 * s * s) - 1 / (2 * e) * log((1 - e * s) / (1 + e * s)));
+  double ratio = q / kGeoArrowWGS84Qp;
+  return asin(ratio > 1 ? 1 : (ratio < -1 ? -1 : ratio));
+}
+
+// Sets xyz to the unit vector of a longitude and latitude in degrees
+static void geodesic_unit_vector(double lon, double lat, int authalic, double* xyz) {
+  lon *= kGeoArrowMeasureDegToRad;
+  lat *= kGeoArrowMeasureDegToRad;
+  if (authalic) {
+    lat = geodesic_authalic_latitude(lat);
+  }
+
+  xyz[0] = cos(lat) * cos(lon);
+  xyz[1] = cos(lat) * sin(lon);
+  xyz[2] = sin(lat);
+}
+
+// Returns the signed spherical excess in steradians of the triangles between the
+// first coordinate of the ring (x0, y0) and each of the n - 1 edges between n
+// coordinates (i.e., the terms of a fan triangulation of the ring). Each term uses
+// the Van Oosterom-Strackee formula, which stays valid for triangles whose excess is
+// larger than pi.
+static double geodesic_excess(const double* x, const double* y, int64_t stride,
+                              int64_t n, double x0, double y0, int authalic) {
+  double excess = 0;
+  double p0[3], a[3], b[3];
+  geodesic_unit_vector(x0, y0, authalic, p0);
+  geodesic_unit_vector(x[0], y[0], authalic, b);
+  for (int64_t i = 1; i < n; i++) {
+    memcpy(a, b, sizeof(a));
+    geodesic_unit_vector(x[i * stride], y[i * stride], authalic, b);
+    double triple = p0[0] * (a[1] * b[2] - a[2] * b[1]) +
+                    p0[1] * (a[2] * b[0] - a[0] * b[2]) +
+                    p0[2] * (a[0] * b[1] - a[1] * b[0]);
+    double denom = 1 + (p0[0] * a[0] + p0[1] * a[1] + p0[2] * a[2]) +
+                   (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) +
+                   (b[0] * p0[0] + b[1] * p0[1] + b[2] * p0[2]);
+    excess += 2 * atan2(triple, denom);
+  }
+
+  return excess;
+}
+
+// Measures of visited and native features
+
+static void measure_feat_start(struct GeoArrowMeasurePrivate* measure) {
+  memset(&measure->feature, 0, sizeof(struct GeoArrowMeasureFeature));
+  measure->path.active = 0;
+}
+
+static void measure_path_start(struct GeoArrowMeasurePrivate* measure, int is_ring) {
+  struct GeoArrowMeasurePath* path = &measure->path;
+  path->active = 1;
+  path->is_ring = is_ring;
+  path->n_coords = 0;
+  path->length = 0;
+  path->line_x = 0;
+  path->line_y = 0;
+  path->area2 = 0;
+  path->area_x = 0;
+  path->area_y = 0;
+}
+
+// Accumulates the n - 1 segments between n coordinates, where x and y are relative
+// to the first coordinate of the path. These loops have no branches so that they can
+// be vectorized.
+static double measure_segments_length(const double* x, const double* y, int64_t stride,
+                                      int64_t n) {
+  double length = 0;
+  double dx, dy;
+  for (int64_t i = 1; i < n; i++) {
+    dx = x[i * stride] - x[(i - 1) * stride];
+    dy = y[i * stride] - y[(i - 1) * stride];
+    length += sqrt(dx * dx + dy * dy);
+  }
+
+  return length;
+}
+
+static double measure_segments_area2(const double* x, const double* y, int64_t stride,
+                                     int64_t n, double x0, double y0) {
+  double area2 = 0;
+  double xa, ya, xb, yb;
+  for (int64_t i = 1; i < n; i++) {
+    xa = x[(i - 1) * stride] - x0;
+    ya = y[(i - 1) * stride] - y0;
+    xb = x[i * stride] - x0;
+    yb = y[i * stride] - y0;
+    area2 += xa * yb - xb * ya;
+  }
+
+  return area2;
+}
+
+static void measure_segments_centroid(struct GeoArrowMeasurePath* path, const double* x,
+                                      const double* y, int64_t stride, int64_t n) {
+  double length = 0, line_x = 0, line_y = 0;
+  double area2 = 0, area_x = 0, area_y = 0;
+  double xa, ya, xb, yb, dx, dy, segment_length, a;
+  for (int64_t i = 1; i < n; i++) {
+    xa = x[(i - 1) * stride] - path->x0;
+    ya = y[(i - 1) * stride] - path->y0;
+    xb = x[i * stride] - path->x0;
+    yb = y[i * stride] - path->y0;
+    dx = xb - xa;
+    dy = yb - ya;
+    segment_length = sqrt(dx * dx + dy * dy);
+    length += segment_length;
+    line_x += (xa + xb) * segment_length;
+    line_y += (ya + yb) * segment_length;
+    a = xa * yb - xb * ya;
+    area2 += a;
+    area_x += (xa + xb) * a;
+    area_y += (ya + yb) * a;
+  }
+
+  path->length += length;
+  path->line_x += line_x;
+  path->line_y += line_y;
+  path->area2 += area2;
+  path->area_x += area_x;
+  path->area_y += area_y;
+}
+
+static void measure_segments(struct GeoArrowMeasurePrivate* measure, const double* x,
+                             const double* y, int64_t stride, int64_t n) {
+  struct GeoArrowMeasurePath* path = &measure->path;
+  switch (measure->type) {
+    case GEOARROW_MEASURE_TYPE_LENGTH:
+      if (measure->edge_type == GEOARROW_EDGE_TYPE_PLANAR) {
+        path->length += measure_segments_length(x, y, stride, n);
+      } else if (measure->edge_type == GEOARROW_EDGE_TYPE_SPHERICAL) {
+        path->length +=
+            geodesic_length_spherical(x, y, stride, n) * kGeoArrowEarthRadius;
+      } else {
+        path->length += geodesic_length_ellipsoidal(x, y, stride, n);
+      }
+      break;
+    case GEOARROW_MEASURE_TYPE_AREA:
+      if (!path->is_ring) {
+        break;
+      } else if (measure->edge_type == GEOARROW_EDGE_TYPE_PLANAR) {
+        path->area2 += measure_segments_area2(x, y, stride, n, path->x0, path->y0);
+      } else {
+        // For non-planar edges the spherical excess is accumulated instead
+        int authalic = measure->edge_type != GEOARROW_EDGE_TYPE_SPHERICAL;
+        path->area2 +=
+            geodesic_excess(x, y, stride, n, path->x0, path->y0, authalic);
+      }
+      break;
+    case GEOARROW_MEASURE_TYPE_CENTROID:
+      measure_segments_centroid(path, x, y, stride, n);
+      break;
+    default:
+      break;
+  }
+}
+
+static void measure_points(struct GeoArrowMeasurePrivate* measure, const double* x,
+                           const double* y, int64_t stride, int64_t n) {
+  measure->feature.n_coords += n;
+  if (measure->type != GEOARROW_MEASURE_TYPE_CENTROID) {
+    return;
+  }
+
+  double point_x = 0, point_y = 0;
+  for (int64_t i = 0; i < n; i++) {
+    point_x += x[i * stride];
+    point_y += y[i * stride];
+  }
+
+  measure->feature.point_x += point_x;
+  measure->feature.point_y += point_y;
+}
+
+// Coordinates of a path may arrive in more than one chunk, so the segment between
+// the last coordinate of the previous chunk and the first coordinate of this chunk
+// is accumulated separately.
+static void measure_path_coords(struct GeoArrowMeasurePrivate* measure, const double* x,
+                                const double* y, int64_t stride, int64_t n) {
+  struct GeoArrowMeasurePath* path = &measure->path;
+  if (n == 0) {
+    return;
+  }
+
+  measure_points(measure, x, y, stride, n);
+
+  if (path->n_coords == 0) {
+    path->x0 = x[0];
+    path->y0 = y[0];
+  } else {
+    double junction_x[] = {path->x1, x[0]};
+    double junction_y[] = {path->y1, y[0]};
+    measure_segments(measure, junction_x, junction_y, 1, 2);
+  }
+
+  measure_segments(measure, x, y, stride, n);
+  path->x1 = x[(n - 1) * stride];
+  path->y1 = y[(n - 1) * stride];
+  path->n_coords += n;
+}
+
+static void measure_path_end(struct GeoArrowMeasurePrivate* measure) {
+  struct GeoArrowMeasurePath* path = &measure->path;
+  struct GeoArrowMeasureFeature* feature = &measure->feature;
+  path->active = 0;
+
+  feature->length += path->length;
+  feature->line_x += path->line_x / 2 + path->x0 * path->length;
+  feature->line_y += path->line_y / 2 + path->y0 * path->length;
+
+  if (path->is_ring && measure->edge_type != GEOARROW_EDGE_TYPE_PLANAR) {
+    // A ring divides the sphere into two regions and the smaller one is its interior
+    double excess = fabs(path->area2);
+    if (excess > 2 * kGeoArrowMeasurePi) {
+      excess = 4 * kGeoArrowMeasurePi - excess;
+    }
+
+    double radius = measure->edge_type == GEOARROW_EDGE_TYPE_SPHERICAL
+                        ? kGeoArrowEarthRadius
+                        : kGeoArrowAuthalicRadius;
+    double weight = path->ring_i > 0 ? -1 : 1;
+    feature->area += weight * excess * radius * radius;
+    path->ring_i++;
+  } else if (path->is_ring) {
+    // The first ring of a polygon is its shell and subsequent rings are holes,
+    // regardless of winding order
+    double area = path->area2 / 2;
+    double weight = path->area2 < 0 ? -1 : 1;
+    if (path->ring_i > 0) {
+      weight = -weight;
+    }
+
+    feature->area += weight * area;
+    feature->area_x += weight * (area * path->x0 + path->area_x / 6);
+    feature->area_y += weight * (area * path->y0 + path->area_y / 6);
+    path->ring_i++;
+  }
+}
+
+static ArrowErrorCode measure_append_null(struct GeoArrowMeasurePrivate* measure) {
+  int n_values = measure->type == GEOARROW_MEASURE_TYPE_CENTROID ? 2 : 1;
+  if (measure->validity.buffer.data == NULL) {
+    int64_t length = measure->values[0].size_bytes / (int64_t)sizeof(double);
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&measure->validity, 1, length));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&measure->validity, 0, 1));
+  for (int i = 0; i < n_values; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt64(&measure->values[i], 0));
+  }
+
+  measure->null_count++;
+  return GEOARROW_OK;
+}
+
+static ArrowErrorCode measure_append(struct GeoArrowMeasurePrivate* measure) {
+  if (measure->feature.feat_null) {
+    return measure_append_null(measure);
+  }
+
+  if (measure->validity.buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&measure->validity, 1, 1));
+  }
+
+  struct GeoArrowMeasureFeature* feature = &measure->feature;
+  switch (measure->type) {
+    case GEOARROW_MEASURE_TYPE_LENGTH:
+      return ArrowBufferAppendDouble(&measure->values[0], feature->length);
+    case GEOARROW_MEASURE_TYPE_AREA:
+      return ArrowBufferAppendDouble(&measure->values[0], feature->area);
+    case GEOARROW_MEASURE_TYPE_NUM_COORDS:
+      return ArrowBufferAppendInt64(&measure->values[0], feature->n_coords);
+    case GEOARROW_MEASURE_TYPE_NUM_PARTS:
+      return ArrowBufferAppendInt64(&measure->values[0], feature->n_parts);
+    default:
+      break;
+  }
+
+  double x, y;
+  if (feature->area != 0) {
+    x = feature->area_x / feature->area;
+    y = feature->area_y / feature->area;
+  } else if (feature->length > 0) {
+    x = feature->line_x / feature->length;
+    y = feature->line_y / feature->length;
+  } else if (feature->n_coords > 0) {
+    x = feature->point_x / (double)feature->n_coords;
+    y = feature->point_y / (double)feature->n_coords;
+  } else {
+    x = NAN;
+    y = NAN;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppendDouble(&measure->values[0], x));
+  return ArrowBufferAppendDouble(&measure->values[1], y);
+}
+
+static ArrowErrorCode measure_finish(struct GeoArrowMeasurePrivate* measure,
+                                     struct ArrowArray* out,
+                                     struct GeoArrowError* error) {
+  struct ArrowArray tmp;
+  int64_t length = measure->values[0].size_bytes / (int64_t)sizeof(double);
+  int result;
+
+  if (measure->type == GEOARROW_MEASURE_TYPE_CENTROID) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(&tmp, NANOARROW_TYPE_STRUCT));
+    result = ArrowArrayAllocateChildren(&tmp, 2);
+    for (int i = 0; i < 2 && result == GEOARROW_OK; i++) {
+      result = ArrowArrayInitFromType(tmp.children[i], NANOARROW_TYPE_DOUBLE);
+      if (result == GEOARROW_OK) {
+        result = ArrowArraySetBuffer(tmp.children[i], 1, &measure->values[i]);
+        tmp.children[i]->length = length;
+      }
+    }
+  } else if (measure->type == GEOARROW_MEASURE_TYPE_NUM_COORDS ||
+             measure->type == GEOARROW_MEASURE_TYPE_NUM_PARTS) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(&tmp, NANOARROW_TYPE_INT64));
+    result = ArrowArraySetBuffer(&tmp, 1, &measure->values[0]);
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(&tmp, NANOARROW_TYPE_DOUBLE));
+    result = ArrowArraySetBuffer(&tmp, 1, &measure->values[0]);
+  }
+
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  tmp.length = length;
+  if (measure->null_count > 0) {
+    ArrowArraySetValidityBitmap(&tmp, &measure->validity);
+  } else {
+    ArrowBitmapReset(&measure->validity);
+  }
+
+  result = ArrowArrayFinishBuildingDefault(&tmp, (struct ArrowError*)error);
+  if (result != GEOARROW_OK) {
+    tmp.release(&tmp);
+    return result;
+  }
+
+  tmp.null_count = measure->null_count;
+  measure->null_count = 0;
+  ArrowArrayMove(&tmp, out);
+  return GEOARROW_OK;
+}
+
+
+static int feat_start_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+  measure_feat_start(measure);
+  return GEOARROW_OK;
+}
+
+static int null_feat_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+  measure->feature.feat_null = 1;
+  return GEOARROW_OK;
+}
+
+static int geom_start_measure(struct GeoArrowVisitor* v,
+                              enum GeoArrowGeometryType geometry_type,
+                              enum GeoArrowDimensions dimensions) {
+  NANOARROW_UNUSED(dimensions);
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+
+  measure->feature.depth++;
+  if (measure->feature.depth == 1) {
+    measure->feature.geometry_type = geometry_type;
+  } else if (measure->feature.depth == 2) {
+    measure->feature.n_parts++;
+  }
+
+  if (geometry_type == GEOARROW_GEOMETRY_TYPE_LINESTRING) {
+    measure_path_start(measure, 0);
+  } else if (geometry_type == GEOARROW_GEOMETRY_TYPE_POLYGON) {
+    measure->path.ring_i = 0;
+  }
+
+  return GEOARROW_OK;
+}
+
+static int ring_start_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+  measure_path_start(measure, 1);
+  return GEOARROW_OK;
+}
+
+static int coords_measure(struct GeoArrowVisitor* v,
+                          const struct GeoArrowCoordView* coords) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+
+  if (measure->path.active) {
+    measure_path_coords(measure, coords->values[0], coords->values[1],
+                        coords->coords_stride, coords->n_coords);
+  } else {
+    measure_points(measure, coords->values[0], coords->values[1], coords->coords_stride,
+                   coords->n_coords);
+  }
+
+  return GEOARROW_OK;
+}
+
+static int ring_end_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+  measure_path_end(measure);
+  return GEOARROW_OK;
+}
+
+static int geom_end_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+
+  // Linestrings can't contain other geometries, so an active path that isn't a
+  // ring always ends with its linestring
+  if (measure->path.active && !measure->path.is_ring) {
+    measure_path_end(measure);
+  }
+
+  measure->feature.depth--;
+  return GEOARROW_OK;
+}
+
+static int feat_end_measure(struct GeoArrowVisitor* v) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)v->private_data;
+
+  // Single geometries have one part unless they are empty
+  switch (measure->feature.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+    case GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION:
+      break;
+    default:
+      measure->feature.n_parts = measure->feature.n_coords > 0;
+      break;
+  }
+
+  return measure_append(measure);
+}
+
+// Native measures
+
+static void measure_native_path(struct GeoArrowMeasurePrivate* measure,
+                                const struct GeoArrowCoordView* coords, int64_t start,
+                                int64_t end, int is_ring) {
+  measure_path_start(measure, is_ring);
+  measure_path_coords(measure, &GEOARROW_COORD_VIEW_VALUE(coords, start, 0),
+                      &GEOARROW_COORD_VIEW_VALUE(coords, start, 1),
+                      coords->coords_stride, end - start);
+  measure_path_end(measure);
+}
+
+static void measure_native_polygon(struct GeoArrowMeasurePrivate* measure,
+                                   const struct GeoArrowArrayView* array_view, int level,
+                                   int64_t i) {
+  int64_t ring_start, ring_end, coord_start, coord_end;
+  GeoArrowArrayViewChildRange(array_view, level, i, &ring_start, &ring_end);
+  measure->path.ring_i = 0;
+  for (int64_t j = ring_start; j < ring_end; j++) {
+    GeoArrowArrayViewChildRange(array_view, level + 1, j, &coord_start, &coord_end);
+    measure_native_path(measure, &array_view->coords, coord_start, coord_end, 1);
+  }
+}
+
+static void measure_native_feature(struct GeoArrowMeasurePrivate* measure,
+                                   const struct GeoArrowArrayView* array_view,
+                                   int64_t i) {
+  const struct GeoArrowCoordView* coords = &array_view->coords;
+  int64_t start, end, coord_start, coord_end;
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      measure_points(measure, &GEOARROW_COORD_VIEW_VALUE(coords, i, 0),
+                     &GEOARROW_COORD_VIEW_VALUE(coords, i, 1), coords->coords_stride, 1);
+      break;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      measure_native_path(measure, coords, start, end, 0);
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      measure_native_polygon(measure, array_view, 0, i);
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      measure_points(measure, &GEOARROW_COORD_VIEW_VALUE(coords, start, 0),
+                     &GEOARROW_COORD_VIEW_VALUE(coords, start, 1), coords->coords_stride,
+                     end - start);
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      for (int64_t j = start; j < end; j++) {
+        GeoArrowArrayViewChildRange(array_view, 1, j, &coord_start, &coord_end);
+        measure_native_path(measure, coords, coord_start, coord_end, 0);
+      }
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      for (int64_t j = start; j < end; j++) {
+        measure_native_polygon(measure, array_view, 1, j);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// Computes the number of coordinates and parts of a feature from offsets only
+static void measure_native_counts(struct GeoArrowMeasurePrivate* measure,
+                                  const struct GeoArrowArrayView* array_view,
+                                  int64_t i) {
+  int64_t start = i;
+  int64_t end = i + 1;
+  for (int level = 0; level < array_view->n_offsets; level++) {
+    start = array_view->offsets[level][start] + array_view->offset[level + 1];
+    end = array_view->offsets[level][end] + array_view->offset[level + 1];
+  }
+
+  measure->feature.n_coords = end - start;
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      measure->feature.n_parts =
+          array_view->offsets[0][i + 1] - array_view->offsets[0][i];
+      break;
+    default:
+      measure->feature.n_parts = measure->feature.n_coords > 0;
+      break;
+  }
+}
+
+// Computes the number of coordinates and parts of a WKB feature from its headers.
+// raw_i already includes the offset of the array view.
+static int measure_wkb_counts(struct GeoArrowMeasurePrivate* measure,
+                              const struct GeoArrowArrayView* array_view, int64_t raw_i,
+                              struct GeoArrowError* error) {
+  if (measure->wkb_reader.private_data == NULL) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowWKBReaderInit(&measure->wkb_reader));
+  }
+
+  struct GeoArrowBufferView value;
+  value.data = array_view->data + array_view->offsets[0][raw_i];
+  value.size_bytes = array_view->offsets[0][raw_i + 1] - array_view->offsets[0][raw_i];
+
+  struct GeoArrowWKBSummary summary;
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowWKBReaderScan(&measure->wkb_reader, value, &summary, error));
+
+  measure->feature.n_coords = summary.num_coords;
+
+  switch (summary.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+    case GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION:
+      measure->feature.n_parts = summary.size;
+      break;
+    default:
+      measure->feature.n_parts = measure->feature.n_coords > 0;
+      break;
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMeasureSchemaInit(struct ArrowSchema* schema,
+                                            enum GeoArrowMeasureType type,
+                                            const struct GeoArrowMetadataView* metadata) {
+  switch (type) {
+    case GEOARROW_MEASURE_TYPE_LENGTH:
+    case GEOARROW_MEASURE_TYPE_AREA:
+      return ArrowSchemaInitFromType(schema, NANOARROW_TYPE_DOUBLE);
+    case GEOARROW_MEASURE_TYPE_NUM_COORDS:
+    case GEOARROW_MEASURE_TYPE_NUM_PARTS:
+      return ArrowSchemaInitFromType(schema, NANOARROW_TYPE_INT64);
+    case GEOARROW_MEASURE_TYPE_CENTROID:
+      break;
+    default:
+      return EINVAL;
+  }
+
+  if (metadata != NULL && metadata->edge_type != GEOARROW_EDGE_TYPE_PLANAR) {
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitExtension(schema, GEOARROW_TYPE_POINT));
+  if (metadata != NULL) {
+    int result = GeoArrowSchemaSetMetadata(schema, metadata);
+    if (result != GEOARROW_OK) {
+      schema->release(schema);
+      return result;
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMeasureWriterInit(struct GeoArrowMeasureWriter* writer,
+                                            enum GeoArrowMeasureType type,
+                                            enum GeoArrowEdgeType edge_type,
+                                            struct GeoArrowError* error) {
+  switch (type) {
+    case GEOARROW_MEASURE_TYPE_LENGTH:
+    case GEOARROW_MEASURE_TYPE_AREA:
+    case GEOARROW_MEASURE_TYPE_NUM_COORDS:
+    case GEOARROW_MEASURE_TYPE_NUM_PARTS:
+      break;
+    case GEOARROW_MEASURE_TYPE_CENTROID:
+      if (edge_type != GEOARROW_EDGE_TYPE_PLANAR) {
+        GeoArrowErrorSet(error, "Can't compute the centroid of non-planar edges");
+        return EINVAL;
+      }
+      break;
+    default:
+      GeoArrowErrorSet(error, "Unknown measure type %d", (int)type);
+      return EINVAL;
+  }
+
+  struct GeoArrowMeasurePrivate* private_data =
+      (struct GeoArrowMeasurePrivate*)ArrowMalloc(sizeof(struct GeoArrowMeasurePrivate));
+  if (private_data == NULL) {
+    GeoArrowErrorSet(error, "Failed to allocate GeoArrowMeasurePrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowMeasurePrivate));
+  private_data->type = type;
+  private_data->edge_type = edge_type;
+  ArrowBitmapInit(&private_data->validity);
+  for (int i = 0; i < 2; i++) {
+    ArrowBufferInit(&private_data->values[i]);
+  }
+
+  writer->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+void GeoArrowMeasureWriterInitVisitor(struct GeoArrowMeasureWriter* writer,
+                                      struct GeoArrowVisitor* v) {
+  GeoArrowVisitorInitVoid(v);
+
+  v->feat_start = &feat_start_measure;
+  v->null_feat = &null_feat_measure;
+  v->geom_start = &geom_start_measure;
+  v->ring_start = &ring_start_measure;
+  v->coords = &coords_measure;
+  v->ring_end = &ring_end_measure;
+  v->geom_end = &geom_end_measure;
+  v->feat_end = &feat_end_measure;
+  v->private_data = writer->private_data;
+}
+
+GeoArrowErrorCode GeoArrowMeasureWriterReserve(struct GeoArrowMeasureWriter* writer,
+                                               int64_t additional_length) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)writer->private_data;
+  int n_values = measure->type == GEOARROW_MEASURE_TYPE_CENTROID ? 2 : 1;
+  for (int i = 0; i < n_values; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+        &measure->values[i], additional_length * (int64_t)sizeof(double)));
+  }
+
+  if (measure->validity.buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(&measure->validity, additional_length));
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMeasureWriterAppend(struct GeoArrowMeasureWriter* writer,
+                                              const struct GeoArrowArrayView* array_view,
+                                              int64_t offset, int64_t length,
+                                              struct GeoArrowError* error) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)writer->private_data;
+
+  enum GeoArrowGeometryType geometry_type = array_view->schema_view.geometry_type;
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  int is_native = geometry_type >= GEOARROW_GEOMETRY_TYPE_POINT &&
+                  geometry_type <= GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON;
+  int is_counts = measure->type == GEOARROW_MEASURE_TYPE_NUM_COORDS ||
+                  measure->type == GEOARROW_MEASURE_TYPE_NUM_PARTS;
+  int is_double = is_native && !GeoArrowCoordTypeIsFloat(coord_type) &&
+                  !GeoArrowCoordTypeIsQuantized(coord_type);
+  int is_wkb = array_view->schema_view.type == GEOARROW_TYPE_WKB;
+
+  if (is_counts ? !(is_native || is_wkb) : !is_double) {
+    return ENOTSUP;
+  }
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowMeasureWriterReserve(writer, length));
+
+  for (int64_t i = 0; i < length; i++) {
+    int64_t raw_i = array_view->offset[0] + offset + i;
+    measure_feat_start(measure);
+    if (array_view->validity_bitmap != NULL &&
+        !ArrowBitGet(array_view->validity_bitmap, raw_i)) {
+      measure->feature.feat_null = 1;
+    } else if (is_wkb) {
+      NANOARROW_RETURN_NOT_OK(measure_wkb_counts(measure, array_view, raw_i, error));
+    } else if (is_counts) {
+      measure_native_counts(measure, array_view, raw_i);
+    } else {
+      measure_native_feature(measure, array_view, raw_i);
+    }
+
+    NANOARROW_RETURN_NOT_OK(measure_append(measure));
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMeasureWriterFinish(struct GeoArrowMeasureWriter* writer,
+                                              struct ArrowArray* array,
+                                              struct GeoArrowError* error) {
+  return measure_finish((struct GeoArrowMeasurePrivate*)writer->private_data, array,
+                        error);
+}
+
+void GeoArrowMeasureWriterReset(struct GeoArrowMeasureWriter* writer) {
+  struct GeoArrowMeasurePrivate* measure =
+      (struct GeoArrowMeasurePrivate*)writer->private_data;
+  if (measure->wkb_reader.private_data != NULL) {
+    GeoArrowWKBReaderReset(&measure->wkb_reader);
+  }
+
+  ArrowBitmapReset(&measure->validity);
+  for (int i = 0; i < 2; i++) {
+    ArrowBufferReset(&measure->values[i]);
+  }
+
+  ArrowFree(measure);
+  writer->private_data = NULL;
+}
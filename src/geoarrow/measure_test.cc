@@ -0,0 +1,158 @@
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+// Measures features offset to offset + length of array by appending (if visit is
+// false) or by visiting them, returning the values as strings (empty for null)
+static std::vector<std::string> Measure(enum GeoArrowMeasureType measure_type,
+                                        enum GeoArrowType type,
+                                        const struct ArrowArray* array, int64_t offset,
+                                        int64_t length, bool visit) {
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowMeasureWriter writer;
+  struct GeoArrowVisitor v;
+  struct GeoArrowError error;
+  struct ArrowArray out;
+  std::vector<std::string> values;
+
+  EXPECT_EQ(GeoArrowArrayViewInitFromType(&array_view, type), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowArrayViewSetArray(&array_view, array, &error), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowMeasureWriterInit(&writer, measure_type, GEOARROW_EDGE_TYPE_PLANAR,
+                                      &error),
+            GEOARROW_OK);
+  if (visit) {
+    GeoArrowMeasureWriterInitVisitor(&writer, &v);
+    v.error = &error;
+    EXPECT_EQ(GeoArrowArrayViewVisitNative(&array_view, offset, length, &v),
+              GEOARROW_OK);
+  } else {
+    EXPECT_EQ(
+        GeoArrowMeasureWriterAppend(&writer, &array_view, offset, length, &error),
+        GEOARROW_OK);
+  }
+
+  EXPECT_EQ(GeoArrowMeasureWriterFinish(&writer, &out, &error), GEOARROW_OK);
+  GeoArrowMeasureWriterReset(&writer);
+
+  EXPECT_EQ(out.length, length);
+  for (int64_t i = 0; i < out.length; i++) {
+    if (out.null_count > 0 &&
+        !ArrowBitGet(reinterpret_cast<const uint8_t*>(out.buffers[0]), i)) {
+      values.push_back("");
+    } else if (measure_type == GEOARROW_MEASURE_TYPE_NUM_COORDS ||
+               measure_type == GEOARROW_MEASURE_TYPE_NUM_PARTS) {
+      values.push_back(
+          std::to_string(reinterpret_cast<const int64_t*>(out.buffers[1])[i]));
+    } else {
+      values.push_back(
+          std::to_string(reinterpret_cast<const double*>(out.buffers[1])[i]));
+    }
+  }
+
+  out.release(&out);
+  return values;
+}
+
+TEST(MeasureTest, MeasureAppendMatchesVisit) {
+  struct ArrowArray array;
+  MakeNativeArray(GEOARROW_TYPE_MULTIPOLYGON,
+                  {"MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1)))",
+                   "", "MULTIPOLYGON EMPTY",
+                   "MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)), ((5 5, 6 5, 5 6, 5 5)))"},
+                  &array);
+
+  for (auto measure_type :
+       {GEOARROW_MEASURE_TYPE_LENGTH, GEOARROW_MEASURE_TYPE_AREA,
+        GEOARROW_MEASURE_TYPE_NUM_COORDS, GEOARROW_MEASURE_TYPE_NUM_PARTS}) {
+    SCOPED_TRACE(measure_type);
+    EXPECT_EQ(Measure(measure_type, GEOARROW_TYPE_MULTIPOLYGON, &array, 0, 4, false),
+              Measure(measure_type, GEOARROW_TYPE_MULTIPOLYGON, &array, 0, 4, true));
+    EXPECT_EQ(Measure(measure_type, GEOARROW_TYPE_MULTIPOLYGON, &array, 1, 3, false),
+              Measure(measure_type, GEOARROW_TYPE_MULTIPOLYGON, &array, 1, 3, true));
+  }
+
+  EXPECT_EQ(Measure(GEOARROW_MEASURE_TYPE_AREA, GEOARROW_TYPE_MULTIPOLYGON, &array, 0,
+                    4, false),
+            std::vector<std::string>({"99.500000", "", "0.000000", "1.000000"}));
+  EXPECT_EQ(Measure(GEOARROW_MEASURE_TYPE_NUM_PARTS, GEOARROW_TYPE_MULTIPOLYGON, &array,
+                    0, 4, false),
+            std::vector<std::string>({"1", "", "0", "2"}));
+
+  array.release(&array);
+}
+
+TEST(MeasureTest, MeasureAppendNotSupported) {
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowMeasureWriter writer;
+  struct GeoArrowError error;
+  struct ArrowArray out;
+
+  MakeNativeArray(GEOARROW_TYPE_FLOAT_LINESTRING, {"LINESTRING (0 0, 3 4)"}, &array);
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_FLOAT_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+
+  // Float coordinates have to be visited to compute a length...
+  ASSERT_EQ(GeoArrowMeasureWriterInit(&writer, GEOARROW_MEASURE_TYPE_LENGTH,
+                                      GEOARROW_EDGE_TYPE_PLANAR, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(GeoArrowMeasureWriterAppend(&writer, &array_view, 0, 1, &error), ENOTSUP);
+  ASSERT_EQ(GeoArrowMeasureWriterFinish(&writer, &out, &error), GEOARROW_OK);
+  EXPECT_EQ(out.length, 0);
+  out.release(&out);
+  GeoArrowMeasureWriterReset(&writer);
+
+  // ...but not to count them
+  ASSERT_EQ(GeoArrowMeasureWriterInit(&writer, GEOARROW_MEASURE_TYPE_NUM_COORDS,
+                                      GEOARROW_EDGE_TYPE_PLANAR, &error),
+            GEOARROW_OK);
+  EXPECT_EQ(GeoArrowMeasureWriterAppend(&writer, &array_view, 0, 1, &error),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowMeasureWriterFinish(&writer, &out, &error), GEOARROW_OK);
+  ASSERT_EQ(out.length, 1);
+  EXPECT_EQ(reinterpret_cast<const int64_t*>(out.buffers[1])[0], 2);
+  out.release(&out);
+  GeoArrowMeasureWriterReset(&writer);
+
+  array.release(&array);
+}
+
+TEST(MeasureTest, MeasureCentroidEdges) {
+  struct GeoArrowMeasureWriter writer;
+  struct GeoArrowError error;
+  struct GeoArrowMetadataView metadata;
+  struct ArrowSchema schema;
+
+  EXPECT_EQ(GeoArrowMeasureWriterInit(&writer, GEOARROW_MEASURE_TYPE_CENTROID,
+                                      GEOARROW_EDGE_TYPE_SPHERICAL, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't compute the centroid of non-planar edges");
+
+  GeoArrowMetadataViewInit(&metadata, {nullptr, 0}, nullptr);
+  metadata.edge_type = GEOARROW_EDGE_TYPE_SPHERICAL;
+  EXPECT_EQ(GeoArrowMeasureSchemaInit(&schema, GEOARROW_MEASURE_TYPE_CENTROID, &metadata),
+            EINVAL);
+
+  // Other measures are defined for any edge type
+  ASSERT_EQ(GeoArrowMeasureSchemaInit(&schema, GEOARROW_MEASURE_TYPE_AREA, &metadata),
+            GEOARROW_OK);
+  EXPECT_STREQ(schema.format, "g");
+  schema.release(&schema);
+
+  metadata.edge_type = GEOARROW_EDGE_TYPE_PLANAR;
+  ASSERT_EQ(GeoArrowMeasureSchemaInit(&schema, GEOARROW_MEASURE_TYPE_CENTROID, &metadata),
+            GEOARROW_OK);
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInit(&schema_view, &schema, &error), GEOARROW_OK);
+  EXPECT_EQ(schema_view.type, GEOARROW_TYPE_POINT);
+  schema.release(&schema);
+}
@@ -1,5 +1,6 @@
 
 #include <errno.h>
+#include <math.h>
 #include <stdio.h>
 
 #include "nanoarrow/nanoarrow.h"
@@ -183,6 +184,48 @@ static GeoArrowErrorCode FindObject(struct ArrowStringView* s,
   return EINVAL;
 }
 
+// Parses a JSON array of 1-4 finite numbers (e.g., the value of the "scale" key) into
+// out. Dimensions beyond the number of values specified repeat the last value.
+static GeoArrowErrorCode ParseNumberList(struct ArrowStringView v, double* out) {
+  struct ArrowStringView s = v;
+  NANOARROW_RETURN_NOT_OK(ParseChar(&s, '['));
+  SkipWhitespace(&s);
+
+  int n = 0;
+  while (s.size_bytes > 0 && s.data[0] != ']') {
+    if (n >= 4) {
+      return EINVAL;
+    }
+
+    const char* start = s.data;
+    SkipUntil(&s, ", \t\r\n]");
+    NANOARROW_RETURN_NOT_OK(GeoArrowFromChars(start, s.data, out + n));
+    if (!isfinite(out[n])) {
+      return EINVAL;
+    }
+
+    n++;
+
+    SkipWhitespace(&s);
+    if (s.size_bytes > 0 && s.data[0] == ',') {
+      s.size_bytes--;
+      s.data++;
+      SkipWhitespace(&s);
+    }
+  }
+
+  NANOARROW_RETURN_NOT_OK(ParseChar(&s, ']'));
+  if (n == 0) {
+    return EINVAL;
+  }
+
+  for (int i = n; i < 4; i++) {
+    out[i] = out[n - 1];
+  }
+
+  return GEOARROW_OK;
+}
+
 static GeoArrowErrorCode ParseJSONMetadata(struct GeoArrowMetadataView* metadata_view,
                                            struct ArrowStringView* s) {
   NANOARROW_RETURN_NOT_OK(ParseChar(s, '{'));
@@ -271,6 +314,23 @@ static GeoArrowErrorCode ParseJSONMetadata(struct GeoArrowMetadataView* metadata
         // Reject values that are not a string
         return EINVAL;
       }
+    } else if (k.size_bytes == 7 && strncmp(k.data, "\"scale\"", 7) == 0) {
+      if (v.data[0] != '[') {
+        return EINVAL;
+      }
+
+      NANOARROW_RETURN_NOT_OK(ParseNumberList(v, metadata_view->quantization.scale));
+      for (int i = 0; i < 4; i++) {
+        if (metadata_view->quantization.scale[i] == 0) {
+          return EINVAL;
+        }
+      }
+    } else if (k.size_bytes == 8 && strncmp(k.data, "\"offset\"", 8) == 0) {
+      if (v.data[0] != '[') {
+        return EINVAL;
+      }
+
+      NANOARROW_RETURN_NOT_OK(ParseNumberList(v, metadata_view->quantization.offset));
     }
 
     SkipUntil(s, ",}");
@@ -331,6 +391,7 @@ GeoArrowErrorCode GeoArrowMetadataViewInit(struct GeoArrowMetadataView* metadata
   metadata_view->crs_type = GEOARROW_CRS_TYPE_NONE;
   metadata_view->crs.data = NULL;
   metadata_view->crs.size_bytes = 0;
+  GeoArrowQuantizationInitDefault(&metadata_view->quantization);
 
   if (metadata.size_bytes == 0) {
     return GEOARROW_OK;
@@ -343,6 +404,49 @@ static int GeoArrowMetadataCrsNeedsEscape(struct GeoArrowStringView crs) {
   return (crs.size_bytes == 0) || (*crs.data != '{' && *crs.data != '"');
 }
 
+// Four values of at most 40 characters each plus brackets and commas
+#define GEOARROW_METADATA_NUMBER_LIST_MAX_SIZE (4 * 40 + 5)
+
+// Writes the value of the "scale" or "offset" key into out (which must have
+// space for at least GEOARROW_METADATA_NUMBER_LIST_MAX_SIZE characters) and returns
+// the number of characters written or -1 if any value is not finite (NaN and Inf
+// can't be represented in JSON). Writes nothing if all values are equal to
+// default_value or are all zero (i.e., the GeoArrowMetadataView was zero-initialized
+// and the quantization was never set).
+static int64_t GeoArrowMetadataWriteNumberList(const double* values,
+                                               double default_value, char* out) {
+  int all_default = 1;
+  int all_equal = 1;
+  for (int i = 0; i < 4; i++) {
+    if (!isfinite(values[i])) {
+      return -1;
+    }
+
+    all_default = all_default && values[i] == default_value;
+    all_equal = all_equal && values[i] == values[0];
+  }
+
+  if (all_default || (all_equal && values[0] == 0)) {
+    return 0;
+  }
+
+  int n_values = all_equal ? 1 : 4;
+  char* out_initial = out;
+  *out++ = '[';
+  for (int i = 0; i < n_values; i++) {
+    if (i > 0) {
+      *out++ = ',';
+    }
+
+    // Use the shortest representation that round trips (which, unlike snprintf(),
+    // does not depend on the decimal separator of the current locale)
+    out += GeoArrowPrintDouble(values[i], GEOARROW_PRECISION_SHORTEST, out);
+  }
+  *out++ = ']';
+
+  return out - out_initial;
+}
+
 static int64_t GeoArrowMetadataCalculateSerializedSize(
     const struct GeoArrowMetadataView* metadata_view) {
   const int64_t kSizeOuterBraces = 2;
@@ -352,6 +456,10 @@ static int64_t GeoArrowMetadataCalculateSerializedSize(
   const int64_t kSizeEdgesKey = 5 + kSizeQuotes + kSizeColon;
   const int64_t kSizeCrsTypeKey = 8 + kSizeQuotes + kSizeColon;
   const int64_t kSizeCrsKey = 3 + kSizeQuotes + kSizeColon;
+  const int64_t kSizeScaleKey = 5 + kSizeQuotes + kSizeColon;
+  const int64_t kSizeOffsetKey = 6 + kSizeQuotes + kSizeColon;
+  char number_list[GEOARROW_METADATA_NUMBER_LIST_MAX_SIZE];
+  int64_t number_list_size;
 
   int n_keys = 0;
   int64_t size_out = 0;
@@ -385,6 +493,24 @@ static int64_t GeoArrowMetadataCalculateSerializedSize(
     }
   }
 
+  number_list_size =
+      GeoArrowMetadataWriteNumberList(metadata_view->quantization.scale, 1, number_list);
+  if (number_list_size < 0) {
+    return -1;
+  } else if (number_list_size > 0) {
+    n_keys += 1;
+    size_out += kSizeScaleKey + number_list_size;
+  }
+
+  number_list_size =
+      GeoArrowMetadataWriteNumberList(metadata_view->quantization.offset, 0, number_list);
+  if (number_list_size < 0) {
+    return -1;
+  } else if (number_list_size > 0) {
+    n_keys += 1;
+    size_out += kSizeOffsetKey + number_list_size;
+  }
+
   if (n_keys > 1) {
     size_out += kSizeComma * (n_keys - 1);
   }
@@ -410,6 +536,10 @@ static int64_t GeoArrowMetadataSerializeInternal(
   const struct ArrowStringView kEdgesKey = ArrowCharView("\"edges\":");
   const struct ArrowStringView kCrsTypeKey = ArrowCharView("\"crs_type\":");
   const struct ArrowStringView kCrsKey = ArrowCharView("\"crs\":");
+  const struct ArrowStringView kScaleKey = ArrowCharView("\"scale\":");
+  const struct ArrowStringView kOffsetKey = ArrowCharView("\"offset\":");
+  char number_list[GEOARROW_METADATA_NUMBER_LIST_MAX_SIZE];
+  int64_t number_list_size;
 
   char* out_initial = out;
   int n_keys = 0;
@@ -464,6 +594,32 @@ static int64_t GeoArrowMetadataSerializeInternal(
     }
   }
 
+  number_list_size =
+      GeoArrowMetadataWriteNumberList(metadata_view->quantization.scale, 1, number_list);
+  if (number_list_size > 0) {
+    if (n_keys > 0) {
+      *out++ = ',';
+    }
+
+    n_keys += 1;
+    GeoArrowWriteStringView(kScaleKey, &out);
+    memcpy(out, number_list, number_list_size);
+    out += number_list_size;
+  }
+
+  number_list_size =
+      GeoArrowMetadataWriteNumberList(metadata_view->quantization.offset, 0, number_list);
+  if (number_list_size > 0) {
+    if (n_keys > 0) {
+      *out++ = ',';
+    }
+
+    n_keys += 1;
+    GeoArrowWriteStringView(kOffsetKey, &out);
+    memcpy(out, number_list, number_list_size);
+    out += number_list_size;
+  }
+
   *out++ = '}';
   return out - out_initial;
 }
@@ -471,6 +627,10 @@ static int64_t GeoArrowMetadataSerializeInternal(
 static GeoArrowErrorCode GeoArrowSchemaSetMetadataInternal(
     struct ArrowSchema* schema, const struct GeoArrowMetadataView* metadata_view) {
   int64_t metadata_size = GeoArrowMetadataCalculateSerializedSize(metadata_view);
+  if (metadata_size < 0) {
+    return EINVAL;
+  }
+
   char* metadata = (char*)ArrowMalloc(metadata_size);
   if (metadata == NULL) {
     return ENOMEM;
@@ -506,6 +666,10 @@ static GeoArrowErrorCode GeoArrowSchemaSetMetadataInternal(
 int64_t GeoArrowMetadataSerialize(const struct GeoArrowMetadataView* metadata_view,
                                   char* out, int64_t n) {
   int64_t metadata_size = GeoArrowMetadataCalculateSerializedSize(metadata_view);
+  if (metadata_size < 0) {
+    return metadata_size;
+  }
+
   if (metadata_size <= n) {
     int64_t chars_written = GeoArrowMetadataSerializeInternal(metadata_view, out);
     NANOARROW_DCHECK(chars_written == metadata_size);
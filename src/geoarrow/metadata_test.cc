@@ -1,3 +1,5 @@
+#include <cmath>
+
 
 #include <gtest/gtest.h>
 
@@ -186,6 +188,55 @@ TEST(MetadataTest, MetadataTestReadJSONCrs) {
   EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"crs_type": false})", EINVAL));
 }
 
+static struct GeoArrowStringView MakeStringView(const char* value) {
+  return {value, static_cast<int64_t>(strlen(value))};
+}
+
+TEST(MetadataTest, MetadataTestReadJSONQuantization) {
+  struct GeoArrowMetadataView metadata_view;
+  struct GeoArrowError error;
+
+  // Default
+  ASSERT_EQ(GeoArrowMetadataViewInit(&metadata_view, MakeStringView("{}"), &error),
+            GEOARROW_OK);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(metadata_view.quantization.scale[i], 1);
+    EXPECT_EQ(metadata_view.quantization.offset[i], 0);
+  }
+
+  // A single value applies to all dimensions
+  ASSERT_EQ(GeoArrowMetadataViewInit(
+                &metadata_view,
+                MakeStringView(R"({"scale": [0.001], "offset": [ -180 , -90 ]})"),
+                &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(metadata_view.quantization.scale[0], 0.001);
+  EXPECT_EQ(metadata_view.quantization.scale[3], 0.001);
+  EXPECT_EQ(metadata_view.quantization.offset[0], -180);
+  EXPECT_EQ(metadata_view.quantization.offset[1], -90);
+  EXPECT_EQ(metadata_view.quantization.offset[2], -90);
+
+  // Keys can be combined with other keys
+  ASSERT_EQ(
+      GeoArrowMetadataViewInit(
+          &metadata_view,
+          MakeStringView(R"({"scale": [1, 2, 3, 4], "crs": "OGC:CRS84"})"), &error),
+      GEOARROW_OK);
+  EXPECT_EQ(metadata_view.quantization.scale[3], 4);
+  EXPECT_EQ(metadata_view.crs_type, GEOARROW_CRS_TYPE_UNKNOWN);
+
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": []})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": [0]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": [1, 2, 3, 4, 5]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": ["1"]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"offset": {}})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": [nan]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"scale": [inf]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"offset": [0, -inf]})", EINVAL));
+  EXPECT_NO_FATAL_FAILURE(TestMetadataError(R"({"offset": [1e400]})", EINVAL));
+}
+
 TEST(MetadataTest, MetadataTestSetMetadata) {
   struct GeoArrowMetadataView metadata_view;
   struct GeoArrowStringView metadata;
@@ -254,6 +305,58 @@ TEST(MetadataTest, MetadataTestWriteJSON) {
   EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, nullptr, 0), 10);
   EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), 10);
   EXPECT_STREQ(out, "{\"crs\":{}}");
+
+  metadata_view.crs_type = GEOARROW_CRS_TYPE_NONE;
+  metadata_view.quantization.scale[0] = 0.1;
+  metadata_view.quantization.scale[1] = 0.1;
+  metadata_view.quantization.scale[2] = 0.1;
+  metadata_view.quantization.scale[3] = 0.1;
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, nullptr, 0), 15);
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), 15);
+  EXPECT_STREQ(out, "{\"scale\":[0.1]}");
+
+  metadata_view.quantization.offset[1] = -90;
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, nullptr, 0), 36);
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), 36);
+  EXPECT_STREQ(out, "{\"scale\":[0.1],\"offset\":[0,-90,0,0]}");
+
+  // Serialized values round trip
+  struct GeoArrowMetadataView metadata_view2;
+  ASSERT_EQ(GeoArrowMetadataViewInit(&metadata_view2, MakeStringView(out), nullptr),
+            GEOARROW_OK);
+  EXPECT_EQ(metadata_view2.quantization.scale[2], 0.1);
+  EXPECT_EQ(metadata_view2.quantization.offset[1], -90);
+
+  // ...including values that need all 17 significant digits
+  metadata_view.quantization.scale[0] = 1.0 / 3;
+  metadata_view.quantization.offset[0] = -1e-7;
+  metadata_view.quantization.offset[1] = 6378137.0 * 3.141592653589793;
+  metadata_view.quantization.offset[3] = 1e20;
+  ASSERT_GT(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), 0);
+  ASSERT_EQ(GeoArrowMetadataViewInit(&metadata_view2, MakeStringView(out), nullptr),
+            GEOARROW_OK);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(metadata_view2.quantization.scale[i], metadata_view.quantization.scale[i]);
+    EXPECT_EQ(metadata_view2.quantization.offset[i],
+              metadata_view.quantization.offset[i]);
+  }
+
+  // NaN and Inf can't be written as JSON
+  struct ArrowSchema schema;
+  ASSERT_EQ(GeoArrowSchemaInitExtension(&schema, GEOARROW_TYPE_POINT), GEOARROW_OK);
+  metadata_view.quantization.scale[1] = NAN;
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), -1);
+  EXPECT_EQ(GeoArrowSchemaSetMetadata(&schema, &metadata_view), EINVAL);
+  metadata_view.quantization.scale[1] = 1;
+  metadata_view.quantization.offset[2] = INFINITY;
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), -1);
+  EXPECT_EQ(GeoArrowSchemaSetMetadata(&schema, &metadata_view), EINVAL);
+  schema.release(&schema);
+
+  // A zero-initialized quantization is not serialized
+  memset(&metadata_view.quantization, 0, sizeof(struct GeoArrowQuantization));
+  EXPECT_EQ(GeoArrowMetadataSerialize(&metadata_view, out, sizeof(out)), 2);
+  EXPECT_STREQ(out, "{}");
 }
 
 TEST(MetadataTest, MetadataTestUnescapeCRS) {
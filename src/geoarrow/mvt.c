@@ -0,0 +1,838 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Protocol buffer wire types and the field numbers of the vector tile schema
+// (https://github.com/mapbox/vector-tile-spec/blob/master/2.1/vector_tile.proto)
+#define GEOARROW_MVT_WIRE_VARINT 0
+#define GEOARROW_MVT_WIRE_FIXED64 1
+#define GEOARROW_MVT_WIRE_LEN 2
+#define GEOARROW_MVT_WIRE_FIXED32 5
+
+#define GEOARROW_MVT_TILE_LAYERS 3
+
+#define GEOARROW_MVT_LAYER_NAME 1
+#define GEOARROW_MVT_LAYER_FEATURES 2
+#define GEOARROW_MVT_LAYER_KEYS 3
+#define GEOARROW_MVT_LAYER_VALUES 4
+#define GEOARROW_MVT_LAYER_EXTENT 5
+#define GEOARROW_MVT_LAYER_VERSION 15
+
+#define GEOARROW_MVT_FEATURE_TAGS 2
+#define GEOARROW_MVT_FEATURE_TYPE 3
+#define GEOARROW_MVT_FEATURE_GEOMETRY 4
+
+#define GEOARROW_MVT_VALUE_STRING 1
+#define GEOARROW_MVT_VALUE_FLOAT 2
+#define GEOARROW_MVT_VALUE_DOUBLE 3
+#define GEOARROW_MVT_VALUE_UINT 5
+#define GEOARROW_MVT_VALUE_SINT 6
+#define GEOARROW_MVT_VALUE_BOOL 7
+
+#define GEOARROW_MVT_COMMAND_MOVE_TO 1
+#define GEOARROW_MVT_COMMAND_LINE_TO 2
+#define GEOARROW_MVT_COMMAND_CLOSE_PATH 7
+
+#define GEOARROW_MVT_GEOM_POINT 1
+#define GEOARROW_MVT_GEOM_LINESTRING 2
+#define GEOARROW_MVT_GEOM_POLYGON 3
+
+struct GeoArrowMVTWriterPrivate {
+  struct GeoArrowArrayView array_view;
+  int mvt_geometry_type;
+  struct ArrowBuffer name;
+  uint32_t extent;
+
+  // Attribute columns and their names, which are encoded as the layer's keys
+  int has_attributes;
+  struct ArrowArrayView attributes;
+  struct ArrowBuffer keys;
+
+  // Encoded features (each framed as a Layer.features field)
+  struct ArrowBuffer features;
+  int64_t n_features;
+
+  // Unique encoded Value messages, their start offsets (plus one final offset), and
+  // an open addressing hash table of value index + 1 (zero for an empty slot)
+  struct ArrowBuffer values;
+  struct ArrowBuffer value_offsets;
+  struct ArrowBuffer value_table;
+  int64_t n_values;
+
+  // Scratch space for the current feature
+  struct ArrowBuffer geometry;
+  struct ArrowBuffer tags;
+  struct ArrowBuffer value;
+  struct ArrowBuffer path;
+
+  // The encoded layer
+  struct ArrowBuffer layer;
+};
+
+static inline int64_t GeoArrowMVTVarintSize(uint64_t value) {
+  int64_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+
+  return size;
+}
+
+static inline void GeoArrowMVTAppendVarintUnsafe(struct ArrowBuffer* buffer,
+                                                 uint64_t value) {
+  uint8_t* out = buffer->data + buffer->size_bytes;
+  while (value >= 0x80) {
+    *out++ = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+
+  *out++ = (uint8_t)value;
+  buffer->size_bytes = out - buffer->data;
+}
+
+static inline ArrowErrorCode GeoArrowMVTAppendVarint(struct ArrowBuffer* buffer,
+                                                     uint64_t value) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, 10));
+  GeoArrowMVTAppendVarintUnsafe(buffer, value);
+  return GEOARROW_OK;
+}
+
+static inline ArrowErrorCode GeoArrowMVTAppendTag(struct ArrowBuffer* buffer,
+                                                  uint32_t field, uint32_t wire_type) {
+  return GeoArrowMVTAppendVarint(buffer, (field << 3) | wire_type);
+}
+
+static ArrowErrorCode GeoArrowMVTAppendBytesField(struct ArrowBuffer* buffer,
+                                                  uint32_t field, const void* data,
+                                                  int64_t size_bytes) {
+  NANOARROW_RETURN_NOT_OK(GeoArrowMVTAppendTag(buffer, field, GEOARROW_MVT_WIRE_LEN));
+  NANOARROW_RETURN_NOT_OK(GeoArrowMVTAppendVarint(buffer, (uint64_t)size_bytes));
+  return ArrowBufferAppend(buffer, data, size_bytes);
+}
+
+static inline uint32_t GeoArrowMVTZigZag32(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline uint64_t GeoArrowMVTZigZag64(int64_t value) {
+  return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline uint32_t GeoArrowMVTCommand(uint32_t id, int64_t count) {
+  return (id & 0x7) | ((uint32_t)count << 3);
+}
+
+static int GeoArrowMVTGeometryType(enum GeoArrowGeometryType geometry_type) {
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return GEOARROW_MVT_GEOM_POINT;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return GEOARROW_MVT_GEOM_LINESTRING;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      return GEOARROW_MVT_GEOM_POLYGON;
+    default:
+      return 0;
+  }
+}
+
+static int GeoArrowMVTAttributeTypeSupported(enum ArrowType type) {
+  switch (type) {
+    case NANOARROW_TYPE_BOOL:
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+    case NANOARROW_TYPE_FLOAT:
+    case NANOARROW_TYPE_DOUBLE:
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static void GeoArrowMVTWriterClear(struct GeoArrowMVTWriterPrivate* private_data) {
+  private_data->features.size_bytes = 0;
+  private_data->n_features = 0;
+  private_data->values.size_bytes = 0;
+  private_data->value_offsets.size_bytes = 0;
+  if (private_data->value_table.size_bytes > 0) {
+    memset(private_data->value_table.data, 0,
+           (size_t)private_data->value_table.size_bytes);
+  }
+  private_data->n_values = 0;
+}
+
+static void GeoArrowMVTWriterPrivateReset(struct GeoArrowMVTWriterPrivate* private_data) {
+  ArrowBufferReset(&private_data->name);
+  ArrowArrayViewReset(&private_data->attributes);
+  ArrowBufferReset(&private_data->keys);
+  ArrowBufferReset(&private_data->features);
+  ArrowBufferReset(&private_data->values);
+  ArrowBufferReset(&private_data->value_offsets);
+  ArrowBufferReset(&private_data->value_table);
+  ArrowBufferReset(&private_data->geometry);
+  ArrowBufferReset(&private_data->tags);
+  ArrowBufferReset(&private_data->value);
+  ArrowBufferReset(&private_data->path);
+  ArrowBufferReset(&private_data->layer);
+}
+
+GeoArrowErrorCode GeoArrowMVTWriterInit(struct GeoArrowMVTWriter* writer,
+                                        enum GeoArrowType type, const char* layer_name,
+                                        uint32_t extent,
+                                        const struct ArrowSchema* attributes,
+                                        struct GeoArrowError* error) {
+  struct GeoArrowMVTWriterPrivate* private_data =
+      (struct GeoArrowMVTWriterPrivate*)ArrowMalloc(
+          sizeof(struct GeoArrowMVTWriterPrivate));
+  if (private_data == NULL) {
+    GeoArrowErrorSet(error, "Failed to allocate GeoArrowMVTWriterPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowMVTWriterPrivate));
+  ArrowBufferInit(&private_data->name);
+  ArrowArrayViewInitFromType(&private_data->attributes, NANOARROW_TYPE_UNINITIALIZED);
+  ArrowBufferInit(&private_data->keys);
+  ArrowBufferInit(&private_data->features);
+  ArrowBufferInit(&private_data->values);
+  ArrowBufferInit(&private_data->value_offsets);
+  ArrowBufferInit(&private_data->value_table);
+  ArrowBufferInit(&private_data->geometry);
+  ArrowBufferInit(&private_data->tags);
+  ArrowBufferInit(&private_data->value);
+  ArrowBufferInit(&private_data->path);
+  ArrowBufferInit(&private_data->layer);
+
+  int result = GeoArrowArrayViewInitFromType(&private_data->array_view, type);
+  enum GeoArrowCoordType coord_type = private_data->array_view.schema_view.coord_type;
+  private_data->mvt_geometry_type =
+      GeoArrowMVTGeometryType(private_data->array_view.schema_view.geometry_type);
+  if (result != GEOARROW_OK || private_data->mvt_geometry_type == 0 ||
+      GeoArrowCoordTypeIsFloat(coord_type) || GeoArrowCoordTypeIsQuantized(coord_type)) {
+    GeoArrowErrorSet(error, "Can't encode array of type %d as MVT geometries", (int)type);
+    GeoArrowMVTWriterPrivateReset(private_data);
+    ArrowFree(private_data);
+    return EINVAL;
+  }
+
+  private_data->extent = extent;
+  result =
+      ArrowBufferAppend(&private_data->name, layer_name, (int64_t)strlen(layer_name));
+
+  // Each attribute column's name is a key whose index is the column index
+  if (result == GEOARROW_OK && attributes != NULL) {
+    private_data->has_attributes = 1;
+    result = ArrowArrayViewInitFromSchema(&private_data->attributes, attributes,
+                                          (struct ArrowError*)error);
+    if (result == GEOARROW_OK &&
+        private_data->attributes.storage_type != NANOARROW_TYPE_STRUCT) {
+      GeoArrowErrorSet(error, "Expected struct array for MVT attributes");
+      result = EINVAL;
+    }
+
+    for (int64_t i = 0; result == GEOARROW_OK && i < attributes->n_children; i++) {
+      const char* name = attributes->children[i]->name;
+      name = name == NULL ? "" : name;
+      if (!GeoArrowMVTAttributeTypeSupported(
+              private_data->attributes.children[i]->storage_type)) {
+        GeoArrowErrorSet(error, "Unsupported MVT attribute type for column '%s'", name);
+        result = ENOTSUP;
+        break;
+      }
+
+      result = GeoArrowMVTAppendBytesField(&private_data->keys, GEOARROW_MVT_LAYER_KEYS,
+                                           name, (int64_t)strlen(name));
+    }
+  }
+
+  if (result != GEOARROW_OK) {
+    GeoArrowMVTWriterPrivateReset(private_data);
+    ArrowFree(private_data);
+    return result;
+  }
+
+  writer->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+// Encodes the value of row i of an attribute column as a Value message
+static ArrowErrorCode GeoArrowMVTEncodeValue(struct ArrowBuffer* out,
+                                             const struct ArrowArrayView* column,
+                                             int64_t i) {
+  out->size_bytes = 0;
+  switch (column->storage_type) {
+    case NANOARROW_TYPE_BOOL:
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowMVTAppendTag(out, GEOARROW_MVT_VALUE_BOOL, GEOARROW_MVT_WIRE_VARINT));
+      return GeoArrowMVTAppendVarint(out, ArrowArrayViewGetIntUnsafe(column, i) != 0);
+    case NANOARROW_TYPE_INT8:
+    case NANOARROW_TYPE_INT16:
+    case NANOARROW_TYPE_INT32:
+    case NANOARROW_TYPE_INT64:
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowMVTAppendTag(out, GEOARROW_MVT_VALUE_SINT, GEOARROW_MVT_WIRE_VARINT));
+      return GeoArrowMVTAppendVarint(
+          out, GeoArrowMVTZigZag64(ArrowArrayViewGetIntUnsafe(column, i)));
+    case NANOARROW_TYPE_UINT8:
+    case NANOARROW_TYPE_UINT16:
+    case NANOARROW_TYPE_UINT32:
+    case NANOARROW_TYPE_UINT64:
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowMVTAppendTag(out, GEOARROW_MVT_VALUE_UINT, GEOARROW_MVT_WIRE_VARINT));
+      return GeoArrowMVTAppendVarint(out, ArrowArrayViewGetUIntUnsafe(column, i));
+    case NANOARROW_TYPE_FLOAT: {
+      // Wire values are little endian
+      float value = (float)ArrowArrayViewGetDoubleUnsafe(column, i);
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      uint8_t bytes[4];
+      for (int j = 0; j < 4; j++) {
+        bytes[j] = (uint8_t)(bits >> (8 * j));
+      }
+
+      NANOARROW_RETURN_NOT_OK(
+          GeoArrowMVTAppendTag(out, GEOARROW_MVT_VALUE_FLOAT, GEOARROW_MVT_WIRE_FIXED32));
+      return ArrowBufferAppend(out, bytes, sizeof(bytes));
+    }
+    case NANOARROW_TYPE_DOUBLE: {
+      double value = ArrowArrayViewGetDoubleUnsafe(column, i);
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      uint8_t bytes[8];
+      for (int j = 0; j < 8; j++) {
+        bytes[j] = (uint8_t)(bits >> (8 * j));
+      }
+
+      NANOARROW_RETURN_NOT_OK(GeoArrowMVTAppendTag(out, GEOARROW_MVT_VALUE_DOUBLE,
+                                                   GEOARROW_MVT_WIRE_FIXED64));
+      return ArrowBufferAppend(out, bytes, sizeof(bytes));
+    }
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING: {
+      struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(column, i);
+      return GeoArrowMVTAppendBytesField(out, GEOARROW_MVT_VALUE_STRING, value.data,
+                                         value.size_bytes);
+    }
+    default:
+      return ENOTSUP;
+  }
+}
+
+static inline uint64_t GeoArrowMVTHash(const uint8_t* data, int64_t size_bytes) {
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  for (int64_t i = 0; i < size_bytes; i++) {
+    hash ^= data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+static void GeoArrowMVTValueTableInsert(struct GeoArrowMVTWriterPrivate* private_data,
+                                        int64_t value_index, uint64_t hash) {
+  int64_t* table = (int64_t*)private_data->value_table.data;
+  int64_t mask = private_data->value_table.size_bytes / (int64_t)sizeof(int64_t) - 1;
+  int64_t slot = (int64_t)(hash & (uint64_t)mask);
+  while (table[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+
+  table[slot] = value_index + 1;
+}
+
+// Doubles the capacity of the value table (keeping it at most half full)
+static ArrowErrorCode GeoArrowMVTValueTableGrow(
+    struct GeoArrowMVTWriterPrivate* private_data) {
+  int64_t capacity = private_data->value_table.size_bytes / (int64_t)sizeof(int64_t);
+  capacity = capacity == 0 ? 64 : capacity * 2;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(&private_data->value_table,
+                                            capacity * (int64_t)sizeof(int64_t), 0));
+  if (private_data->value_table.size_bytes > 0) {
+    memset(private_data->value_table.data, 0,
+           (size_t)private_data->value_table.size_bytes);
+  }
+
+  const int64_t* offsets = (const int64_t*)private_data->value_offsets.data;
+  for (int64_t i = 0; i < private_data->n_values; i++) {
+    uint64_t hash = GeoArrowMVTHash(private_data->values.data + offsets[i],
+                                    offsets[i + 1] - offsets[i]);
+    GeoArrowMVTValueTableInsert(private_data, i, hash);
+  }
+
+  return GEOARROW_OK;
+}
+
+// Finds or adds the value that was just encoded in private_data->value
+static ArrowErrorCode GeoArrowMVTValueIndex(struct GeoArrowMVTWriterPrivate* private_data,
+                                            int64_t* value_index) {
+  const uint8_t* value = private_data->value.data;
+  int64_t value_size = private_data->value.size_bytes;
+  uint64_t hash = GeoArrowMVTHash(value, value_size);
+
+  int64_t capacity = private_data->value_table.size_bytes / (int64_t)sizeof(int64_t);
+  if (capacity > 0) {
+    const int64_t* table = (const int64_t*)private_data->value_table.data;
+    const int64_t* offsets = (const int64_t*)private_data->value_offsets.data;
+    int64_t mask = capacity - 1;
+    for (int64_t slot = (int64_t)(hash & (uint64_t)mask); table[slot] != 0;
+         slot = (slot + 1) & mask) {
+      int64_t i = table[slot] - 1;
+      if ((offsets[i + 1] - offsets[i]) == value_size &&
+          memcmp(private_data->values.data + offsets[i], value, (size_t)value_size) ==
+              0) {
+        *value_index = i;
+        return GEOARROW_OK;
+      }
+    }
+  }
+
+  if ((private_data->n_values + 1) * 2 > capacity) {
+    NANOARROW_RETURN_NOT_OK(GeoArrowMVTValueTableGrow(private_data));
+  }
+
+  if (private_data->n_values == 0) {
+    int64_t zero = 0;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(&private_data->value_offsets, &zero, sizeof(int64_t)));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&private_data->values, value, value_size));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(&private_data->value_offsets,
+                                            &private_data->values.size_bytes,
+                                            sizeof(int64_t)));
+
+  *value_index = private_data->n_values++;
+  GeoArrowMVTValueTableInsert(private_data, *value_index, hash);
+  return GEOARROW_OK;
+}
+
+static ArrowErrorCode GeoArrowMVTEncodeTags(struct GeoArrowMVTWriterPrivate* private_data,
+                                            int64_t i) {
+  private_data->tags.size_bytes = 0;
+  if (!private_data->has_attributes) {
+    return GEOARROW_OK;
+  }
+
+  int64_t raw_i = private_data->attributes.offset + i;
+  for (int64_t j = 0; j < private_data->attributes.n_children; j++) {
+    const struct ArrowArrayView* column = private_data->attributes.children[j];
+    if (ArrowArrayViewIsNull(column, raw_i)) {
+      continue;
+    }
+
+    int64_t value_index;
+    NANOARROW_RETURN_NOT_OK(GeoArrowMVTEncodeValue(&private_data->value, column, raw_i));
+    NANOARROW_RETURN_NOT_OK(GeoArrowMVTValueIndex(private_data, &value_index));
+    NANOARROW_RETURN_NOT_OK(GeoArrowMVTAppendVarint(&private_data->tags, (uint64_t)j));
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowMVTAppendVarint(&private_data->tags, (uint64_t)value_index));
+  }
+
+  return GEOARROW_OK;
+}
+
+// Rounds the coordinates [start, end) of a linestring or ring to integers in
+// private_data->path, skipping repeated coordinates (for rings, including the
+// closing coordinate), and returns the number of coordinates written. For rings,
+// area2 is set to twice the signed area (positive when clockwise with y pointing
+// down, i.e., in tile coordinates).
+static ArrowErrorCode GeoArrowMVTRoundPath(struct GeoArrowMVTWriterPrivate* private_data,
+                                           int64_t start, int64_t end, int is_ring,
+                                           int64_t* n_out, int64_t* area2) {
+  const struct GeoArrowCoordView* coords = &private_data->array_view.coords;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+      &private_data->path, (end - start) * 2 * (int64_t)sizeof(int32_t), 0));
+  int32_t* path = (int32_t*)private_data->path.data;
+
+  int64_t n = 0;
+  for (int64_t i = start; i < end; i++) {
+    int32_t x = (int32_t)floor(GEOARROW_COORD_VIEW_VALUE(coords, i, 0) + 0.5);
+    int32_t y = (int32_t)floor(GEOARROW_COORD_VIEW_VALUE(coords, i, 1) + 0.5);
+    if (n > 0 && x == path[2 * (n - 1)] && y == path[2 * (n - 1) + 1]) {
+      continue;
+    }
+
+    path[2 * n] = x;
+    path[2 * n + 1] = y;
+    n++;
+  }
+
+  if (is_ring) {
+    while (n > 1 && path[2 * (n - 1)] == path[0] && path[2 * (n - 1) + 1] == path[1]) {
+      n--;
+    }
+
+    int64_t area = 0;
+    for (int64_t i = 0; i < n; i++) {
+      int64_t next = i + 1 == n ? 0 : i + 1;
+      area += (int64_t)path[2 * i] * path[2 * next + 1] -
+              (int64_t)path[2 * next] * path[2 * i + 1];
+    }
+
+    *area2 = area;
+  }
+
+  *n_out = n;
+  return GEOARROW_OK;
+}
+
+// Appends the delta from the cursor to point i of private_data->path as a
+// parameter of the current command
+static inline void GeoArrowMVTAppendPointUnsafe(
+    struct GeoArrowMVTWriterPrivate* private_data, int64_t i, int32_t* cursor) {
+  const int32_t* path = (const int32_t*)private_data->path.data;
+  int32_t x = path[2 * i];
+  int32_t y = path[2 * i + 1];
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTZigZag32((int32_t)((uint32_t)x - cursor[0])));
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTZigZag32((int32_t)((uint32_t)y - cursor[1])));
+  cursor[0] = x;
+  cursor[1] = y;
+}
+
+// Encodes the points [start, end) as a single MoveTo command
+static ArrowErrorCode GeoArrowMVTEncodePoints(
+    struct GeoArrowMVTWriterPrivate* private_data, int64_t start, int64_t end,
+    int32_t* cursor) {
+  const struct GeoArrowCoordView* coords = &private_data->array_view.coords;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+      &private_data->path, (end - start) * 2 * (int64_t)sizeof(int32_t), 0));
+  int32_t* path = (int32_t*)private_data->path.data;
+
+  // Empty points are stored as nan
+  int64_t n = 0;
+  for (int64_t i = start; i < end; i++) {
+    double x = GEOARROW_COORD_VIEW_VALUE(coords, i, 0);
+    double y = GEOARROW_COORD_VIEW_VALUE(coords, i, 1);
+    if (isnan(x) || isnan(y)) {
+      continue;
+    }
+
+    path[2 * n] = (int32_t)floor(x + 0.5);
+    path[2 * n + 1] = (int32_t)floor(y + 0.5);
+    n++;
+  }
+
+  if (n == 0) {
+    return GEOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private_data->geometry, (1 + 2 * n) * 5));
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_MOVE_TO, n));
+  for (int64_t i = 0; i < n; i++) {
+    GeoArrowMVTAppendPointUnsafe(private_data, i, cursor);
+  }
+
+  return GEOARROW_OK;
+}
+
+static ArrowErrorCode GeoArrowMVTEncodeLinestring(
+    struct GeoArrowMVTWriterPrivate* private_data, int64_t start, int64_t end,
+    int32_t* cursor) {
+  int64_t n;
+  NANOARROW_RETURN_NOT_OK(GeoArrowMVTRoundPath(private_data, start, end, 0, &n, NULL));
+  if (n < 2) {
+    return GEOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private_data->geometry, (2 + 2 * n) * 5));
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_MOVE_TO, 1));
+  GeoArrowMVTAppendPointUnsafe(private_data, 0, cursor);
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_LINE_TO, n - 1));
+  for (int64_t i = 1; i < n; i++) {
+    GeoArrowMVTAppendPointUnsafe(private_data, i, cursor);
+  }
+
+  return GEOARROW_OK;
+}
+
+// Encodes a ring such that it is clockwise in tile coordinates if it is the
+// exterior ring and counterclockwise otherwise. Rings with fewer than three
+// distinct coordinates or no area are skipped and written is set to zero.
+static ArrowErrorCode GeoArrowMVTEncodeRing(struct GeoArrowMVTWriterPrivate* private_data,
+                                            int64_t start, int64_t end, int is_exterior,
+                                            int32_t* cursor, int* written) {
+  int64_t n;
+  int64_t area2;
+  *written = 0;
+  NANOARROW_RETURN_NOT_OK(GeoArrowMVTRoundPath(private_data, start, end, 1, &n, &area2));
+  if (n < 3 || area2 == 0) {
+    return GEOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private_data->geometry, (3 + 2 * n) * 5));
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_MOVE_TO, 1));
+  GeoArrowMVTAppendPointUnsafe(private_data, 0, cursor);
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_LINE_TO, n - 1));
+  if ((area2 > 0) == is_exterior) {
+    for (int64_t i = 1; i < n; i++) {
+      GeoArrowMVTAppendPointUnsafe(private_data, i, cursor);
+    }
+  } else {
+    for (int64_t i = n - 1; i > 0; i--) {
+      GeoArrowMVTAppendPointUnsafe(private_data, i, cursor);
+    }
+  }
+
+  GeoArrowMVTAppendVarintUnsafe(&private_data->geometry,
+                                GeoArrowMVTCommand(GEOARROW_MVT_COMMAND_CLOSE_PATH, 1));
+  *written = 1;
+  return GEOARROW_OK;
+}
+
+// Encodes polygon i whose rings are given by the offsets at level. Holes of a
+// polygon whose exterior ring was skipped are also skipped.
+static ArrowErrorCode GeoArrowMVTEncodePolygon(
+    struct GeoArrowMVTWriterPrivate* private_data, int level, int64_t i,
+    int32_t* cursor) {
+  const struct GeoArrowArrayView* array_view = &private_data->array_view;
+  int64_t ring_start, ring_end, coord_start, coord_end;
+  GeoArrowArrayViewChildRange(array_view, level, i, &ring_start, &ring_end);
+  for (int64_t j = ring_start; j < ring_end; j++) {
+    int written;
+    GeoArrowArrayViewChildRange(array_view, level + 1, j, &coord_start, &coord_end);
+    NANOARROW_RETURN_NOT_OK(GeoArrowMVTEncodeRing(
+        private_data, coord_start, coord_end, j == ring_start, cursor, &written));
+    if (!written && j == ring_start) {
+      break;
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+static ArrowErrorCode GeoArrowMVTEncodeGeometry(
+    struct GeoArrowMVTWriterPrivate* private_data, int64_t i) {
+  const struct GeoArrowArrayView* array_view = &private_data->array_view;
+  int32_t cursor[2] = {0, 0};
+  int64_t start, end, coord_start, coord_end;
+  private_data->geometry.size_bytes = 0;
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      return GeoArrowMVTEncodePoints(private_data, i, i + 1, cursor);
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      return GeoArrowMVTEncodePoints(private_data, start, end, cursor);
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      return GeoArrowMVTEncodeLinestring(private_data, start, end, cursor);
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      for (int64_t j = start; j < end; j++) {
+        GeoArrowArrayViewChildRange(array_view, 1, j, &coord_start, &coord_end);
+        NANOARROW_RETURN_NOT_OK(
+            GeoArrowMVTEncodeLinestring(private_data, coord_start, coord_end, cursor));
+      }
+      return GEOARROW_OK;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      return GeoArrowMVTEncodePolygon(private_data, 0, i, cursor);
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      GeoArrowArrayViewChildRange(array_view, 0, i, &start, &end);
+      for (int64_t j = start; j < end; j++) {
+        NANOARROW_RETURN_NOT_OK(GeoArrowMVTEncodePolygon(private_data, 1, j, cursor));
+      }
+      return GEOARROW_OK;
+    default:
+      return ENOTSUP;
+  }
+}
+
+// Frames the current feature's tags and geometry as a Layer.features field
+static ArrowErrorCode GeoArrowMVTAppendFeature(
+    struct GeoArrowMVTWriterPrivate* private_data) {
+  int64_t tags_size = private_data->tags.size_bytes;
+  int64_t geometry_size = private_data->geometry.size_bytes;
+
+  int64_t feature_size = 2 + 1 + GeoArrowMVTVarintSize((uint64_t)geometry_size) +
+                         geometry_size;
+  if (tags_size > 0) {
+    feature_size += 1 + GeoArrowMVTVarintSize((uint64_t)tags_size) + tags_size;
+  }
+
+  struct ArrowBuffer* features = &private_data->features;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(features, 10 + feature_size));
+  GeoArrowMVTAppendVarintUnsafe(
+      features, (GEOARROW_MVT_LAYER_FEATURES << 3) | GEOARROW_MVT_WIRE_LEN);
+  GeoArrowMVTAppendVarintUnsafe(features, (uint64_t)feature_size);
+  if (tags_size > 0) {
+    GeoArrowMVTAppendVarintUnsafe(
+        features, (GEOARROW_MVT_FEATURE_TAGS << 3) | GEOARROW_MVT_WIRE_LEN);
+    GeoArrowMVTAppendVarintUnsafe(features, (uint64_t)tags_size);
+    memcpy(features->data + features->size_bytes, private_data->tags.data,
+           (size_t)tags_size);
+    features->size_bytes += tags_size;
+  }
+
+  GeoArrowMVTAppendVarintUnsafe(
+      features, (GEOARROW_MVT_FEATURE_TYPE << 3) | GEOARROW_MVT_WIRE_VARINT);
+  GeoArrowMVTAppendVarintUnsafe(features, (uint64_t)private_data->mvt_geometry_type);
+  GeoArrowMVTAppendVarintUnsafe(
+      features, (GEOARROW_MVT_FEATURE_GEOMETRY << 3) | GEOARROW_MVT_WIRE_LEN);
+  GeoArrowMVTAppendVarintUnsafe(features, (uint64_t)geometry_size);
+  memcpy(features->data + features->size_bytes, private_data->geometry.data,
+         (size_t)geometry_size);
+  features->size_bytes += geometry_size;
+
+  private_data->n_features++;
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMVTWriterAppend(struct GeoArrowMVTWriter* writer,
+                                          const struct ArrowArray* array,
+                                          const struct ArrowArray* attributes,
+                                          struct GeoArrowError* error) {
+  struct GeoArrowMVTWriterPrivate* private_data =
+      (struct GeoArrowMVTWriterPrivate*)writer->private_data;
+  struct GeoArrowArrayView* array_view = &private_data->array_view;
+
+  NANOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(array_view, array, error));
+  if (private_data->has_attributes) {
+    if (attributes == NULL || attributes->length != array->length) {
+      GeoArrowErrorSet(error, "Expected attributes with %ld rows",
+                       (long)array->length);
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(&private_data->attributes, attributes,
+                                                   (struct ArrowError*)error));
+  }
+
+  int result;
+  for (int64_t i = 0; i < array->length; i++) {
+    int64_t raw_i = array_view->offset[0] + i;
+    if (array_view->validity_bitmap != NULL &&
+        !ArrowBitGet(array_view->validity_bitmap, raw_i)) {
+      continue;
+    }
+
+    result = GeoArrowMVTEncodeGeometry(private_data, raw_i);
+    if (result != GEOARROW_OK) {
+      GeoArrowErrorSet(error, "Failed to encode geometry of feature %ld", (long)i);
+      return result;
+    }
+
+    // Features without any geometry (e.g., EMPTY) are not written
+    if (private_data->geometry.size_bytes == 0) {
+      continue;
+    }
+
+    result = GeoArrowMVTEncodeTags(private_data, i);
+    if (result == GEOARROW_OK) {
+      result = GeoArrowMVTAppendFeature(private_data);
+    }
+
+    if (result != GEOARROW_OK) {
+      GeoArrowErrorSet(error, "Failed to encode feature %ld", (long)i);
+      return result;
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowMVTWriterFinish(struct GeoArrowMVTWriter* writer,
+                                          struct GeoArrowBufferView* out,
+                                          struct GeoArrowError* error) {
+  struct GeoArrowMVTWriterPrivate* private_data =
+      (struct GeoArrowMVTWriterPrivate*)writer->private_data;
+  struct ArrowBuffer* layer = &private_data->layer;
+
+  // Encode the Layer message body after some room for the Tile.layers field header
+  // and move it into place when its size is known
+  const int64_t header_size = 11;
+  layer->size_bytes = 0;
+  int result = ArrowBufferResize(layer, header_size, 0);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowMVTAppendTag(layer, GEOARROW_MVT_LAYER_VERSION,
+                                  GEOARROW_MVT_WIRE_VARINT);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowMVTAppendVarint(layer, 2);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowMVTAppendBytesField(layer, GEOARROW_MVT_LAYER_NAME,
+                                         private_data->name.data,
+                                         private_data->name.size_bytes);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = ArrowBufferAppend(layer, private_data->features.data,
+                               private_data->features.size_bytes);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = ArrowBufferAppend(layer, private_data->keys.data,
+                               private_data->keys.size_bytes);
+  }
+
+  const int64_t* offsets = (const int64_t*)private_data->value_offsets.data;
+  for (int64_t i = 0; result == GEOARROW_OK && i < private_data->n_values; i++) {
+    result = GeoArrowMVTAppendBytesField(layer, GEOARROW_MVT_LAYER_VALUES,
+                                         private_data->values.data + offsets[i],
+                                         offsets[i + 1] - offsets[i]);
+  }
+
+  if (result == GEOARROW_OK) {
+    result =
+        GeoArrowMVTAppendTag(layer, GEOARROW_MVT_LAYER_EXTENT, GEOARROW_MVT_WIRE_VARINT);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowMVTAppendVarint(layer, private_data->extent);
+  }
+
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "Failed to encode MVT layer");
+    return result;
+  }
+
+  uint64_t layer_size = (uint64_t)(layer->size_bytes - header_size);
+  int64_t field_header_size = 1 + GeoArrowMVTVarintSize(layer_size);
+  int64_t start = header_size - field_header_size;
+  struct ArrowBuffer field_header;
+  field_header.data = layer->data + start;
+  field_header.size_bytes = 0;
+  GeoArrowMVTAppendVarintUnsafe(&field_header,
+                                (GEOARROW_MVT_TILE_LAYERS << 3) | GEOARROW_MVT_WIRE_LEN);
+  GeoArrowMVTAppendVarintUnsafe(&field_header, layer_size);
+
+  out->data = layer->data + start;
+  out->size_bytes = layer->size_bytes - start;
+
+  // The next layer starts empty
+  GeoArrowMVTWriterClear(private_data);
+  return GEOARROW_OK;
+}
+
+void GeoArrowMVTWriterReset(struct GeoArrowMVTWriter* writer) {
+  struct GeoArrowMVTWriterPrivate* private_data =
+      (struct GeoArrowMVTWriterPrivate*)writer->private_data;
+  GeoArrowMVTWriterPrivateReset(private_data);
+  ArrowFree(private_data);
+  writer->private_data = NULL;
+}
@@ -0,0 +1,375 @@
+
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+// A minimal protocol buffer reader for the messages written by the GeoArrowMVTWriter
+class ProtoReader {
+ public:
+  ProtoReader(const uint8_t* data, int64_t size_bytes)
+      : data_(data), end_(data + size_bytes) {}
+
+  bool Next(uint32_t* field, uint32_t* wire_type) {
+    if (data_ >= end_) {
+      return false;
+    }
+
+    uint64_t tag = Varint();
+    *field = static_cast<uint32_t>(tag >> 3);
+    *wire_type = static_cast<uint32_t>(tag & 0x7);
+    return true;
+  }
+
+  uint64_t Varint() {
+    uint64_t value = 0;
+    int shift = 0;
+    while (data_ < end_) {
+      uint8_t byte = *data_++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      shift += 7;
+      if ((byte & 0x80) == 0) {
+        break;
+      }
+    }
+
+    return value;
+  }
+
+  std::string Bytes() {
+    uint64_t size = Varint();
+    std::string out(reinterpret_cast<const char*>(data_), size);
+    data_ += size;
+    return out;
+  }
+
+  std::vector<uint32_t> Packed() {
+    std::string bytes = Bytes();
+    ProtoReader reader(reinterpret_cast<const uint8_t*>(bytes.data()),
+                       static_cast<int64_t>(bytes.size()));
+    std::vector<uint32_t> out;
+    while (reader.data_ < reader.end_) {
+      out.push_back(static_cast<uint32_t>(reader.Varint()));
+    }
+
+    return out;
+  }
+
+ private:
+  const uint8_t* data_;
+  const uint8_t* end_;
+};
+
+struct MVTFeature {
+  uint32_t type{0};
+  std::vector<uint32_t> tags;
+  std::vector<uint32_t> geometry;
+};
+
+struct MVTLayer {
+  uint32_t version{0};
+  std::string name;
+  std::vector<MVTFeature> features;
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  uint32_t extent{0};
+};
+
+static std::vector<MVTLayer> DecodeTile(struct GeoArrowBufferView tile) {
+  std::vector<MVTLayer> layers;
+  ProtoReader tile_reader(tile.data, tile.size_bytes);
+  uint32_t field, wire_type;
+  while (tile_reader.Next(&field, &wire_type)) {
+    EXPECT_EQ(field, 3);
+    EXPECT_EQ(wire_type, 2);
+    std::string layer_bytes = tile_reader.Bytes();
+    ProtoReader layer_reader(reinterpret_cast<const uint8_t*>(layer_bytes.data()),
+                             static_cast<int64_t>(layer_bytes.size()));
+    MVTLayer layer;
+    while (layer_reader.Next(&field, &wire_type)) {
+      switch (field) {
+        case 15:
+          layer.version = static_cast<uint32_t>(layer_reader.Varint());
+          break;
+        case 1:
+          layer.name = layer_reader.Bytes();
+          break;
+        case 2: {
+          std::string feature_bytes = layer_reader.Bytes();
+          ProtoReader feature_reader(
+              reinterpret_cast<const uint8_t*>(feature_bytes.data()),
+              static_cast<int64_t>(feature_bytes.size()));
+          MVTFeature feature;
+          while (feature_reader.Next(&field, &wire_type)) {
+            if (field == 2) {
+              feature.tags = feature_reader.Packed();
+            } else if (field == 3) {
+              feature.type = static_cast<uint32_t>(feature_reader.Varint());
+            } else if (field == 4) {
+              feature.geometry = feature_reader.Packed();
+            } else {
+              ADD_FAILURE() << "Unexpected feature field " << field;
+              return layers;
+            }
+          }
+          layer.features.push_back(feature);
+          break;
+        }
+        case 3:
+          layer.keys.push_back(layer_reader.Bytes());
+          break;
+        case 4:
+          layer.values.push_back(layer_reader.Bytes());
+          break;
+        case 5:
+          layer.extent = static_cast<uint32_t>(layer_reader.Varint());
+          break;
+        default:
+          ADD_FAILURE() << "Unexpected layer field " << field;
+          return layers;
+      }
+    }
+
+    layers.push_back(layer);
+  }
+
+  return layers;
+}
+
+static MVTLayer EncodeLayer(enum GeoArrowType type,
+                            const std::vector<std::string>& wkts) {
+  struct GeoArrowMVTWriter writer;
+  struct GeoArrowError error;
+  struct GeoArrowBufferView tile;
+  struct ArrowArray array;
+  MakeNativeArray(type, wkts, &array);
+
+  EXPECT_EQ(GeoArrowMVTWriterInit(&writer, type, "layer", 4096, nullptr, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(GeoArrowMVTWriterAppend(&writer, &array, nullptr, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(GeoArrowMVTWriterFinish(&writer, &tile, &error), GEOARROW_OK)
+      << error.message;
+  std::vector<MVTLayer> layers = DecodeTile(tile);
+  GeoArrowMVTWriterReset(&writer);
+  array.release(&array);
+
+  EXPECT_EQ(layers.size(), 1);
+  return layers.empty() ? MVTLayer() : layers[0];
+}
+
+TEST(MVTTest, MVTTestLayer) {
+  MVTLayer layer = EncodeLayer(GEOARROW_TYPE_POINT, {"POINT (25 17)"});
+  EXPECT_EQ(layer.version, 2);
+  EXPECT_EQ(layer.name, "layer");
+  EXPECT_EQ(layer.extent, 4096);
+  EXPECT_TRUE(layer.keys.empty());
+  EXPECT_TRUE(layer.values.empty());
+  ASSERT_EQ(layer.features.size(), 1);
+  EXPECT_TRUE(layer.features[0].tags.empty());
+}
+
+// Examples are from the vector tile specification
+TEST(MVTTest, MVTTestPoints) {
+  MVTLayer layer = EncodeLayer(GEOARROW_TYPE_POINT,
+                               {"POINT (25 17)", "", "POINT EMPTY", "POINT (24.6 17.4)"});
+  ASSERT_EQ(layer.features.size(), 2);
+  EXPECT_EQ(layer.features[0].type, 1);
+  EXPECT_EQ(layer.features[0].geometry, std::vector<uint32_t>({9, 50, 34}));
+  EXPECT_EQ(layer.features[1].geometry, std::vector<uint32_t>({9, 50, 34}));
+
+  layer = EncodeLayer(GEOARROW_TYPE_MULTIPOINT,
+                      {"MULTIPOINT ((5 7), (3 2))", "MULTIPOINT EMPTY"});
+  ASSERT_EQ(layer.features.size(), 1);
+  EXPECT_EQ(layer.features[0].type, 1);
+  EXPECT_EQ(layer.features[0].geometry, std::vector<uint32_t>({17, 10, 14, 3, 9}));
+}
+
+TEST(MVTTest, MVTTestLinestrings) {
+  MVTLayer layer = EncodeLayer(
+      GEOARROW_TYPE_LINESTRING,
+      {"LINESTRING (2 2, 2 10, 2 10, 10 10)", "LINESTRING (0 0, 0.1 0.1)",
+       "LINESTRING EMPTY"});
+  ASSERT_EQ(layer.features.size(), 1);
+  EXPECT_EQ(layer.features[0].type, 2);
+  EXPECT_EQ(layer.features[0].geometry,
+            std::vector<uint32_t>({9, 4, 4, 18, 0, 16, 16, 0}));
+
+  // The cursor is shared between parts and collapsed parts are skipped
+  layer = EncodeLayer(
+      GEOARROW_TYPE_MULTILINESTRING,
+      {"MULTILINESTRING ((2 2, 2 10, 10 10), (5 5, 5 5), (1 1, 3 5))"});
+  ASSERT_EQ(layer.features.size(), 1);
+  EXPECT_EQ(layer.features[0].type, 2);
+  EXPECT_EQ(layer.features[0].geometry,
+            std::vector<uint32_t>({9, 4, 4, 18, 0, 16, 16, 0, 9, 17, 17, 10, 4, 8}));
+}
+
+TEST(MVTTest, MVTTestPolygons) {
+  std::vector<uint32_t> expected = {9, 6, 12, 18, 10, 12, 24, 44, 15};
+
+  // Exterior rings are rewound to be clockwise in tile coordinates
+  MVTLayer layer = EncodeLayer(
+      GEOARROW_TYPE_POLYGON,
+      {"POLYGON ((3 6, 8 12, 20 34, 3 6))", "POLYGON ((3 6, 20 34, 8 12, 3 6))",
+       "POLYGON ((0 0, 1 1, 2 2, 0 0))", "POLYGON EMPTY"});
+  ASSERT_EQ(layer.features.size(), 2);
+  EXPECT_EQ(layer.features[0].type, 3);
+  EXPECT_EQ(layer.features[0].geometry, expected);
+  EXPECT_EQ(layer.features[1].geometry, expected);
+
+  expected = {9,  0, 0, 26, 20, 0, 0, 20, 19, 0,  15, 9, 22, 2, 26, 18, 0,
+              0, 18, 17, 0, 15, 9, 4, 13, 26, 0, 8,  8, 0,  0, 7,  15};
+  layer = EncodeLayer(
+      GEOARROW_TYPE_MULTIPOLYGON,
+      {"MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), "
+       "((11 11, 20 11, 20 20, 11 20, 11 11), (13 13, 13 17, 17 17, 17 13, 13 13)))",
+       // Holes are rewound to be counterclockwise in tile coordinates
+       "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), "
+       "((11 11, 11 20, 20 20, 20 11, 11 11), (13 13, 17 13, 17 17, 13 17, 13 13)))",
+       // Polygons whose exterior ring collapses are skipped along with their holes
+       "MULTIPOLYGON (((0 0, 0.1 0, 0.1 0.1, 0 0), (0 0, 0 0.1, 0.1 0.1, 0 0)), "
+       "((0 0, 10 0, 10 10, 0 10, 0 0)))"});
+  ASSERT_EQ(layer.features.size(), 3);
+  EXPECT_EQ(layer.features[0].type, 3);
+  EXPECT_EQ(layer.features[0].geometry, expected);
+  EXPECT_EQ(layer.features[1].geometry, expected);
+  EXPECT_EQ(layer.features[2].geometry,
+            std::vector<uint32_t>({9, 0, 0, 26, 20, 0, 0, 20, 19, 0, 15}));
+}
+
+TEST(MVTTest, MVTTestAttributes) {
+  struct ArrowSchema schema;
+  struct ArrowArray attributes;
+  struct ArrowArray array;
+  struct GeoArrowMVTWriter writer;
+  struct GeoArrowBufferView tile;
+  struct GeoArrowError error;
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 4), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "name"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[1], "count"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[2], NANOARROW_TYPE_BOOL), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[2], "flag"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[3], NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[3], "value"), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(&attributes, &schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(&attributes), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(attributes.children[0], ArrowCharView("a")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(attributes.children[1], -1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(attributes.children[2], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(attributes.children[3], 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&attributes), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(attributes.children[0], ArrowCharView("a")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(attributes.children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(attributes.children[2], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(attributes.children[3], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&attributes), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(attributes.children[0], ArrowCharView("b")),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(attributes.children[1], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(attributes.children[2], 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(attributes.children[3], 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(&attributes), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(&attributes, nullptr), NANOARROW_OK);
+
+  MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)", "POINT (2 3)", "POINT (4 5)"},
+                  &array);
+
+  ASSERT_EQ(GeoArrowMVTWriterInit(&writer, GEOARROW_TYPE_POINT, "points", 4096, &schema,
+                                  &error),
+            GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(GeoArrowMVTWriterAppend(&writer, &array, &attributes, &error), GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(GeoArrowMVTWriterFinish(&writer, &tile, &error), GEOARROW_OK)
+      << error.message;
+  std::vector<MVTLayer> layers = DecodeTile(tile);
+
+  ASSERT_EQ(layers.size(), 1);
+  EXPECT_EQ(layers[0].keys, std::vector<std::string>({"name", "count", "flag", "value"}));
+
+  // Values are deduplicated across features and columns
+  std::string double_value("\x19\x00\x00\x00\x00\x00\x00\xf8\x3f", 9);
+  EXPECT_EQ(layers[0].values, std::vector<std::string>({std::string("\x0a\x01" "a", 3),
+                                                        std::string("\x30\x01", 2),
+                                                        std::string("\x38\x01", 2),
+                                                        double_value,
+                                                        std::string("\x0a\x01" "b", 3),
+                                                        std::string("\x30\x04", 2),
+                                                        std::string("\x38\x00", 2)}));
+  ASSERT_EQ(layers[0].features.size(), 3);
+  EXPECT_EQ(layers[0].features[0].tags, std::vector<uint32_t>({0, 0, 1, 1, 2, 2, 3, 3}));
+  EXPECT_EQ(layers[0].features[1].tags, std::vector<uint32_t>({0, 0, 2, 2}));
+  EXPECT_EQ(layers[0].features[2].tags, std::vector<uint32_t>({0, 4, 1, 5, 2, 6, 3, 3}));
+
+  // The writer can be reused for another layer and the output of several writers
+  // can be concatenated
+  std::string tile_bytes(reinterpret_cast<const char*>(tile.data), tile.size_bytes);
+  ASSERT_EQ(GeoArrowMVTWriterAppend(&writer, &array, &attributes, &error), GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(GeoArrowMVTWriterFinish(&writer, &tile, &error), GEOARROW_OK)
+      << error.message;
+  tile_bytes += std::string(reinterpret_cast<const char*>(tile.data), tile.size_bytes);
+  tile.data = reinterpret_cast<const uint8_t*>(tile_bytes.data());
+  tile.size_bytes = static_cast<int64_t>(tile_bytes.size());
+  layers = DecodeTile(tile);
+  ASSERT_EQ(layers.size(), 2);
+  EXPECT_EQ(layers[1].values, layers[0].values);
+  EXPECT_EQ(layers[1].features.size(), 3);
+
+  // Attributes must be provided with the same length as the geometry
+  EXPECT_EQ(GeoArrowMVTWriterAppend(&writer, &array, nullptr, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected attributes with 3 rows");
+
+  GeoArrowMVTWriterReset(&writer);
+  array.release(&array);
+  attributes.release(&attributes);
+  schema.release(&schema);
+}
+
+TEST(MVTTest, MVTTestErrors) {
+  struct GeoArrowMVTWriter writer;
+  struct GeoArrowError error;
+  struct ArrowSchema schema;
+
+  EXPECT_EQ(GeoArrowMVTWriterInit(&writer, GEOARROW_TYPE_WKB, "layer", 4096, nullptr,
+                                  &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't encode array of type 100001 as MVT geometries");
+
+  EXPECT_EQ(GeoArrowMVTWriterInit(&writer, GEOARROW_TYPE_BOX, "layer", 4096, nullptr,
+                                  &error),
+            EINVAL);
+
+  ArrowSchemaInit(&schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(&schema, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_BINARY), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col"), NANOARROW_OK);
+  EXPECT_EQ(GeoArrowMVTWriterInit(&writer, GEOARROW_TYPE_POINT, "layer", 4096, &schema,
+                                  &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Unsupported MVT attribute type for column 'col'");
+  schema.release(&schema);
+
+  ASSERT_EQ(ArrowSchemaInitFromType(&schema, NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(GeoArrowMVTWriterInit(&writer, GEOARROW_TYPE_POINT, "layer", 4096, &schema,
+                                  &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected struct array for MVT attributes");
+  schema.release(&schema);
+}
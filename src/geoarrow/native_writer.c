@@ -28,6 +28,9 @@ struct GeoArrowNativeWriterPrivate {
   enum GeoArrowDimensions last_dimensions;
   int64_t size[32];
   int32_t level;
+
+  // Interleaved double coordinates used when appending to float output
+  struct ArrowBuffer coords_scratch;
 };
 
 static GeoArrowErrorCode GeoArrowNativeWriterEnsureOutputInitialized(
@@ -51,6 +54,7 @@ GeoArrowErrorCode GeoArrowNativeWriterInit(struct GeoArrowNativeWriter* writer,
   }
 
   ArrowBitmapInit(&private_data->validity);
+  ArrowBufferInit(&private_data->coords_scratch);
 
   // Initialize one empty coordinate
   memcpy(private_data->empty_coord_values, kEmptyPointCoords, 4 * sizeof(double));
@@ -78,9 +82,24 @@ void GeoArrowNativeWriterReset(struct GeoArrowNativeWriter* writer) {
       (struct GeoArrowNativeWriterPrivate*)writer->private_data;
   GeoArrowBuilderReset(&private_data->builder);
   ArrowBitmapReset(&private_data->validity);
+  ArrowBufferReset(&private_data->coords_scratch);
   ArrowFree(private_data);
 }
 
+void GeoArrowNativeWriterSetStatistics(struct GeoArrowNativeWriter* writer,
+                                       struct GeoArrowStatistics* stats) {
+  struct GeoArrowNativeWriterPrivate* private_data =
+      (struct GeoArrowNativeWriterPrivate*)writer->private_data;
+  GeoArrowBuilderSetStatistics(&private_data->builder, stats);
+}
+
+void GeoArrowNativeWriterSetQuantization(
+    struct GeoArrowNativeWriter* writer, const struct GeoArrowQuantization* quantization) {
+  struct GeoArrowNativeWriterPrivate* private_data =
+      (struct GeoArrowNativeWriterPrivate*)writer->private_data;
+  private_data->builder.view.quantization = *quantization;
+}
+
 static GeoArrowErrorCode GeoArrowNativeWriterEnsureOutputInitialized(
     struct GeoArrowNativeWriter* writer) {
   struct GeoArrowNativeWriterPrivate* private_data =
@@ -141,6 +160,48 @@ GeoArrowErrorCode GeoArrowNativeWriterFinish(struct GeoArrowNativeWriter* writer
   return GEOARROW_OK;
 }
 
+GeoArrowErrorCode GeoArrowNativeWriterReserve(struct GeoArrowNativeWriter* writer,
+                                              int64_t features, int64_t parts,
+                                              int64_t rings, int64_t coords) {
+  struct GeoArrowNativeWriterPrivate* private_data =
+      (struct GeoArrowNativeWriterPrivate*)writer->private_data;
+  struct GeoArrowBuilder* builder = &private_data->builder;
+
+  // The number of elements appended to each offset buffer for each geometry type
+  int64_t n_offsets[3] = {0, 0, 0};
+  switch (builder->view.schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      // Null and empty points are written as a coordinate
+      coords = features;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      n_offsets[0] = features;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      n_offsets[0] = features;
+      n_offsets[1] = rings;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      n_offsets[0] = features;
+      n_offsets[1] = parts;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      n_offsets[0] = features;
+      n_offsets[1] = parts;
+      n_offsets[2] = rings;
+      break;
+    default:
+      return GEOARROW_OK;
+  }
+
+  for (int i = 0; i < builder->view.n_offsets; i++) {
+    GEOARROW_RETURN_NOT_OK(GeoArrowBuilderOffsetReserve(builder, i, n_offsets[i]));
+  }
+
+  return GeoArrowBuilderCoordsReserve(builder, coords);
+}
+
 static GeoArrowErrorCode GeoArrowNativeWriterAppendSize(
     struct GeoArrowNativeWriter* writer, uint32_t offset, uint32_t size,
     struct GeoArrowError* error) {
@@ -190,11 +251,57 @@ static GeoArrowErrorCode GeoArrowNativeWriterAppendEmpty(
   }
 }
 
-static void GeoArrowNativeWriterAppendCoordsUnsafe(struct GeoArrowNativeWriter* writer,
-                                                   struct GeoArrowGeometryView geom) {
+static GeoArrowErrorCode GeoArrowNativeWriterAppendCoordsConvert(
+    struct GeoArrowNativeWriter* writer, struct GeoArrowGeometryView geom,
+    int64_t coord_count) {
+  struct GeoArrowNativeWriterPrivate* private_data =
+      (struct GeoArrowNativeWriterPrivate*)writer->private_data;
+  struct GeoArrowWritableArrayView* view = &private_data->builder.view;
+  enum GeoArrowDimensions dimensions = view->schema_view.dimensions;
+  int32_t n_values = view->coords.n_values;
+
+  // Coordinates in the geometry view are always double, so copy them into an
+  // interleaved scratch buffer and narrow or quantize them on the way into the
+  // builder
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+      &private_data->coords_scratch, coord_count * n_values * sizeof(double), 0));
+
+  uint8_t* out[4];
+  int32_t strides[4];
+  struct GeoArrowCoordView scratch_view;
+  scratch_view.n_coords = coord_count;
+  scratch_view.n_values = n_values;
+  scratch_view.coords_stride = n_values;
+  for (int i = 0; i < n_values; i++) {
+    out[i] = private_data->coords_scratch.data + i * sizeof(double);
+    strides[i] = n_values * (int32_t)sizeof(double);
+    scratch_view.values[i] = (double*)private_data->coords_scratch.data + i;
+  }
+
+  GeoArrowGeometryViewCopyCoordsGeneric(geom, out, strides, dimensions);
+  if (GeoArrowCoordTypeIsFloat(view->schema_view.coord_type)) {
+    GeoArrowCoordViewCopyFloat(&scratch_view, dimensions, 0, &view->coords_float,
+                               dimensions, view->coords.size_coords, coord_count);
+  } else {
+    GeoArrowCoordViewCopyInt32(&scratch_view, dimensions, 0, &view->coords_int32,
+                               dimensions, view->coords.size_coords, coord_count,
+                               &view->quantization);
+  }
+
+  return GEOARROW_OK;
+}
+
+static GeoArrowErrorCode GeoArrowNativeWriterAppendCoordsUnsafe(
+    struct GeoArrowNativeWriter* writer, struct GeoArrowGeometryView geom,
+    int64_t coord_count) {
   struct GeoArrowNativeWriterPrivate* private_data =
       (struct GeoArrowNativeWriterPrivate*)writer->private_data;
 
+  enum GeoArrowCoordType coord_type = private_data->builder.view.schema_view.coord_type;
+  if (GeoArrowCoordTypeIsFloat(coord_type) || GeoArrowCoordTypeIsQuantized(coord_type)) {
+    return GeoArrowNativeWriterAppendCoordsConvert(writer, geom, coord_count);
+  }
+
   struct GeoArrowWritableCoordView* out_coords = &private_data->builder.view.coords;
   uint8_t* out[4];
   int32_t strides[4];
@@ -206,6 +313,7 @@ static void GeoArrowNativeWriterAppendCoordsUnsafe(struct GeoArrowNativeWriter*
 
   GeoArrowGeometryViewCopyCoordsGeneric(
       geom, out, strides, private_data->builder.view.schema_view.dimensions);
+  return GEOARROW_OK;
 }
 
 static GeoArrowErrorCode GeoArrowNativeWriterAppendLinestringOffsets(
@@ -424,7 +532,8 @@ GeoArrowErrorCode GeoArrowNativeWriterAppend(struct GeoArrowNativeWriter* writer
   // Append coords
   GEOARROW_RETURN_NOT_OK(
       GeoArrowBuilderCoordsReserve(&private_data->builder, coord_count));
-  GeoArrowNativeWriterAppendCoordsUnsafe(writer, geom);
+  GEOARROW_RETURN_NOT_OK(
+      GeoArrowNativeWriterAppendCoordsUnsafe(writer, geom, coord_count));
   private_data->builder.view.coords.size_coords += coord_count;
 
   // Append to validity buffer
@@ -662,7 +662,34 @@ INSTANTIATE_TEST_SUITE_P(
         WKT_PAIR("MULTIPOLYGON EMPTY", GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON),
         WKT_PAIR("MULTIPOLYGON (((40 40, 20 45, 45 30, 40 40)), ((20 35, 10 30, 10 10, "
                  "30 5, 45 20, 20 35), (30 20, 20 15, 20 25, 30 20)))",
-                 GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON)
+                 GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON),
+
+        // Float Point
+        WKT_PAIR("POINT (0 1)", GEOARROW_TYPE_FLOAT_POINT),
+        WKT_PAIR("POINT ZM (0 1 2 3)", GEOARROW_TYPE_FLOAT_POINT_ZM),
+        WKT_PAIR("POINT (0 1)", GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT),
+        WKT_PAIR("POINT Z (0 1 2)", GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_Z),
+
+        // Float Linestring
+        WKT_PAIR("LINESTRING EMPTY", GEOARROW_TYPE_FLOAT_LINESTRING),
+        WKT_PAIR("LINESTRING (30 10, 12 16)", GEOARROW_TYPE_FLOAT_LINESTRING),
+        WKT_PAIR("LINESTRING M (30 10 11, 12 16 15)",
+                 GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_M),
+
+        // Float Polygon
+        WKT_PAIR("POLYGON ((35 10, 45 45, 15 40, 10 20, 35 10), (20 30, 35 35, 30 "
+                 "20, 20 30))",
+                 GEOARROW_TYPE_FLOAT_POLYGON),
+        WKT_PAIR("POLYGON ((30 10, 40 40, 20 40, 10 20, 30 10))",
+                 GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON),
+
+        // Float Multi*
+        WKT_PAIR("MULTIPOINT ((30 10), (12 16))", GEOARROW_TYPE_FLOAT_MULTIPOINT),
+        WKT_PAIR("MULTILINESTRING ((10 10, 20 20, 10 40), (40 40, 30 30, 40 20, 30 10))",
+                 GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING),
+        WKT_PAIR("MULTIPOLYGON (((40 40, 20 45, 45 30, 40 40)), ((20 35, 10 30, 10 10, "
+                 "30 5, 45 20, 20 35), (30 20, 20 15, 20 25, 30 20)))",
+                 GEOARROW_TYPE_FLOAT_MULTIPOLYGON)
 
         // Comment to keep the last line on its own
         ));
@@ -6,14 +6,14 @@
 
 #include "geoarrow/geoarrow.h"
 
-static GeoArrowErrorCode GeoArrowSchemaInitCoordFixedSizeList(struct ArrowSchema* schema,
-                                                              const char* dims) {
+static GeoArrowErrorCode GeoArrowSchemaInitCoordFixedSizeList(
+    struct ArrowSchema* schema, const char* dims, enum ArrowType storage_type) {
   int64_t n_dims = strlen(dims);
   ArrowSchemaInit(schema);
   NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeFixedSize(
       schema, NANOARROW_TYPE_FIXED_SIZE_LIST, (int32_t)n_dims));
   NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[0], dims));
-  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_DOUBLE));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[0], storage_type));
 
   // Set child field non-nullable
   schema->children[0]->flags = 0;
@@ -22,7 +22,8 @@ static GeoArrowErrorCode GeoArrowSchemaInitCoordFixedSizeList(struct ArrowSchema
 }
 
 static GeoArrowErrorCode GeoArrowSchemaInitCoordStruct(struct ArrowSchema* schema,
-                                                       const char* dims) {
+                                                       const char* dims,
+                                                       enum ArrowType storage_type) {
   int64_t n_dims = strlen(dims);
   char dim_name[] = {'\0', '\0'};
 
@@ -31,8 +32,7 @@ static GeoArrowErrorCode GeoArrowSchemaInitCoordStruct(struct ArrowSchema* schem
 
   for (int64_t i = 0; i < n_dims; i++) {
     dim_name[0] = dims[i];
-    NANOARROW_RETURN_NOT_OK(
-        ArrowSchemaInitFromType(schema->children[i], NANOARROW_TYPE_DOUBLE));
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaInitFromType(schema->children[i], storage_type));
     NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[i], dim_name));
     // Set child non-nullable
     schema->children[i]->flags = 0;
@@ -41,6 +41,27 @@ static GeoArrowErrorCode GeoArrowSchemaInitCoordStruct(struct ArrowSchema* schem
   return GEOARROW_OK;
 }
 
+static GeoArrowErrorCode GeoArrowSchemaInitCoord(struct ArrowSchema* schema,
+                                                 enum GeoArrowCoordType coord_type,
+                                                 const char* dims) {
+  switch (coord_type) {
+    case GEOARROW_COORD_TYPE_SEPARATE:
+      return GeoArrowSchemaInitCoordStruct(schema, dims, NANOARROW_TYPE_DOUBLE);
+    case GEOARROW_COORD_TYPE_INTERLEAVED:
+      return GeoArrowSchemaInitCoordFixedSizeList(schema, dims, NANOARROW_TYPE_DOUBLE);
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+      return GeoArrowSchemaInitCoordStruct(schema, dims, NANOARROW_TYPE_FLOAT);
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+      return GeoArrowSchemaInitCoordFixedSizeList(schema, dims, NANOARROW_TYPE_FLOAT);
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+      return GeoArrowSchemaInitCoordStruct(schema, dims, NANOARROW_TYPE_INT32);
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return GeoArrowSchemaInitCoordFixedSizeList(schema, dims, NANOARROW_TYPE_INT32);
+    default:
+      return EINVAL;
+  }
+}
+
 static GeoArrowErrorCode GeoArrowSchemaInitRect(struct ArrowSchema* schema,
                                                 const char* dims) {
   int64_t n_dims = strlen(dims);
@@ -75,14 +96,7 @@ static GeoArrowErrorCode GeoArrowSchemaInitListOf(struct ArrowSchema* schema,
                                                   const char* dims, int n,
                                                   const char** child_names) {
   if (n == 0) {
-    switch (coord_type) {
-      case GEOARROW_COORD_TYPE_SEPARATE:
-        return GeoArrowSchemaInitCoordStruct(schema, dims);
-      case GEOARROW_COORD_TYPE_INTERLEAVED:
-        return GeoArrowSchemaInitCoordFixedSizeList(schema, dims);
-      default:
-        return EINVAL;
-    }
+    return GeoArrowSchemaInitCoord(schema, coord_type, dims);
   } else {
     ArrowSchemaInit(schema);
     NANOARROW_RETURN_NOT_OK(ArrowSchemaSetFormat(schema, "+l"));
@@ -165,16 +179,7 @@ GeoArrowErrorCode GeoArrowSchemaInit(struct ArrowSchema* schema, enum GeoArrowTy
       break;
 
     case GEOARROW_GEOMETRY_TYPE_POINT:
-      switch (coord_type) {
-        case GEOARROW_COORD_TYPE_SEPARATE:
-          NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitCoordStruct(schema, dims));
-          break;
-        case GEOARROW_COORD_TYPE_INTERLEAVED:
-          NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitCoordFixedSizeList(schema, dims));
-          break;
-        default:
-          return EINVAL;
-      }
+      NANOARROW_RETURN_NOT_OK(GeoArrowSchemaInitCoord(schema, coord_type, dims));
       break;
 
     case GEOARROW_GEOMETRY_TYPE_LINESTRING:
@@ -336,3 +336,31 @@ TEST(SchemaTest, SchemaTestInitSchemaMultipolygon) {
       field("polygons",
             list(field("rings", list(coord_field("vertices", "xyzm")), false)), false))));
 }
+
+TEST(SchemaTest, SchemaTestInitSchemaFloat) {
+  struct ArrowSchema schema;
+
+  EXPECT_EQ(GeoArrowSchemaInit(&schema, GEOARROW_TYPE_FLOAT_POINT), GEOARROW_OK);
+  auto maybe_type = ImportType(&schema);
+  ASSERT_ARROW_OK(maybe_type.status());
+  EXPECT_TRUE(maybe_type.ValueUnsafe()->Equals(
+      struct_({field("x", float32(), false), field("y", float32(), false)})));
+
+  EXPECT_EQ(GeoArrowSchemaInit(&schema, GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_Z),
+            GEOARROW_OK);
+  auto maybe_type_z = ImportType(&schema);
+  ASSERT_ARROW_OK(maybe_type_z.status());
+  EXPECT_TRUE(maybe_type_z.ValueUnsafe()->Equals(
+      fixed_size_list(field("xyz", float32(), false), 3)));
+
+  EXPECT_EQ(GeoArrowSchemaInit(&schema, GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING),
+            GEOARROW_OK);
+  auto maybe_type_ls = ImportType(&schema);
+  ASSERT_ARROW_OK(maybe_type_ls.status());
+  EXPECT_TRUE(maybe_type_ls.ValueUnsafe()->Equals(list(
+      field("vertices", fixed_size_list(field("xy", float32(), false), 2), false))));
+
+  // Boxes are only available with double storage
+  EXPECT_NE(GeoArrowSchemaInit(&schema, (enum GeoArrowType)(GEOARROW_TYPE_BOX + 20000)),
+            GEOARROW_OK);
+}
@@ -6,16 +6,39 @@
 #include "geoarrow/geoarrow.h"
 #include "nanoarrow/nanoarrow.h"
 
+// Returns the storage-specific variant of a coord type layout for an ordinate
+// storage format or GEOARROW_COORD_TYPE_UNKNOWN if the format is not supported
+static enum GeoArrowCoordType GeoArrowCoordTypeFromOrdinateFormat(
+    const char* format, enum GeoArrowCoordType layout) {
+  int is_separate = layout == GEOARROW_COORD_TYPE_SEPARATE;
+  if (strcmp(format, "g") == 0) {
+    return is_separate ? GEOARROW_COORD_TYPE_SEPARATE : GEOARROW_COORD_TYPE_INTERLEAVED;
+  } else if (strcmp(format, "f") == 0) {
+    return is_separate ? GEOARROW_COORD_TYPE_SEPARATE_FLOAT
+                       : GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+  } else if (strcmp(format, "i") == 0) {
+    return is_separate ? GEOARROW_COORD_TYPE_SEPARATE_INT32
+                       : GEOARROW_COORD_TYPE_INTERLEAVED_INT32;
+  } else {
+    return GEOARROW_COORD_TYPE_UNKNOWN;
+  }
+}
+
 static int GeoArrowParsePointFixedSizeList(const struct ArrowSchema* schema,
                                            struct GeoArrowSchemaView* schema_view,
                                            struct ArrowError* error,
                                            const char* ext_name) {
-  if (schema->n_children != 1 || strcmp(schema->children[0]->format, "g") != 0) {
-    ArrowErrorSet(
-        error,
-        "Expected fixed-size list coordinate child 0 to have storage type of double for "
-        "extension '%s'",
-        ext_name);
+  enum GeoArrowCoordType coord_type = GEOARROW_COORD_TYPE_UNKNOWN;
+  if (schema->n_children == 1) {
+    coord_type = GeoArrowCoordTypeFromOrdinateFormat(schema->children[0]->format,
+                                                     GEOARROW_COORD_TYPE_INTERLEAVED);
+  }
+
+  if (coord_type == GEOARROW_COORD_TYPE_UNKNOWN) {
+    ArrowErrorSet(error,
+                  "Expected fixed-size list coordinate child 0 to have storage type of "
+                  "double, float, or int32 for extension '%s'",
+                  ext_name);
     return EINVAL;
   }
 
@@ -63,7 +86,7 @@ static int GeoArrowParsePointFixedSizeList(const struct ArrowSchema* schema,
     return EINVAL;
   }
 
-  schema_view->coord_type = GEOARROW_COORD_TYPE_INTERLEAVED;
+  schema_view->coord_type = coord_type;
   return NANOARROW_OK;
 }
 
@@ -90,10 +113,14 @@ static int GeoArrowParsePointStruct(const struct ArrowSchema* schema,
       return EINVAL;
     }
 
-    if (strcmp(schema->children[i]->format, "g") != 0) {
+    // All children must share the storage type of the first child
+    const char* child_format = schema->children[i]->format;
+    if (GeoArrowCoordTypeFromOrdinateFormat(child_format, GEOARROW_COORD_TYPE_SEPARATE) ==
+            GEOARROW_COORD_TYPE_UNKNOWN ||
+        strcmp(child_format, schema->children[0]->format) != 0) {
       ArrowErrorSet(error,
-                    "Expected coordinate child %d to have storage type of double for "
-                    "extension '%s'",
+                    "Expected coordinate child %d to have storage type of double, "
+                    "float, or int32 matching child 0 for extension '%s'",
                     (int)i, ext_name);
       return EINVAL;
     }
@@ -117,7 +144,8 @@ static int GeoArrowParsePointStruct(const struct ArrowSchema* schema,
     return EINVAL;
   }
 
-  schema_view->coord_type = GEOARROW_COORD_TYPE_SEPARATE;
+  schema_view->coord_type = GeoArrowCoordTypeFromOrdinateFormat(
+      schema->children[0]->format, GEOARROW_COORD_TYPE_SEPARATE);
   return GEOARROW_OK;
 }
 
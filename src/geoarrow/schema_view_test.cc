@@ -123,7 +123,31 @@ INSTANTIATE_TEST_SUITE_P(
         GEOARROW_TYPE_INTERLEAVED_LINESTRING_ZM, GEOARROW_TYPE_INTERLEAVED_POLYGON_ZM,
         GEOARROW_TYPE_INTERLEAVED_MULTIPOINT_ZM,
         GEOARROW_TYPE_INTERLEAVED_MULTILINESTRING_ZM,
-        GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM));
+        GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON_ZM,
+
+        GEOARROW_TYPE_FLOAT_POINT, GEOARROW_TYPE_FLOAT_LINESTRING,
+        GEOARROW_TYPE_FLOAT_POLYGON, GEOARROW_TYPE_FLOAT_MULTIPOINT,
+        GEOARROW_TYPE_FLOAT_MULTILINESTRING, GEOARROW_TYPE_FLOAT_MULTIPOLYGON,
+        GEOARROW_TYPE_FLOAT_POINT_Z, GEOARROW_TYPE_FLOAT_POLYGON_M,
+        GEOARROW_TYPE_FLOAT_MULTIPOLYGON_ZM, GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTILINESTRING,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT_Z,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_POLYGON_M,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOLYGON_ZM,
+
+        GEOARROW_TYPE_INT32_POINT, GEOARROW_TYPE_INT32_LINESTRING,
+        GEOARROW_TYPE_INT32_POLYGON, GEOARROW_TYPE_INT32_MULTIPOINT,
+        GEOARROW_TYPE_INT32_MULTILINESTRING, GEOARROW_TYPE_INT32_MULTIPOLYGON,
+        GEOARROW_TYPE_INT32_POINT_Z, GEOARROW_TYPE_INT32_POLYGON_M,
+        GEOARROW_TYPE_INT32_MULTIPOLYGON_ZM, GEOARROW_TYPE_INTERLEAVED_INT32_POINT,
+        GEOARROW_TYPE_INTERLEAVED_INT32_LINESTRING,
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON,
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT_Z,
+        GEOARROW_TYPE_INTERLEAVED_INT32_MULTIPOLYGON_ZM));
 
 TEST(SchemaViewTest, SchemaViewTestInitInterleavedGuessDims) {
   struct ArrowSchema good_schema;
@@ -268,13 +292,25 @@ TEST(SchemaViewTest, SchemaViewTestInitInvalidPoint) {
   // Bad child type
   ASSERT_EQ(ArrowSchemaDeepCopy(&good_schema, &bad_schema), GEOARROW_OK);
   bad_schema.children[1]->release(bad_schema.children[1]);
-  ASSERT_EQ(ArrowSchemaInitFromType(bad_schema.children[1], NANOARROW_TYPE_INT32),
+  ASSERT_EQ(ArrowSchemaInitFromType(bad_schema.children[1], NANOARROW_TYPE_INT64),
             GEOARROW_OK);
   ASSERT_EQ(ArrowSchemaSetName(bad_schema.children[1], "y"), GEOARROW_OK);
   EXPECT_EQ(GeoArrowSchemaViewInit(&schema_view, &bad_schema, &error), EINVAL);
   EXPECT_STREQ(error.message,
-               "Expected coordinate child 1 to have storage type of double for extension "
-               "'geoarrow.point'");
+               "Expected coordinate child 1 to have storage type of double, float, or "
+               "int32 matching child 0 for extension 'geoarrow.point'");
+  bad_schema.release(&bad_schema);
+
+  // Mixed double and float children
+  ASSERT_EQ(ArrowSchemaDeepCopy(&good_schema, &bad_schema), GEOARROW_OK);
+  bad_schema.children[1]->release(bad_schema.children[1]);
+  ASSERT_EQ(ArrowSchemaInitFromType(bad_schema.children[1], NANOARROW_TYPE_FLOAT),
+            GEOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(bad_schema.children[1], "y"), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowSchemaViewInit(&schema_view, &bad_schema, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected coordinate child 1 to have storage type of double, float, or "
+               "int32 matching child 0 for extension 'geoarrow.point'");
   bad_schema.release(&bad_schema);
 
   // Bad name combination
@@ -329,13 +365,13 @@ TEST(SchemaViewTest, SchemaViewTestInitInvalidInterleavedPoint) {
   // Bad child type
   ASSERT_EQ(ArrowSchemaDeepCopy(&good_schema, &bad_schema), GEOARROW_OK);
   bad_schema.children[0]->release(bad_schema.children[0]);
-  ASSERT_EQ(ArrowSchemaInitFromType(bad_schema.children[0], NANOARROW_TYPE_INT32),
+  ASSERT_EQ(ArrowSchemaInitFromType(bad_schema.children[0], NANOARROW_TYPE_INT64),
             GEOARROW_OK);
   ASSERT_EQ(ArrowSchemaSetName(bad_schema.children[0], "xy"), GEOARROW_OK);
   EXPECT_EQ(GeoArrowSchemaViewInit(&schema_view, &bad_schema, &error), EINVAL);
   EXPECT_STREQ(error.message,
                "Expected fixed-size list coordinate child 0 to have storage type of "
-               "double for extension 'geoarrow.point'");
+               "double, float, or int32 for extension 'geoarrow.point'");
   bad_schema.release(&bad_schema);
 
   good_schema.release(&good_schema);
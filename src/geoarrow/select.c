@@ -0,0 +1,388 @@
+#include <errno.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Selecting rows of a native or serialized array is done by walking the offset
+// buffers of the GeoArrowArrayView: a contiguous run of selected rows at the top level
+// maps to a contiguous range of elements at every level below it, so each run can be
+// copied level by level using one memcpy() per buffer. The selection is expressed
+// as an iterator over these runs such that take (indices) and filter (bitmap) share
+// the same implementation.
+
+struct GeoArrowSelectRuns {
+  // At most one of indices or selection is non-NULL. If both are NULL, all rows
+  // are selected.
+  const int64_t* indices;
+  const uint8_t* selection;
+  // The number of indices or the number of rows
+  int64_t n;
+  // The position of the iterator in indices or selection
+  int64_t i;
+};
+
+static void GeoArrowSelectRunsInit(struct GeoArrowSelectRuns* runs,
+                                   const int64_t* indices, const uint8_t* selection,
+                                   int64_t n) {
+  runs->indices = indices;
+  runs->selection = selection;
+  runs->n = n;
+  runs->i = 0;
+}
+
+// Populates start and length with the next run of selected rows, returning 0 if
+// there are no more runs
+static int GeoArrowSelectRunsNext(struct GeoArrowSelectRuns* runs, int64_t* start,
+                                  int64_t* length) {
+  if (runs->indices != NULL) {
+    // Consecutive indices are coalesced into a run
+    if (runs->i >= runs->n) {
+      return 0;
+    }
+
+    *start = runs->indices[runs->i++];
+    *length = 1;
+    while (runs->i < runs->n && runs->indices[runs->i] == (*start + *length)) {
+      runs->i++;
+      (*length)++;
+    }
+
+    return 1;
+  }
+
+  if (runs->selection == NULL) {
+    // All rows are selected
+    if (runs->i >= runs->n) {
+      return 0;
+    }
+
+    *start = 0;
+    *length = runs->n;
+    runs->i = runs->n;
+    return 1;
+  }
+
+  // Skip unselected rows, a byte at a time when possible
+  const uint8_t* bits = runs->selection;
+  while (runs->i < runs->n && !ArrowBitGet(bits, runs->i)) {
+    if ((runs->i % 8) == 0 && (runs->i + 8) <= runs->n && bits[runs->i / 8] == 0) {
+      runs->i += 8;
+    } else {
+      runs->i++;
+    }
+  }
+
+  if (runs->i >= runs->n) {
+    return 0;
+  }
+
+  // Collect selected rows, a byte at a time when possible
+  *start = runs->i;
+  while (runs->i < runs->n && ArrowBitGet(bits, runs->i)) {
+    if ((runs->i % 8) == 0 && (runs->i + 8) <= runs->n && bits[runs->i / 8] == 0xff) {
+      runs->i += 8;
+    } else {
+      runs->i++;
+    }
+  }
+
+  *length = runs->i - *start;
+  return 1;
+}
+
+// Populates lo and hi with the physical range of elements at each level of
+// array_view (i.e., including the offset of each level) that corresponds to rows
+// [start, start + length) at the top level. Once a range is empty, the ranges of all
+// levels below it are empty and the offset buffers are not accessed.
+static void GeoArrowSelectLevelRanges(const struct GeoArrowArrayView* array_view,
+                                      int64_t start, int64_t length, int64_t* lo,
+                                      int64_t* hi) {
+  lo[0] = array_view->offset[0] + start;
+  hi[0] = lo[0] + length;
+  for (int level = 0; level < array_view->n_offsets; level++) {
+    if (hi[level] == lo[level]) {
+      lo[level + 1] = 0;
+      hi[level + 1] = 0;
+    } else {
+      const int32_t* offsets = array_view->offsets[level];
+      lo[level + 1] = array_view->offset[level + 1] + offsets[lo[level]];
+      hi[level + 1] = array_view->offset[level + 1] + offsets[hi[level]];
+    }
+  }
+}
+
+struct GeoArrowSelectCoords {
+  // Pointers to the first ordinate of each coordinate buffer. For interleaved
+  // coordinates and serialized types only src[0] is used.
+  const uint8_t* src[8];
+  // The number of buffers in src
+  int n_buffers;
+  // The number of bytes per element of the innermost level
+  int64_t element_size;
+};
+
+static void GeoArrowSelectCoordsInit(const struct GeoArrowArrayView* array_view,
+                                     struct GeoArrowSelectCoords* coords) {
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  int n_values = array_view->coords.n_values;
+  int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(coord_type);
+
+  if (coord_type == GEOARROW_COORD_TYPE_UNKNOWN) {
+    // Serialized types: the innermost level is the byte data buffer
+    coords->src[0] = array_view->data;
+    coords->n_buffers = 1;
+    coords->element_size = 1;
+    return;
+  }
+
+  for (int j = 0; j < n_values; j++) {
+    if (GeoArrowCoordTypeIsFloat(coord_type)) {
+      coords->src[j] = (const uint8_t*)array_view->coords_float.values[j];
+    } else if (GeoArrowCoordTypeIsQuantized(coord_type)) {
+      coords->src[j] = (const uint8_t*)array_view->coords_int32.values[j];
+    } else {
+      coords->src[j] = (const uint8_t*)array_view->coords.values[j];
+    }
+  }
+
+  if (GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_SEPARATE) {
+    coords->n_buffers = n_values;
+    coords->element_size = ordinate_size;
+  } else {
+    coords->n_buffers = 1;
+    coords->element_size = ordinate_size * n_values;
+  }
+}
+
+// Copies length bits from src starting at bit src_offset to dst starting at bit
+// dst_offset, shifting whole bytes at a time when possible
+static void GeoArrowSelectCopyBits(const uint8_t* src, int64_t src_offset,
+                                   uint8_t* dst, int64_t dst_offset, int64_t length) {
+  // Copy bit by bit until the output is byte-aligned
+  while (length > 0 && (dst_offset % 8) != 0) {
+    ArrowBitSetTo(dst, dst_offset++, ArrowBitGet(src, src_offset++));
+    length--;
+  }
+
+  int64_t n_bytes = length / 8;
+  int shift = (int)(src_offset % 8);
+  const uint8_t* src_bytes = src + src_offset / 8;
+  uint8_t* dst_bytes = dst + dst_offset / 8;
+  if (shift == 0) {
+    memcpy(dst_bytes, src_bytes, (size_t)n_bytes);
+  } else {
+    // The next input byte always contains bits that are part of the copy
+    for (int64_t i = 0; i < n_bytes; i++) {
+      dst_bytes[i] =
+          (uint8_t)((src_bytes[i] >> shift) | (src_bytes[i + 1] << (8 - shift)));
+    }
+  }
+
+  src_offset += n_bytes * 8;
+  dst_offset += n_bytes * 8;
+  length -= n_bytes * 8;
+  while (length > 0) {
+    ArrowBitSetTo(dst, dst_offset++, ArrowBitGet(src, src_offset++));
+    length--;
+  }
+}
+
+// Selects runs[i] from each of arrays[i] and concatenates the result into out. All
+// output buffers are allocated before any values are copied.
+static GeoArrowErrorCode GeoArrowSelect(const struct ArrowArray* const* arrays,
+                                        int64_t n_arrays, enum GeoArrowType type,
+                                        struct GeoArrowSelectRuns* runs,
+                                        struct ArrowArray* out,
+                                        struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+  switch (type) {
+    case GEOARROW_TYPE_WKB:
+    case GEOARROW_TYPE_WKT:
+      break;
+    default:
+      if (array_view.schema_view.coord_type == GEOARROW_COORD_TYPE_UNKNOWN) {
+        GeoArrowErrorSet(error, "Can't select rows of type %d", (int)type);
+        return ENOTSUP;
+      }
+      break;
+  }
+
+  int n_offsets = array_view.n_offsets;
+  int64_t lo[4];
+  int64_t hi[4];
+  int64_t start;
+  int64_t length;
+
+  // First pass: validate each input and compute the number of elements at each
+  // level of the output
+  int64_t out_length[4] = {0, 0, 0, 0};
+  int has_validity = 0;
+  for (int64_t i = 0; i < n_arrays; i++) {
+    GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, arrays[i], error));
+    has_validity = has_validity ||
+                   (array_view.validity_bitmap != NULL && arrays[i]->null_count != 0);
+
+    struct GeoArrowSelectRuns first_pass = runs[i];
+    while (GeoArrowSelectRunsNext(&first_pass, &start, &length)) {
+      GeoArrowSelectLevelRanges(&array_view, start, length, lo, hi);
+      for (int level = 0; level <= n_offsets; level++) {
+        out_length[level] += hi[level] - lo[level];
+      }
+    }
+  }
+
+  for (int level = 1; level <= n_offsets; level++) {
+    if (out_length[level] > INT32_MAX) {
+      GeoArrowErrorSet(error, "Selected rows have more than %d elements at level %d",
+                       (int)INT32_MAX, level);
+      return EOVERFLOW;
+    }
+  }
+
+  // Allocate each output buffer once
+  struct GeoArrowSelectCoords coords;
+  GeoArrowSelectCoordsInit(&array_view, &coords);
+
+  struct GeoArrowBuilder builder;
+  GEOARROW_RETURN_NOT_OK(GeoArrowBuilderInitFromType(&builder, type));
+
+  int result = GEOARROW_OK;
+  if (has_validity) {
+    result = GeoArrowBuilderReserveBuffer(&builder, 0, _ArrowBytesForBits(out_length[0]));
+    builder.view.buffers[0].size_bytes = _ArrowBytesForBits(out_length[0]);
+    if (result == GEOARROW_OK && out_length[0] > 0) {
+      memset(builder.view.buffers[0].data.data, 0,
+             (size_t)builder.view.buffers[0].size_bytes);
+    }
+  }
+
+  for (int level = 0; level < n_offsets && result == GEOARROW_OK; level++) {
+    int64_t size_bytes = (out_length[level] + 1) * (int64_t)sizeof(int32_t);
+    result = GeoArrowBuilderReserveBuffer(&builder, 1 + level, size_bytes);
+    builder.view.buffers[1 + level].size_bytes = size_bytes;
+  }
+
+  for (int j = 0; j < coords.n_buffers && result == GEOARROW_OK; j++) {
+    int64_t size_bytes = out_length[n_offsets] * coords.element_size;
+    result = GeoArrowBuilderReserveBuffer(&builder, 1 + n_offsets + j, size_bytes);
+    builder.view.buffers[1 + n_offsets + j].size_bytes = size_bytes;
+  }
+
+  if (result != GEOARROW_OK) {
+    GeoArrowBuilderReset(&builder);
+    return result;
+  }
+
+  // Second pass: copy each run
+  uint8_t* validity = builder.view.buffers[0].data.as_uint8;
+  int32_t* out_offsets[3];
+  for (int level = 0; level < n_offsets; level++) {
+    out_offsets[level] = builder.view.buffers[1 + level].data.as_int32;
+    out_offsets[level][0] = 0;
+  }
+
+  int64_t out_start[4] = {0, 0, 0, 0};
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < n_arrays; i++) {
+    // Already validated in the first pass
+    GeoArrowArrayViewSetArray(&array_view, arrays[i], NULL);
+    GeoArrowSelectCoordsInit(&array_view, &coords);
+    const uint8_t* in_validity =
+        arrays[i]->null_count != 0 ? array_view.validity_bitmap : NULL;
+
+    while (GeoArrowSelectRunsNext(&runs[i], &start, &length)) {
+      GeoArrowSelectLevelRanges(&array_view, start, length, lo, hi);
+
+      if (has_validity && in_validity != NULL) {
+        GeoArrowSelectCopyBits(in_validity, lo[0], validity, out_start[0], length);
+        null_count += length - ArrowBitCountSet(in_validity, lo[0], length);
+      } else if (has_validity) {
+        ArrowBitsSetTo(validity, out_start[0], length, 1);
+      }
+
+      // Offsets are rebased from the first element of the run in the input to the
+      // number of elements already written in the output
+      for (int level = 0; level < n_offsets; level++) {
+        const int32_t* src = array_view.offsets[level] + lo[level] + 1;
+        int32_t* dst = out_offsets[level] + out_start[level] + 1;
+        int64_t n = hi[level] - lo[level];
+        if (n > 0) {
+          int64_t first = lo[level + 1] - array_view.offset[level + 1];
+          int32_t delta = (int32_t)(out_start[level + 1] - first);
+          for (int64_t k = 0; k < n; k++) {
+            dst[k] = src[k] + delta;
+          }
+        }
+      }
+
+      int64_t n_elements = hi[n_offsets] - lo[n_offsets];
+      if (n_elements > 0) {
+        for (int j = 0; j < coords.n_buffers; j++) {
+          memcpy(builder.view.buffers[1 + n_offsets + j].data.as_uint8 +
+                     out_start[n_offsets] * coords.element_size,
+                 coords.src[j] + lo[n_offsets] * coords.element_size,
+                 (size_t)(n_elements * coords.element_size));
+        }
+      }
+
+      for (int level = 0; level <= n_offsets; level++) {
+        out_start[level] += hi[level] - lo[level];
+      }
+    }
+  }
+
+  result = GeoArrowBuilderFinish(&builder, out, error);
+  GeoArrowBuilderReset(&builder);
+  GEOARROW_RETURN_NOT_OK(result);
+
+  out->null_count = has_validity ? null_count : 0;
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowArrayTake(const struct ArrowArray* array,
+                                    enum GeoArrowType type, const int64_t* indices,
+                                    int64_t n_indices, struct ArrowArray* out,
+                                    struct GeoArrowError* error) {
+  for (int64_t i = 0; i < n_indices; i++) {
+    if (indices[i] < 0 || indices[i] >= array->length) {
+      GeoArrowErrorSet(error, "Index %ld is out of range for array of length %ld",
+                       (long)indices[i], (long)array->length);
+      return EINVAL;
+    }
+  }
+
+  struct GeoArrowSelectRuns runs;
+  GeoArrowSelectRunsInit(&runs, indices, NULL, n_indices);
+  return GeoArrowSelect(&array, 1, type, &runs, out, error);
+}
+
+GeoArrowErrorCode GeoArrowArrayFilter(const struct ArrowArray* array,
+                                      enum GeoArrowType type, const uint8_t* selection,
+                                      struct ArrowArray* out,
+                                      struct GeoArrowError* error) {
+  struct GeoArrowSelectRuns runs;
+  GeoArrowSelectRunsInit(&runs, NULL, selection, array->length);
+  return GeoArrowSelect(&array, 1, type, &runs, out, error);
+}
+
+GeoArrowErrorCode GeoArrowArrayConcat(const struct ArrowArray* const* arrays,
+                                      int64_t n_arrays, enum GeoArrowType type,
+                                      struct ArrowArray* out,
+                                      struct GeoArrowError* error) {
+  struct GeoArrowSelectRuns* runs = (struct GeoArrowSelectRuns*)ArrowMalloc(
+      sizeof(struct GeoArrowSelectRuns) * (n_arrays > 0 ? n_arrays : 1));
+  if (runs == NULL) {
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < n_arrays; i++) {
+    GeoArrowSelectRunsInit(&runs[i], NULL, NULL, arrays[i]->length);
+  }
+
+  int result = GeoArrowSelect(arrays, n_arrays, type, runs, out, error);
+  ArrowFree(runs);
+  return result;
+}
@@ -0,0 +1,319 @@
+#include <errno.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+static std::vector<std::string> TestWKT(enum GeoArrowGeometryType geometry_type) {
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      return {"POINT (0 1)", "", "POINT (2 3)", "POINT (4 5)", "POINT (6 7)",
+              "", "POINT (8 9)", "POINT (10 11)", "POINT (12 13)", "POINT (14 15)"};
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      return {"LINESTRING (0 1, 2 3)", "", "LINESTRING EMPTY",
+              "LINESTRING (4 5, 6 7, 8 9)", "LINESTRING (10 11, 12 13)",
+              "LINESTRING (14 15, 16 17)"};
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      return {"POLYGON ((0 0, 1 0, 0 1, 0 0))", "", "POLYGON EMPTY",
+              "POLYGON ((0 0, 2 0, 0 2, 0 0), (1 1, 2 1, 1 2, 1 1))",
+              "POLYGON ((3 3, 4 3, 3 4, 3 3))", "POLYGON ((5 5, 6 5, 5 6, 5 5))"};
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return {"MULTIPOINT ((0 1), (2 3))", "", "MULTIPOINT EMPTY",
+              "MULTIPOINT ((4 5))", "MULTIPOINT ((6 7), (8 9), (10 11))",
+              "MULTIPOINT ((12 13))"};
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return {"MULTILINESTRING ((0 1, 2 3))", "", "MULTILINESTRING EMPTY",
+              "MULTILINESTRING ((4 5, 6 7), (8 9, 10 11, 12 13))",
+              "MULTILINESTRING ((14 15, 16 17))", "MULTILINESTRING (EMPTY)"};
+    default:
+      return {"MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))", "", "MULTIPOLYGON EMPTY",
+              "MULTIPOLYGON (((0 0, 2 0, 0 2, 0 0), (1 1, 2 1, 1 2, 1 1)), "
+              "((3 3, 4 3, 3 4, 3 3)))",
+              "MULTIPOLYGON (EMPTY, ((5 5, 6 5, 5 6, 5 5)))",
+              "MULTIPOLYGON (((7 7, 8 7, 7 8, 7 7)))"};
+  }
+}
+
+static std::vector<std::string> Select(const std::vector<std::string>& values,
+                                       const std::vector<int64_t>& indices) {
+  std::vector<std::string> out;
+  for (int64_t i : indices) {
+    out.push_back(values[i]);
+  }
+
+  return out;
+}
+
+static std::vector<uint8_t> MakeBitmap(const std::vector<int64_t>& indices,
+                                       int64_t length) {
+  std::vector<uint8_t> bitmap((length + 7) / 8 + 1, 0);
+  for (int64_t i : indices) {
+    ArrowBitSet(bitmap.data(), i);
+  }
+
+  return bitmap;
+}
+
+class SelectTypeParameterizedTestFixture
+    : public ::testing::TestWithParam<enum GeoArrowType> {};
+
+TEST_P(SelectTypeParameterizedTestFixture, SelectTestTakeAndFilter) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(type, TestWKT(schema_view.geometry_type), &array));
+  std::vector<std::string> values = FormatWKT(type, &array);
+  int64_t n = static_cast<int64_t>(values.size());
+
+  std::vector<int64_t> all;
+  std::vector<int64_t> reversed;
+  for (int64_t i = 0; i < n; i++) {
+    all.push_back(i);
+    reversed.insert(reversed.begin(), i);
+  }
+
+  std::vector<std::vector<int64_t>> selections = {
+      {}, all, reversed, {2, 2, 2}, {1, 2, 3, n - 1}, {0, 3, 4, 5}, {2}, {3, 1}};
+
+  struct ArrowArray out;
+  struct GeoArrowError error;
+  for (const auto& indices : selections) {
+    SCOPED_TRACE("indices of size " + std::to_string(indices.size()));
+    ASSERT_EQ(GeoArrowArrayTake(&array, type, indices.data(),
+                                static_cast<int64_t>(indices.size()), &out, &error),
+              GEOARROW_OK)
+        << error.message;
+    EXPECT_EQ(out.length, static_cast<int64_t>(indices.size()));
+    EXPECT_EQ(FormatWKT(type, &out), Select(values, indices));
+    out.release(&out);
+  }
+
+  // Filters can't repeat or reorder rows
+  for (auto indices : selections) {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    std::vector<uint8_t> bitmap = MakeBitmap(indices, n);
+    ASSERT_EQ(GeoArrowArrayFilter(&array, type, bitmap.data(), &out, &error), GEOARROW_OK)
+        << error.message;
+    EXPECT_EQ(FormatWKT(type, &out), Select(values, indices));
+    out.release(&out);
+  }
+
+  // Check a slice that does not start on a byte boundary
+  array.offset = 1;
+  array.length -= 1;
+  array.null_count = -1;
+  std::vector<std::string> values_sliced(values.begin() + 1, values.end());
+  std::vector<int64_t> indices = {0, 2, 3, n - 2};
+  ASSERT_EQ(GeoArrowArrayTake(&array, type, indices.data(), 4, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(type, &out), Select(values_sliced, indices));
+  EXPECT_EQ(out.null_count, 1);
+  out.release(&out);
+
+  std::vector<uint8_t> bitmap = MakeBitmap(indices, n - 1);
+  ASSERT_EQ(GeoArrowArrayFilter(&array, type, bitmap.data(), &out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(type, &out), Select(values_sliced, indices));
+  out.release(&out);
+
+  array.release(&array);
+}
+
+TEST_P(SelectTypeParameterizedTestFixture, SelectTestConcat) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+
+  // One chunk with nulls, one without a validity buffer, and slices of the first
+  // that do not start on a byte boundary
+  std::vector<std::string> wkts = TestWKT(schema_view.geometry_type);
+  std::vector<std::string> wkts_valid = {wkts[3], wkts[0], wkts[2]};
+  struct ArrowArray array;
+  struct ArrowArray array_valid;
+  struct ArrowArray array_sliced;
+  struct ArrowArray array_empty;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts_valid, &array_valid));
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array_sliced));
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array_empty));
+  array_sliced.offset = 1;
+  array_sliced.length -= 2;
+  array_sliced.null_count = -1;
+  array_empty.offset = 3;
+  array_empty.length = 0;
+
+  std::vector<std::string> values = FormatWKT(type, &array);
+  std::vector<std::string> values_valid = FormatWKT(type, &array_valid);
+  std::vector<std::string> values_sliced = FormatWKT(type, &array_sliced);
+  EXPECT_EQ(array_valid.null_count, 0);
+
+  std::vector<std::string> expected;
+  expected.insert(expected.end(), values_valid.begin(), values_valid.end());
+  expected.insert(expected.end(), values.begin(), values.end());
+  expected.insert(expected.end(), values_sliced.begin(), values_sliced.end());
+  expected.insert(expected.end(), values_valid.begin(), values_valid.end());
+  expected.insert(expected.end(), values_sliced.begin(), values_sliced.end());
+
+  const struct ArrowArray* arrays[] = {&array_valid, &array,       &array_sliced,
+                                       &array_empty, &array_valid, &array_sliced};
+  struct ArrowArray out;
+  struct GeoArrowError error;
+  ASSERT_EQ(GeoArrowArrayConcat(arrays, 6, type, &out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.length, static_cast<int64_t>(expected.size()));
+  EXPECT_EQ(out.null_count, std::count(expected.begin(), expected.end(), "<null value>"));
+  EXPECT_EQ(FormatWKT(type, &out), expected);
+  out.release(&out);
+
+  // Without any nulls, the output should not have a validity buffer
+  ASSERT_EQ(GeoArrowArrayConcat(arrays, 1, type, &out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.buffers[0], nullptr);
+  EXPECT_EQ(FormatWKT(type, &out), values_valid);
+  out.release(&out);
+
+  ASSERT_EQ(GeoArrowArrayConcat(arrays, 0, type, &out, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.length, 0);
+  out.release(&out);
+
+  array.release(&array);
+  array_valid.release(&array_valid);
+  array_sliced.release(&array_sliced);
+  array_empty.release(&array_empty);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    SelectTest, SelectTypeParameterizedTestFixture,
+    ::testing::Values(GEOARROW_TYPE_POINT, GEOARROW_TYPE_LINESTRING,
+                      GEOARROW_TYPE_POLYGON, GEOARROW_TYPE_MULTIPOINT,
+                      GEOARROW_TYPE_MULTILINESTRING, GEOARROW_TYPE_MULTIPOLYGON,
+                      GEOARROW_TYPE_INTERLEAVED_POINT, GEOARROW_TYPE_INTERLEAVED_POLYGON,
+                      GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON, GEOARROW_TYPE_POINT_ZM,
+                      GEOARROW_TYPE_INTERLEAVED_LINESTRING_Z,
+                      GEOARROW_TYPE_FLOAT_MULTILINESTRING,
+                      GEOARROW_TYPE_INTERLEAVED_FLOAT_POINT,
+                      GEOARROW_TYPE_INT32_MULTIPOINT, GEOARROW_TYPE_WKB,
+                      GEOARROW_TYPE_WKT));
+
+TEST(SelectTest, SelectTestBox) {
+  struct GeoArrowBuilder builder;
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+
+  // Build the array for [BOX (0 1 => 10 11), null, BOX (2 3 => 12 13),
+  // BOX (4 5 => 14 15)]
+  std::vector<std::vector<double>> ordinates = {
+      {0, 0, 2, 4}, {1, 1, 3, 5}, {10, 10, 12, 14}, {11, 11, 13, 15}};
+  uint8_t validity = 0x0d;
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_BOX), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderAppendBuffer(&builder, 0, {{&validity}, 1}), GEOARROW_OK);
+  for (int j = 0; j < 4; j++) {
+    struct GeoArrowBufferView buffer = {
+        {reinterpret_cast<const uint8_t*>(ordinates[j].data())},
+        static_cast<int64_t>(ordinates[j].size() * sizeof(double))};
+    ASSERT_EQ(GeoArrowBuilderAppendBuffer(&builder, 1 + j, buffer), GEOARROW_OK);
+  }
+  ASSERT_EQ(GeoArrowBuilderFinish(&builder, &array, nullptr), GEOARROW_OK);
+  GeoArrowBuilderReset(&builder);
+
+  std::vector<int64_t> indices = {3, 1, 2, 3};
+  ASSERT_EQ(GeoArrowArrayTake(&array, GEOARROW_TYPE_BOX, indices.data(), 4, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  ASSERT_EQ(out.length, 4);
+  ASSERT_EQ(out.n_children, 4);
+  EXPECT_EQ(out.null_count, 1);
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(out.buffers[0])[0] & 0x0f, 0x0d);
+  for (int j = 0; j < 4; j++) {
+    const double* values = reinterpret_cast<const double*>(out.children[j]->buffers[1]);
+    EXPECT_EQ(std::vector<double>(values, values + 4),
+              std::vector<double>({ordinates[j][3], ordinates[j][1], ordinates[j][2],
+                                   ordinates[j][3]}));
+  }
+
+  out.release(&out);
+  array.release(&array);
+}
+
+TEST(SelectTest, SelectTestConcatValidity) {
+  // Enough rows that whole bytes of the validity bitmap are shifted
+  std::vector<std::string> wkts;
+  for (int i = 0; i < 40; i++) {
+    wkts.push_back((i % 3) == 0 ? "" : "POINT (" + std::to_string(i) + " 0)");
+  }
+
+  struct ArrowArray array;
+  struct ArrowArray array_sliced;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, wkts, &array));
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, wkts, &array_sliced));
+  array_sliced.offset = 5;
+  array_sliced.length = 30;
+  array_sliced.null_count = -1;
+
+  std::vector<std::string> values = FormatWKT(GEOARROW_TYPE_POINT, &array);
+  std::vector<std::string> values_sliced = FormatWKT(GEOARROW_TYPE_POINT, &array_sliced);
+  std::vector<std::string> expected;
+  for (const auto& chunk : {values_sliced, values, values_sliced}) {
+    expected.insert(expected.end(), chunk.begin(), chunk.end());
+  }
+
+  const struct ArrowArray* arrays[] = {&array_sliced, &array, &array_sliced};
+  struct ArrowArray out;
+  struct GeoArrowError error;
+  ASSERT_EQ(GeoArrowArrayConcat(arrays, 3, GEOARROW_TYPE_POINT, &out, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out.null_count, std::count(expected.begin(), expected.end(), "<null value>"));
+  EXPECT_EQ(FormatWKT(GEOARROW_TYPE_POINT, &out), expected);
+
+  out.release(&out);
+  array.release(&array);
+  array_sliced.release(&array_sliced);
+}
+
+TEST(SelectTest, SelectTestErrors) {
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)", "POINT (2 3)"}, &array));
+
+  std::vector<int64_t> indices = {0, 2};
+  EXPECT_EQ(GeoArrowArrayTake(&array, GEOARROW_TYPE_POINT, indices.data(), 2, &out,
+                              &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Index 2 is out of range for array of length 2");
+
+  indices = {-1};
+  EXPECT_EQ(GeoArrowArrayTake(&array, GEOARROW_TYPE_POINT, indices.data(), 1, &out,
+                              &error),
+            EINVAL);
+
+  indices = {0};
+  EXPECT_EQ(GeoArrowArrayTake(&array, GEOARROW_TYPE_LARGE_WKB, indices.data(), 1, &out,
+                              &error),
+            ENOTSUP);
+  EXPECT_STREQ(error.message, "Can't select rows of type 100002");
+
+  // Chunks that don't match the type
+  const struct ArrowArray* arrays[] = {&array};
+  EXPECT_EQ(GeoArrowArrayConcat(arrays, 1, GEOARROW_TYPE_LINESTRING, &out, &error),
+            EINVAL);
+
+  array.release(&array);
+}
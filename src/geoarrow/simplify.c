@@ -0,0 +1,777 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Simplify linestrings and polygon rings using the Douglas-Peucker algorithm or the
+// Visvalingam-Whyatt algorithm. Neither algorithm recurses: Douglas-Peucker keeps a
+// stack of the spans left to split and Visvalingam-Whyatt keeps a heap of the
+// effective area of each coordinate. Only X and Y are considered and the first and
+// last coordinates of every path are kept. Rings that collapse to fewer than four
+// coordinates are removed (the whole polygon if the shell collapses) unless
+// preserve_topology is set, in which case rings always keep at least four coordinates
+// (note that this does not check for self-intersections). Points are not modified.
+//
+// Scratch space is grown as needed and reused across paths, features, and batches.
+
+struct GeoArrowSimplifierPrivate {
+  enum GeoArrowSimplifyMethod method;
+  double tolerance;
+  int preserve_topology;
+  struct ArrowBuffer keep;
+  struct ArrowBuffer indices;
+  struct ArrowBuffer areas;
+  // For visited input, the next visitor and the coordinates of the current
+  // linestring or ring, which are buffered until the end of the path
+  struct GeoArrowVisitor next;
+  struct ArrowBuffer coords;
+  int n_values;
+  int64_t n_coords;
+  int path_active;
+  int path_is_ring;
+  int64_t ring_i;
+  int shell_dropped;
+  // Polygons in a multipolygon are started when their first ring is written such
+  // that polygons whose shell collapsed can be removed
+  int depth;
+  int multipolygon_depth;
+  int polygon_deferred;
+  int polygon_pending;
+  enum GeoArrowDimensions polygon_dimensions;
+};
+
+// Reserves scratch space for simplifying a path of n coordinates
+static ArrowErrorCode simplify_reserve(struct GeoArrowSimplifierPrivate* simplify,
+                                       int64_t n) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(&simplify->keep, n, 0));
+  if (simplify->method == GEOARROW_SIMPLIFY_VISVALINGAM) {
+    // prev, next, heap, and heap position for each coordinate
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferResize(&simplify->indices, 4 * n * (int64_t)sizeof(int64_t), 0));
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferResize(&simplify->areas, n * (int64_t)sizeof(double), 0));
+  } else {
+    // Each span on the stack is a pair of indices and there are at most n - 1 spans
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferResize(&simplify->indices, 2 * n * (int64_t)sizeof(int64_t), 0));
+  }
+
+  return GEOARROW_OK;
+}
+
+// Returns the squared distance between a point and a segment, both relative to the
+// start of the segment, where inv_length2 is one over the squared length of the
+// segment (or zero for a segment of length zero)
+static inline double simplify_segment_dist2(double px, double py, double dx, double dy,
+                                            double inv_length2) {
+  double t = (px * dx + py * dy) * inv_length2;
+  t = t < 0 ? 0 : t;
+  t = t > 1 ? 1 : t;
+  double qx = px - t * dx;
+  double qy = py - t * dy;
+  return qx * qx + qy * qy;
+}
+
+static int64_t simplify_douglas_peucker(struct GeoArrowSimplifierPrivate* simplify,
+                                        const double* x, const double* y,
+                                        int64_t stride, int64_t n, uint8_t* keep) {
+  int64_t* stack = (int64_t*)simplify->indices.data;
+  double tolerance2 = simplify->tolerance * simplify->tolerance;
+
+  memset(keep, 0, (size_t)n);
+  keep[0] = 1;
+  keep[n - 1] = 1;
+  int64_t n_kept = 2;
+
+  int64_t top = 0;
+  stack[top++] = 0;
+  stack[top++] = n - 1;
+  while (top > 0) {
+    int64_t end = stack[--top];
+    int64_t start = stack[--top];
+
+    double x0 = x[start * stride];
+    double y0 = y[start * stride];
+    double dx = x[end * stride] - x0;
+    double dy = y[end * stride] - y0;
+    double length2 = dx * dx + dy * dy;
+    double inv_length2 = length2 > 0 ? 1 / length2 : 0;
+
+    int64_t i_max = start;
+    double dist2_max = -1;
+    for (int64_t i = start + 1; i < end; i++) {
+      double dist2 = simplify_segment_dist2(x[i * stride] - x0, y[i * stride] - y0, dx,
+                                            dy, inv_length2);
+      i_max = dist2 > dist2_max ? i : i_max;
+      dist2_max = dist2 > dist2_max ? dist2 : dist2_max;
+    }
+
+    if (i_max != start && dist2_max > tolerance2) {
+      keep[i_max] = 1;
+      n_kept++;
+      stack[top++] = start;
+      stack[top++] = i_max;
+      stack[top++] = i_max;
+      stack[top++] = end;
+    }
+  }
+
+  return n_kept;
+}
+
+// Keeps the coordinate furthest from the first coordinate of a ring and the coordinate
+// furthest from the segment between those two such that the ring keeps at least four
+// coordinates
+static int64_t simplify_ring_keep4(const double* x, const double* y, int64_t stride,
+                                   int64_t n, uint8_t* keep) {
+  double x0 = x[0];
+  double y0 = y[0];
+
+  int64_t i1 = 1;
+  double dist2_max = -1;
+  for (int64_t i = 1; i < (n - 1); i++) {
+    double dx = x[i * stride] - x0;
+    double dy = y[i * stride] - y0;
+    double dist2 = dx * dx + dy * dy;
+    i1 = dist2 > dist2_max ? i : i1;
+    dist2_max = dist2 > dist2_max ? dist2 : dist2_max;
+  }
+
+  double dx = x[i1 * stride] - x0;
+  double dy = y[i1 * stride] - y0;
+  double length2 = dx * dx + dy * dy;
+  double inv_length2 = length2 > 0 ? 1 / length2 : 0;
+  int64_t i2 = i1 == 1 ? 2 : 1;
+  dist2_max = -1;
+  for (int64_t i = 1; i < (n - 1); i++) {
+    double dist2 = simplify_segment_dist2(x[i * stride] - x0, y[i * stride] - y0, dx, dy,
+                                          inv_length2);
+    int is_max = i != i1 && dist2 > dist2_max;
+    i2 = is_max ? i : i2;
+    dist2_max = is_max ? dist2 : dist2_max;
+  }
+
+  keep[i1] = 1;
+  keep[i2] = 1;
+
+  int64_t n_kept = 0;
+  for (int64_t i = 0; i < n; i++) {
+    n_kept += keep[i];
+  }
+
+  return n_kept;
+}
+
+static inline double simplify_triangle_area(const double* x, const double* y,
+                                            int64_t stride, int64_t a, int64_t b,
+                                            int64_t c) {
+  double ax = x[a * stride] - x[b * stride];
+  double ay = y[a * stride] - y[b * stride];
+  double cx = x[c * stride] - x[b * stride];
+  double cy = y[c * stride] - y[b * stride];
+  return fabs(ax * cy - cx * ay) / 2;
+}
+
+// A binary min-heap of coordinate indices ordered by area, where pos is the position
+// of each coordinate in the heap
+static void simplify_heap_swap(int64_t* heap, int64_t* pos, int64_t i, int64_t j) {
+  int64_t tmp = heap[i];
+  heap[i] = heap[j];
+  heap[j] = tmp;
+  pos[heap[i]] = i;
+  pos[heap[j]] = j;
+}
+
+static void simplify_heap_up(int64_t* heap, int64_t* pos, const double* areas,
+                             int64_t i) {
+  while (i > 0) {
+    int64_t parent = (i - 1) / 2;
+    if (areas[heap[parent]] <= areas[heap[i]]) {
+      break;
+    }
+
+    simplify_heap_swap(heap, pos, i, parent);
+    i = parent;
+  }
+}
+
+static void simplify_heap_down(int64_t* heap, int64_t* pos, const double* areas,
+                               int64_t n_heap, int64_t i) {
+  while (1) {
+    int64_t smallest = i;
+    int64_t left = 2 * i + 1;
+    int64_t right = left + 1;
+    if (left < n_heap && areas[heap[left]] < areas[heap[smallest]]) {
+      smallest = left;
+    }
+
+    if (right < n_heap && areas[heap[right]] < areas[heap[smallest]]) {
+      smallest = right;
+    }
+
+    if (smallest == i) {
+      break;
+    }
+
+    simplify_heap_swap(heap, pos, i, smallest);
+    i = smallest;
+  }
+}
+
+static int64_t simplify_visvalingam(struct GeoArrowSimplifierPrivate* simplify,
+                                    const double* x, const double* y, int64_t stride,
+                                    int64_t n, int64_t min_kept, uint8_t* keep) {
+  int64_t* prev = (int64_t*)simplify->indices.data;
+  int64_t* next = prev + n;
+  int64_t* heap = next + n;
+  int64_t* pos = heap + n;
+  double* areas = (double*)simplify->areas.data;
+
+  memset(keep, 1, (size_t)n);
+  int64_t n_heap = 0;
+  for (int64_t i = 1; i < (n - 1); i++) {
+    prev[i] = i - 1;
+    next[i] = i + 1;
+    areas[i] = simplify_triangle_area(x, y, stride, i - 1, i, i + 1);
+    heap[n_heap] = i;
+    pos[i] = n_heap;
+    n_heap++;
+  }
+
+  for (int64_t i = n_heap / 2 - 1; i >= 0; i--) {
+    simplify_heap_down(heap, pos, areas, n_heap, i);
+  }
+
+  int64_t n_kept = n;
+  while (n_heap > 0 && n_kept > min_kept) {
+    int64_t i = heap[0];
+    double area = areas[i];
+    if (area >= simplify->tolerance) {
+      break;
+    }
+
+    n_heap--;
+    if (n_heap > 0) {
+      simplify_heap_swap(heap, pos, 0, n_heap);
+      simplify_heap_down(heap, pos, areas, n_heap, 0);
+    }
+
+    keep[i] = 0;
+    n_kept--;
+
+    // The effective area of a neighbour never drops below that of the coordinate
+    // that was just removed
+    int64_t a = prev[i];
+    int64_t c = next[i];
+    if (a > 0) {
+      next[a] = c;
+      double new_area = simplify_triangle_area(x, y, stride, prev[a], a, c);
+      areas[a] = new_area > area ? new_area : area;
+      simplify_heap_up(heap, pos, areas, pos[a]);
+      simplify_heap_down(heap, pos, areas, n_heap, pos[a]);
+    }
+
+    if (c < (n - 1)) {
+      prev[c] = a;
+      double new_area = simplify_triangle_area(x, y, stride, a, c, next[c]);
+      areas[c] = new_area > area ? new_area : area;
+      simplify_heap_up(heap, pos, areas, pos[c]);
+      simplify_heap_down(heap, pos, areas, n_heap, pos[c]);
+    }
+  }
+
+  return n_kept;
+}
+
+// Populates simplify->keep with the coordinates of a path of n coordinates to keep
+// and n_kept with their number (zero if the path is a ring that collapsed)
+static ArrowErrorCode simplify_path(struct GeoArrowSimplifierPrivate* simplify,
+                                    const double* x, const double* y, int64_t stride,
+                                    int64_t n, int is_ring, int64_t* n_kept) {
+  // simplify->keep may not have been allocated yet
+  if (n == 0) {
+    *n_kept = 0;
+    return GEOARROW_OK;
+  }
+
+  NANOARROW_RETURN_NOT_OK(simplify_reserve(simplify, n));
+  uint8_t* keep = simplify->keep.data;
+
+  if (n <= 2 || (is_ring && n < 4)) {
+    memset(keep, 1, (size_t)n);
+    *n_kept = n;
+    return GEOARROW_OK;
+  }
+
+  int preserve_ring = is_ring && simplify->preserve_topology;
+  if (simplify->method == GEOARROW_SIMPLIFY_VISVALINGAM) {
+    int64_t min_kept = preserve_ring ? 4 : 2;
+    *n_kept = simplify_visvalingam(simplify, x, y, stride, n, min_kept, keep);
+  } else {
+    *n_kept = simplify_douglas_peucker(simplify, x, y, stride, n, keep);
+    if (preserve_ring && *n_kept < 4) {
+      *n_kept = simplify_ring_keep4(x, y, stride, n, keep);
+    }
+  }
+
+  if (is_ring && *n_kept < 4) {
+    *n_kept = 0;
+  }
+
+  return GEOARROW_OK;
+}
+
+// Visited input
+//
+// Coordinates of each linestring or ring are buffered until the end of the path and
+// every other callback is forwarded to the next visitor, whose callbacks expect their
+// own private_data and an up-to-date error
+
+static int feat_start_simplify(struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  return simplify->next.feat_start(&simplify->next);
+}
+
+static int null_feat_simplify(struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  return simplify->next.null_feat(&simplify->next);
+}
+
+static int geom_start_simplify(struct GeoArrowVisitor* v,
+                               enum GeoArrowGeometryType geometry_type,
+                               enum GeoArrowDimensions dimensions) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      simplify->path_active = 1;
+      simplify->path_is_ring = 0;
+      simplify->n_coords = 0;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      simplify->ring_i = 0;
+      simplify->shell_dropped = 0;
+      if (simplify->multipolygon_depth >= 0 &&
+          simplify->multipolygon_depth == (simplify->depth - 1)) {
+        simplify->depth++;
+        simplify->polygon_deferred = 1;
+        simplify->polygon_pending = 1;
+        simplify->polygon_dimensions = dimensions;
+        return GEOARROW_OK;
+      }
+      break;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      simplify->multipolygon_depth = simplify->depth;
+      break;
+    default:
+      break;
+  }
+
+  simplify->depth++;
+  return simplify->next.geom_start(&simplify->next, geometry_type, dimensions);
+}
+
+static int ring_start_simplify(struct GeoArrowVisitor* v) {
+  // The ring is forwarded on ring_end() if it did not collapse
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  simplify->path_active = 1;
+  simplify->path_is_ring = 1;
+  simplify->n_coords = 0;
+  return GEOARROW_OK;
+}
+
+static int coords_simplify(struct GeoArrowVisitor* v,
+                           const struct GeoArrowCoordView* coords) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  if (!simplify->path_active) {
+    return simplify->next.coords(&simplify->next, coords);
+  }
+
+  int n_values = coords->n_values;
+  simplify->n_values = n_values;
+  int64_t n_ordinates = (simplify->n_coords + coords->n_coords) * n_values;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferResize(
+      &simplify->coords, n_ordinates * (int64_t)sizeof(double), 0));
+
+  double* out = (double*)simplify->coords.data + simplify->n_coords * n_values;
+  for (int64_t i = 0; i < coords->n_coords; i++) {
+    for (int j = 0; j < n_values; j++) {
+      out[i * n_values + j] = coords->values[j][i * coords->coords_stride];
+    }
+  }
+
+  simplify->n_coords += coords->n_coords;
+  return GEOARROW_OK;
+}
+
+// Simplifies the buffered path and moves the kept coordinates to the front
+static ArrowErrorCode simplify_buffered_path(struct GeoArrowSimplifierPrivate* simplify,
+                                             int64_t* n_kept) {
+  simplify->path_active = 0;
+  int n_values = simplify->n_values;
+  double* values = (double*)simplify->coords.data;
+  NANOARROW_RETURN_NOT_OK(simplify_path(simplify, values, values + 1, n_values,
+                                        simplify->n_coords, simplify->path_is_ring,
+                                        n_kept));
+
+  const uint8_t* keep = simplify->keep.data;
+  int64_t k = 0;
+  for (int64_t i = 0; i < simplify->n_coords; i++) {
+    if (keep[i]) {
+      memmove(values + k * n_values, values + i * n_values,
+              n_values * sizeof(double));
+      k++;
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+static int simplify_forward_coords(struct GeoArrowSimplifierPrivate* simplify,
+                                   int64_t n_kept) {
+  if (n_kept == 0) {
+    return GEOARROW_OK;
+  }
+
+  struct GeoArrowCoordView coords;
+  coords.n_coords = n_kept;
+  coords.n_values = simplify->n_values;
+  coords.coords_stride = simplify->n_values;
+  for (int j = 0; j < simplify->n_values; j++) {
+    coords.values[j] = (const double*)simplify->coords.data + j;
+  }
+
+  return simplify->next.coords(&simplify->next, &coords);
+}
+
+static int ring_end_simplify(struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  int64_t ring_i = simplify->ring_i++;
+  if (simplify->shell_dropped) {
+    simplify->path_active = 0;
+    return GEOARROW_OK;
+  }
+
+  int64_t n_kept;
+  NANOARROW_RETURN_NOT_OK(simplify_buffered_path(simplify, &n_kept));
+  if (n_kept == 0 && simplify->n_coords > 0) {
+    simplify->shell_dropped = ring_i == 0;
+    return GEOARROW_OK;
+  }
+
+  if (simplify->polygon_pending) {
+    simplify->polygon_pending = 0;
+    NANOARROW_RETURN_NOT_OK(simplify->next.geom_start(
+        &simplify->next, GEOARROW_GEOMETRY_TYPE_POLYGON, simplify->polygon_dimensions));
+  }
+
+  NANOARROW_RETURN_NOT_OK(simplify->next.ring_start(&simplify->next));
+  NANOARROW_RETURN_NOT_OK(simplify_forward_coords(simplify, n_kept));
+  return simplify->next.ring_end(&simplify->next);
+}
+
+static int geom_end_simplify(struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  if (simplify->path_active) {
+    int64_t n_kept;
+    NANOARROW_RETURN_NOT_OK(simplify_buffered_path(simplify, &n_kept));
+    NANOARROW_RETURN_NOT_OK(simplify_forward_coords(simplify, n_kept));
+  }
+
+  simplify->depth--;
+  if (simplify->polygon_deferred && simplify->depth == simplify->multipolygon_depth + 1) {
+    simplify->polygon_deferred = 0;
+    if (simplify->polygon_pending) {
+      simplify->polygon_pending = 0;
+      return GEOARROW_OK;
+    }
+  } else if (simplify->depth == simplify->multipolygon_depth) {
+    simplify->multipolygon_depth = -1;
+  }
+
+  return simplify->next.geom_end(&simplify->next);
+}
+
+static int feat_end_simplify(struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* simplify =
+      (struct GeoArrowSimplifierPrivate*)v->private_data;
+  simplify->next.error = v->error;
+  return simplify->next.feat_end(&simplify->next);
+}
+
+// Native input
+
+// Appends the kept coordinates of the path starting at coordinate start to builder,
+// whose coordinates have already been reserved
+static void simplify_native_append(struct GeoArrowBuilder* builder,
+                                   const struct GeoArrowArrayView* array_view,
+                                   int64_t start, int64_t n, const uint8_t* keep) {
+  struct GeoArrowWritableCoordView* out = &builder->view.coords;
+  const struct GeoArrowCoordView* coords = &array_view->coords;
+  int64_t k = out->size_coords;
+  for (int64_t i = 0; i < n; i++) {
+    if (!keep[i]) {
+      continue;
+    }
+
+    for (int j = 0; j < coords->n_values; j++) {
+      out->values[j][k * out->coords_stride] =
+          coords->values[j][(start + i) * coords->coords_stride];
+    }
+
+    k++;
+  }
+
+  out->size_coords = k;
+}
+
+// Simplifies the linestrings or rings [start, end) whose coordinates are given by the
+// offsets at level, appending an offset at level for each path written. For rings,
+// nothing is written if the first ring (i.e., the shell) collapses.
+static ArrowErrorCode simplify_native_paths(struct GeoArrowSimplifierPrivate* simplify,
+                                            struct GeoArrowBuilder* builder,
+                                            const struct GeoArrowArrayView* array_view,
+                                            int level, int64_t start, int64_t end,
+                                            int is_ring, int64_t* n_paths) {
+  const int32_t* offsets = array_view->offsets[level];
+  int64_t stride = array_view->coords.coords_stride;
+  *n_paths = 0;
+
+  for (int64_t i = start; i < end; i++) {
+    int64_t coord_start = offsets[i];
+    int64_t n = offsets[i + 1] - coord_start;
+    int64_t n_kept;
+    NANOARROW_RETURN_NOT_OK(simplify_path(
+        simplify, array_view->coords.values[0] + coord_start * stride,
+        array_view->coords.values[1] + coord_start * stride, stride, n, is_ring,
+        &n_kept));
+
+    if (n_kept == 0 && n > 0) {
+      if (i == start) {
+        return GEOARROW_OK;
+      }
+
+      continue;
+    }
+
+    simplify_native_append(builder, array_view, coord_start, n, simplify->keep.data);
+    int32_t offset = (int32_t)builder->view.coords.size_coords;
+    GeoArrowBuilderOffsetAppendUnsafe(builder, level, &offset, 1);
+    (*n_paths)++;
+  }
+
+  return GEOARROW_OK;
+}
+
+static ArrowErrorCode simplify_native(struct GeoArrowSimplifierPrivate* simplify,
+                                      struct GeoArrowBuilder* builder,
+                                      const struct GeoArrowArrayView* array_view) {
+  // The output is never larger than the input
+  NANOARROW_RETURN_NOT_OK(
+      GeoArrowBuilderCoordsReserve(builder, array_view->coords.n_coords));
+  int32_t zero = 0;
+  for (int i = 0; i < array_view->n_offsets; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        GeoArrowBuilderOffsetReserve(builder, i, array_view->length[i] + 1));
+    GeoArrowBuilderOffsetAppendUnsafe(builder, i, &zero, 1);
+  }
+
+  const int32_t* offsets = array_view->offsets[0];
+  int64_t n_paths;
+  int64_t n_paths_total = 0;
+  int64_t n_polygons_total = 0;
+  int32_t offset;
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      return simplify_native_paths(simplify, builder, array_view, 0, 0,
+                                   array_view->length[0], 0, &n_paths);
+
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING: {
+      int is_ring =
+          array_view->schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_POLYGON;
+      for (int64_t i = 0; i < array_view->length[0]; i++) {
+        NANOARROW_RETURN_NOT_OK(simplify_native_paths(simplify, builder, array_view, 1,
+                                                      offsets[i], offsets[i + 1],
+                                                      is_ring, &n_paths));
+        n_paths_total += n_paths;
+        offset = (int32_t)n_paths_total;
+        GeoArrowBuilderOffsetAppendUnsafe(builder, 0, &offset, 1);
+      }
+
+      return GEOARROW_OK;
+    }
+
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON: {
+      // Polygons whose shell collapsed are removed
+      const int32_t* ring_offsets = array_view->offsets[1];
+      for (int64_t i = 0; i < array_view->length[0]; i++) {
+        for (int64_t j = offsets[i]; j < offsets[i + 1]; j++) {
+          NANOARROW_RETURN_NOT_OK(simplify_native_paths(
+              simplify, builder, array_view, 2, ring_offsets[j], ring_offsets[j + 1], 1,
+              &n_paths));
+          if (n_paths > 0) {
+            n_paths_total += n_paths;
+            offset = (int32_t)n_paths_total;
+            GeoArrowBuilderOffsetAppendUnsafe(builder, 1, &offset, 1);
+            n_polygons_total++;
+          }
+        }
+
+        offset = (int32_t)n_polygons_total;
+        GeoArrowBuilderOffsetAppendUnsafe(builder, 0, &offset, 1);
+      }
+
+      return GEOARROW_OK;
+    }
+
+    default:
+      return ENOTSUP;
+  }
+}
+
+// Only unsliced input whose offsets start at zero is simplified from its buffers
+static int simplify_native_supported(const struct GeoArrowArrayView* array_view,
+                                     const struct GeoArrowBuilder* builder) {
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      break;
+    default:
+      return 0;
+  }
+
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  if (GeoArrowCoordTypeOrdinateSize(coord_type) != (int64_t)sizeof(double) ||
+      builder->view.schema_view.type != array_view->schema_view.type) {
+    return 0;
+  }
+
+  for (int i = 0; i <= array_view->n_offsets; i++) {
+    if (array_view->offset[i] != 0) {
+      return 0;
+    }
+  }
+
+  for (int i = 0; i < array_view->n_offsets; i++) {
+    if (array_view->length[i] > 0 && array_view->first_offset[i] != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+GeoArrowErrorCode GeoArrowSimplifierInit(struct GeoArrowSimplifier* simplifier,
+                                         enum GeoArrowSimplifyMethod method,
+                                         double tolerance, int preserve_topology,
+                                         struct GeoArrowError* error) {
+  switch (method) {
+    case GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER:
+    case GEOARROW_SIMPLIFY_VISVALINGAM:
+      break;
+    default:
+      GeoArrowErrorSet(error, "Unknown simplify method %d", (int)method);
+      return EINVAL;
+  }
+
+  if (!(tolerance >= 0)) {
+    GeoArrowErrorSet(error, "Expected a non-negative tolerance");
+    return EINVAL;
+  }
+
+  struct GeoArrowSimplifierPrivate* private_data =
+      (struct GeoArrowSimplifierPrivate*)ArrowMalloc(
+          sizeof(struct GeoArrowSimplifierPrivate));
+  if (private_data == NULL) {
+    GeoArrowErrorSet(error, "Failed to allocate GeoArrowSimplifierPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct GeoArrowSimplifierPrivate));
+  private_data->method = method;
+  private_data->tolerance = tolerance;
+  private_data->preserve_topology = preserve_topology != 0;
+  ArrowBufferInit(&private_data->keep);
+  ArrowBufferInit(&private_data->indices);
+  ArrowBufferInit(&private_data->areas);
+  ArrowBufferInit(&private_data->coords);
+  GeoArrowVisitorInitVoid(&private_data->next);
+  private_data->multipolygon_depth = -1;
+
+  simplifier->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+void GeoArrowSimplifierInitVisitor(struct GeoArrowSimplifier* simplifier,
+                                   const struct GeoArrowVisitor* next,
+                                   struct GeoArrowVisitor* v) {
+  struct GeoArrowSimplifierPrivate* private_data =
+      (struct GeoArrowSimplifierPrivate*)simplifier->private_data;
+  private_data->next = *next;
+  private_data->path_active = 0;
+  private_data->depth = 0;
+  private_data->multipolygon_depth = -1;
+  private_data->polygon_deferred = 0;
+  private_data->polygon_pending = 0;
+
+  GeoArrowVisitorInitVoid(v);
+  v->feat_start = &feat_start_simplify;
+  v->null_feat = &null_feat_simplify;
+  v->geom_start = &geom_start_simplify;
+  v->ring_start = &ring_start_simplify;
+  v->coords = &coords_simplify;
+  v->ring_end = &ring_end_simplify;
+  v->geom_end = &geom_end_simplify;
+  v->feat_end = &feat_end_simplify;
+  v->private_data = private_data;
+}
+
+GeoArrowErrorCode GeoArrowSimplifierAppend(struct GeoArrowSimplifier* simplifier,
+                                           const struct GeoArrowArrayView* array_view,
+                                           struct GeoArrowBuilder* builder) {
+  struct GeoArrowSimplifierPrivate* private_data =
+      (struct GeoArrowSimplifierPrivate*)simplifier->private_data;
+  if (!simplify_native_supported(array_view, builder)) {
+    return ENOTSUP;
+  }
+
+  if (array_view->validity_bitmap != NULL) {
+    struct GeoArrowBufferView validity;
+    validity.data = array_view->validity_bitmap;
+    validity.size_bytes = _ArrowBytesForBits(array_view->length[0]);
+    GEOARROW_RETURN_NOT_OK(GeoArrowBuilderAppendBuffer(builder, 0, validity));
+  }
+
+  return simplify_native(private_data, builder, array_view);
+}
+
+void GeoArrowSimplifierReset(struct GeoArrowSimplifier* simplifier) {
+  struct GeoArrowSimplifierPrivate* private_data =
+      (struct GeoArrowSimplifierPrivate*)simplifier->private_data;
+  ArrowBufferReset(&private_data->keep);
+  ArrowBufferReset(&private_data->indices);
+  ArrowBufferReset(&private_data->areas);
+  ArrowBufferReset(&private_data->coords);
+  ArrowFree(private_data);
+  simplifier->private_data = NULL;
+}
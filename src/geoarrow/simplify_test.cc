@@ -0,0 +1,140 @@
+#include <errno.h>
+#include <math.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+// Simplifies array by appending it to a builder (if visit is false) or by visiting
+// it, returning the result as WKT
+static std::vector<std::string> Simplify(enum GeoArrowSimplifyMethod method,
+                                         double tolerance, int preserve_topology,
+                                         enum GeoArrowType type,
+                                         const struct ArrowArray* array, bool visit) {
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowSimplifier simplifier;
+  struct GeoArrowError error;
+  WKXTester tester;
+
+  EXPECT_EQ(GeoArrowArrayViewInitFromType(&array_view, type), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowArrayViewSetArray(&array_view, array, &error), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowSimplifierInit(&simplifier, method, tolerance, preserve_topology,
+                                   &error),
+            GEOARROW_OK);
+
+  if (visit) {
+    struct GeoArrowVisitor v;
+    GeoArrowSimplifierInitVisitor(&simplifier, tester.WKTVisitor(), &v);
+    v.error = &error;
+    EXPECT_EQ(GeoArrowArrayViewVisitNative(&array_view, 0, array_view.length[0], &v),
+              GEOARROW_OK);
+  } else {
+    struct GeoArrowBuilder builder;
+    struct ArrowArray out;
+    EXPECT_EQ(GeoArrowBuilderInitFromType(&builder, type), GEOARROW_OK);
+    EXPECT_EQ(GeoArrowSimplifierAppend(&simplifier, &array_view, &builder),
+              GEOARROW_OK);
+    EXPECT_EQ(GeoArrowBuilderFinish(&builder, &out, &error), GEOARROW_OK);
+    GeoArrowBuilderReset(&builder);
+
+    EXPECT_EQ(GeoArrowArrayViewSetArray(&array_view, &out, &error), GEOARROW_OK);
+    EXPECT_EQ(GeoArrowArrayViewVisitNative(&array_view, 0, array_view.length[0],
+                                           tester.WKTVisitor()),
+              GEOARROW_OK);
+    out.release(&out);
+  }
+
+  GeoArrowSimplifierReset(&simplifier);
+  return tester.WKTValues("<null value>");
+}
+
+TEST(SimplifyTest, SimplifyInitErrors) {
+  struct GeoArrowSimplifier simplifier;
+  struct GeoArrowError error;
+
+  EXPECT_EQ(GeoArrowSimplifierInit(&simplifier, GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER, -1, 0,
+                                   &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected a non-negative tolerance");
+  EXPECT_EQ(GeoArrowSimplifierInit(&simplifier, GEOARROW_SIMPLIFY_VISVALINGAM, NAN, 0,
+                                   &error),
+            EINVAL);
+  EXPECT_EQ(GeoArrowSimplifierInit(&simplifier,
+                                   static_cast<enum GeoArrowSimplifyMethod>(100), 1, 0,
+                                   &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Unknown simplify method 100");
+}
+
+TEST(SimplifyTest, SimplifyAppendMatchesVisit) {
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_MULTIPOLYGON,
+      {"MULTIPOLYGON (((0 0, 10 0, 10 0.1, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1)))",
+       "", "MULTIPOLYGON EMPTY",
+       "MULTIPOLYGON (((0 0, 0.1 0, 0 0.1, 0 0)), ((5 5, 15 5, 5 15, 5 5)))"},
+      &array));
+
+  for (auto method : {GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER, GEOARROW_SIMPLIFY_VISVALINGAM}) {
+    SCOPED_TRACE(method);
+    for (int preserve_topology : {0, 1}) {
+      EXPECT_EQ(Simplify(method, 1, preserve_topology, GEOARROW_TYPE_MULTIPOLYGON, &array,
+                         false),
+                Simplify(method, 1, preserve_topology, GEOARROW_TYPE_MULTIPOLYGON, &array,
+                         true));
+    }
+  }
+
+  // The small hole and the small polygon collapse
+  EXPECT_EQ(Simplify(GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER, 1, 0, GEOARROW_TYPE_MULTIPOLYGON,
+                     &array, false),
+            std::vector<std::string>(
+                {"MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)))", "<null value>",
+                 "MULTIPOLYGON EMPTY", "MULTIPOLYGON (((5 5, 15 5, 5 15, 5 5)))"}));
+
+  array.release(&array);
+}
+
+TEST(SimplifyTest, SimplifyAppendNotSupported) {
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowSimplifier simplifier;
+  struct GeoArrowBuilder builder;
+  struct GeoArrowError error;
+
+  ASSERT_EQ(GeoArrowSimplifierInit(&simplifier, GEOARROW_SIMPLIFY_DOUGLAS_PEUCKER, 1, 0,
+                                   &error),
+            GEOARROW_OK);
+
+  // Points are never simplified...
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)"}, &array));
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_POINT), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_POINT), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowSimplifierAppend(&simplifier, &array_view, &builder), ENOTSUP);
+  GeoArrowBuilderReset(&builder);
+  array.release(&array);
+
+  // ...and sliced input has to be visited
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_LINESTRING, {"LINESTRING (0 0, 1 0)", "LINESTRING (0 0, 1 0)"},
+      &array));
+  array.offset = 1;
+  array.length = 1;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_LINESTRING),
+            GEOARROW_OK);
+  EXPECT_EQ(GeoArrowSimplifierAppend(&simplifier, &array_view, &builder), ENOTSUP);
+  GeoArrowBuilderReset(&builder);
+  array.release(&array);
+
+  GeoArrowSimplifierReset(&simplifier);
+}
@@ -0,0 +1,405 @@
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// Coordinate operations only ever touch coordinates: offset and validity buffers
+// never change, so a transformed native array can reuse them as-is (or, when the
+// caller owns the array, the coordinates can be overwritten in place). Each loop
+// reads and writes through a stride that is passed as a constant from the
+// dispatcher for the common separated (1) and interleaved XY (2) layouts such that
+// the compiler can vectorize it.
+
+static const double kGeoArrowTransformPi = 3.14159265358979323846;
+static const double kGeoArrowTransformDegToRad = 0.017453292519943295;
+static const double kGeoArrowTransformRadToDeg = 57.29577951308232;
+
+// The radius of the sphere used by Web Mercator (EPSG:3857) and the latitude at which
+// its extent is square, beyond which latitudes are clamped
+static const double kGeoArrowWebMercatorRadius = 6378137.0;
+static const double kGeoArrowWebMercatorMaxLat = 85.0511287798066;
+
+void GeoArrowTransformInit(struct GeoArrowTransform* transform,
+                           enum GeoArrowTransformType type) {
+  memset(transform, 0, sizeof(struct GeoArrowTransform));
+  transform->type = type;
+  transform->matrix[0] = 1;
+  transform->matrix[4] = 1;
+  transform->matrix[8] = 1;
+}
+
+GeoArrowErrorCode GeoArrowTransformSetAffine(struct GeoArrowTransform* transform,
+                                             const double* values, int n_values) {
+  GeoArrowTransformInit(transform, GEOARROW_TRANSFORM_AFFINE);
+  switch (n_values) {
+    case 6:
+      transform->matrix[0] = values[0];
+      transform->matrix[1] = values[1];
+      transform->matrix[3] = values[2];
+      transform->matrix[4] = values[3];
+      transform->matrix[9] = values[4];
+      transform->matrix[10] = values[5];
+      return GEOARROW_OK;
+    case 12:
+      memcpy(transform->matrix, values, sizeof(transform->matrix));
+      return GEOARROW_OK;
+    default:
+      return EINVAL;
+  }
+}
+
+static inline void GeoArrowTransformAffineXY(const double* m, const double* x,
+                                             const double* y, int64_t src_stride,
+                                             double* x_out, double* y_out,
+                                             int64_t dst_stride, int64_t n) {
+  double a = m[0], b = m[1], d = m[3], e = m[4], xoff = m[9], yoff = m[10];
+  for (int64_t i = 0; i < n; i++) {
+    double xi = x[i * src_stride];
+    double yi = y[i * src_stride];
+    x_out[i * dst_stride] = a * xi + b * yi + xoff;
+    y_out[i * dst_stride] = d * xi + e * yi + yoff;
+  }
+}
+
+static inline void GeoArrowTransformAffineXYZ(const double* m, const double* x,
+                                              const double* y, const double* z,
+                                              int64_t src_stride, double* x_out,
+                                              double* y_out, double* z_out,
+                                              int64_t dst_stride, int64_t n) {
+  double a = m[0], b = m[1], c = m[2], d = m[3], e = m[4], f = m[5];
+  double g = m[6], h = m[7], k = m[8], xoff = m[9], yoff = m[10], zoff = m[11];
+  for (int64_t i = 0; i < n; i++) {
+    double xi = x[i * src_stride];
+    double yi = y[i * src_stride];
+    double zi = z[i * src_stride];
+    x_out[i * dst_stride] = a * xi + b * yi + c * zi + xoff;
+    y_out[i * dst_stride] = d * xi + e * yi + f * zi + yoff;
+    z_out[i * dst_stride] = g * xi + h * yi + k * zi + zoff;
+  }
+}
+
+static inline void GeoArrowTransformToWebMercator(const double* x, const double* y,
+                                                  int64_t src_stride, double* x_out,
+                                                  double* y_out, int64_t dst_stride,
+                                                  int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    double lat = y[i * src_stride];
+    lat = lat > kGeoArrowWebMercatorMaxLat ? kGeoArrowWebMercatorMaxLat : lat;
+    lat = lat < -kGeoArrowWebMercatorMaxLat ? -kGeoArrowWebMercatorMaxLat : lat;
+    x_out[i * dst_stride] =
+        x[i * src_stride] * kGeoArrowTransformDegToRad * kGeoArrowWebMercatorRadius;
+    // Equivalent to log(tan(pi / 4 + lat / 2)) but exact at the equator
+    y_out[i * dst_stride] =
+        atanh(sin(lat * kGeoArrowTransformDegToRad)) * kGeoArrowWebMercatorRadius;
+  }
+}
+
+static inline void GeoArrowTransformFromWebMercator(const double* x, const double* y,
+                                                    int64_t src_stride, double* x_out,
+                                                    double* y_out, int64_t dst_stride,
+                                                    int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    double yi = y[i * src_stride] / kGeoArrowWebMercatorRadius;
+    x_out[i * dst_stride] =
+        x[i * src_stride] / kGeoArrowWebMercatorRadius * kGeoArrowTransformRadToDeg;
+    y_out[i * dst_stride] =
+        (2 * atan(exp(yi)) - kGeoArrowTransformPi / 2) * kGeoArrowTransformRadToDeg;
+  }
+}
+
+static inline void GeoArrowTransformStrided(const struct GeoArrowTransform* transform,
+                                            const double* const* src,
+                                            int64_t src_stride, double* const* dst,
+                                            int64_t dst_stride, int64_t n_coords,
+                                            int z_index) {
+  switch (transform->type) {
+    case GEOARROW_TRANSFORM_AFFINE:
+      if (z_index < 0) {
+        GeoArrowTransformAffineXY(transform->matrix, src[0], src[1], src_stride, dst[0],
+                                  dst[1], dst_stride, n_coords);
+      } else {
+        GeoArrowTransformAffineXYZ(transform->matrix, src[0], src[1], src[z_index],
+                                   src_stride, dst[0], dst[1], dst[z_index],
+                                   dst_stride, n_coords);
+      }
+      break;
+    case GEOARROW_TRANSFORM_TO_WEB_MERCATOR:
+      GeoArrowTransformToWebMercator(src[0], src[1], src_stride, dst[0], dst[1],
+                                     dst_stride, n_coords);
+      break;
+    case GEOARROW_TRANSFORM_FROM_WEB_MERCATOR:
+      GeoArrowTransformFromWebMercator(src[0], src[1], src_stride, dst[0], dst[1],
+                                       dst_stride, n_coords);
+      break;
+  }
+}
+
+GeoArrowErrorCode GeoArrowTransformOrdinates(const struct GeoArrowTransform* transform,
+                                             const double* const* src,
+                                             int64_t src_stride, double* const* dst,
+                                             int64_t dst_stride, int64_t n_coords,
+                                             enum GeoArrowDimensions dimensions) {
+  int n_values;
+  int z_index;
+  switch (dimensions) {
+    case GEOARROW_DIMENSIONS_XY:
+      n_values = 2;
+      z_index = -1;
+      break;
+    case GEOARROW_DIMENSIONS_XYZ:
+      n_values = 3;
+      z_index = 2;
+      break;
+    case GEOARROW_DIMENSIONS_XYM:
+      n_values = 3;
+      z_index = -1;
+      break;
+    case GEOARROW_DIMENSIONS_XYZM:
+      n_values = 4;
+      z_index = 2;
+      break;
+    default:
+      return EINVAL;
+  }
+
+  switch (transform->type) {
+    case GEOARROW_TRANSFORM_AFFINE:
+    case GEOARROW_TRANSFORM_TO_WEB_MERCATOR:
+    case GEOARROW_TRANSFORM_FROM_WEB_MERCATOR:
+      break;
+    default:
+      return EINVAL;
+  }
+
+  // Only the affine transform modifies Z
+  if (transform->type != GEOARROW_TRANSFORM_AFFINE) {
+    z_index = -1;
+  }
+
+  if (src_stride == 1 && dst_stride == 1) {
+    GeoArrowTransformStrided(transform, src, 1, dst, 1, n_coords, z_index);
+  } else if (src_stride == 2 && dst_stride == 2) {
+    GeoArrowTransformStrided(transform, src, 2, dst, 2, n_coords, z_index);
+  } else {
+    GeoArrowTransformStrided(transform, src, src_stride, dst, dst_stride, n_coords,
+                             z_index);
+  }
+
+  // Copy any ordinates that were not transformed
+  for (int j = 2; j < n_values; j++) {
+    if (j == z_index || src[j] == dst[j]) {
+      continue;
+    }
+
+    for (int64_t i = 0; i < n_coords; i++) {
+      dst[j][i * dst_stride] = src[j][i * src_stride];
+    }
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowArrayTransformInPlace(struct ArrowArray* array,
+                                                enum GeoArrowType type,
+                                                const struct GeoArrowTransform* transform,
+                                                struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+
+  enum GeoArrowCoordType coord_type = array_view.schema_view.coord_type;
+  if (array_view.schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX ||
+      GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_UNKNOWN ||
+      GeoArrowCoordTypeOrdinateSize(coord_type) != (int64_t)sizeof(double)) {
+    GeoArrowErrorSet(error, "Can't transform coordinates of type %d in place",
+                     (int)type);
+    return EINVAL;
+  }
+
+  // Validates the structure of the input
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, array, error));
+
+  // For POINT arrays the coordinates are the array itself, so only the slice is
+  // transformed. For other types the whole coordinate child is transformed
+  // (including any coordinates outside the range referenced by a sliced parent)
+  // because the caller owns all of it.
+  int64_t start = array_view.offset[array_view.n_offsets];
+  int64_t n_coords = array_view.length[array_view.n_offsets];
+  int64_t stride = array_view.coords.coords_stride;
+
+  double* values[4];
+  for (int j = 0; j < array_view.coords.n_values; j++) {
+    values[j] = (double*)array_view.coords.values[j] + start * stride;
+  }
+
+  int result =
+      GeoArrowTransformOrdinates(transform, (const double* const*)values, stride, values,
+                                 stride, n_coords, array_view.schema_view.dimensions);
+  if (result != GEOARROW_OK) {
+    GeoArrowErrorSet(error, "Can't apply transform of type %d", (int)transform->type);
+    return result;
+  }
+
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowTransformAppendCoords(
+    const struct GeoArrowTransform* transform,
+    const struct GeoArrowArrayView* array_view, struct GeoArrowBuilder* builder) {
+  enum GeoArrowCoordType coord_type = array_view->schema_view.coord_type;
+  if (GeoArrowCoordTypeOrdinateSize(coord_type) != (int64_t)sizeof(double) ||
+      builder->view.schema_view.coord_type != coord_type ||
+      builder->view.coords.n_values != array_view->coords.n_values) {
+    return EINVAL;
+  }
+
+  int64_t n_coords = array_view->coords.n_coords;
+  GEOARROW_RETURN_NOT_OK(GeoArrowBuilderCoordsReserve(builder, n_coords));
+
+  struct GeoArrowWritableCoordView* out = &builder->view.coords;
+  double* dst[4];
+  for (int j = 0; j < out->n_values; j++) {
+    dst[j] = out->values[j] + out->size_coords * out->coords_stride;
+  }
+
+  GEOARROW_RETURN_NOT_OK(GeoArrowTransformOrdinates(
+      transform, array_view->coords.values, array_view->coords.coords_stride, dst,
+      out->coords_stride, n_coords, array_view->schema_view.dimensions));
+  out->size_coords += n_coords;
+  return GEOARROW_OK;
+}
+
+// The filter forwards every callback to the next visitor, whose callbacks expect
+// their own private_data and an up-to-date error
+
+static int feat_start_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.feat_start(&filter->next);
+}
+
+static int null_feat_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.null_feat(&filter->next);
+}
+
+static int geom_start_transform(struct GeoArrowVisitor* v,
+                                enum GeoArrowGeometryType geometry_type,
+                                enum GeoArrowDimensions dimensions) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->dimensions = dimensions;
+  filter->next.error = v->error;
+  return filter->next.geom_start(&filter->next, geometry_type, dimensions);
+}
+
+static int ring_start_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.ring_start(&filter->next);
+}
+
+static int coords_transform(struct GeoArrowVisitor* v,
+                            const struct GeoArrowCoordView* coords) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+
+  // Trust the number of ordinates if it disagrees with the declared dimensions
+  enum GeoArrowDimensions dimensions = filter->dimensions;
+  switch (coords->n_values) {
+    case 2:
+      dimensions = GEOARROW_DIMENSIONS_XY;
+      break;
+    case 3:
+      if (dimensions != GEOARROW_DIMENSIONS_XYM) {
+        dimensions = GEOARROW_DIMENSIONS_XYZ;
+      }
+      break;
+    case 4:
+      dimensions = GEOARROW_DIMENSIONS_XYZM;
+      break;
+    default:
+      GeoArrowErrorSet(v->error, "Can't transform coordinates with %d values",
+                       (int)coords->n_values);
+      return EINVAL;
+  }
+
+  double values[4][64];
+  struct GeoArrowCoordView chunk;
+  chunk.n_values = coords->n_values;
+  chunk.coords_stride = 1;
+  const double* src[4];
+  double* dst[4];
+  for (int j = 0; j < coords->n_values; j++) {
+    dst[j] = values[j];
+    chunk.values[j] = values[j];
+  }
+
+  for (int64_t start = 0; start < coords->n_coords; start += 64) {
+    chunk.n_coords = coords->n_coords - start;
+    if (chunk.n_coords > 64) {
+      chunk.n_coords = 64;
+    }
+
+    for (int j = 0; j < coords->n_values; j++) {
+      src[j] = coords->values[j] + start * coords->coords_stride;
+    }
+
+    GEOARROW_RETURN_NOT_OK(GeoArrowTransformOrdinates(&filter->transform, src,
+                                                      coords->coords_stride, dst, 1,
+                                                      chunk.n_coords, dimensions));
+    GEOARROW_RETURN_NOT_OK(filter->next.coords(&filter->next, &chunk));
+  }
+
+  return GEOARROW_OK;
+}
+
+static int ring_end_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.ring_end(&filter->next);
+}
+
+static int geom_end_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.geom_end(&filter->next);
+}
+
+static int feat_end_transform(struct GeoArrowVisitor* v) {
+  struct GeoArrowTransformFilter* filter =
+      (struct GeoArrowTransformFilter*)v->private_data;
+  filter->next.error = v->error;
+  return filter->next.feat_end(&filter->next);
+}
+
+void GeoArrowTransformFilterInit(struct GeoArrowTransformFilter* filter,
+                                 const struct GeoArrowTransform* transform,
+                                 const struct GeoArrowVisitor* next) {
+  filter->transform = *transform;
+  filter->dimensions = GEOARROW_DIMENSIONS_UNKNOWN;
+  filter->next = *next;
+}
+
+void GeoArrowTransformFilterInitVisitor(struct GeoArrowTransformFilter* filter,
+                                        struct GeoArrowVisitor* v) {
+  GeoArrowVisitorInitVoid(v);
+  v->feat_start = &feat_start_transform;
+  v->null_feat = &null_feat_transform;
+  v->geom_start = &geom_start_transform;
+  v->ring_start = &ring_start_transform;
+  v->coords = &coords_transform;
+  v->ring_end = &ring_end_transform;
+  v->geom_end = &geom_end_transform;
+  v->feat_end = &feat_end_transform;
+  v->private_data = filter;
+}
@@ -0,0 +1,261 @@
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+TEST(TransformTest, TransformTestSetAffine) {
+  struct GeoArrowTransform transform;
+  GeoArrowTransformInit(&transform, GEOARROW_TRANSFORM_TO_WEB_MERCATOR);
+  EXPECT_EQ(transform.type, GEOARROW_TRANSFORM_TO_WEB_MERCATOR);
+  EXPECT_EQ(std::vector<double>(transform.matrix, transform.matrix + 12),
+            std::vector<double>({1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0}));
+
+  double values2d[] = {1, 2, 3, 4, 5, 6};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, values2d, 6), GEOARROW_OK);
+  EXPECT_EQ(transform.type, GEOARROW_TRANSFORM_AFFINE);
+  EXPECT_EQ(std::vector<double>(transform.matrix, transform.matrix + 12),
+            std::vector<double>({1, 2, 0, 3, 4, 0, 0, 0, 1, 5, 6, 0}));
+
+  double values3d[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, values3d, 12), GEOARROW_OK);
+  EXPECT_EQ(std::vector<double>(transform.matrix, transform.matrix + 12),
+            std::vector<double>(values3d, values3d + 12));
+
+  EXPECT_EQ(GeoArrowTransformSetAffine(&transform, values3d, 4), EINVAL);
+}
+
+TEST(TransformTest, TransformTestOrdinates) {
+  struct GeoArrowTransform transform;
+  double translate_scale[] = {2, 0, 0, 3, 10, 20};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, translate_scale, 6), GEOARROW_OK);
+
+  // Separated XYM: M is copied as-is
+  std::vector<double> xs = {0, 1, 2};
+  std::vector<double> ys = {10, 11, 12};
+  std::vector<double> ms = {30, 31, 32};
+  const double* src[] = {xs.data(), ys.data(), ms.data()};
+  std::vector<double> xs2(3), ys2(3), ms2(3);
+  double* dst[] = {xs2.data(), ys2.data(), ms2.data()};
+  ASSERT_EQ(GeoArrowTransformOrdinates(&transform, src, 1, dst, 1, 3,
+                                       GEOARROW_DIMENSIONS_XYM),
+            GEOARROW_OK);
+  EXPECT_EQ(xs2, std::vector<double>({10, 12, 14}));
+  EXPECT_EQ(ys2, std::vector<double>({50, 53, 56}));
+  EXPECT_EQ(ms2, ms);
+
+  // Interleaved XYZ in place: a 2D matrix leaves Z as-is
+  std::vector<double> interleaved = {0, 10, 20, 1, 11, 21};
+  double* values[] = {interleaved.data(), interleaved.data() + 1,
+                      interleaved.data() + 2};
+  ASSERT_EQ(GeoArrowTransformOrdinates(&transform, values, 3, values, 3, 2,
+                                       GEOARROW_DIMENSIONS_XYZ),
+            GEOARROW_OK);
+  EXPECT_EQ(interleaved, std::vector<double>({10, 50, 20, 12, 53, 21}));
+
+  // Interleaved XYZ with a 3D matrix that swaps X and Z
+  double swap_xz[] = {0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 100};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, swap_xz, 12), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowTransformOrdinates(&transform, values, 3, values, 3, 2,
+                                       GEOARROW_DIMENSIONS_XYZ),
+            GEOARROW_OK);
+  EXPECT_EQ(interleaved, std::vector<double>({20, 50, 110, 21, 53, 112}));
+
+  EXPECT_EQ(GeoArrowTransformOrdinates(&transform, src, 1, dst, 1, 3,
+                                       GEOARROW_DIMENSIONS_UNKNOWN),
+            EINVAL);
+  transform.type = static_cast<enum GeoArrowTransformType>(100);
+  EXPECT_EQ(GeoArrowTransformOrdinates(&transform, src, 1, dst, 1, 3,
+                                       GEOARROW_DIMENSIONS_XY),
+            EINVAL);
+}
+
+TEST(TransformTest, TransformTestWebMercator) {
+  struct GeoArrowTransform to_merc;
+  struct GeoArrowTransform from_merc;
+  GeoArrowTransformInit(&to_merc, GEOARROW_TRANSFORM_TO_WEB_MERCATOR);
+  GeoArrowTransformInit(&from_merc, GEOARROW_TRANSFORM_FROM_WEB_MERCATOR);
+
+  // Latitudes beyond the extent of Web Mercator are clamped
+  std::vector<double> lon = {0, 180, -180, -123.1207, 45};
+  std::vector<double> lat = {0, 85.0511287798066, -90, 49.2827, 0};
+  const double* src[] = {lon.data(), lat.data()};
+  std::vector<double> xs(5), ys(5);
+  double* dst[] = {xs.data(), ys.data()};
+  ASSERT_EQ(GeoArrowTransformOrdinates(&to_merc, src, 1, dst, 1, 5,
+                                       GEOARROW_DIMENSIONS_XY),
+            GEOARROW_OK);
+  EXPECT_DOUBLE_EQ(xs[0], 0);
+  EXPECT_DOUBLE_EQ(ys[0], 0);
+  EXPECT_NEAR(xs[1], 20037508.342789244, 1e-6);
+  EXPECT_NEAR(ys[1], 20037508.342789244, 1e-6);
+  EXPECT_NEAR(xs[2], -20037508.342789244, 1e-6);
+  EXPECT_NEAR(ys[2], -20037508.342789244, 1e-6);
+  EXPECT_NEAR(xs[3], -13705733.63, 1e-2);
+  EXPECT_NEAR(ys[3], 6322966.52, 1e-2);
+
+  // The inverse recovers the input except for the clamped latitude
+  std::vector<double> lon2(5), lat2(5);
+  double* roundtrip[] = {lon2.data(), lat2.data()};
+  ASSERT_EQ(GeoArrowTransformOrdinates(&from_merc, dst, 1, roundtrip, 1, 5,
+                                       GEOARROW_DIMENSIONS_XY),
+            GEOARROW_OK);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_NEAR(lon2[i], lon[i], 1e-9);
+    if (i != 2) {
+      EXPECT_NEAR(lat2[i], lat[i], 1e-9);
+    }
+  }
+
+  EXPECT_NEAR(lat2[2], -85.0511287798066, 1e-9);
+}
+
+TEST(TransformTest, TransformTestArrayInPlace) {
+  struct GeoArrowTransform transform;
+  double translate[] = {1, 0, 0, 1, 100, 200};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, translate, 6), GEOARROW_OK);
+
+  std::vector<std::string> wkts = {"POLYGON ((0 0, 1 0, 0 1, 0 0))", "",
+                                   "POLYGON ((10 10, 11 10, 10 11, 10 10))"};
+  std::vector<std::string> expected = {
+      "POLYGON ((100 200, 101 200, 100 201, 100 200))", "<null value>",
+      "POLYGON ((110 210, 111 210, 110 211, 110 210))"};
+
+  for (auto type : {GEOARROW_TYPE_POLYGON, GEOARROW_TYPE_INTERLEAVED_POLYGON}) {
+    SCOPED_TRACE(std::to_string(type));
+    struct ArrowArray array;
+    struct GeoArrowError error;
+    ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+    ASSERT_EQ(GeoArrowArrayTransformInPlace(&array, type, &transform, &error),
+              GEOARROW_OK)
+        << error.message;
+    EXPECT_EQ(FormatWKT(type, &array), expected);
+    array.release(&array);
+  }
+
+  // Points with Z and M and a sliced coordinate array
+  struct ArrowArray array;
+  struct GeoArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_POINT_ZM, {"POINT ZM (0 1 2 3)", "POINT ZM (4 5 6 7)"}, &array));
+  array.offset = 1;
+  array.length = 1;
+  ASSERT_EQ(
+      GeoArrowArrayTransformInPlace(&array, GEOARROW_TYPE_POINT_ZM, &transform, &error),
+      GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(GEOARROW_TYPE_POINT_ZM, &array),
+            std::vector<std::string>({"POINT ZM (104 205 6 7)"}));
+  array.offset = 0;
+  array.length = 2;
+  EXPECT_EQ(FormatWKT(GEOARROW_TYPE_POINT_ZM, &array),
+            std::vector<std::string>({"POINT ZM (0 1 2 3)", "POINT ZM (104 205 6 7)"}));
+  array.release(&array);
+}
+
+TEST(TransformTest, TransformTestArrayInPlaceErrors) {
+  struct GeoArrowTransform transform;
+  GeoArrowTransformInit(&transform, GEOARROW_TRANSFORM_AFFINE);
+
+  struct ArrowArray array;
+  struct GeoArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)"}, &array));
+
+  EXPECT_EQ(GeoArrowArrayTransformInPlace(&array, GEOARROW_TYPE_WKB, &transform, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't transform coordinates of type 100001 in place");
+  EXPECT_EQ(GeoArrowArrayTransformInPlace(&array, GEOARROW_TYPE_FLOAT_POINT, &transform,
+                                          &error),
+            EINVAL);
+
+  // Type that doesn't match the array
+  EXPECT_EQ(GeoArrowArrayTransformInPlace(&array, GEOARROW_TYPE_POINT_Z, &transform,
+                                          &error),
+            EINVAL);
+
+  transform.type = static_cast<enum GeoArrowTransformType>(100);
+  EXPECT_EQ(
+      GeoArrowArrayTransformInPlace(&array, GEOARROW_TYPE_POINT, &transform, &error),
+      EINVAL);
+  EXPECT_STREQ(error.message, "Can't apply transform of type 100");
+
+  array.release(&array);
+}
+
+TEST(TransformTest, TransformTestAppendCoords) {
+  struct GeoArrowTransform transform;
+  double translate[] = {1, 0, 0, 1, 100, 200};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, translate, 6), GEOARROW_OK);
+
+  struct ArrowArray array;
+  struct GeoArrowArrayView array_view;
+  struct GeoArrowBuilder builder;
+  struct GeoArrowError error;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(
+      GEOARROW_TYPE_POINT_ZM, {"POINT ZM (0 1 2 3)", "POINT ZM (4 5 6 7)"}, &array));
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_POINT_ZM),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, &error), GEOARROW_OK);
+
+  // Coordinates are appended after any that are already in the builder
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_POINT_ZM), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowTransformAppendCoords(&transform, &array_view, &builder),
+            GEOARROW_OK);
+  ASSERT_EQ(GeoArrowTransformAppendCoords(&transform, &array_view, &builder),
+            GEOARROW_OK);
+
+  struct ArrowArray out;
+  ASSERT_EQ(GeoArrowBuilderFinish(&builder, &out, &error), GEOARROW_OK);
+  EXPECT_EQ(FormatWKT(GEOARROW_TYPE_POINT_ZM, &out),
+            std::vector<std::string>({"POINT ZM (100 201 2 3)", "POINT ZM (104 205 6 7)",
+                                      "POINT ZM (100 201 2 3)",
+                                      "POINT ZM (104 205 6 7)"}));
+  out.release(&out);
+  GeoArrowBuilderReset(&builder);
+
+  // The builder must have the same coordinate type as the input
+  ASSERT_EQ(GeoArrowBuilderInitFromType(&builder, GEOARROW_TYPE_INTERLEAVED_POINT_ZM),
+            GEOARROW_OK);
+  EXPECT_EQ(GeoArrowTransformAppendCoords(&transform, &array_view, &builder), EINVAL);
+  GeoArrowBuilderReset(&builder);
+
+  array.release(&array);
+}
+
+TEST(TransformTest, TransformTestFilter) {
+  struct GeoArrowTransform transform;
+  double translate[] = {1, 0, 0, 1, 100, 200};
+  ASSERT_EQ(GeoArrowTransformSetAffine(&transform, translate, 6), GEOARROW_OK);
+
+  WKXTester tester;
+  struct GeoArrowTransformFilter filter;
+  struct GeoArrowVisitor v;
+  struct GeoArrowError error;
+  GeoArrowTransformFilterInit(&filter, &transform, tester.WKTVisitor());
+  GeoArrowTransformFilterInitVisitor(&filter, &v);
+  v.error = &error;
+
+  // More coordinates than fit in one chunk
+  std::string wkt = "LINESTRING (";
+  std::string expected = "LINESTRING (";
+  for (int i = 0; i < 100; i++) {
+    wkt += (i > 0 ? ", " : "") + std::to_string(i) + " 0";
+    expected += (i > 0 ? ", " : "") + std::to_string(i + 100) + " 200";
+  }
+  wkt += ")";
+  expected += ")";
+
+  tester.ReadWKT("POLYGON M ((0 0 1, 1 0 2, 0 1 3, 0 0 1))", &v);
+  tester.ReadNulls(1, &v);
+  tester.ReadWKT(wkt, &v);
+  EXPECT_EQ(tester.WKTValues("<null value>"),
+            std::vector<std::string>(
+                {"POLYGON M ((100 200 1, 101 200 2, 100 201 3, 100 200 1))",
+                 "<null value>", expected}));
+}
@@ -0,0 +1,545 @@
+
+#include <errno.h>
+#include <string.h>
+
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/geoarrow.h"
+
+// The transposition loops are moving 4- or 8-byte values without interpreting
+// them, so double, float, and int32 ordinates share the same loops. The number of
+// ordinates per coordinate is passed as a constant from a switch such that the
+// compiler can unroll the inner loop and emit shuffles for the interleaved side
+// (e.g., using SSE/AVX or NEON) when vectorization is enabled.
+
+static inline void GeoArrowTransposeInterleave32(const uint32_t* const* src,
+                                                 uint32_t* dst, int64_t n,
+                                                 int n_values) {
+  const uint32_t* src_values[4];
+  for (int j = 0; j < n_values; j++) {
+    src_values[j] = src[j];
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst[i * n_values + j] = src_values[j][i];
+    }
+  }
+}
+
+static inline void GeoArrowTransposeInterleave64(const uint64_t* const* src,
+                                                 uint64_t* dst, int64_t n,
+                                                 int n_values) {
+  const uint64_t* src_values[4];
+  for (int j = 0; j < n_values; j++) {
+    src_values[j] = src[j];
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst[i * n_values + j] = src_values[j][i];
+    }
+  }
+}
+
+static inline void GeoArrowTransposeDeinterleave32(const uint32_t* src,
+                                                   uint32_t* const* dst, int64_t n,
+                                                   int n_values) {
+  uint32_t* dst_values[4];
+  for (int j = 0; j < n_values; j++) {
+    dst_values[j] = dst[j];
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst_values[j][i] = src[i * n_values + j];
+    }
+  }
+}
+
+static inline void GeoArrowTransposeDeinterleave64(const uint64_t* src,
+                                                   uint64_t* const* dst, int64_t n,
+                                                   int n_values) {
+  uint64_t* dst_values[4];
+  for (int j = 0; j < n_values; j++) {
+    dst_values[j] = dst[j];
+  }
+
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst_values[j][i] = src[i * n_values + j];
+    }
+  }
+}
+
+GeoArrowErrorCode GeoArrowInterleaveOrdinates(const void* const* src, void* dst,
+                                              int64_t n_coords, int n_values,
+                                              int64_t ordinate_size) {
+  if (n_values < 1 || n_values > 4) {
+    return EINVAL;
+  }
+
+  switch (ordinate_size) {
+    case 4:
+      switch (n_values) {
+        case 2:
+          GeoArrowTransposeInterleave32((const uint32_t* const*)src, (uint32_t*)dst,
+                                        n_coords, 2);
+          return GEOARROW_OK;
+        case 3:
+          GeoArrowTransposeInterleave32((const uint32_t* const*)src, (uint32_t*)dst,
+                                        n_coords, 3);
+          return GEOARROW_OK;
+        case 4:
+          GeoArrowTransposeInterleave32((const uint32_t* const*)src, (uint32_t*)dst,
+                                        n_coords, 4);
+          return GEOARROW_OK;
+        default:
+          GeoArrowTransposeInterleave32((const uint32_t* const*)src, (uint32_t*)dst,
+                                        n_coords, n_values);
+          return GEOARROW_OK;
+      }
+    case 8:
+      switch (n_values) {
+        case 2:
+          GeoArrowTransposeInterleave64((const uint64_t* const*)src, (uint64_t*)dst,
+                                        n_coords, 2);
+          return GEOARROW_OK;
+        case 3:
+          GeoArrowTransposeInterleave64((const uint64_t* const*)src, (uint64_t*)dst,
+                                        n_coords, 3);
+          return GEOARROW_OK;
+        case 4:
+          GeoArrowTransposeInterleave64((const uint64_t* const*)src, (uint64_t*)dst,
+                                        n_coords, 4);
+          return GEOARROW_OK;
+        default:
+          GeoArrowTransposeInterleave64((const uint64_t* const*)src, (uint64_t*)dst,
+                                        n_coords, n_values);
+          return GEOARROW_OK;
+      }
+    default:
+      return EINVAL;
+  }
+}
+
+GeoArrowErrorCode GeoArrowDeinterleaveOrdinates(const void* src, void* const* dst,
+                                                int64_t n_coords, int n_values,
+                                                int64_t ordinate_size) {
+  if (n_values < 1 || n_values > 4) {
+    return EINVAL;
+  }
+
+  switch (ordinate_size) {
+    case 4:
+      switch (n_values) {
+        case 2:
+          GeoArrowTransposeDeinterleave32((const uint32_t*)src, (uint32_t* const*)dst,
+                                          n_coords, 2);
+          return GEOARROW_OK;
+        case 3:
+          GeoArrowTransposeDeinterleave32((const uint32_t*)src, (uint32_t* const*)dst,
+                                          n_coords, 3);
+          return GEOARROW_OK;
+        case 4:
+          GeoArrowTransposeDeinterleave32((const uint32_t*)src, (uint32_t* const*)dst,
+                                          n_coords, 4);
+          return GEOARROW_OK;
+        default:
+          GeoArrowTransposeDeinterleave32((const uint32_t*)src, (uint32_t* const*)dst,
+                                          n_coords, n_values);
+          return GEOARROW_OK;
+      }
+    case 8:
+      switch (n_values) {
+        case 2:
+          GeoArrowTransposeDeinterleave64((const uint64_t*)src, (uint64_t* const*)dst,
+                                          n_coords, 2);
+          return GEOARROW_OK;
+        case 3:
+          GeoArrowTransposeDeinterleave64((const uint64_t*)src, (uint64_t* const*)dst,
+                                          n_coords, 3);
+          return GEOARROW_OK;
+        case 4:
+          GeoArrowTransposeDeinterleave64((const uint64_t*)src, (uint64_t* const*)dst,
+                                          n_coords, 4);
+          return GEOARROW_OK;
+        default:
+          GeoArrowTransposeDeinterleave64((const uint64_t*)src, (uint64_t* const*)dst,
+                                          n_coords, n_values);
+          return GEOARROW_OK;
+      }
+    default:
+      return EINVAL;
+  }
+}
+
+static enum GeoArrowCoordType GeoArrowTransposeCoordType(
+    enum GeoArrowCoordType coord_type) {
+  switch (coord_type) {
+    case GEOARROW_COORD_TYPE_SEPARATE:
+      return GEOARROW_COORD_TYPE_INTERLEAVED;
+    case GEOARROW_COORD_TYPE_INTERLEAVED:
+      return GEOARROW_COORD_TYPE_SEPARATE;
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+      return GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+      return GEOARROW_COORD_TYPE_SEPARATE_FLOAT;
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+      return GEOARROW_COORD_TYPE_INTERLEAVED_INT32;
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return GEOARROW_COORD_TYPE_SEPARATE_INT32;
+    default:
+      return GEOARROW_COORD_TYPE_UNKNOWN;
+  }
+}
+
+// Copy the validity bitmap of a (possibly sliced) array to buffer 0 of builder
+static GeoArrowErrorCode GeoArrowTransposeAppendValidity(struct GeoArrowBuilder* builder,
+                                                         const struct ArrowArray* array) {
+  struct GeoArrowBufferView buffer;
+  const uint8_t* validity = (const uint8_t*)array->buffers[0];
+
+  if ((array->offset % 8) == 0) {
+    buffer.data = validity + array->offset / 8;
+    buffer.size_bytes = _ArrowBytesForBits(array->length);
+    return GeoArrowBuilderAppendBuffer(builder, 0, buffer);
+  }
+
+  struct ArrowBitmap bitmap;
+  ArrowBitmapInit(&bitmap);
+  GEOARROW_RETURN_NOT_OK(ArrowBitmapReserve(&bitmap, array->length));
+  for (int64_t i = 0; i < array->length; i++) {
+    ArrowBitmapAppendUnsafe(&bitmap, ArrowBitGet(validity, array->offset + i), 1);
+  }
+
+  buffer.data = bitmap.buffer.data;
+  buffer.size_bytes = bitmap.buffer.size_bytes;
+  int result = GeoArrowBuilderAppendBuffer(builder, 0, buffer);
+  ArrowBitmapReset(&bitmap);
+  return result;
+}
+
+// Builds a point array with the transposed coordinates of the coordinate array
+// coords (i.e., the innermost child of a native array), including the validity
+// bitmap if requested
+static GeoArrowErrorCode GeoArrowTransposeCoordArray(const struct ArrowArray* coords,
+                                                     enum GeoArrowCoordType coord_type,
+                                                     enum GeoArrowDimensions dimensions,
+                                                     int include_validity,
+                                                     struct ArrowArray* out,
+                                                     struct GeoArrowError* error) {
+  enum GeoArrowType out_type = GeoArrowMakeType(
+      GEOARROW_GEOMETRY_TYPE_POINT, dimensions, GeoArrowTransposeCoordType(coord_type));
+  int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(coord_type);
+  int64_t n_coords = coords->length;
+
+  struct GeoArrowBuilder builder;
+  GEOARROW_RETURN_NOT_OK(GeoArrowBuilderInitFromType(&builder, out_type));
+  int n_values = builder.view.coords.n_values;
+
+  int result = GEOARROW_OK;
+  if (include_validity && coords->null_count != 0 && coords->buffers[0] != NULL) {
+    result = GeoArrowTransposeAppendValidity(&builder, coords);
+  }
+
+  // Resolve pointers to the first ordinate of the (sliced) input and reserve the
+  // output coordinate buffers
+  const uint8_t* src[4];
+  uint8_t* dst[4];
+  if (GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_SEPARATE) {
+    for (int j = 0; j < n_values; j++) {
+      const struct ArrowArray* child = coords->children[j];
+      src[j] = (const uint8_t*)child->buffers[1] +
+               (child->offset + coords->offset) * ordinate_size;
+    }
+
+    if (result == GEOARROW_OK) {
+      result = GeoArrowBuilderReserveBuffer(&builder, 1,
+                                            n_coords * n_values * ordinate_size);
+    }
+
+    if (result == GEOARROW_OK) {
+      builder.view.buffers[1].size_bytes = n_coords * n_values * ordinate_size;
+      result = GeoArrowInterleaveOrdinates((const void* const*)src,
+                                           builder.view.buffers[1].data.data, n_coords,
+                                           n_values, ordinate_size);
+    }
+  } else {
+    const struct ArrowArray* child = coords->children[0];
+    src[0] = (const uint8_t*)child->buffers[1] +
+             (child->offset + coords->offset * n_values) * ordinate_size;
+
+    for (int j = 0; j < n_values && result == GEOARROW_OK; j++) {
+      result = GeoArrowBuilderReserveBuffer(&builder, 1 + j, n_coords * ordinate_size);
+      builder.view.buffers[1 + j].size_bytes = n_coords * ordinate_size;
+      dst[j] = builder.view.buffers[1 + j].data.as_uint8;
+    }
+
+    if (result == GEOARROW_OK) {
+      result = GeoArrowDeinterleaveOrdinates(src[0], (void* const*)dst, n_coords,
+                                             n_values, ordinate_size);
+    }
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowBuilderFinish(&builder, out, error);
+  }
+
+  GeoArrowBuilderReset(&builder);
+  return result;
+}
+
+GeoArrowErrorCode GeoArrowArrayTransposeCoords(struct ArrowArray* array,
+                                               enum GeoArrowType type,
+                                               struct ArrowArray* out,
+                                               struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+
+  enum GeoArrowCoordType coord_type = array_view.schema_view.coord_type;
+  if (array_view.schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX ||
+      GeoArrowTransposeCoordType(coord_type) == GEOARROW_COORD_TYPE_UNKNOWN) {
+    GeoArrowErrorSet(error, "Can't transpose coordinates of non-native type %d",
+                     (int)type);
+    return EINVAL;
+  }
+
+  // Validates the structure of the input
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, array, error));
+
+  struct ArrowArray* coords = array;
+  for (int i = 0; i < array_view.n_offsets; i++) {
+    coords = coords->children[0];
+  }
+
+  struct ArrowArray transposed;
+  GEOARROW_RETURN_NOT_OK(GeoArrowTransposeCoordArray(
+      coords, coord_type, array_view.schema_view.dimensions, array_view.n_offsets == 0,
+      &transposed, error));
+
+  if (array_view.n_offsets == 0) {
+    // For points the coordinate array is the whole array
+    transposed.null_count = array->null_count;
+    array->release(array);
+    ArrowArrayMove(&transposed, out);
+  } else {
+    // Otherwise, the validity and offset buffers are kept as-is and only the
+    // innermost child is replaced. Parents only release children that have not
+    // already been released, so the replacement is released independently.
+    coords->release(coords);
+    ArrowArrayMove(&transposed, coords);
+    ArrowArrayMove(array, out);
+  }
+
+  return GEOARROW_OK;
+}
+
+// Populates map with the index of each output ordinate in the input ordinates,
+// returning the number of output ordinates or 0 if dimensions can't be obtained
+// by dropping ordinates from in_dimensions
+static int GeoArrowProjectDimensionMap(enum GeoArrowDimensions in_dimensions,
+                                       enum GeoArrowDimensions dimensions, int* map) {
+  int n_values;
+  switch (dimensions) {
+    case GEOARROW_DIMENSIONS_XY:
+      n_values = 2;
+      break;
+    case GEOARROW_DIMENSIONS_XYZ:
+    case GEOARROW_DIMENSIONS_XYM:
+      n_values = 3;
+      break;
+    case GEOARROW_DIMENSIONS_XYZM:
+      n_values = 4;
+      break;
+    default:
+      return 0;
+  }
+
+  if (in_dimensions == GEOARROW_DIMENSIONS_UNKNOWN) {
+    return 0;
+  }
+
+  GeoArrowMapDimensions(in_dimensions, dimensions, map);
+  for (int j = 0; j < n_values; j++) {
+    if (map[j] < 0) {
+      return 0;
+    }
+  }
+
+  return n_values;
+}
+
+static inline void GeoArrowProjectInterleaved32(const uint32_t* src, int n_src_values,
+                                                uint32_t* dst, int n_values,
+                                                const int* map, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst[i * n_values + j] = src[i * n_src_values + map[j]];
+    }
+  }
+}
+
+static inline void GeoArrowProjectInterleaved64(const uint64_t* src, int n_src_values,
+                                                uint64_t* dst, int n_values,
+                                                const int* map, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    for (int j = 0; j < n_values; j++) {
+      dst[i * n_values + j] = src[i * n_src_values + map[j]];
+    }
+  }
+}
+
+// Builds an interleaved point array with the selected ordinates of the interleaved
+// coordinate array coords (i.e., the innermost child of a native array), including
+// the validity bitmap if requested
+static GeoArrowErrorCode GeoArrowProjectInterleavedCoordArray(
+    const struct ArrowArray* coords, enum GeoArrowCoordType coord_type,
+    enum GeoArrowDimensions dimensions, int n_src_values, const int* map,
+    int include_validity, struct ArrowArray* out, struct GeoArrowError* error) {
+  enum GeoArrowType out_type =
+      GeoArrowMakeType(GEOARROW_GEOMETRY_TYPE_POINT, dimensions, coord_type);
+  int64_t ordinate_size = GeoArrowCoordTypeOrdinateSize(coord_type);
+  int64_t n_coords = coords->length;
+
+  struct GeoArrowBuilder builder;
+  GEOARROW_RETURN_NOT_OK(GeoArrowBuilderInitFromType(&builder, out_type));
+  int n_values = builder.view.coords.n_values;
+
+  int result = GEOARROW_OK;
+  if (include_validity && coords->null_count != 0 && coords->buffers[0] != NULL) {
+    result = GeoArrowTransposeAppendValidity(&builder, coords);
+  }
+
+  if (result == GEOARROW_OK) {
+    result = GeoArrowBuilderReserveBuffer(&builder, 1,
+                                          n_coords * n_values * ordinate_size);
+  }
+
+  if (result == GEOARROW_OK) {
+    builder.view.buffers[1].size_bytes = n_coords * n_values * ordinate_size;
+    const struct ArrowArray* child = coords->children[0];
+    const uint8_t* src = (const uint8_t*)child->buffers[1] +
+                         (child->offset + coords->offset * n_src_values) * ordinate_size;
+    if (ordinate_size == 4) {
+      GeoArrowProjectInterleaved32((const uint32_t*)src, n_src_values,
+                                   (uint32_t*)builder.view.buffers[1].data.data,
+                                   n_values, map, n_coords);
+    } else {
+      GeoArrowProjectInterleaved64((const uint64_t*)src, n_src_values,
+                                   (uint64_t*)builder.view.buffers[1].data.data,
+                                   n_values, map, n_coords);
+    }
+
+    result = GeoArrowBuilderFinish(&builder, out, error);
+  }
+
+  GeoArrowBuilderReset(&builder);
+  return result;
+}
+
+// A struct coordinate array whose children are borrowed from another struct
+// coordinate array that it keeps alive until released. This lets separated
+// coordinates drop Z and/or M without copying any buffers.
+struct GeoArrowProjectPrivate {
+  struct ArrowArray parent;
+  struct ArrowArray* children[4];
+};
+
+static void GeoArrowProjectRelease(struct ArrowArray* array) {
+  struct GeoArrowProjectPrivate* private_data =
+      (struct GeoArrowProjectPrivate*)array->private_data;
+  if (private_data->parent.release != NULL) {
+    private_data->parent.release(&private_data->parent);
+  }
+
+  ArrowFree(private_data);
+  array->release = NULL;
+}
+
+// Replaces the struct coordinate array coords with one that only contains the
+// children listed in map
+static GeoArrowErrorCode GeoArrowProjectSeparatedCoordArray(struct ArrowArray* coords,
+                                                            int n_values,
+                                                            const int* map) {
+  struct GeoArrowProjectPrivate* private_data =
+      (struct GeoArrowProjectPrivate*)ArrowMalloc(sizeof(struct GeoArrowProjectPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  ArrowArrayMove(coords, &private_data->parent);
+  for (int j = 0; j < n_values; j++) {
+    private_data->children[j] = private_data->parent.children[map[j]];
+  }
+
+  coords->length = private_data->parent.length;
+  coords->null_count = private_data->parent.null_count;
+  coords->offset = private_data->parent.offset;
+  coords->n_buffers = private_data->parent.n_buffers;
+  coords->n_children = n_values;
+  coords->buffers = private_data->parent.buffers;
+  coords->children = private_data->children;
+  coords->dictionary = NULL;
+  coords->release = &GeoArrowProjectRelease;
+  coords->private_data = private_data;
+  return GEOARROW_OK;
+}
+
+GeoArrowErrorCode GeoArrowArrayProjectDimensions(struct ArrowArray* array,
+                                                 enum GeoArrowType type,
+                                                 enum GeoArrowDimensions dimensions,
+                                                 struct ArrowArray* out,
+                                                 struct GeoArrowError* error) {
+  struct GeoArrowArrayView array_view;
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewInitFromType(&array_view, type));
+
+  enum GeoArrowCoordType coord_type = array_view.schema_view.coord_type;
+  if (array_view.schema_view.geometry_type == GEOARROW_GEOMETRY_TYPE_BOX ||
+      GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_UNKNOWN) {
+    GeoArrowErrorSet(error, "Can't project dimensions of non-native type %d",
+                     (int)type);
+    return EINVAL;
+  }
+
+  int map[4];
+  int n_values =
+      GeoArrowProjectDimensionMap(array_view.schema_view.dimensions, dimensions, map);
+  if (n_values == 0) {
+    GeoArrowErrorSet(error, "Can't project dimensions %d to dimensions %d",
+                     (int)array_view.schema_view.dimensions, (int)dimensions);
+    return EINVAL;
+  }
+
+  // Validates the structure of the input
+  GEOARROW_RETURN_NOT_OK(GeoArrowArrayViewSetArray(&array_view, array, error));
+
+  struct ArrowArray* coords = array;
+  for (int i = 0; i < array_view.n_offsets; i++) {
+    coords = coords->children[0];
+  }
+
+  if (GeoArrowCoordTypeLayout(coord_type) == GEOARROW_COORD_TYPE_SEPARATE) {
+    // For points, coords is array and any validity buffer is kept by the parent
+    GEOARROW_RETURN_NOT_OK(GeoArrowProjectSeparatedCoordArray(coords, n_values, map));
+    ArrowArrayMove(array, out);
+    return GEOARROW_OK;
+  }
+
+  struct ArrowArray projected;
+  GEOARROW_RETURN_NOT_OK(GeoArrowProjectInterleavedCoordArray(
+      coords, coord_type, dimensions, array_view.coords.n_values, map,
+      array_view.n_offsets == 0, &projected, error));
+
+  if (array_view.n_offsets == 0) {
+    projected.null_count = array->null_count;
+    array->release(array);
+    ArrowArrayMove(&projected, out);
+  } else {
+    coords->release(coords);
+    ArrowArrayMove(&projected, coords);
+    ArrowArrayMove(array, out);
+  }
+
+  return GEOARROW_OK;
+}
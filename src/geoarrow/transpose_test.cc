@@ -0,0 +1,371 @@
+#include <errno.h>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "geoarrow/geoarrow.h"
+#include "nanoarrow/nanoarrow.h"
+
+#include "geoarrow/wkx_testing.hpp"
+
+// Coordinate i as WKT, where ordinate j is 10 * i + j for X, Y, Z, and M (e.g.,
+// "10 11 13" for the second XYM coordinate)
+static std::string Coord(int i, enum GeoArrowDimensions dimensions) {
+  std::string out = std::to_string(i * 10) + " " + std::to_string(i * 10 + 1);
+  if (dimensions == GEOARROW_DIMENSIONS_XYZ || dimensions == GEOARROW_DIMENSIONS_XYZM) {
+    out += " " + std::to_string(i * 10 + 2);
+  }
+
+  if (dimensions == GEOARROW_DIMENSIONS_XYM || dimensions == GEOARROW_DIMENSIONS_XYZM) {
+    out += " " + std::to_string(i * 10 + 3);
+  }
+
+  return out;
+}
+
+static std::vector<std::string> TestWKT(enum GeoArrowGeometryType geometry_type,
+                                        enum GeoArrowDimensions dimensions) {
+  std::string dims;
+  switch (dimensions) {
+    case GEOARROW_DIMENSIONS_XYZ:
+      dims = " Z";
+      break;
+    case GEOARROW_DIMENSIONS_XYM:
+      dims = " M";
+      break;
+    case GEOARROW_DIMENSIONS_XYZM:
+      dims = " ZM";
+      break;
+    default:
+      break;
+  }
+
+  std::string ls0 = "(" + Coord(0, dimensions) + ", " + Coord(1, dimensions) + ")";
+  std::string ls1 = "(" + Coord(2, dimensions) + ", " + Coord(3, dimensions) + ", " +
+                    Coord(4, dimensions) + ")";
+  std::string ring = "(" + Coord(0, dimensions) + ", " + Coord(1, dimensions) + ", " +
+                     Coord(2, dimensions) + ", " + Coord(0, dimensions) + ")";
+
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      return {"POINT" + dims + " (" + Coord(1, dimensions) + ")",
+              "",
+              "POINT" + dims + " (" + Coord(2, dimensions) + ")",
+              "POINT" + dims + " (" + Coord(3, dimensions) + ")",
+              "",
+              "POINT" + dims + " (" + Coord(4, dimensions) + ")",
+              "POINT" + dims + " (" + Coord(5, dimensions) + ")",
+              "POINT" + dims + " (" + Coord(6, dimensions) + ")",
+              "POINT" + dims + " (" + Coord(7, dimensions) + ")",
+              "POINT" + dims + " (" + Coord(8, dimensions) + ")"};
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      return {"LINESTRING" + dims + " " + ls0, "", "LINESTRING" + dims + " " + ls1,
+              "LINESTRING" + dims + " EMPTY"};
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      return {"POLYGON" + dims + " (" + ring + ")", "",
+              "POLYGON" + dims + " (" + ring + ", " + ring + ")"};
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return {"MULTIPOINT" + dims + " ((" + Coord(0, dimensions) + "), (" +
+                  Coord(1, dimensions) + "))",
+              "",
+              "MULTIPOINT" + dims + " ((" + Coord(2, dimensions) + "), (" +
+                  Coord(3, dimensions) + "), (" + Coord(4, dimensions) + "))"};
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return {"MULTILINESTRING" + dims + " (" + ls0 + ")", "",
+              "MULTILINESTRING" + dims + " (" + ls0 + ", " + ls1 + ")"};
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      return {"MULTIPOLYGON" + dims + " ((" + ring + "))", "",
+              "MULTIPOLYGON" + dims + " ((" + ring + "), (" + ring + ", " + ring + "))"};
+    default:
+      return {};
+  }
+}
+
+// TestWKT() as formatted by FormatWKT()
+static std::vector<std::string> ExpectedWKT(enum GeoArrowGeometryType geometry_type,
+                                            enum GeoArrowDimensions dimensions) {
+  std::vector<std::string> out = TestWKT(geometry_type, dimensions);
+  for (auto& wkt : out) {
+    if (wkt.empty()) {
+      wkt = "<null value>";
+    }
+  }
+
+  return out;
+}
+
+static enum GeoArrowCoordType OtherLayout(enum GeoArrowCoordType coord_type) {
+  switch (coord_type) {
+    case GEOARROW_COORD_TYPE_SEPARATE:
+      return GEOARROW_COORD_TYPE_INTERLEAVED;
+    case GEOARROW_COORD_TYPE_INTERLEAVED:
+      return GEOARROW_COORD_TYPE_SEPARATE;
+    case GEOARROW_COORD_TYPE_SEPARATE_FLOAT:
+      return GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT;
+    case GEOARROW_COORD_TYPE_INTERLEAVED_FLOAT:
+      return GEOARROW_COORD_TYPE_SEPARATE_FLOAT;
+    case GEOARROW_COORD_TYPE_SEPARATE_INT32:
+      return GEOARROW_COORD_TYPE_INTERLEAVED_INT32;
+    case GEOARROW_COORD_TYPE_INTERLEAVED_INT32:
+      return GEOARROW_COORD_TYPE_SEPARATE_INT32;
+    default:
+      return GEOARROW_COORD_TYPE_UNKNOWN;
+  }
+}
+
+class TransposeTypeParameterizedTestFixture
+    : public ::testing::TestWithParam<enum GeoArrowType> {};
+
+TEST_P(TransposeTypeParameterizedTestFixture, TransposeTestRoundtrip) {
+  enum GeoArrowType type = GetParam();
+  struct GeoArrowSchemaView schema_view;
+  ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+  enum GeoArrowType other_type =
+      GeoArrowMakeType(schema_view.geometry_type, schema_view.dimensions,
+                       OtherLayout(schema_view.coord_type));
+  ASSERT_NE(other_type, GEOARROW_TYPE_UNINITIALIZED);
+
+  std::vector<std::string> wkts =
+      TestWKT(schema_view.geometry_type, schema_view.dimensions);
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+  std::vector<std::string> expected = FormatWKT(type, &array);
+  ASSERT_EQ(expected.size(), wkts.size());
+
+  // Keep track of the offset buffers to check that they were not copied
+  std::vector<const void*> buffers;
+  struct ArrowArray* level = &array;
+  while (level->n_children == 1 && level->children[0]->n_children > 0) {
+    buffers.push_back(level->buffers[0]);
+    buffers.push_back(level->buffers[1]);
+    level = level->children[0];
+  }
+
+  struct ArrowArray transposed;
+  struct GeoArrowError error;
+  ASSERT_EQ(GeoArrowArrayTransposeCoords(&array, type, &transposed, &error), GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(array.release, nullptr);
+  EXPECT_EQ(FormatWKT(other_type, &transposed), expected);
+
+  level = &transposed;
+  for (size_t i = 0; i < buffers.size(); i += 2) {
+    EXPECT_EQ(level->buffers[0], buffers[i]);
+    EXPECT_EQ(level->buffers[1], buffers[i + 1]);
+    level = level->children[0];
+  }
+
+  // ...and back again
+  struct ArrowArray roundtripped;
+  ASSERT_EQ(GeoArrowArrayTransposeCoords(&transposed, other_type, &roundtripped, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(type, &roundtripped), expected);
+
+  // Check a slice that does not start on a byte boundary
+  roundtripped.offset = 1;
+  roundtripped.length -= 1;
+  roundtripped.null_count = -1;
+  std::vector<std::string> expected_sliced(expected.begin() + 1, expected.end());
+  ASSERT_EQ(FormatWKT(type, &roundtripped), expected_sliced);
+
+  ASSERT_EQ(GeoArrowArrayTransposeCoords(&roundtripped, type, &transposed, &error),
+            GEOARROW_OK)
+      << error.message;
+  EXPECT_EQ(FormatWKT(other_type, &transposed), expected_sliced);
+  transposed.release(&transposed);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    TransposeTest, TransposeTypeParameterizedTestFixture,
+    ::testing::Values(
+        GEOARROW_TYPE_POINT, GEOARROW_TYPE_LINESTRING, GEOARROW_TYPE_POLYGON,
+        GEOARROW_TYPE_MULTIPOINT, GEOARROW_TYPE_MULTILINESTRING,
+        GEOARROW_TYPE_MULTIPOLYGON, GEOARROW_TYPE_INTERLEAVED_POINT,
+        GEOARROW_TYPE_INTERLEAVED_MULTIPOLYGON, GEOARROW_TYPE_POINT_Z,
+        GEOARROW_TYPE_INTERLEAVED_POINT_M, GEOARROW_TYPE_LINESTRING_ZM,
+        GEOARROW_TYPE_INTERLEAVED_POLYGON_ZM, GEOARROW_TYPE_FLOAT_POINT,
+        GEOARROW_TYPE_INTERLEAVED_FLOAT_LINESTRING_Z, GEOARROW_TYPE_INT32_POLYGON,
+        GEOARROW_TYPE_INTERLEAVED_INT32_POINT_ZM));
+
+TEST(TransposeTest, TransposeTestOrdinates) {
+  std::vector<double> xs = {0, 1, 2};
+  std::vector<double> ys = {10, 11, 12};
+  std::vector<double> zs = {20, 21, 22};
+  std::vector<double> ms = {30, 31, 32};
+  const void* src[] = {xs.data(), ys.data(), zs.data(), ms.data()};
+
+  std::vector<double> interleaved(12);
+  ASSERT_EQ(GeoArrowInterleaveOrdinates(src, interleaved.data(), 3, 4, sizeof(double)),
+            GEOARROW_OK);
+  EXPECT_EQ(interleaved,
+            std::vector<double>({0, 10, 20, 30, 1, 11, 21, 31, 2, 12, 22, 32}));
+
+  std::vector<double> xs2(3), ys2(3), zs2(3), ms2(3);
+  void* dst[] = {xs2.data(), ys2.data(), zs2.data(), ms2.data()};
+  ASSERT_EQ(GeoArrowDeinterleaveOrdinates(interleaved.data(), dst, 3, 4, sizeof(double)),
+            GEOARROW_OK);
+  EXPECT_EQ(xs2, xs);
+  EXPECT_EQ(ys2, ys);
+  EXPECT_EQ(zs2, zs);
+  EXPECT_EQ(ms2, ms);
+
+  std::vector<float> xs_float = {0, 1, 2};
+  std::vector<float> ys_float = {10, 11, 12};
+  std::vector<float> zs_float = {20, 21, 22};
+  const void* src_float[] = {xs_float.data(), ys_float.data(), zs_float.data()};
+  std::vector<float> interleaved_float(9);
+  ASSERT_EQ(GeoArrowInterleaveOrdinates(src_float, interleaved_float.data(), 3, 3,
+                                        sizeof(float)),
+            GEOARROW_OK);
+  EXPECT_EQ(interleaved_float, std::vector<float>({0, 10, 20, 1, 11, 21, 2, 12, 22}));
+
+  EXPECT_EQ(GeoArrowInterleaveOrdinates(src, interleaved.data(), 3, 5, sizeof(double)),
+            EINVAL);
+  EXPECT_EQ(GeoArrowInterleaveOrdinates(src, interleaved.data(), 3, 2, 2), EINVAL);
+  EXPECT_EQ(GeoArrowDeinterleaveOrdinates(interleaved.data(), dst, 3, 0, sizeof(double)),
+            EINVAL);
+}
+
+TEST(TransposeTest, TransposeTestErrors) {
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(GEOARROW_TYPE_POINT, {"POINT (0 1)"}, &array));
+
+  // Type that isn't a native type
+  EXPECT_EQ(GeoArrowArrayTransposeCoords(&array, GEOARROW_TYPE_BOX, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't transpose coordinates of non-native type 990");
+  EXPECT_EQ(GeoArrowArrayTransposeCoords(&array, GEOARROW_TYPE_WKB, &out, &error),
+            EINVAL);
+
+  // Type that doesn't match the array
+  EXPECT_EQ(
+      GeoArrowArrayTransposeCoords(&array, GEOARROW_TYPE_POINT_Z, &out, &error),
+      EINVAL);
+
+  // The input should not have been released
+  ASSERT_NE(array.release, nullptr);
+  array.release(&array);
+}
+
+TEST(TransposeTest, TransposeTestProjectDimensions) {
+  std::vector<enum GeoArrowType> types = {GEOARROW_TYPE_POINT_ZM,
+                                          GEOARROW_TYPE_INTERLEAVED_POINT_ZM,
+                                          GEOARROW_TYPE_LINESTRING_Z,
+                                          GEOARROW_TYPE_INTERLEAVED_POLYGON_M,
+                                          GEOARROW_TYPE_MULTIPOLYGON_ZM,
+                                          GEOARROW_TYPE_FLOAT_LINESTRING_ZM,
+                                          GEOARROW_TYPE_INTERLEAVED_FLOAT_MULTIPOINT_Z,
+                                          GEOARROW_TYPE_INT32_POINT_ZM};
+  std::vector<enum GeoArrowDimensions> all_dimensions = {
+      GEOARROW_DIMENSIONS_XY, GEOARROW_DIMENSIONS_XYZ, GEOARROW_DIMENSIONS_XYM,
+      GEOARROW_DIMENSIONS_XYZM};
+
+  for (enum GeoArrowType type : types) {
+    struct GeoArrowSchemaView schema_view;
+    ASSERT_EQ(GeoArrowSchemaViewInitFromType(&schema_view, type), GEOARROW_OK);
+    std::vector<std::string> wkts =
+        TestWKT(schema_view.geometry_type, schema_view.dimensions);
+
+    for (enum GeoArrowDimensions dimensions : all_dimensions) {
+      SCOPED_TRACE(std::to_string(type) + " to dimensions " + std::to_string(dimensions));
+      int is_subset = dimensions == GEOARROW_DIMENSIONS_XY ||
+                      dimensions == schema_view.dimensions ||
+                      schema_view.dimensions == GEOARROW_DIMENSIONS_XYZM;
+      enum GeoArrowType out_type = GeoArrowMakeType(schema_view.geometry_type,
+                                                    dimensions, schema_view.coord_type);
+
+      struct ArrowArray array;
+      struct ArrowArray projected;
+      struct GeoArrowError error;
+      ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkts, &array));
+
+      if (!is_subset) {
+        EXPECT_EQ(
+            GeoArrowArrayProjectDimensions(&array, type, dimensions, &projected, &error),
+            EINVAL);
+        ASSERT_NE(array.release, nullptr);
+        array.release(&array);
+        continue;
+      }
+
+      // Keep track of the first coordinate buffer to check if it was copied
+      struct ArrowArray* coords = &array;
+      while (coords->n_children == 1 && coords->children[0]->n_children > 0) {
+        coords = coords->children[0];
+      }
+      const void* x_buffer = coords->children[0]->buffers[1];
+
+      ASSERT_EQ(
+          GeoArrowArrayProjectDimensions(&array, type, dimensions, &projected, &error),
+          GEOARROW_OK)
+          << error.message;
+      EXPECT_EQ(array.release, nullptr);
+      EXPECT_EQ(FormatWKT(out_type, &projected),
+                ExpectedWKT(schema_view.geometry_type, dimensions));
+
+      coords = &projected;
+      while (coords->n_children == 1 && coords->children[0]->n_children > 0) {
+        coords = coords->children[0];
+      }
+
+      if (GeoArrowCoordTypeLayout(schema_view.coord_type) ==
+          GEOARROW_COORD_TYPE_SEPARATE) {
+        EXPECT_EQ(coords->children[0]->buffers[1], x_buffer);
+      }
+
+      // Check a sliced input
+      projected.offset = 1;
+      projected.length -= 1;
+      projected.null_count = -1;
+      struct ArrowArray projected_xy;
+      ASSERT_EQ(GeoArrowArrayProjectDimensions(&projected, out_type,
+                                               GEOARROW_DIMENSIONS_XY, &projected_xy,
+                                               &error),
+                GEOARROW_OK)
+          << error.message;
+      std::vector<std::string> expected_xy =
+          ExpectedWKT(schema_view.geometry_type, GEOARROW_DIMENSIONS_XY);
+      expected_xy.erase(expected_xy.begin());
+
+      EXPECT_EQ(FormatWKT(GeoArrowMakeType(schema_view.geometry_type,
+                                           GEOARROW_DIMENSIONS_XY,
+                                           schema_view.coord_type),
+                          &projected_xy),
+                expected_xy);
+      projected_xy.release(&projected_xy);
+    }
+  }
+}
+
+TEST(TransposeTest, TransposeTestProjectDimensionsErrors) {
+  struct ArrowArray array;
+  struct ArrowArray out;
+  struct GeoArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(
+      MakeNativeArray(GEOARROW_TYPE_POINT_Z, {"POINT Z (0 1 2)"}, &array));
+
+  EXPECT_EQ(GeoArrowArrayProjectDimensions(&array, GEOARROW_TYPE_BOX,
+                                           GEOARROW_DIMENSIONS_XY, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't project dimensions of non-native type 990");
+
+  EXPECT_EQ(GeoArrowArrayProjectDimensions(&array, GEOARROW_TYPE_POINT_Z,
+                                           GEOARROW_DIMENSIONS_XYM, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't project dimensions 2 to dimensions 3");
+
+  EXPECT_EQ(GeoArrowArrayProjectDimensions(&array, GEOARROW_TYPE_POINT_Z,
+                                           GEOARROW_DIMENSIONS_UNKNOWN, &out, &error),
+            EINVAL);
+
+  // The input should not have been released
+  ASSERT_NE(array.release, nullptr);
+  array.release(&array);
+}
@@ -49,10 +49,11 @@ static inline int WKBReaderReadUInt32(struct WKBReaderPrivate* s, uint32_t* out,
   }
 }
 
-static inline GeoArrowErrorCode WKBReaderReadNodeCoordinates(
-    struct WKBReaderPrivate* s, uint32_t n_coords, uint32_t coord_size_elements,
-    struct GeoArrowGeometryNode* node, struct GeoArrowError* error) {
-  int64_t bytes_needed = n_coords * coord_size_elements * sizeof(double);
+static inline GeoArrowErrorCode WKBReaderSkipCoordinates(struct WKBReaderPrivate* s,
+                                                         uint32_t n_coords,
+                                                         uint32_t coord_size_elements,
+                                                         struct GeoArrowError* error) {
+  int64_t bytes_needed = (int64_t)n_coords * coord_size_elements * sizeof(double);
   if (s->size_bytes < bytes_needed) {
     GeoArrowErrorSet(
         error,
@@ -63,20 +64,35 @@ static inline GeoArrowErrorCode WKBReaderReadNodeCoordinates(
     return EINVAL;
   }
 
+  s->data += bytes_needed;
+  s->size_bytes -= bytes_needed;
+  return GEOARROW_OK;
+}
+
+static inline GeoArrowErrorCode WKBReaderReadNodeCoordinates(
+    struct WKBReaderPrivate* s, uint32_t n_coords, uint32_t coord_size_elements,
+    struct GeoArrowGeometryNode* node, struct GeoArrowError* error) {
+  const uint8_t* coords = s->data;
+  NANOARROW_RETURN_NOT_OK(
+      WKBReaderSkipCoordinates(s, n_coords, coord_size_elements, error));
+
   if (n_coords > 0) {
     for (uint32_t i = 0; i < coord_size_elements; i++) {
       node->coord_stride[i] = (int32_t)coord_size_elements * sizeof(double);
-      node->coords[i] = s->data + (i * sizeof(double));
+      node->coords[i] = coords + (i * sizeof(double));
     }
   }
 
-  s->data += bytes_needed;
   return GEOARROW_OK;
 }
 
-static inline GeoArrowErrorCode WKBReaderReadNodeGeometry(
-    struct WKBReaderPrivate* s, struct GeoArrowGeometryNode* node,
-    struct GeoArrowError* error) {
+// Reads the endian, geometry type, and (except for points, whose size is always 1)
+// size of a geometry, resolving EWKB and ISO dimensions
+static inline GeoArrowErrorCode WKBReaderReadHeader(struct WKBReaderPrivate* s,
+                                                    uint32_t* geometry_type_out,
+                                                    enum GeoArrowDimensions* dimensions,
+                                                    uint32_t* size,
+                                                    struct GeoArrowError* error) {
   NANOARROW_RETURN_NOT_OK(WKBReaderReadEndian(s, error));
   uint32_t geometry_type;
   const uint8_t* data_at_geom_type = s->data;
@@ -117,28 +133,56 @@ static inline GeoArrowErrorCode WKBReaderReadNodeGeometry(
     has_z = 1;
   }
 
+  if (geometry_type < GEOARROW_GEOMETRY_TYPE_POINT ||
+      geometry_type > GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION) {
+    GeoArrowErrorSet(error, "Expected valid geometry type code but found %u at byte %ld",
+                     (unsigned int)geometry_type, (long)(data_at_geom_type - s->data0));
+    return EINVAL;
+  }
+
   // Read the number of coordinates/rings/parts
-  uint32_t size;
   if (geometry_type != GEOARROW_GEOMETRY_TYPE_POINT) {
-    NANOARROW_RETURN_NOT_OK(WKBReaderReadUInt32(s, &size, error));
+    NANOARROW_RETURN_NOT_OK(WKBReaderReadUInt32(s, size, error));
   } else {
-    size = 1;
+    *size = 1;
   }
 
-  // Set coord size
-  uint32_t coord_size_elements = 2 + has_z + has_m;
-
   // Resolve dimensions
-  enum GeoArrowDimensions dimensions;
   if (has_z && has_m) {
-    dimensions = GEOARROW_DIMENSIONS_XYZM;
+    *dimensions = GEOARROW_DIMENSIONS_XYZM;
   } else if (has_z) {
-    dimensions = GEOARROW_DIMENSIONS_XYZ;
+    *dimensions = GEOARROW_DIMENSIONS_XYZ;
   } else if (has_m) {
-    dimensions = GEOARROW_DIMENSIONS_XYM;
+    *dimensions = GEOARROW_DIMENSIONS_XYM;
   } else {
-    dimensions = GEOARROW_DIMENSIONS_XY;
+    *dimensions = GEOARROW_DIMENSIONS_XY;
+  }
+
+  *geometry_type_out = geometry_type;
+  return GEOARROW_OK;
+}
+
+static inline uint32_t WKBReaderCoordSizeElements(enum GeoArrowDimensions dimensions) {
+  switch (dimensions) {
+    case GEOARROW_DIMENSIONS_XYZ:
+    case GEOARROW_DIMENSIONS_XYM:
+      return 3;
+    case GEOARROW_DIMENSIONS_XYZM:
+      return 4;
+    default:
+      return 2;
   }
+}
+
+static inline GeoArrowErrorCode WKBReaderReadNodeGeometry(
+    struct WKBReaderPrivate* s, struct GeoArrowGeometryNode* node,
+    struct GeoArrowError* error) {
+  uint32_t geometry_type;
+  enum GeoArrowDimensions dimensions;
+  uint32_t size;
+  NANOARROW_RETURN_NOT_OK(
+      WKBReaderReadHeader(s, &geometry_type, &dimensions, &size, error));
+  uint32_t coord_size_elements = WKBReaderCoordSizeElements(dimensions);
 
   // Populate the node
   node->geometry_type = (uint8_t)geometry_type;
@@ -176,10 +220,7 @@ static inline GeoArrowErrorCode WKBReaderReadNodeGeometry(
             WKBReaderReadNodeCoordinates(s, ring_size, coord_size_elements, ring, error));
       }
       break;
-    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
-    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
-    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
-    case GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION:
+    default:
       if (node->level == 255) {
         GeoArrowErrorSet(error, "WKBReader exceeded maximum recursion");
         return ENOTSUP;
@@ -193,13 +234,62 @@ static inline GeoArrowErrorCode WKBReaderReadNodeGeometry(
         GEOARROW_RETURN_NOT_OK(WKBReaderReadNodeGeometry(s, child, error));
       }
       break;
+  }
+
+  return GEOARROW_OK;
+}
+
+// Like WKBReaderReadNodeGeometry() but only accumulates counts into out. The
+// geometry_type, dimensions, and size are set after those of any children such
+// that they describe the outermost geometry.
+static GeoArrowErrorCode WKBReaderScanGeometry(struct WKBReaderPrivate* s, int level,
+                                               struct GeoArrowWKBSummary* out,
+                                               struct GeoArrowError* error) {
+  uint32_t geometry_type;
+  enum GeoArrowDimensions dimensions;
+  uint32_t size;
+  NANOARROW_RETURN_NOT_OK(
+      WKBReaderReadHeader(s, &geometry_type, &dimensions, &size, error));
+  uint32_t coord_size_elements = WKBReaderCoordSizeElements(dimensions);
+
+  switch (geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      NANOARROW_RETURN_NOT_OK(
+          WKBReaderSkipCoordinates(s, size, coord_size_elements, error));
+      out->num_coords += size;
+      break;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      if (level == 255) {
+        GeoArrowErrorSet(error, "WKBReader exceeded maximum recursion");
+        return ENOTSUP;
+      }
+
+      uint32_t ring_size;
+      for (uint32_t i = 0; i < size; i++) {
+        GEOARROW_RETURN_NOT_OK(WKBReaderReadUInt32(s, &ring_size, error));
+        GEOARROW_RETURN_NOT_OK(
+            WKBReaderSkipCoordinates(s, ring_size, coord_size_elements, error));
+        out->num_coords += ring_size;
+      }
+
+      out->num_rings += size;
+      break;
     default:
-      GeoArrowErrorSet(error,
-                       "Expected valid geometry type code but found %u at byte %ld",
-                       (unsigned int)geometry_type, (long)(data_at_geom_type - s->data0));
-      return EINVAL;
+      if (level == 255) {
+        GeoArrowErrorSet(error, "WKBReader exceeded maximum recursion");
+        return ENOTSUP;
+      }
+
+      for (uint32_t i = 0; i < size; i++) {
+        GEOARROW_RETURN_NOT_OK(WKBReaderScanGeometry(s, level + 1, out, error));
+      }
+      break;
   }
 
+  out->geometry_type = (enum GeoArrowGeometryType)geometry_type;
+  out->dimensions = dimensions;
+  out->size = size;
   return GEOARROW_OK;
 }
 
@@ -265,3 +355,17 @@ GeoArrowErrorCode GeoArrowWKBReaderRead(struct GeoArrowWKBReader* reader,
   *out = GeoArrowGeometryAsView(&s->geom);
   return GEOARROW_OK;
 }
+
+GeoArrowErrorCode GeoArrowWKBReaderScan(struct GeoArrowWKBReader* reader,
+                                        struct GeoArrowBufferView src,
+                                        struct GeoArrowWKBSummary* out,
+                                        struct GeoArrowError* error) {
+  struct WKBReaderPrivate* s = (struct WKBReaderPrivate*)reader->private_data;
+  s->data0 = src.data;
+  s->data = src.data;
+  s->size_bytes = src.size_bytes;
+
+  out->num_rings = 0;
+  out->num_coords = 0;
+  return WKBReaderScanGeometry(s, 0, out, error);
+}
@@ -242,3 +242,103 @@ TEST(WKBReaderTest, WKTReaderTestManyCoordinates) {
   std::vector<uint8_t> big_linestring_wkb = tester.AsWKB(ss.str());
   EXPECT_WKB_ROUNDTRIP(tester, big_linestring_wkb);
 }
+
+TEST(WKBReaderTest, WKBReaderTestScan) {
+  WKXTester tester;
+  struct GeoArrowWKBReader reader;
+  ASSERT_EQ(GeoArrowWKBReaderInit(&reader), GEOARROW_OK);
+
+  struct ScanCase {
+    std::string wkt;
+    enum GeoArrowGeometryType geometry_type;
+    enum GeoArrowDimensions dimensions;
+    uint32_t size;
+    int64_t num_rings;
+    int64_t num_coords;
+  };
+
+  std::vector<ScanCase> cases = {
+      {"POINT (30 10)", GEOARROW_GEOMETRY_TYPE_POINT, GEOARROW_DIMENSIONS_XY, 1, 0, 1},
+      {"LINESTRING Z (0 0 0, 1 1 1, 2 2 2)", GEOARROW_GEOMETRY_TYPE_LINESTRING,
+       GEOARROW_DIMENSIONS_XYZ, 3, 0, 3},
+      {"LINESTRING EMPTY", GEOARROW_GEOMETRY_TYPE_LINESTRING, GEOARROW_DIMENSIONS_XY, 0,
+       0, 0},
+      {"POLYGON M ((0 0 0, 1 0 0, 0 1 0, 0 0 0), (0 0 0, 1 1 0, 0 0 0))",
+       GEOARROW_GEOMETRY_TYPE_POLYGON, GEOARROW_DIMENSIONS_XYM, 2, 2, 7},
+      {"MULTIPOINT ZM (0 0 0 0, 1 1 1 1)", GEOARROW_GEOMETRY_TYPE_MULTIPOINT,
+       GEOARROW_DIMENSIONS_XYZM, 2, 0, 2},
+      {"MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)), ((0 0, 1 0, 0 1, 0 0)), EMPTY)",
+       GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON, GEOARROW_DIMENSIONS_XY, 3, 2, 8},
+      {"GEOMETRYCOLLECTION (POINT (0 1), GEOMETRYCOLLECTION (LINESTRING (0 0, 1 1), "
+       "POLYGON ((0 0, 1 0, 0 1, 0 0))))",
+       GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION, GEOARROW_DIMENSIONS_XY, 2, 1, 7},
+      {"GEOMETRYCOLLECTION EMPTY", GEOARROW_GEOMETRY_TYPE_GEOMETRYCOLLECTION,
+       GEOARROW_DIMENSIONS_XY, 0, 0, 0}};
+
+  struct GeoArrowWKBSummary summary;
+  for (const auto& item : cases) {
+    SCOPED_TRACE(item.wkt);
+    std::vector<uint8_t> wkb = tester.AsWKB(item.wkt);
+    ASSERT_EQ(
+        GeoArrowWKBReaderScan(&reader, {wkb.data(), static_cast<int64_t>(wkb.size())},
+                              &summary, nullptr),
+        GEOARROW_OK);
+    EXPECT_EQ(summary.geometry_type, item.geometry_type);
+    EXPECT_EQ(summary.dimensions, item.dimensions);
+    EXPECT_EQ(summary.size, item.size);
+    EXPECT_EQ(summary.num_rings, item.num_rings);
+    EXPECT_EQ(summary.num_coords, item.num_coords);
+  }
+
+  // EWKB with an embedded SRID
+  std::vector<uint8_t> point_zms(
+      {0x01, 0x01, 0x00, 0x00, 0xe0, 0xe6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+       0x00, 0x3e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00,
+       0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x40});
+  ASSERT_EQ(GeoArrowWKBReaderScan(
+                &reader, {point_zms.data(), static_cast<int64_t>(point_zms.size())},
+                &summary, nullptr),
+            GEOARROW_OK);
+  EXPECT_EQ(summary.geometry_type, GEOARROW_GEOMETRY_TYPE_POINT);
+  EXPECT_EQ(summary.dimensions, GEOARROW_DIMENSIONS_XYZM);
+  EXPECT_EQ(summary.num_coords, 1);
+
+  GeoArrowWKBReaderReset(&reader);
+}
+
+TEST(WKBReaderTest, WKBReaderTestScanInvalid) {
+  WKXTester tester;
+  struct GeoArrowWKBReader reader;
+  struct GeoArrowWKBSummary summary;
+  struct GeoArrowGeometryView geometry;
+  struct GeoArrowError error;
+  ASSERT_EQ(GeoArrowWKBReaderInit(&reader), GEOARROW_OK);
+
+  std::vector<uint8_t> bad_point({0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+                                  0x00, 0x00, 0x00, 0x00, 0x3e, 0x40, 0x00,
+                                  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40});
+  EXPECT_EQ(GeoArrowWKBReaderScan(
+                &reader, {bad_point.data(), static_cast<int64_t>(bad_point.size())},
+                &summary, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected valid geometry type code but found 257 at byte 1");
+
+  // The second point of this multipoint is missing some of its coordinate bytes, which
+  // must be detected after the coordinates of the first point were skipped
+  std::vector<uint8_t> multipoint = tester.AsWKB("MULTIPOINT (0 1, 2 3)");
+  multipoint.resize(multipoint.size() - 5);
+  struct GeoArrowBufferView src = {multipoint.data(),
+                                   static_cast<int64_t>(multipoint.size())};
+
+  EXPECT_EQ(GeoArrowWKBReaderScan(&reader, src, &summary, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected coordinate sequence of 1 coords (16 bytes) but found 11 bytes "
+               "remaining at byte 35");
+
+  EXPECT_EQ(GeoArrowWKBReaderRead(&reader, src, &geometry, &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected coordinate sequence of 1 coords (16 bytes) but found 11 bytes "
+               "remaining at byte 35");
+
+  GeoArrowWKBReaderReset(&reader);
+}
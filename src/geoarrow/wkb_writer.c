@@ -19,6 +19,8 @@ struct WKBWriterPrivate {
   int64_t length;
   int64_t null_count;
   int feat_is_null;
+  struct GeoArrowStatistics* stats;
+  int64_t last_capacity[3];
 };
 
 static uint8_t kWKBWriterEmptyPointCoords2[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -40,6 +42,21 @@ static inline int WKBWriterCheckLevel(struct WKBWriterPrivate* private) {
   }
 }
 
+static inline void WKBWriterUpdateStatistics(struct WKBWriterPrivate* private) {
+  if (private->stats == NULL) {
+    return;
+  }
+
+  int64_t capacity[3] = {private->validity.buffer.capacity_bytes,
+                         private->offsets.capacity_bytes, private->values.capacity_bytes};
+  for (int i = 0; i < 3; i++) {
+    if (capacity[i] != private->last_capacity[i]) {
+      private->stats->num_reallocations++;
+      private->last_capacity[i] = capacity[i];
+    }
+  }
+}
+
 static int feat_start_wkb(struct GeoArrowVisitor* v) {
   struct WKBWriterPrivate* private = (struct WKBWriterPrivate*)v->private_data;
   private->level = 0;
@@ -172,11 +189,12 @@ static int feat_end_wkb(struct GeoArrowVisitor* v) {
     }
 
     private->null_count++;
-    return ArrowBitmapAppend(&private->validity, 0, 1);
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&private->validity, 0, 1));
   } else if (private->validity.buffer.data != NULL) {
-    return ArrowBitmapAppend(&private->validity, 1, 1);
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&private->validity, 1, 1));
   }
 
+  WKBWriterUpdateStatistics(private);
   return GEOARROW_OK;
 }
 
@@ -191,6 +209,8 @@ GeoArrowErrorCode GeoArrowWKBWriterInit(struct GeoArrowWKBWriter* writer) {
   private->length = 0;
   private->level = 0;
   private->null_count = 0;
+  private->stats = NULL;
+  memset(private->last_capacity, 0, sizeof(private->last_capacity));
   ArrowBitmapInit(&private->validity);
   ArrowBufferInit(&private->offsets);
   ArrowBufferInit(&private->values);
@@ -214,6 +234,99 @@ void GeoArrowWKBWriterInitVisitor(struct GeoArrowWKBWriter* writer,
   v->feat_end = &feat_end_wkb;
 }
 
+GeoArrowErrorCode GeoArrowWKBWriterReserve(struct GeoArrowWKBWriter* writer,
+                                           int64_t additional_length,
+                                           int64_t additional_size_bytes) {
+  struct WKBWriterPrivate* private = (struct WKBWriterPrivate*)writer->private_data;
+  // Includes the final offset appended by GeoArrowWKBWriterFinish()
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+      &private->offsets, (additional_length + 1) * (int64_t)sizeof(int32_t)));
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private->values, additional_size_bytes));
+  WKBWriterUpdateStatistics(private);
+  return GEOARROW_OK;
+}
+
+// Computes the number of bytes written by the GeoArrowWKBWriter for the non-null
+// features raw_offset to raw_offset + length (ignoring the validity bitmap), which
+// only depends on the number of elements at each level of nesting
+static int64_t GeoArrowWKBSizeNative(const struct GeoArrowArrayView* array_view,
+                                     int64_t raw_offset, int64_t length) {
+  // n[0] is the number of features and n[level + 1] is the number of children at
+  // the next level of nesting
+  int64_t n[4] = {length, 0, 0, 0};
+  int64_t start = raw_offset;
+  int64_t end = raw_offset + length;
+  for (int32_t level = 0; level < array_view->n_offsets; level++) {
+    const int32_t* offsets = array_view->offsets[level];
+    n[level + 1] = (int64_t)offsets[end] - offsets[start];
+    int64_t next_start = offsets[start] + array_view->offset[level + 1];
+    end = offsets[end] + array_view->offset[level + 1];
+    start = next_start;
+  }
+
+  int64_t header_size = sizeof(uint8_t) + sizeof(uint32_t);
+  int64_t coord_size = _GeoArrowkNumDimensions[array_view->schema_view.dimensions] *
+                       (int64_t)sizeof(double);
+
+  switch (array_view->schema_view.geometry_type) {
+    case GEOARROW_GEOMETRY_TYPE_POINT:
+      return n[0] * (header_size + coord_size);
+    case GEOARROW_GEOMETRY_TYPE_LINESTRING:
+      return n[0] * (header_size + 4) + n[1] * coord_size;
+    case GEOARROW_GEOMETRY_TYPE_POLYGON:
+      return n[0] * (header_size + 4) + n[1] * 4 + n[2] * coord_size;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOINT:
+      return n[0] * (header_size + 4) + n[1] * (header_size + coord_size);
+    case GEOARROW_GEOMETRY_TYPE_MULTILINESTRING:
+      return n[0] * (header_size + 4) + n[1] * (header_size + 4) + n[2] * coord_size;
+    case GEOARROW_GEOMETRY_TYPE_MULTIPOLYGON:
+      return n[0] * (header_size + 4) + n[1] * (header_size + 4) + n[2] * 4 +
+             n[3] * coord_size;
+    default:
+      return -1;
+  }
+}
+
+GeoArrowErrorCode GeoArrowArrayViewWKBSize(const struct GeoArrowArrayView* array_view,
+                                           int64_t offset, int64_t length,
+                                           int64_t* size_bytes) {
+  switch (array_view->schema_view.type) {
+    case GEOARROW_TYPE_WKB:
+    case GEOARROW_TYPE_WKT:
+    case GEOARROW_TYPE_LARGE_WKB:
+    case GEOARROW_TYPE_LARGE_WKT:
+    case GEOARROW_TYPE_WKB_VIEW:
+    case GEOARROW_TYPE_WKT_VIEW:
+      return ENOTSUP;
+    default:
+      break;
+  }
+
+  int64_t raw_offset = array_view->offset[0] + offset;
+  int64_t size = GeoArrowWKBSizeNative(array_view, raw_offset, length);
+  if (size < 0) {
+    return ENOTSUP;
+  }
+
+  // Null features are written as zero bytes regardless of their content
+  if (array_view->validity_bitmap != NULL) {
+    for (int64_t i = raw_offset; i < (raw_offset + length); i++) {
+      if (!ArrowBitGet(array_view->validity_bitmap, i)) {
+        size -= GeoArrowWKBSizeNative(array_view, i, 1);
+      }
+    }
+  }
+
+  *size_bytes = size;
+  return GEOARROW_OK;
+}
+
+void GeoArrowWKBWriterSetStatistics(struct GeoArrowWKBWriter* writer,
+                                    struct GeoArrowStatistics* stats) {
+  struct WKBWriterPrivate* private = (struct WKBWriterPrivate*)writer->private_data;
+  private->stats = stats;
+}
+
 GeoArrowErrorCode GeoArrowWKBWriterFinish(struct GeoArrowWKBWriter* writer,
                                           struct ArrowArray* array,
                                           struct GeoArrowError* error) {
@@ -226,6 +339,14 @@ GeoArrowErrorCode GeoArrowWKBWriterFinish(struct GeoArrowWKBWriter* writer,
 
   NANOARROW_RETURN_NOT_OK(
       ArrowBufferAppendInt32(&private->offsets, (int32_t) private->values.size_bytes));
+  if (private->stats != NULL) {
+    WKBWriterUpdateStatistics(private);
+    private->stats->bytes_written += private->validity.buffer.size_bytes +
+                                     private->offsets.size_bytes +
+                                     private->values.size_bytes;
+    memset(private->last_capacity, 0, sizeof(private->last_capacity));
+  }
+
   NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array, private->storage_type));
   ArrowArraySetValidityBitmap(array, &private->validity);
   NANOARROW_RETURN_NOT_OK(ArrowArraySetBuffer(array, 1, &private->offsets));
@@ -265,6 +386,7 @@ static GeoArrowErrorCode GeoArrowWKBWriterAppendValidity(struct GeoArrowWKBWrite
     NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&private_data->validity, 1, 1));
   }
 
+  WKBWriterUpdateStatistics(private_data);
   return GEOARROW_OK;
 }
 
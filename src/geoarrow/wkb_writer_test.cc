@@ -1,4 +1,9 @@
 
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "geoarrow/geoarrow.h"
@@ -353,3 +358,91 @@ TEST(WKBWriterTest, WKBWriterTestNestedCollection) {
   auto geom = tester.AsGeometry(wkt);
   EXPECT_EQ(tester.AsWKB(geom), expected);
 }
+
+class WKBSizeTest : public ::testing::TestWithParam<
+                        std::pair<enum GeoArrowType, std::vector<std::string>>> {};
+
+TEST_P(WKBSizeTest, WKBWriterTestArrayViewWKBSize) {
+  enum GeoArrowType type = GetParam().first;
+  const std::vector<std::string>& wkt = GetParam().second;
+
+  struct ArrowArray array;
+  ASSERT_NO_FATAL_FAILURE(MakeNativeArray(type, wkt, &array));
+  struct GeoArrowArrayView array_view;
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, type), GEOARROW_OK);
+  ASSERT_EQ(GeoArrowArrayViewSetArray(&array_view, &array, nullptr), GEOARROW_OK);
+
+  // Check every slice of the array against the visitor's output
+  int64_t n = static_cast<int64_t>(wkt.size());
+  for (int64_t offset = 0; offset <= n; offset++) {
+    for (int64_t length = 0; length <= (n - offset); length++) {
+      int64_t size_bytes = -1;
+      ASSERT_EQ(GeoArrowArrayViewWKBSize(&array_view, offset, length, &size_bytes),
+                GEOARROW_OK);
+
+      struct GeoArrowWKBWriter writer;
+      struct GeoArrowVisitor v;
+      struct GeoArrowStatistics stats;
+      memset(&stats, 0, sizeof(stats));
+      ASSERT_EQ(GeoArrowWKBWriterInit(&writer), GEOARROW_OK);
+      GeoArrowWKBWriterInitVisitor(&writer, &v);
+      GeoArrowWKBWriterSetStatistics(&writer, &stats);
+
+      // After reserving, visiting only allocates the (lazy) validity bitmap
+      ASSERT_EQ(GeoArrowWKBWriterReserve(&writer, length, size_bytes), GEOARROW_OK);
+      int64_t num_reallocations = stats.num_reallocations;
+      ASSERT_EQ(GeoArrowArrayViewVisitNative(&array_view, offset, length, &v),
+                GEOARROW_OK);
+
+      struct ArrowArray out;
+      ASSERT_EQ(GeoArrowWKBWriterFinish(&writer, &out, nullptr), GEOARROW_OK);
+      EXPECT_EQ(reinterpret_cast<const int32_t*>(out.buffers[1])[length], size_bytes)
+          << "offset = " << offset << ", length = " << length;
+      EXPECT_EQ(stats.num_reallocations - num_reallocations, out.null_count > 0);
+
+      out.release(&out);
+      GeoArrowWKBWriterReset(&writer);
+    }
+  }
+
+  array.release(&array);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    WKBWriterTest, WKBSizeTest,
+    ::testing::Values(
+        std::make_pair(GEOARROW_TYPE_POINT,
+                       std::vector<std::string>{"POINT (0 1)", "", "POINT (2 3)"}),
+        std::make_pair(GEOARROW_TYPE_POINT_ZM,
+                       std::vector<std::string>{"POINT ZM (0 1 2 3)", "POINT ZM EMPTY"}),
+        std::make_pair(GEOARROW_TYPE_LINESTRING,
+                       std::vector<std::string>{"LINESTRING (0 1, 2 3)", "",
+                                                "LINESTRING EMPTY",
+                                                "LINESTRING (0 1, 2 3, 4 5)"}),
+        std::make_pair(GEOARROW_TYPE_POLYGON,
+                       std::vector<std::string>{
+                           "POLYGON ((0 0, 1 0, 0 1, 0 0))", "POLYGON EMPTY", "",
+                           "POLYGON ((0 0, 1 0, 0 1, 0 0), (0 0, 1 0, 0 1, 0 0))"}),
+        std::make_pair(GEOARROW_TYPE_MULTIPOINT_Z,
+                       std::vector<std::string>{"MULTIPOINT Z ((0 1 2), (3 4 5))", "",
+                                                "MULTIPOINT Z EMPTY"}),
+        std::make_pair(GEOARROW_TYPE_MULTILINESTRING,
+                       std::vector<std::string>{
+                           "MULTILINESTRING ((0 1, 2 3), (4 5, 6 7))", "",
+                           "MULTILINESTRING EMPTY", "MULTILINESTRING ((0 1, 2 3))"}),
+        std::make_pair(GEOARROW_TYPE_MULTIPOLYGON,
+                       std::vector<std::string>{
+                           "MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)), ((0 0, 1 0, 0 1, 0 0), "
+                           "(0 0, 1 0, 0 1, 0 0)))",
+                           "", "MULTIPOLYGON EMPTY", "MULTIPOLYGON ((EMPTY))"})));
+
+TEST(WKBWriterTest, WKBWriterTestArrayViewWKBSizeErrors) {
+  struct GeoArrowArrayView array_view;
+  int64_t size_bytes;
+
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_WKB), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowArrayViewWKBSize(&array_view, 0, 0, &size_bytes), ENOTSUP);
+
+  ASSERT_EQ(GeoArrowArrayViewInitFromType(&array_view, GEOARROW_TYPE_BOX), GEOARROW_OK);
+  EXPECT_EQ(GeoArrowArrayViewWKBSize(&array_view, 0, 0, &size_bytes), ENOTSUP);
+}
@@ -6,6 +6,9 @@
 
 #include "geoarrow/geoarrow.h"
 
+// The number of coordinates printed per call to GeoArrowPrintCoords()
+#define WKT_WRITER_COORDS_PER_CHUNK 64
+
 struct WKTWriterPrivate {
   enum ArrowType storage_type;
   struct ArrowBitmap validity;
@@ -21,6 +24,8 @@ struct WKTWriterPrivate {
   int use_flat_multipoint;
   int64_t max_element_size_bytes;
   int feat_is_null;
+  struct GeoArrowStatistics* stats;
+  int64_t last_capacity[3];
 };
 
 static inline int WKTWriterCheckLevel(struct WKTWriterPrivate* private) {
@@ -31,18 +36,23 @@ static inline int WKTWriterCheckLevel(struct WKTWriterPrivate* private) {
   }
 }
 
-static inline int WKTWriterWrite(struct WKTWriterPrivate* private, const char* value) {
-  return ArrowBufferAppend(&private->values, value, strlen(value));
+static inline void WKTWriterUpdateStatistics(struct WKTWriterPrivate* private) {
+  if (private->stats == NULL) {
+    return;
+  }
+
+  int64_t capacity[3] = {private->validity.buffer.capacity_bytes,
+                         private->offsets.capacity_bytes, private->values.capacity_bytes};
+  for (int i = 0; i < 3; i++) {
+    if (capacity[i] != private->last_capacity[i]) {
+      private->stats->num_reallocations++;
+      private->last_capacity[i] = capacity[i];
+    }
+  }
 }
 
-static inline void WKTWriterWriteDoubleUnsafe(struct WKTWriterPrivate* private,
-                                              double value) {
-  // Always ensure that we have at least 40 writable bytes remaining before calling
-  // GeoArrowPrintDouble()
-  NANOARROW_DCHECK((private->values.capacity_bytes - private->values.size_bytes) >= 40);
-  private->values.size_bytes +=
-      GeoArrowPrintDouble(value, private->precision,
-                          ((char*)private->values.data) + private->values.size_bytes);
+static inline int WKTWriterWrite(struct WKTWriterPrivate* private, const char* value) {
+  return ArrowBufferAppend(&private->values, value, strlen(value));
 }
 
 static int feat_start_wkt(struct GeoArrowVisitor* v) {
@@ -147,31 +157,14 @@ static int coords_wkt(struct GeoArrowVisitor* v, const struct GeoArrowCoordView*
   struct WKTWriterPrivate* private = (struct WKTWriterPrivate*)v->private_data;
   NANOARROW_RETURN_NOT_OK(WKTWriterCheckLevel(private));
 
-  int64_t max_chars_per_coord_theoretical =
-      // space + comma after coordinate
-      (n_coords * 2) +
-      // spaces between ordinates
-      (n_coords * (n_dims - 1)) +
-      // GeoArrowPrintDouble might require up to 40 accessible bytes per call
-      (40 * n_dims);
-
-  // Use a heuristic to estimate the number of characters we are about to write
-  // to avoid more then one allocation for this call. This is normally substantially
-  // less than the theoretical amount.
-  int64_t max_chars_estimated =
-      (n_coords * 2) +             // space + comma after coordinate
-      (n_coords * (n_dims - 1)) +  // spaces between ordinates
-      // precision + decimal + estimate of normal
-      // digits to the left of the decimal
-      ((private->precision + 1 + 8) * n_coords * n_dims) +
-      // Ensure that the last reserve() call doesn't trigger an allocation
-      max_chars_per_coord_theoretical;
-  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private->values, max_chars_estimated));
-
-  // Write the first coordinate, possibly with a leading comma if there was
-  // a previous call to coords, or the opening (if it wasn't). Special case
-  // for the flat multipoint output MULTIPOINT (1 2, 3 4, ...) which doesn't
-  // have extra () for inner POINTs
+  // GeoArrowPrintCoords() requires up to 40 bytes per ordinate plus the spaces
+  // between ordinates and the ", " between coordinates
+  int64_t max_chars_per_coord = 41 * n_dims + 1;
+
+  // Write a leading comma if there was a previous call to coords, or the opening
+  // (if it wasn't). Special case for the flat multipoint output
+  // MULTIPOINT (1 2, 3 4, ...) which doesn't have extra () for inner POINTs
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&private->values, 2));
   if (private->i[private->level] != 0) {
     ArrowBufferAppendUnsafe(&private->values, ", ", 2);
   } else if (private->level < 1 || !private->use_flat_multipoint ||
@@ -180,35 +173,36 @@ static int coords_wkt(struct GeoArrowVisitor* v, const struct GeoArrowCoordView*
     ArrowBufferAppendUnsafe(&private->values, "(", 1);
   }
 
-  // Actually write the first coordinate (no leading comma)
-  // Reserve the theoretical amount for each coordinate because we need this to guarantee
-  // that there won't be a segfault when writing a coordinate. This probably results in
-  // a few dozen bytes of of overallocation.
-  NANOARROW_RETURN_NOT_OK(
-      ArrowBufferReserve(&private->values, max_chars_per_coord_theoretical));
-  WKTWriterWriteDoubleUnsafe(private, GEOARROW_COORD_VIEW_VALUE(coords, 0, 0));
-  for (int32_t j = 1; j < n_dims; j++) {
-    ArrowBufferAppendUnsafe(&private->values, " ", 1);
-    WKTWriterWriteDoubleUnsafe(private, GEOARROW_COORD_VIEW_VALUE(coords, 0, j));
+  // Print coordinates in chunks such that the worst-case size only has to be
+  // reserved once per chunk (without overallocating by much for long sequences).
+  // When limiting the size of each element, check the limit after every coordinate
+  // to consume as little input as possible.
+  int64_t coords_per_chunk = WKT_WRITER_COORDS_PER_CHUNK;
+  if (private->max_element_size_bytes >= 0) {
+    coords_per_chunk = 1;
   }
 
-  // Write the remaining coordinates (which all have leading commas)
-  for (int64_t i = 1; i < n_coords; i++) {
-    // Check if we've hit our max number of bytes for this feature
-    if (private->max_element_size_bytes >= 0 &&
+  for (int64_t offset = 0; offset < n_coords; offset += coords_per_chunk) {
+    if (offset > 0 && private->max_element_size_bytes >= 0 &&
         (private->values.size_bytes - private->values_feat_start) >=
             private->max_element_size_bytes) {
       return EAGAIN;
     }
 
+    int64_t chunk_size = n_coords - offset;
+    if (chunk_size > coords_per_chunk) {
+      chunk_size = coords_per_chunk;
+    }
+
     NANOARROW_RETURN_NOT_OK(
-        ArrowBufferReserve(&private->values, max_chars_per_coord_theoretical));
-    ArrowBufferAppendUnsafe(&private->values, ", ", 2);
-    WKTWriterWriteDoubleUnsafe(private, GEOARROW_COORD_VIEW_VALUE(coords, i, 0));
-    for (int32_t j = 1; j < n_dims; j++) {
-      ArrowBufferAppendUnsafe(&private->values, " ", 1);
-      WKTWriterWriteDoubleUnsafe(private, GEOARROW_COORD_VIEW_VALUE(coords, i, j));
+        ArrowBufferReserve(&private->values, chunk_size * max_chars_per_coord));
+    if (offset > 0) {
+      ArrowBufferAppendUnsafe(&private->values, ", ", 2);
     }
+
+    private->values.size_bytes += GeoArrowPrintCoords(
+        coords, offset, chunk_size, (uint32_t)private->precision,
+        ((char*)private->values.data) + private->values.size_bytes);
   }
 
   private->i[private->level] += n_coords;
@@ -247,6 +241,7 @@ static int geom_end_wkt(struct GeoArrowVisitor* v) {
 
 static int feat_end_wkt(struct GeoArrowVisitor* v) {
   struct WKTWriterPrivate* private = (struct WKTWriterPrivate*)v->private_data;
+  WKTWriterUpdateStatistics(private);
 
   if (private->feat_is_null) {
     if (private->validity.buffer.data == NULL) {
@@ -257,7 +252,7 @@ static int feat_end_wkt(struct GeoArrowVisitor* v) {
     private->null_count++;
     return ArrowBitmapAppend(&private->validity, 0, 1);
   } else if (private->validity.buffer.data != NULL) {
-    return ArrowBitmapAppend(&private->validity, 1, 1);
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(&private->validity, 1, 1));
   }
 
   if (private->max_element_size_bytes >= 0 &&
@@ -281,6 +276,8 @@ GeoArrowErrorCode GeoArrowWKTWriterInit(struct GeoArrowWKTWriter* writer) {
   private->length = 0;
   private->level = 0;
   private->null_count = 0;
+  private->stats = NULL;
+  memset(private->last_capacity, 0, sizeof(private->last_capacity));
   ArrowBitmapInit(&private->validity);
   ArrowBufferInit(&private->offsets);
   ArrowBufferInit(&private->values);
@@ -302,7 +299,9 @@ void GeoArrowWKTWriterInitVisitor(struct GeoArrowWKTWriter* writer,
   struct WKTWriterPrivate* private = (struct WKTWriterPrivate*)writer->private_data;
 
   // Clamp writer->precision to a specific range of valid values
-  if (writer->precision < 0 || writer->precision > 16) {
+  if (writer->precision == GEOARROW_PRECISION_SHORTEST) {
+    private->precision = GEOARROW_PRECISION_SHORTEST;
+  } else if (writer->precision < 0 || writer->precision > 16) {
     private->precision = 16;
   } else {
     private->precision = writer->precision;
@@ -322,6 +321,12 @@ void GeoArrowWKTWriterInitVisitor(struct GeoArrowWKTWriter* writer,
   v->feat_end = &feat_end_wkt;
 }
 
+void GeoArrowWKTWriterSetStatistics(struct GeoArrowWKTWriter* writer,
+                                    struct GeoArrowStatistics* stats) {
+  struct WKTWriterPrivate* private = (struct WKTWriterPrivate*)writer->private_data;
+  private->stats = stats;
+}
+
 GeoArrowErrorCode GeoArrowWKTWriterFinish(struct GeoArrowWKTWriter* writer,
                                           struct ArrowArray* array,
                                           struct GeoArrowError* error) {
@@ -333,6 +338,14 @@ GeoArrowErrorCode GeoArrowWKTWriterFinish(struct GeoArrowWKTWriter* writer,
   }
   NANOARROW_RETURN_NOT_OK(
       ArrowBufferAppendInt32(&private->offsets, (int32_t) private->values.size_bytes));
+  if (private->stats != NULL) {
+    WKTWriterUpdateStatistics(private);
+    private->stats->bytes_written += private->validity.buffer.size_bytes +
+                                     private->offsets.size_bytes +
+                                     private->values.size_bytes;
+    memset(private->last_capacity, 0, sizeof(private->last_capacity));
+  }
+
   NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array, private->storage_type));
   ArrowArraySetValidityBitmap(array, &private->validity);
   NANOARROW_RETURN_NOT_OK(ArrowArraySetBuffer(array, 1, &private->offsets));
@@ -352,3 +365,265 @@ void GeoArrowWKTWriterReset(struct GeoArrowWKTWriter* writer) {
   ArrowFree(private);
   writer->private_data = NULL;
 }
+
+// GeoArrowArrayFormatWKT() formats each range of rows into its own chunk and then
+// copies each chunk into its place in the output. Every range except the last
+// contains a multiple of 8 rows such that each chunk's validity bitmap starts on a
+// byte boundary of the output's validity bitmap.
+struct WKTFormatRange {
+  int64_t offset;
+  int64_t length;
+  int64_t values_offset;
+  struct ArrowArray chunk;
+  int result;
+  struct GeoArrowError error;
+};
+
+struct WKTFormatTasks {
+  const struct ArrowArray* array;
+  enum GeoArrowType type;
+  int precision;
+  int64_t max_element_size_bytes;
+  struct WKTFormatRange* ranges;
+  enum ArrowType storage_type;
+  uint8_t* validity;
+  uint8_t* offsets;
+  uint8_t* values;
+};
+
+static int WKTFormatRangeVisit(struct WKTFormatTasks* tasks,
+                               struct WKTFormatRange* range,
+                               struct GeoArrowArrayReader* reader,
+                               struct GeoArrowWKTWriter* writer) {
+  struct GeoArrowVisitor v;
+  writer->precision = tasks->precision;
+  writer->max_element_size_bytes = tasks->max_element_size_bytes;
+  GeoArrowWKTWriterInitVisitor(writer, &v);
+  v.error = &range->error;
+
+  GEOARROW_RETURN_NOT_OK(
+      GeoArrowArrayReaderSetArray(reader, tasks->array, &range->error));
+
+  if (tasks->max_element_size_bytes < 0) {
+    GEOARROW_RETURN_NOT_OK(
+        GeoArrowArrayReaderVisit(reader, range->offset, range->length, &v));
+  } else {
+    // Visit features one at a time such that a feature that reaches
+    // max_element_size_bytes only ends that feature
+    for (int64_t i = range->offset; i < (range->offset + range->length); i++) {
+      int result = GeoArrowArrayReaderVisit(reader, i, 1, &v);
+      if (result == EAGAIN) {
+        result = v.feat_end(&v);
+      }
+
+      GEOARROW_RETURN_NOT_OK(result);
+    }
+  }
+
+  return GeoArrowWKTWriterFinish(writer, &range->chunk, &range->error);
+}
+
+static void WKTFormatRangeTask(void* task_data, int64_t i) {
+  struct WKTFormatTasks* tasks = (struct WKTFormatTasks*)task_data;
+  struct WKTFormatRange* range = tasks->ranges + i;
+  struct GeoArrowArrayReader reader;
+  struct GeoArrowWKTWriter writer;
+
+  range->result = GeoArrowArrayReaderInitFromType(&reader, tasks->type);
+  if (range->result != GEOARROW_OK) {
+    return;
+  }
+
+  range->result = GeoArrowWKTWriterInit(&writer);
+  if (range->result != GEOARROW_OK) {
+    GeoArrowArrayReaderReset(&reader);
+    return;
+  }
+
+  range->result = WKTFormatRangeVisit(tasks, range, &reader, &writer);
+  GeoArrowWKTWriterReset(&writer);
+  GeoArrowArrayReaderReset(&reader);
+}
+
+static void WKTFormatStitchTask(void* task_data, int64_t i) {
+  struct WKTFormatTasks* tasks = (struct WKTFormatTasks*)task_data;
+  struct WKTFormatRange* range = tasks->ranges + i;
+  const int32_t* chunk_offsets = (const int32_t*)range->chunk.buffers[1];
+  int64_t chunk_values_size = chunk_offsets[range->length];
+
+  if (chunk_values_size > 0) {
+    memcpy(tasks->values + range->values_offset, range->chunk.buffers[2],
+           (size_t)chunk_values_size);
+  }
+
+  // The first offset of each range is written by the range before it (or is the
+  // zero written before any tasks run)
+  if (tasks->storage_type == NANOARROW_TYPE_STRING) {
+    int32_t* offsets = (int32_t*)tasks->offsets + range->offset;
+    int32_t values_offset = (int32_t)range->values_offset;
+    for (int64_t j = 1; j <= range->length; j++) {
+      offsets[j] = values_offset + chunk_offsets[j];
+    }
+  } else {
+    int64_t* offsets = (int64_t*)tasks->offsets + range->offset;
+    for (int64_t j = 1; j <= range->length; j++) {
+      offsets[j] = range->values_offset + chunk_offsets[j];
+    }
+  }
+
+  if (tasks->validity != NULL) {
+    uint8_t* validity = tasks->validity + range->offset / 8;
+    int64_t validity_size = _ArrowBytesForBits(range->length);
+    if (range->chunk.buffers[0] == NULL) {
+      memset(validity, 0xff, (size_t)validity_size);
+    } else {
+      memcpy(validity, range->chunk.buffers[0], (size_t)validity_size);
+    }
+  }
+}
+
+static void WKTFormatRunTasks(struct GeoArrowExecutor* executor, int64_t n_tasks,
+                              void (*task)(void* task_data, int64_t i),
+                              void* task_data) {
+  if (executor == NULL) {
+    for (int64_t i = 0; i < n_tasks; i++) {
+      task(task_data, i);
+    }
+  } else {
+    executor->parallel_for(executor, n_tasks, task, task_data);
+  }
+}
+
+static int WKTFormatStitch(struct WKTFormatTasks* tasks, int64_t n_ranges,
+                           struct GeoArrowExecutor* executor, struct ArrowArray* out,
+                           struct GeoArrowError* error) {
+  int64_t values_size = 0;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < n_ranges; i++) {
+    struct WKTFormatRange* range = tasks->ranges + i;
+    range->values_offset = values_size;
+    values_size += ((const int32_t*)range->chunk.buffers[1])[range->length];
+    null_count += range->chunk.null_count;
+  }
+
+  if (tasks->storage_type == NANOARROW_TYPE_STRING && values_size > 2147483647) {
+    GeoArrowErrorSet(error, "Can't format %ld bytes of WKT into a non-large array",
+                     (long)values_size);
+    return EOVERFLOW;
+  }
+
+  int64_t length = tasks->array->length;
+  int64_t offset_size = tasks->storage_type == NANOARROW_TYPE_STRING ? 4 : 8;
+
+  GEOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(out, tasks->storage_type));
+  if (null_count > 0) {
+    struct ArrowBitmap* validity = ArrowArrayValidityBitmap(out);
+    GEOARROW_RETURN_NOT_OK(ArrowBitmapReserve(validity, length));
+    validity->size_bits = length;
+    validity->buffer.size_bytes = _ArrowBytesForBits(length);
+    tasks->validity = validity->buffer.data;
+  }
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(out, 1);
+  GEOARROW_RETURN_NOT_OK(ArrowBufferResize(offsets, (length + 1) * offset_size, 0));
+  memset(offsets->data, 0, (size_t)offset_size);
+  tasks->offsets = offsets->data;
+
+  struct ArrowBuffer* values = ArrowArrayBuffer(out, 2);
+  GEOARROW_RETURN_NOT_OK(ArrowBufferResize(values, values_size, 0));
+  tasks->values = values->data;
+
+  WKTFormatRunTasks(executor, n_ranges, &WKTFormatStitchTask, tasks);
+
+  out->length = length;
+  out->null_count = null_count;
+  return ArrowArrayFinishBuildingDefault(out, (struct ArrowError*)error);
+}
+
+GeoArrowErrorCode GeoArrowArrayFormatWKT(const struct ArrowArray* array,
+                                         enum GeoArrowType type, int precision,
+                                         int64_t max_element_size_bytes,
+                                         enum GeoArrowType out_type, int64_t n_tasks,
+                                         struct GeoArrowExecutor* executor,
+                                         struct ArrowArray* out,
+                                         struct GeoArrowError* error) {
+  struct WKTFormatTasks tasks;
+  memset(&tasks, 0, sizeof(struct WKTFormatTasks));
+  tasks.array = array;
+  tasks.type = type;
+  tasks.precision = precision;
+  tasks.max_element_size_bytes = max_element_size_bytes;
+
+  switch (out_type) {
+    case GEOARROW_TYPE_WKT:
+      tasks.storage_type = NANOARROW_TYPE_STRING;
+      break;
+    case GEOARROW_TYPE_LARGE_WKT:
+      tasks.storage_type = NANOARROW_TYPE_LARGE_STRING;
+      break;
+    default:
+      GeoArrowErrorSet(error, "Expected out_type GEOARROW_TYPE_WKT or LARGE_WKT");
+      return EINVAL;
+  }
+
+  // Use ranges with a multiple of 8 rows (see WKTFormatRange)
+  if (n_tasks < 1) {
+    n_tasks = 1;
+  }
+
+  int64_t rows_per_range = (array->length + n_tasks - 1) / n_tasks;
+  rows_per_range = (rows_per_range + 7) / 8 * 8;
+  if (rows_per_range == 0) {
+    rows_per_range = 8;
+  }
+
+  int64_t n_ranges = (array->length + rows_per_range - 1) / rows_per_range;
+  if (n_ranges > 0) {
+    tasks.ranges = (struct WKTFormatRange*)ArrowMalloc(
+        (size_t)n_ranges * sizeof(struct WKTFormatRange));
+    if (tasks.ranges == NULL) {
+      GeoArrowErrorSet(error, "Failed to allocate %ld ranges", (long)n_ranges);
+      return ENOMEM;
+    }
+  }
+
+  for (int64_t i = 0; i < n_ranges; i++) {
+    struct WKTFormatRange* range = tasks.ranges + i;
+    range->offset = i * rows_per_range;
+    range->length = array->length - range->offset;
+    if (range->length > rows_per_range) {
+      range->length = rows_per_range;
+    }
+    range->chunk.release = NULL;
+    range->result = GEOARROW_OK;
+    range->error.message[0] = '\0';
+  }
+
+  WKTFormatRunTasks(executor, n_ranges, &WKTFormatRangeTask, &tasks);
+
+  int result = GEOARROW_OK;
+  for (int64_t i = 0; i < n_ranges; i++) {
+    if (tasks.ranges[i].result != GEOARROW_OK) {
+      result = tasks.ranges[i].result;
+      GeoArrowErrorSet(error, "%s", tasks.ranges[i].error.message);
+      break;
+    }
+  }
+
+  if (result == GEOARROW_OK) {
+    out->release = NULL;
+    result = WKTFormatStitch(&tasks, n_ranges, executor, out, error);
+    if (result != GEOARROW_OK && out->release != NULL) {
+      out->release(out);
+    }
+  }
+
+  for (int64_t i = 0; i < n_ranges; i++) {
+    if (tasks.ranges[i].chunk.release != NULL) {
+      tasks.ranges[i].chunk.release(&tasks.ranges[i].chunk);
+    }
+  }
+
+  ArrowFree(tasks.ranges);
+  return result;
+}
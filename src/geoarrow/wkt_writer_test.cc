@@ -1,6 +1,10 @@
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -84,6 +88,94 @@ TEST(WKTWriterTest, WKTWriterTestPrintDouble) {
   EXPECT_EQ(std::string(out.data(), 17), "314.1592653589793");
 }
 
+TEST(WKTWriterTest, WKTWriterTestPrintDoubleFast) {
+  std::array<char, 40> out{};
+
+  // Integers and values with few decimal places don't need ryu/snprintf() but
+  // must give identical output
+  int64_t n_chars = GeoArrowPrintDouble(-0.0, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "0");
+
+  n_chars = GeoArrowPrintDouble(-0.4, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "-0.4");
+
+  n_chars = GeoArrowPrintDouble(1.005, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "1.005");
+
+  n_chars = GeoArrowPrintDouble(999999999999.999, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "999999999999.999");
+
+  n_chars = GeoArrowPrintDouble(1e12, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "1000000000000");
+
+  // Precision still applies (ryu and snprintf() both round half to even here)
+  n_chars = GeoArrowPrintDouble(1.25, 1, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "1.2");
+
+  n_chars = GeoArrowPrintDouble(1.5, 0, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "2");
+
+  for (int64_t i = -1000000; i <= 1000000; i += 7) {
+    std::string expected = std::to_string(i / 1000);
+    if (i < 0 && i > -1000) {
+      expected = "-" + expected;
+    }
+
+    std::string decimals = std::to_string(1000 + std::abs(i) % 1000).substr(1);
+    while (!decimals.empty() && decimals.back() == '0') {
+      decimals.pop_back();
+    }
+
+    if (!decimals.empty()) {
+      expected += "." + decimals;
+    }
+
+    n_chars = GeoArrowPrintDouble(i / 1000.0, 16, out.data());
+    ASSERT_EQ(std::string(out.data(), n_chars), expected);
+  }
+}
+
+TEST(WKTWriterTest, WKTWriterTestPrintDoubleShortest) {
+  std::array<char, 40> out{};
+
+  int64_t n_chars = GeoArrowPrintDouble(0.012345678901234567, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "0.0123456789012346");
+
+  n_chars =
+      GeoArrowPrintDouble(0.012345678901234567, GEOARROW_PRECISION_SHORTEST, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "0.012345678901234567");
+
+  n_chars = GeoArrowPrintDouble(M_PI * 100, GEOARROW_PRECISION_SHORTEST, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "314.1592653589793");
+
+  n_chars = GeoArrowPrintDouble(0, GEOARROW_PRECISION_SHORTEST, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "0");
+
+  // Very small and very large values use scientific notation, whose exact form
+  // depends on whether or not ryu is used
+  for (double value : {1.5e-7, -1.333333333333333e-100, 4.9e-324,
+                       std::numeric_limits<double>::lowest()}) {
+    std::memset(out.data(), 0, sizeof(out));
+    n_chars = GeoArrowPrintDouble(value, GEOARROW_PRECISION_SHORTEST, out.data());
+    EXPECT_LE(n_chars, 25);
+    EXPECT_EQ(std::strtod(out.data(), nullptr), value) << out.data();
+  }
+}
+
+TEST(WKTWriterTest, WKTWriterTestPrintCoords) {
+  std::array<char, 3 * (41 * 3 + 1)> out{};
+  TestCoords coords({1, 4.5, 7}, {2, -5, 8.25}, {3, 6, 0.1});
+
+  int64_t n_chars = GeoArrowPrintCoords(coords.view(), 0, 3, 16, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "1 2 3, 4.5 -5 6, 7 8.25 0.1");
+
+  n_chars = GeoArrowPrintCoords(coords.view(), 1, 2, 0, out.data());
+  EXPECT_EQ(std::string(out.data(), n_chars), "4 -5 6, 7 8 0");
+
+  n_chars = GeoArrowPrintCoords(coords.view(), 1, 0, 16, out.data());
+  EXPECT_EQ(n_chars, 0);
+}
+
 TEST(WKTWriterTest, WKTWriterTestOneNull) {
   struct GeoArrowWKTWriter writer;
   struct GeoArrowVisitor v;
@@ -776,6 +868,83 @@ TEST(WKTWriterTest, WKTWriterTestStreamingCoords) {
   GeoArrowWKTWriterReset(&writer);
 }
 
+TEST(WKTWriterTest, WKTWriterTestShortestPrecision) {
+  struct GeoArrowWKTWriter writer;
+  struct GeoArrowVisitor v;
+  GeoArrowWKTWriterInit(&writer);
+  writer.precision = GEOARROW_PRECISION_SHORTEST;
+  GeoArrowWKTWriterInitVisitor(&writer, &v);
+
+  TestCoords coords({0.1}, {0.012345678901234567});
+
+  EXPECT_EQ(v.feat_start(&v), GEOARROW_OK);
+  EXPECT_EQ(v.geom_start(&v, GEOARROW_GEOMETRY_TYPE_POINT, GEOARROW_DIMENSIONS_XY),
+            GEOARROW_OK);
+  EXPECT_EQ(v.coords(&v, coords.view()), GEOARROW_OK);
+  EXPECT_EQ(v.geom_end(&v), GEOARROW_OK);
+  EXPECT_EQ(v.feat_end(&v), GEOARROW_OK);
+
+  struct ArrowArray array;
+  EXPECT_EQ(GeoArrowWKTWriterFinish(&writer, &array, nullptr), GEOARROW_OK);
+
+  struct ArrowArrayView view;
+  ArrowArrayViewInitFromType(&view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&view, &array, nullptr), GEOARROW_OK);
+
+  struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(&view, 0);
+  EXPECT_EQ(std::string(value.data, value.size_bytes),
+            "POINT (0.1 0.012345678901234567)");
+
+  ArrowArrayViewReset(&view);
+  array.release(&array);
+  GeoArrowWKTWriterReset(&writer);
+}
+
+TEST(WKTWriterTest, WKTWriterTestManyCoords) {
+  struct GeoArrowWKTWriter writer;
+  struct GeoArrowVisitor v;
+  GeoArrowWKTWriterInit(&writer);
+  GeoArrowWKTWriterInitVisitor(&writer, &v);
+
+  // Enough coordinates to be printed in more than one chunk
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::stringstream expected;
+  expected << "LINESTRING (";
+  for (int i = 0; i < 1000; i++) {
+    xs.push_back(i);
+    ys.push_back(i + 0.5);
+    if (i > 0) {
+      expected << ", ";
+    }
+    expected << i << " " << i << ".5";
+  }
+  expected << ")";
+
+  TestCoords coords(xs, ys);
+
+  EXPECT_EQ(v.feat_start(&v), GEOARROW_OK);
+  EXPECT_EQ(v.geom_start(&v, GEOARROW_GEOMETRY_TYPE_LINESTRING, GEOARROW_DIMENSIONS_XY),
+            GEOARROW_OK);
+  EXPECT_EQ(v.coords(&v, coords.view()), GEOARROW_OK);
+  EXPECT_EQ(v.geom_end(&v), GEOARROW_OK);
+  EXPECT_EQ(v.feat_end(&v), GEOARROW_OK);
+
+  struct ArrowArray array;
+  EXPECT_EQ(GeoArrowWKTWriterFinish(&writer, &array, nullptr), GEOARROW_OK);
+
+  struct ArrowArrayView view;
+  ArrowArrayViewInitFromType(&view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&view, &array, nullptr), GEOARROW_OK);
+
+  struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(&view, 0);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), expected.str());
+
+  ArrowArrayViewReset(&view);
+  array.release(&array);
+  GeoArrowWKTWriterReset(&writer);
+}
+
 TEST(WKTWriterTest, WKTWriterTestMaxFeatLen) {
   struct GeoArrowWKTWriter writer;
   struct GeoArrowVisitor v;
@@ -818,6 +987,44 @@ TEST(WKTWriterTest, WKTWriterTestMaxFeatLen) {
   GeoArrowWKTWriterReset(&writer);
 }
 
+TEST(WKTWriterTest, WKTWriterTestMaxFeatLenAfterNull) {
+  struct GeoArrowWKTWriter writer;
+  struct GeoArrowVisitor v;
+  GeoArrowWKTWriterInit(&writer);
+  writer.max_element_size_bytes = 6;
+  GeoArrowWKTWriterInitVisitor(&writer, &v);
+
+  TestCoords coords({1, 2}, {2, 3});
+
+  // Once a null has allocated the validity bitmap, features must still be truncated
+  EXPECT_EQ(v.feat_start(&v), GEOARROW_OK);
+  EXPECT_EQ(v.null_feat(&v), GEOARROW_OK);
+  EXPECT_EQ(v.feat_end(&v), GEOARROW_OK);
+
+  EXPECT_EQ(v.feat_start(&v), GEOARROW_OK);
+  EXPECT_EQ(v.geom_start(&v, GEOARROW_GEOMETRY_TYPE_LINESTRING, GEOARROW_DIMENSIONS_XY),
+            GEOARROW_OK);
+  EXPECT_EQ(v.coords(&v, coords.view()), EAGAIN);
+  EXPECT_EQ(v.feat_end(&v), GEOARROW_OK);
+
+  struct ArrowArray array;
+  EXPECT_EQ(GeoArrowWKTWriterFinish(&writer, &array, nullptr), GEOARROW_OK);
+  EXPECT_EQ(array.length, 2);
+  EXPECT_EQ(array.null_count, 1);
+
+  struct ArrowArrayView view;
+  ArrowArrayViewInitFromType(&view, NANOARROW_TYPE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(&view, &array, nullptr), GEOARROW_OK);
+
+  EXPECT_TRUE(ArrowArrayViewIsNull(&view, 0));
+  struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(&view, 1);
+  EXPECT_EQ(std::string(value.data, value.size_bytes), "LINEST");
+
+  ArrowArrayViewReset(&view);
+  array.release(&array);
+  GeoArrowWKTWriterReset(&writer);
+}
+
 TEST(WKTWriterTest, WKTWriterTestVeryLongCoords) {
   struct GeoArrowWKTWriter writer;
   struct GeoArrowVisitor v;
@@ -850,3 +1057,172 @@ TEST(WKTWriterTest, WKTWriterTestVeryLongCoords) {
   array.release(&array);
   GeoArrowWKTWriterReset(&writer);
 }
+
+// Runs tasks on up to four std::threads
+static void ThreadParallelFor(struct GeoArrowExecutor* executor, int64_t n_tasks,
+                              void (*task)(void* task_data, int64_t i),
+                              void* task_data) {
+  int64_t n_threads = std::min<int64_t>(n_tasks, 4);
+  std::vector<std::thread> threads;
+  for (int64_t j = 0; j < n_threads; j++) {
+    threads.emplace_back([=] {
+      for (int64_t i = j; i < n_tasks; i += n_threads) {
+        task(task_data, i);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  (*reinterpret_cast<int64_t*>(executor->private_data))++;
+}
+
+class FormatWKTTester {
+ public:
+  FormatWKTTester() {
+    executor_.parallel_for = &ThreadParallelFor;
+    executor_.private_data = &n_calls_;
+    array_.release = nullptr;
+  }
+
+  ~FormatWKTTester() {
+    if (array_.release != nullptr) {
+      array_.release(&array_);
+    }
+  }
+
+  // Builds a WKT input array from values, appending empty strings as nulls
+  void SetInput(const std::vector<std::string>& values) {
+    ASSERT_EQ(ArrowArrayInitFromType(&array_, NANOARROW_TYPE_STRING), GEOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(&array_), GEOARROW_OK);
+    for (const auto& value : values) {
+      if (value.empty()) {
+        ASSERT_EQ(ArrowArrayAppendNull(&array_, 1), GEOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendString(&array_, {value.data(), (int64_t)value.size()}),
+                  GEOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(&array_, nullptr), GEOARROW_OK);
+  }
+
+  std::vector<std::string> Format(enum GeoArrowType out_type, int64_t n_tasks,
+                                  bool use_executor,
+                                  int64_t max_element_size_bytes = -1) {
+    std::vector<std::string> result;
+    struct ArrowArray out;
+    struct GeoArrowError error;
+    int code = GeoArrowArrayFormatWKT(&array_, GEOARROW_TYPE_WKT, 16,
+                                      max_element_size_bytes, out_type, n_tasks,
+                                      use_executor ? &executor_ : nullptr, &out, &error);
+    EXPECT_EQ(code, GEOARROW_OK) << error.message;
+    if (code != GEOARROW_OK) {
+      return result;
+    }
+
+    struct ArrowArrayView view;
+    ArrowArrayViewInitFromType(&view, out_type == GEOARROW_TYPE_WKT
+                                          ? NANOARROW_TYPE_STRING
+                                          : NANOARROW_TYPE_LARGE_STRING);
+    EXPECT_EQ(ArrowArrayViewSetArray(&view, &out, nullptr), GEOARROW_OK);
+    EXPECT_EQ(ArrowArrayViewValidate(&view, NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+              GEOARROW_OK);
+
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < out.length; i++) {
+      if (ArrowArrayViewIsNull(&view, i)) {
+        null_count++;
+        result.push_back("");
+      } else {
+        struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(&view, i);
+        result.push_back(std::string(value.data, value.size_bytes));
+      }
+    }
+    EXPECT_EQ(out.null_count, null_count);
+
+    ArrowArrayViewReset(&view);
+    out.release(&out);
+    return result;
+  }
+
+  const struct ArrowArray* array() { return &array_; }
+  struct GeoArrowExecutor* executor() { return &executor_; }
+  int64_t n_calls() { return n_calls_; }
+
+ private:
+  struct GeoArrowExecutor executor_;
+  int64_t n_calls_{0};
+  struct ArrowArray array_;
+};
+
+TEST(WKTWriterTest, WKTWriterTestFormatArray) {
+  std::vector<std::string> values;
+  for (int i = 0; i < 103; i++) {
+    if (i % 7 == 3) {
+      values.push_back("");
+    } else {
+      values.push_back("LINESTRING (" + std::to_string(i) + " 1, 2 " + std::to_string(i) +
+                       ")");
+    }
+  }
+
+  FormatWKTTester tester;
+  ASSERT_NO_FATAL_FAILURE(tester.SetInput(values));
+
+  for (int64_t n_tasks : {-1, 1, 3, 4, 16, 200}) {
+    SCOPED_TRACE("n_tasks = " + std::to_string(n_tasks));
+    EXPECT_EQ(tester.Format(GEOARROW_TYPE_WKT, n_tasks, false), values);
+    EXPECT_EQ(tester.Format(GEOARROW_TYPE_WKT, n_tasks, true), values);
+    EXPECT_EQ(tester.Format(GEOARROW_TYPE_LARGE_WKT, n_tasks, true), values);
+  }
+
+  // One call to format the ranges and one call to stitch them
+  EXPECT_EQ(tester.n_calls(), 6 * 2 * 2);
+}
+
+TEST(WKTWriterTest, WKTWriterTestFormatArrayNoNulls) {
+  std::vector<std::string> values(21, "POINT (0 1)");
+  FormatWKTTester tester;
+  ASSERT_NO_FATAL_FAILURE(tester.SetInput(values));
+  EXPECT_EQ(tester.Format(GEOARROW_TYPE_WKT, 3, true), values);
+}
+
+TEST(WKTWriterTest, WKTWriterTestFormatArrayEmpty) {
+  FormatWKTTester tester;
+  ASSERT_NO_FATAL_FAILURE(tester.SetInput({}));
+  EXPECT_EQ(tester.Format(GEOARROW_TYPE_WKT, 4, true), std::vector<std::string>());
+  EXPECT_EQ(tester.Format(GEOARROW_TYPE_LARGE_WKT, 4, false), std::vector<std::string>());
+}
+
+TEST(WKTWriterTest, WKTWriterTestFormatArrayMaxFeatLen) {
+  std::vector<std::string> values(20, "LINESTRING (1 2, 2 3)");
+  values[2] = "";
+  values[9] = "POINT (0 1)";
+  FormatWKTTester tester;
+  ASSERT_NO_FATAL_FAILURE(tester.SetInput(values));
+
+  std::vector<std::string> expected(20, "LINEST");
+  expected[2] = "";
+  expected[9] = "POINT ";
+  EXPECT_EQ(tester.Format(GEOARROW_TYPE_WKT, 2, true, 6), expected);
+}
+
+TEST(WKTWriterTest, WKTWriterTestFormatArrayErrors) {
+  FormatWKTTester tester;
+  ASSERT_NO_FATAL_FAILURE(tester.SetInput({"POINT (0 1)", "NOT WKT"}));
+
+  struct ArrowArray out;
+  struct GeoArrowError error;
+  EXPECT_EQ(GeoArrowArrayFormatWKT(tester.array(), GEOARROW_TYPE_WKT, 16, -1,
+                                   GEOARROW_TYPE_WKB, 1, nullptr, &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected out_type GEOARROW_TYPE_WKT or LARGE_WKT");
+
+  // Errors from a range are propagated
+  EXPECT_EQ(GeoArrowArrayFormatWKT(tester.array(), GEOARROW_TYPE_WKT, 16, -1,
+                                   GEOARROW_TYPE_WKT, 2, tester.executor(), &out, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected geometry type at byte 0");
+}
@@ -3,6 +3,7 @@
 
 #include <exception>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "geoarrow/geoarrow.h"
@@ -253,6 +254,73 @@ class WKXTester {
   struct GeoArrowError error_;
 };
 
+// Builds an array of the given type from WKT values, appending empty strings as nulls
+static inline void MakeNativeArray(enum GeoArrowType type,
+                                   const std::vector<std::string>& wkts,
+                                   struct ArrowArray* out) {
+  struct GeoArrowArrayWriter writer;
+  struct GeoArrowVisitor v;
+  struct GeoArrowError error;
+  WKXTester tester;
+
+  int result = GeoArrowArrayWriterInitFromType(&writer, type);
+  if (result != GEOARROW_OK) {
+    throw WKXTestException("GeoArrowArrayWriterInitFromType", result, "");
+  }
+
+  try {
+    result = GeoArrowArrayWriterInitVisitor(&writer, &v);
+    if (result != GEOARROW_OK) {
+      throw WKXTestException("GeoArrowArrayWriterInitVisitor", result, "");
+    }
+
+    for (const auto& wkt : wkts) {
+      if (wkt.empty()) {
+        tester.ReadNulls(1, &v);
+      } else {
+        tester.ReadWKT(wkt, &v);
+      }
+    }
+
+    error.message[0] = '\0';
+    result = GeoArrowArrayWriterFinish(&writer, out, &error);
+    if (result != GEOARROW_OK) {
+      throw WKXTestException("GeoArrowArrayWriterFinish", result, error.message);
+    }
+  } catch (...) {
+    GeoArrowArrayWriterReset(&writer);
+    throw;
+  }
+
+  GeoArrowArrayWriterReset(&writer);
+}
+
+// Formats array (of the given type) as WKT, using "<null value>" for null features
+static inline std::vector<std::string> FormatWKT(enum GeoArrowType type,
+                                                 const struct ArrowArray* array) {
+  struct GeoArrowArrayReader reader;
+  struct GeoArrowError error;
+  WKXTester tester;
+
+  int result = GeoArrowArrayReaderInitFromType(&reader, type);
+  if (result != GEOARROW_OK) {
+    throw WKXTestException("GeoArrowArrayReaderInitFromType", result, "");
+  }
+
+  error.message[0] = '\0';
+  result = GeoArrowArrayReaderSetArray(&reader, array, &error);
+  if (result == GEOARROW_OK) {
+    result = GeoArrowArrayReaderVisit(&reader, 0, array->length, tester.WKTVisitor());
+  }
+
+  GeoArrowArrayReaderReset(&reader);
+  if (result != GEOARROW_OK) {
+    throw WKXTestException("GeoArrowArrayReaderVisit", result, error.message);
+  }
+
+  return tester.WKTValues("<null value>");
+}
+
 class TestCoords {
  public:
   TestCoords(std::vector<double> x1, std::vector<double> x2) : storage_(2) {